@@ -15,6 +15,15 @@
 #include <functional>
 #include <sstream>
 #include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+// Levels below this are compiled out of the VX_* macros entirely (0 = DEBUG ... 3 = ERROR).
+#ifndef VX_LOG_COMPILE_MIN_LEVEL
+#define VX_LOG_COMPILE_MIN_LEVEL 0
+#endif
 
 ELIX_NESTED_NAMESPACE_BEGIN(core)
 
@@ -66,9 +75,25 @@ public:
     void error(const std::string &message, LogLayer layer = LogLayer::Developer, const std::string &category = "General");
     void warning(const std::string &message, LogLayer layer = LogLayer::Developer, const std::string &category = "General");
 
+    // Only captures the message into a queue; formatting and output happen on the logger's writer thread.
     void log(LogLevel logLevel, const std::string &message);
     void log(LogLevel logLevel, LogLayer layer, const std::string &category, const std::string &message);
 
+    // Runtime filter, checked by the VX_* macros before the message is built.
+    void setMinLevel(LogLevel level);
+    LogLevel getMinLevel() const;
+    bool isEnabled(LogLevel level) const
+    {
+        return static_cast<uint8_t>(level) >= m_minLevel.load(std::memory_order_relaxed);
+    }
+
+    // Blocks until everything logged so far has been written and delivered to sinks.
+    void flush();
+    // Like flush(), but gives up after timeout. For crash handlers, where the writer thread or a sink
+    // may be what crashed. Returns true if everything was written.
+    bool flushFor(std::chrono::milliseconds timeout);
+
+    // Sinks are called on the writer thread.
     SinkId addSink(SinkCallback callback);
     void removeSink(SinkId sinkId);
 
@@ -88,11 +113,53 @@ public:
     ~Logger();
 
 private:
-    static std::string getCurrentTime();
+    struct QueuedRecord
+    {
+        std::chrono::system_clock::time_point time;
+        LogLevel level{LogLevel::INFO};
+        LogLayer layer{LogLayer::Developer};
+        std::string category;
+        std::string message;
+    };
+
+    // Bounded MPSC ring: producers claim slots with a CAS, the writer thread is the only consumer.
+    struct RingSlot
+    {
+        std::atomic<size_t> sequence{0};
+        QueuedRecord record;
+    };
+
+    static constexpr size_t RING_CAPACITY = 8192; // power of two
+    static constexpr auto WRITER_IDLE_INTERVAL = std::chrono::milliseconds(5);
+
+    static std::string formatTimestamp(std::chrono::system_clock::time_point time);
     static Logger::TerminalColorType logLevelToColor(LogLevel level);
     static std::string buildFormattedMessage(const LogMessage &logMessage);
     void pushHistory(const LogMessage &logMessage);
 
+    bool tryEnqueue(QueuedRecord &record);
+    bool tryDequeue(QueuedRecord &record);
+    void wakeWriter();
+    void writerLoop();
+    void drainQueue();
+
+    std::unique_ptr<RingSlot[]> m_ring;
+    std::atomic<size_t> m_enqueuePosition{0};
+    size_t m_dequeuePosition{0}; // writer thread only
+    std::atomic<uint8_t> m_minLevel{static_cast<uint8_t>(LogLevel::DEBUG)};
+
+    std::atomic<uint64_t> m_submittedCount{0};
+    uint64_t m_writtenCount{0}; // guarded by m_flushMutex
+    std::mutex m_flushMutex;
+    std::condition_variable m_flushCv;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCv;
+    bool m_wakeRequested{false};
+    bool m_stopRequested{false};
+    std::thread m_writerThread;
+    std::vector<LogMessage> m_writeBatch; // writer thread only
+
     mutable std::mutex m_logMutex;
 
     bool m_isConsoleOutput{true};
@@ -108,20 +175,30 @@ private:
     static inline std::unique_ptr<Logger> s_defaultLogger{nullptr};
 };
 
-#define VX_LOG(layer, level, category, message)                     \
-    do                                                              \
-    {                                                               \
-        auto *__vx_logger = elix::core::Logger::getDefaultLogger(); \
-        if (__vx_logger)                                            \
-            __vx_logger->log(level, layer, category, message);      \
+#define VX_LOG(layer, level, category, message)                                 \
+    do                                                                          \
+    {                                                                           \
+        if (static_cast<int>(level) >= VX_LOG_COMPILE_MIN_LEVEL)                \
+        {                                                                       \
+            auto *__vx_logger = elix::core::Logger::getDefaultLogger();         \
+            if (__vx_logger && __vx_logger->isEnabled(level))                   \
+                __vx_logger->log(level, layer, category, message);              \
+        }                                                                       \
     } while (0)
 
-#define VX_LOG_STREAM(layer, level, category, expr)        \
-    do                                                     \
-    {                                                      \
-        std::ostringstream __vx_stream;                    \
-        __vx_stream << expr;                               \
-        VX_LOG(layer, level, category, __vx_stream.str()); \
+#define VX_LOG_STREAM(layer, level, category, expr)                             \
+    do                                                                          \
+    {                                                                           \
+        if (static_cast<int>(level) >= VX_LOG_COMPILE_MIN_LEVEL)                \
+        {                                                                       \
+            auto *__vx_logger = elix::core::Logger::getDefaultLogger();         \
+            if (__vx_logger && __vx_logger->isEnabled(level))                   \
+            {                                                                   \
+                std::ostringstream __vx_stream;                                 \
+                __vx_stream << expr;                                            \
+                __vx_logger->log(level, layer, category, __vx_stream.str());    \
+            }                                                                   \
+        }                                                                       \
     } while (0)
 
 #define VX_CORE_INFO_STREAM(expr) VX_LOG_STREAM(elix::core::Logger::LogLayer::Core, elix::core::Logger::LogLevel::INFO, "Core", expr)
@@ -159,11 +236,13 @@ private:
 #define VX_WARNING(message) VX_LOG(elix::core::Logger::LogLayer::Developer, elix::core::Logger::LogLevel::WARNING, "General", message)
 #define VX_ERROR(message) VX_LOG(elix::core::Logger::LogLayer::Developer, elix::core::Logger::LogLevel::LOG_LEVEL_ERROR, "General", message)
 
-#define VX_FATAL(msg)  \
-    do                 \
-    {                  \
-        VX_ERROR(msg); \
-        std::abort();  \
+#define VX_FATAL(msg)                                                   \
+    do                                                                  \
+    {                                                                   \
+        VX_ERROR(msg);                                                  \
+        if (auto *__vx_logger = elix::core::Logger::getDefaultLogger()) \
+            __vx_logger->flush();                                       \
+        std::abort();                                                   \
     } while (0)
 
 ELIX_NESTED_NAMESPACE_END
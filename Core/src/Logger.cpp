@@ -5,6 +5,7 @@
 #include <chrono>
 #include <iomanip>
 #include <sstream>
+#include <cstddef>
 
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -48,9 +49,15 @@ namespace terminalColors
 
 ELIX_NESTED_NAMESPACE_BEGIN(core)
 
-Logger::Logger() = default;
+Logger::Logger() : m_ring(std::make_unique<RingSlot[]>(RING_CAPACITY))
+{
+    for (size_t index = 0; index < RING_CAPACITY; ++index)
+        m_ring[index].sequence.store(index, std::memory_order_relaxed);
+
+    m_writerThread = std::thread(&Logger::writerLoop, this);
+}
 
-Logger::Logger(const std::string &logFilePath)
+Logger::Logger(const std::string &logFilePath) : Logger()
 {
     setFileOutputPath(logFilePath);
 }
@@ -98,28 +105,176 @@ void Logger::log(LogLevel logLevel, const std::string &message)
 
 void Logger::log(LogLevel logLevel, LogLayer layer, const std::string &category, const std::string &message)
 {
-    LogMessage logMessage{};
-    logMessage.timestamp = getCurrentTime();
-    logMessage.level = logLevel;
-    logMessage.layer = layer;
-    logMessage.category = category.empty() ? "General" : category;
-    logMessage.message = message;
-    logMessage.formattedMessage = buildFormattedMessage(logMessage);
+    if (!isEnabled(logLevel))
+        return;
+
+    QueuedRecord record{};
+    record.time = std::chrono::system_clock::now();
+    record.level = logLevel;
+    record.layer = layer;
+    record.category = category.empty() ? "General" : category;
+    record.message = message;
+
+    const bool onWriterThread = std::this_thread::get_id() == m_writerThread.get_id();
+
+    while (!tryEnqueue(record))
+    {
+        // A sink logging from the writer thread cannot wait for itself to make room.
+        if (onWriterThread)
+            return;
+
+        wakeWriter();
+        std::this_thread::yield();
+    }
+
+    m_submittedCount.fetch_add(1, std::memory_order_release);
+
+    // Errors are written right away; everything else is picked up on the writer's next idle tick.
+    if (logLevel == LogLevel::LOG_LEVEL_ERROR)
+        wakeWriter();
+}
+
+void Logger::setMinLevel(LogLevel level)
+{
+    m_minLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+Logger::LogLevel Logger::getMinLevel() const
+{
+    return static_cast<LogLevel>(m_minLevel.load(std::memory_order_relaxed));
+}
+
+void Logger::flush()
+{
+    if (std::this_thread::get_id() == m_writerThread.get_id())
+        return;
+
+    const uint64_t target = m_submittedCount.load(std::memory_order_acquire);
+    wakeWriter();
+
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    m_flushCv.wait(lock, [this, target]()
+                   { return m_writtenCount >= target; });
+}
+
+bool Logger::flushFor(std::chrono::milliseconds timeout)
+{
+    if (std::this_thread::get_id() == m_writerThread.get_id())
+        return false;
+
+    const uint64_t target = m_submittedCount.load(std::memory_order_acquire);
+    wakeWriter();
+
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    return m_flushCv.wait_for(lock, timeout, [this, target]()
+                              { return m_writtenCount >= target; });
+}
+
+bool Logger::tryEnqueue(QueuedRecord &record)
+{
+    size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        RingSlot &slot = m_ring[position & (RING_CAPACITY - 1u)];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+            {
+                slot.record = std::move(record);
+                slot.sequence.store(position + 1u, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+            return false; // full
+        else
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+}
+
+bool Logger::tryDequeue(QueuedRecord &record)
+{
+    RingSlot &slot = m_ring[m_dequeuePosition & (RING_CAPACITY - 1u)];
+    const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+    if (static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(m_dequeuePosition + 1u) < 0)
+        return false;
+
+    record = std::move(slot.record);
+    slot.sequence.store(m_dequeuePosition + RING_CAPACITY, std::memory_order_release);
+    ++m_dequeuePosition;
+    return true;
+}
+
+void Logger::wakeWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeRequested = true;
+    }
+    m_wakeCv.notify_one();
+}
+
+void Logger::writerLoop()
+{
+    for (;;)
+    {
+        bool stopping = false;
+        {
+            std::unique_lock<std::mutex> lock(m_wakeMutex);
+            m_wakeCv.wait_for(lock, WRITER_IDLE_INTERVAL, [this]()
+                              { return m_wakeRequested || m_stopRequested; });
+            m_wakeRequested = false;
+            stopping = m_stopRequested;
+        }
+
+        drainQueue();
+
+        if (stopping)
+            return;
+    }
+}
+
+void Logger::drainQueue()
+{
+    QueuedRecord record{};
+    while (tryDequeue(record))
+    {
+        LogMessage logMessage{};
+        logMessage.timestamp = formatTimestamp(record.time);
+        logMessage.level = record.level;
+        logMessage.layer = record.layer;
+        logMessage.category = std::move(record.category);
+        logMessage.message = std::move(record.message);
+        logMessage.formattedMessage = buildFormattedMessage(logMessage);
+        m_writeBatch.push_back(std::move(logMessage));
+    }
+
+    if (m_writeBatch.empty())
+        return;
 
     std::vector<SinkCallback> sinks;
     {
         std::lock_guard<std::mutex> lock(m_logMutex);
 
-        if (m_isConsoleOutput)
-            terminalColors::logColoredMessageToTerminal(logLevelToColor(logLevel), logMessage.formattedMessage);
-
-        if (m_isOutputFile && m_logFile.is_open())
+        for (const auto &logMessage : m_writeBatch)
         {
-            m_logFile << logMessage.formattedMessage << '\n';
-            m_logFile.flush();
+            if (m_isConsoleOutput)
+                terminalColors::logColoredMessageToTerminal(logLevelToColor(logMessage.level), logMessage.formattedMessage);
+
+            if (m_isOutputFile && m_logFile.is_open())
+                m_logFile << logMessage.formattedMessage << '\n';
+
+            pushHistory(logMessage);
         }
 
-        pushHistory(logMessage);
+        // One flush per batch instead of per message.
+        if (m_isOutputFile && m_logFile.is_open())
+            m_logFile.flush();
 
         sinks.reserve(m_sinks.size());
         for (const auto &[_, callback] : m_sinks)
@@ -129,8 +284,18 @@ void Logger::log(LogLevel logLevel, LogLayer layer, const std::string &category,
         }
     }
 
-    for (const auto &callback : sinks)
-        callback(logMessage);
+    for (const auto &logMessage : m_writeBatch)
+        for (const auto &callback : sinks)
+            callback(logMessage);
+
+    const size_t writtenCount = m_writeBatch.size();
+    m_writeBatch.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(m_flushMutex);
+        m_writtenCount += writtenCount;
+    }
+    m_flushCv.notify_all();
 }
 
 Logger::SinkId Logger::addSink(SinkCallback callback)
@@ -200,9 +365,8 @@ void Logger::setFileOutputPath(const std::string &logFilePath)
     m_isOutputFile = m_logFile.is_open();
 }
 
-std::string Logger::getCurrentTime()
+std::string Logger::formatTimestamp(std::chrono::system_clock::time_point now)
 {
-    const auto now = std::chrono::system_clock::now();
     const auto time_t = std::chrono::system_clock::to_time_t(now);
     const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
 
@@ -287,6 +451,15 @@ void Logger::pushHistory(const LogMessage &logMessage)
 
 Logger::~Logger()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopRequested = true;
+    }
+    m_wakeCv.notify_one();
+
+    if (m_writerThread.joinable())
+        m_writerThread.join();
+
     if (m_logFile.is_open())
         m_logFile.close();
 }
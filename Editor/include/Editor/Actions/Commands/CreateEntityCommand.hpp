@@ -1,6 +1,7 @@
 #ifndef ELIX_EDITOR_ACTIONS_COMMANDS_CREATE_ENTITY_COMMAND_HPP
 #define ELIX_EDITOR_ACTIONS_COMMANDS_CREATE_ENTITY_COMMAND_HPP
 
+#include "Editor/Actions/CompressedSnapshot.hpp"
 #include "Editor/Actions/EditorActionHistory.hpp"
 
 #include <cstdint>
@@ -25,12 +26,13 @@ namespace actions
         bool execute() override;
         bool undo() override;
         const char *getName() const override;
+        std::size_t getMemoryUsage() const override;
 
         uint32_t getRootEntityId() const;
 
     private:
         engine::Scene *m_scene{nullptr};
-        std::string m_serializedHierarchy;
+        CompressedSnapshot m_serializedHierarchy;
         uint32_t m_rootEntityId{0u};
         std::string m_label;
     };
@@ -0,0 +1,58 @@
+#ifndef ELIX_EDITOR_ACTIONS_COMMANDS_ENTITY_PROPERTY_COMMAND_HPP
+#define ELIX_EDITOR_ACTIONS_COMMANDS_ENTITY_PROPERTY_COMMAND_HPP
+
+#include "Editor/Actions/EditorActionHistory.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <variant>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+namespace actions
+{
+    using PropertyValue = std::variant<bool, int32_t, float, glm::vec2, glm::vec3, glm::vec4, glm::quat, std::string>;
+
+    // Writes a value into one field of an entity's component. Returns false if the entity has no such component.
+    using PropertySetter = bool (*)(engine::Entity &entity, const PropertyValue &value);
+
+    // Undo step for a single property edit: stores only the old and new value, not the entity.
+    // Consecutive edits of the same property on the same entity merge into one step.
+    class EntityPropertyCommand final : public IEditorCommand
+    {
+    public:
+        EntityPropertyCommand(engine::Scene *scene,
+                              uint32_t entityId,
+                              PropertySetter setter,
+                              PropertyValue oldValue,
+                              PropertyValue newValue,
+                              std::string label);
+
+        bool execute() override;
+        bool undo() override;
+        const char *getName() const override;
+        bool mergeWith(const IEditorCommand &next) override;
+        std::size_t getMemoryUsage() const override;
+
+    private:
+        bool apply(const PropertyValue &value) const;
+
+        engine::Scene *m_scene{nullptr};
+        uint32_t m_entityId{0u};
+        PropertySetter m_setter{nullptr};
+        PropertyValue m_oldValue;
+        PropertyValue m_newValue;
+        std::string m_label;
+    };
+
+    // Setters for Transform3DComponent fields.
+    bool setTransformPosition(engine::Entity &entity, const PropertyValue &value);
+    bool setTransformRotation(engine::Entity &entity, const PropertyValue &value); // glm::quat
+    bool setTransformScale(engine::Entity &entity, const PropertyValue &value);
+} // namespace actions
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_EDITOR_ACTIONS_COMMANDS_ENTITY_PROPERTY_COMMAND_HPP
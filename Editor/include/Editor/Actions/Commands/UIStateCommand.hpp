@@ -1,6 +1,7 @@
 #ifndef ELIX_EDITOR_ACTIONS_COMMANDS_UI_STATE_COMMAND_HPP
 #define ELIX_EDITOR_ACTIONS_COMMANDS_UI_STATE_COMMAND_HPP
 
+#include "Editor/Actions/CompressedSnapshot.hpp"
 #include "Editor/Actions/EditorActionHistory.hpp"
 
 #include <string>
@@ -19,11 +20,12 @@ namespace actions
         bool execute() override;
         bool undo() override;
         const char *getName() const override;
+        std::size_t getMemoryUsage() const override;
 
     private:
         engine::Scene *m_scene{nullptr};
-        std::string m_beforeState;
-        std::string m_afterState;
+        CompressedSnapshot m_beforeState;
+        CompressedSnapshot m_afterState;
         std::string m_label;
     };
 } // namespace actions
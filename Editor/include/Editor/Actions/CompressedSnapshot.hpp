@@ -0,0 +1,35 @@
+#ifndef ELIX_EDITOR_ACTIONS_COMPRESSED_SNAPSHOT_HPP
+#define ELIX_EDITOR_ACTIONS_COMPRESSED_SNAPSHOT_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Assets/Compressor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+namespace actions
+{
+    // Serialized scene payload kept compressed while it sits in the undo history.
+    class CompressedSnapshot
+    {
+    public:
+        CompressedSnapshot() = default;
+        explicit CompressedSnapshot(const std::string &payload);
+
+        bool empty() const { return m_uncompressedSize == 0u; }
+        std::string decompress() const;
+
+        std::size_t getMemoryUsage() const { return m_bytes.capacity(); }
+
+    private:
+        std::vector<std::uint8_t> m_bytes;
+        std::size_t m_uncompressedSize{0u};
+        engine::Compressor::Algorithm m_algorithm{engine::Compressor::Algorithm::None};
+    };
+} // namespace actions
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_EDITOR_ACTIONS_COMPRESSED_SNAPSHOT_HPP
@@ -21,20 +21,45 @@ namespace actions
         virtual bool execute() = 0;
         virtual bool undo() = 0;
         virtual const char *getName() const = 0;
+
+        // Folds an already executed `next` into this command so a continuous edit is one undo step.
+        virtual bool mergeWith(const IEditorCommand &next)
+        {
+            (void)next;
+            return false;
+        }
+
+        // Approximate bytes held by this command, for the history's memory budget.
+        virtual std::size_t getMemoryUsage() const
+        {
+            return sizeof(*this);
+        }
     };
 
+    // Undo/redo stack bounded by entry count and by the memory its commands hold.
+    //
+    // While coalescing is open, a new command that the previous one accepts through mergeWith()
+    // extends that step instead of adding another. Undo, redo and breakCoalescing() close it.
     class EditorCommandHistory
     {
     public:
-        explicit EditorCommandHistory(std::size_t maxEntries = 64u);
+        static constexpr std::size_t DEFAULT_MAX_MEMORY_BYTES = 64u * 1024u * 1024u;
+
+        explicit EditorCommandHistory(std::size_t maxEntries = 1024u, std::size_t maxMemoryBytes = DEFAULT_MAX_MEMORY_BYTES);
         ~EditorCommandHistory();
 
         void clear();
         void setMaxEntries(std::size_t maxEntries);
+        void setMaxMemoryBytes(std::size_t maxMemoryBytes);
 
         bool execute(std::unique_ptr<IEditorCommand> command);
         bool recordExecuted(std::unique_ptr<IEditorCommand> command);
 
+        // Ends the current continuous edit; the next command starts a new undo step.
+        void breakCoalescing();
+
+        std::size_t getMemoryUsage() const { return m_memoryUsage; }
+
         bool canUndo() const;
         bool canRedo() const;
 
@@ -42,12 +67,19 @@ namespace actions
         bool redo();
 
     private:
+        void discardRedoCommands();
+        bool tryMergeIntoLast(const IEditorCommand &command);
+        void pushCommand(std::unique_ptr<IEditorCommand> command);
         void trimHistoryToLimit();
 
     private:
         std::vector<std::unique_ptr<IEditorCommand>> m_commands;
+        std::vector<std::size_t> m_commandMemoryUsage; // parallel to m_commands
         std::size_t m_nextCommandIndex{0u};
-        std::size_t m_maxEntries{64u};
+        std::size_t m_maxEntries{1024u};
+        std::size_t m_maxMemoryBytes{DEFAULT_MAX_MEMORY_BYTES};
+        std::size_t m_memoryUsage{0u};
+        bool m_coalescing{false};
     };
 
     class EditorEntityClipboard
@@ -0,0 +1,117 @@
+#ifndef ELIX_ASSET_DATABASE_HPP
+#define ELIX_ASSET_DATABASE_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Assets/Asset.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+
+struct AssetRecord
+{
+    std::string path; // project-relative, '/'-separated; empty for the project root
+    bool isDirectory{false};
+    engine::Asset::AssetType type{engine::Asset::AssetType::NONE}; // from the .elixasset header
+    uint64_t size{0};
+    int64_t modifiedTime{0}; // platform ticks, only compared for change detection
+    uint64_t contentHash{0};
+    std::vector<std::string> dependencies; // asset paths referenced by JSON assets, as written
+
+    std::string getFileName() const;
+};
+
+// Index of every file and folder in a project, so panels don't walk or open files on disk.
+//
+// The index is saved under .velixcache/ and reloaded on open. Records whose size and
+// modification time still match are reused; new or changed files are read and hashed on
+// the job system. On Linux an inotify watcher reports changes, which processChanges()
+// applies on the calling thread. Elsewhere, call markChanged() after touching files.
+//
+// Not thread-safe: every call except the watcher itself belongs to the editor thread.
+// Record pointers stay valid until the next processChanges() or rescan().
+class AssetDatabase
+{
+public:
+    static constexpr uint32_t FILE_VERSION = 1u;
+
+    AssetDatabase();
+    ~AssetDatabase();
+
+    AssetDatabase(const AssetDatabase &) = delete;
+    AssetDatabase &operator=(const AssetDatabase &) = delete;
+
+    bool open(const std::filesystem::path &projectRoot);
+    void close();
+    bool save();
+
+    // Validates the whole project against the disk.
+    void rescan();
+
+    // Queues a file or folder (absolute or project-relative) to be revalidated by processChanges().
+    void markChanged(const std::filesystem::path &path);
+
+    // Applies changes reported by the watcher or markChanged(). Returns true if the index changed.
+    bool processChanges();
+
+    bool isOpen() const { return !m_projectRoot.empty(); }
+    bool isWatching() const;
+
+    // Bumped whenever a record is added, changed or removed.
+    uint64_t getRevision() const { return m_revision; }
+    size_t getRecordCount() const { return m_records.size(); }
+
+    const std::filesystem::path &getProjectRoot() const { return m_projectRoot; }
+    std::filesystem::path getAbsolutePath(const AssetRecord &record) const;
+
+    // Accepts absolute or project-relative paths.
+    const AssetRecord *find(const std::filesystem::path &path) const;
+    // Direct children of a folder, unsorted.
+    std::vector<const AssetRecord *> getChildren(const std::filesystem::path &directory) const;
+    std::vector<const AssetRecord *> findByType(engine::Asset::AssetType type) const;
+    // Records that list `path` among their dependencies.
+    std::vector<const AssetRecord *> findDependents(const std::filesystem::path &path) const;
+
+    // Folders that are never indexed (build output, VCS, IDE state). Hidden folders are skipped too.
+    static bool isExcludedDirectoryName(const std::string &name);
+
+private:
+    struct Watcher;
+
+    struct ScanEntry
+    {
+        std::string path;
+        bool isDirectory{false};
+    };
+
+    // Brings every record at or under `relativePath` in line with the disk.
+    bool reconcile(const std::string &relativePath);
+    void gatherEntries(const std::string &relativePath, std::vector<ScanEntry> &outEntries) const;
+    AssetRecord validateEntry(const ScanEntry &entry) const;
+
+    void insertRecord(AssetRecord &&record);
+    void eraseRecord(const std::string &relativePath);
+
+    std::string toRelativeKey(const std::filesystem::path &path) const;
+    std::filesystem::path getDatabaseFilePath() const;
+    bool load();
+
+    std::filesystem::path m_projectRoot;
+    std::unordered_map<std::string, AssetRecord> m_records;
+    std::unordered_map<std::string, std::vector<std::string>> m_children; // folder -> child paths
+    std::unordered_set<std::string> m_markedPaths;
+    uint64_t m_revision{0};
+    bool m_dirty{false};
+
+    std::unique_ptr<Watcher> m_watcher;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_ASSET_DATABASE_HPP
@@ -2,6 +2,9 @@
 #define ELIX_ASSETS_PREVIEW_SYSTEM
 
 #include "Editor/Project.hpp"
+#include "Editor/RenderGraphPasses/PreviewAssetsRenderGraphPass.hpp"
+#include "Editor/ThumbnailCache.hpp"
+#include "Engine/Assets/AssetStreamingWorker.hpp"
 #include "Engine/Assets/AssetsLoader.hpp"
 #include "Engine/Material.hpp"
 #include "Engine/Mesh.hpp"
@@ -16,6 +19,9 @@
 #include <cstring>
 #include <filesystem>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -26,7 +32,14 @@
 
 ELIX_NESTED_NAMESPACE_BEGIN(editor)
 
-// Class that handle thumbnails of materials/textures
+// Class that handle thumbnails of materials/models/textures.
+//
+// Thumbnails are built off the editor thread: a dedicated thumbnail thread reads the source asset (or
+// the project's ThumbnailCache, keyed by content hash) and hands back a small RGBA8 image. Loads block
+// on disk, so they stay off the shared job pool. Materials and models
+// that miss the cache are rendered once by the preview pass in a fixed pose and read back.
+// Per-frame budgets bound uploads, GPU preparation and captures, and queued work for cells that
+// scrolled out of view is dropped before it reaches a worker.
 class AssetsPreviewSystem
 {
 public:
@@ -44,6 +57,7 @@ public:
         engine::Material *material{nullptr};
         engine::GPUMesh *mesh{nullptr};
         glm::mat4 modelTransform{1.0f};
+        uint32_t captureId{0}; // non-zero: rendered once and returned through consumeCapturedPreviews()
     };
 
     AssetsPreviewSystem() = default;
@@ -51,7 +65,10 @@ public:
     void setProject(Project *project)
     {
         if (m_project != project)
+        {
             clearEntries();
+            m_thumbnailCache = project ? ThumbnailCache(project->fullPath) : ThumbnailCache{};
+        }
 
         m_project = project;
     }
@@ -60,6 +77,7 @@ public:
     {
         ++m_frameIndex;
         m_requestedRenderItemsThisFrame.clear();
+        m_captureRequestsThisFrame = 0;
         flushDeferredDescriptorReleases();
 
         for (auto &[_, e] : m_materialEntries)
@@ -69,6 +87,7 @@ public:
             e.requestedThisFrame = false;
 
         cleanupStaleDescriptors();
+        updateThumbnails();
     }
 
     void refreshImguiDescriptors(VkSampler previewSampler, bool backendRecreated)
@@ -167,25 +186,29 @@ public:
 
     std::vector<RenderPreviewJob> captureRequestedRenderJobsForSubmission()
     {
-        m_inFlightRenderItems = m_requestedRenderItemsThisFrame;
+        // Captures go first so the preview pass's job limit never drops one.
+        std::stable_partition(m_requestedRenderItemsThisFrame.begin(), m_requestedRenderItemsThisFrame.end(),
+                              [](const RequestedRenderItem &item)
+                              { return item.captureId != 0u; });
+
+        m_inFlightRenderItems.clear();
 
         std::vector<RenderPreviewJob> jobs;
-        jobs.reserve(m_inFlightRenderItems.size());
+        jobs.reserve(m_requestedRenderItemsThisFrame.size());
 
-        for (const auto &item : m_inFlightRenderItems)
+        for (const auto &item : m_requestedRenderItemsThisFrame)
         {
+            RenderPreviewJob job{.kind = item.kind, .path = item.path, .captureId = item.captureId};
+            ThumbnailSlot *thumbnail = nullptr;
+
             if (item.kind == PreviewKind::Material)
             {
                 auto it = m_materialEntries.find(item.path);
                 if (it == m_materialEntries.end() || !it->second.material)
                     continue;
 
-                jobs.push_back(RenderPreviewJob{
-                    .kind = PreviewKind::Material,
-                    .path = item.path,
-                    .material = it->second.material.get(),
-                    .mesh = nullptr,
-                    .modelTransform = glm::mat4(1.0f)});
+                job.material = it->second.material.get();
+                thumbnail = &it->second.thumbnail;
             }
             else if (item.kind == PreviewKind::Model)
             {
@@ -193,13 +216,24 @@ public:
                 if (it == m_modelEntries.end() || !it->second.material || !it->second.mesh)
                     continue;
 
-                jobs.push_back(RenderPreviewJob{
-                    .kind = PreviewKind::Model,
-                    .path = item.path,
-                    .material = it->second.material.get(),
-                    .mesh = it->second.mesh.get(),
-                    .modelTransform = it->second.previewTransform});
+                job.material = it->second.material.get();
+                job.mesh = it->second.mesh.get();
+                job.modelTransform = it->second.previewTransform;
+                thumbnail = &it->second.thumbnail;
             }
+            else
+                continue;
+
+            if (item.captureId != 0u)
+            {
+                thumbnail->state = ThumbnailState::Capturing;
+                thumbnail->stateFrame = m_frameIndex;
+                m_captureTargets[item.captureId] = ThumbnailKey{item.kind, item.path, thumbnail->serial};
+            }
+
+            // Kept in job order: consumeRenderedJobs() pairs views with items by index.
+            m_inFlightRenderItems.push_back(item);
+            jobs.push_back(std::move(job));
         }
 
         return jobs;
@@ -213,6 +247,10 @@ public:
         {
             const auto &item = m_inFlightRenderItems[i];
 
+            // Captured thumbnails arrive through consumeCapturedPreviews() instead.
+            if (item.captureId != 0u)
+                continue;
+
             if (item.kind == PreviewKind::Material)
             {
                 auto it = m_materialEntries.find(item.path);
@@ -240,6 +278,46 @@ public:
         m_inFlightRenderItems.clear();
     }
 
+    void consumeCapturedPreviews(std::vector<PreviewAssetsRenderGraphPass::CapturedPreview> &&captures)
+    {
+        for (auto &capture : captures)
+        {
+            auto targetIt = m_captureTargets.find(capture.captureId);
+            if (targetIt == m_captureTargets.end())
+                continue;
+
+            const ThumbnailKey target = std::move(targetIt->second);
+            m_captureTargets.erase(targetIt);
+
+            ThumbnailSlot *thumbnail = findThumbnailSlot(target.kind, target.path);
+            if (!thumbnail || thumbnail->serial != target.serial || thumbnail->state != ThumbnailState::Capturing)
+                continue;
+
+            // The preview target cannot be read back as RGBA8: keep rendering it live as before.
+            if (!PreviewAssetsRenderGraphPass::isCaptureFormatSupported(capture.format))
+            {
+                thumbnail->state = ThumbnailState::Live;
+                continue;
+            }
+
+            // Dropped by the pass (a previous readback was still in flight): render again later.
+            if (capture.pixels.empty())
+            {
+                thumbnail->state = ThumbnailState::Render;
+                continue;
+            }
+
+            thumbnail->state = ThumbnailState::Working;
+            submitThumbnailTask(ThumbnailTask{
+                .kind = target.kind,
+                .path = target.path,
+                .contentHash = thumbnail->contentHash,
+                .serial = thumbnail->serial,
+                .cache = m_thumbnailCache,
+                .capture = std::move(capture)});
+        }
+    }
+
     VkDescriptorSet getOrRequestTexturePreview(const std::string &texturePath, engine::Texture::SharedPtr texture = nullptr)
     {
         if (!isPreviewEnabled(PreviewKind::Texture))
@@ -254,18 +332,19 @@ public:
         entry.path = normalizedTexturePath;
         entry.lastRequestedFrame = m_frameIndex;
 
+        // A caller-provided texture is shown as is and bypasses the thumbnail pipeline.
         if (texture && entry.texture != texture)
         {
             entry.texture = std::move(texture);
+            entry.thumbnail = ThumbnailSlot{};
+            entry.thumbnail.state = ThumbnailState::Live;
 
             if (entry.imguiDescriptorSet != VK_NULL_HANDLE && entry.texture)
                 replaceDescriptor(entry.imguiDescriptorSet, entry.texture->vkSampler(), entry.texture->vkImageView());
         }
 
-        if (!entry.texture && m_project)
-        {
-            entry.texture = loadOrGetTexture(normalizedTexturePath, TextureUsage::PreviewColor);
-        }
+        if (entry.thumbnail.state != ThumbnailState::Live && m_project)
+            requestThumbnail(PreviewKind::Texture, normalizedTexturePath, entry.thumbnail);
 
         if (!entry.texture)
             return getPlaceholder();
@@ -294,22 +373,24 @@ public:
         entry.kind = PreviewKind::Material;
         entry.lastRequestedFrame = m_frameIndex;
 
+        // A caller-provided material may be edited at any time, so it is rendered every frame.
         if (material)
-            entry.material = std::move(material);
-
-        if (!entry.requestedThisFrame)
         {
-            entry.requestedThisFrame = true;
-            m_requestedRenderItemsThisFrame.push_back({PreviewKind::Material, normalizedMaterialPath});
+            if (entry.thumbnail.state != ThumbnailState::Live)
+            {
+                entry.thumbnail = ThumbnailSlot{};
+                entry.thumbnail.state = ThumbnailState::Live;
+            }
+
+            entry.material = std::move(material);
         }
 
-        if (!entry.material && !ensureMaterialLoaded(normalizedMaterialPath, entry.material))
-            return getPlaceholder();
+        if (entry.thumbnail.state != ThumbnailState::Live && m_project)
+            requestThumbnail(PreviewKind::Material, normalizedMaterialPath, entry.thumbnail);
 
-        if (entry.imguiDescriptorSet)
-            return entry.imguiDescriptorSet;
+        requestRenderIfNeeded(PreviewKind::Material, normalizedMaterialPath, entry.thumbnail, entry.requestedThisFrame);
 
-        return getPlaceholder();
+        return getPreviewDescriptor(entry.imguiDescriptorSet, entry.previewSampler, entry.previewImageView, entry.thumbnail);
     }
 
     VkDescriptorSet getOrRequestModelPreview(const std::string &modelPath)
@@ -317,7 +398,7 @@ public:
         if (!isPreviewEnabled(PreviewKind::Model))
             return getThumbnailDisabledFallback();
 
-        if (modelPath.empty())
+        if (modelPath.empty() || !m_project)
             return getPlaceholder();
 
         auto &entry = m_modelEntries[modelPath];
@@ -325,19 +406,12 @@ public:
         entry.kind = PreviewKind::Model;
         entry.lastRequestedFrame = m_frameIndex;
 
-        if (!entry.requestedThisFrame)
-        {
-            entry.requestedThisFrame = true;
-            m_requestedRenderItemsThisFrame.push_back({PreviewKind::Model, modelPath});
-        }
-
-        if ((!entry.mesh || !entry.material) && !ensureModelLoaded(modelPath, entry))
-            return getPlaceholder();
+        if (entry.thumbnail.state != ThumbnailState::Live)
+            requestThumbnail(PreviewKind::Model, modelPath, entry.thumbnail);
 
-        if (entry.imguiDescriptorSet)
-            return entry.imguiDescriptorSet;
+        requestRenderIfNeeded(PreviewKind::Model, modelPath, entry.thumbnail, entry.requestedThisFrame);
 
-        return getPlaceholder();
+        return getPreviewDescriptor(entry.imguiDescriptorSet, entry.previewSampler, entry.previewImageView, entry.thumbnail);
     }
 
 private:
@@ -345,15 +419,95 @@ private:
     {
         PreviewKind kind{PreviewKind::Material};
         std::string path;
+        uint32_t captureId{0};
     };
 
     static constexpr uint64_t STALE_DESCRIPTOR_MAX_AGE = 180;
     static constexpr uint64_t DESCRIPTOR_RELEASE_DELAY_FRAMES = 4;
 
+    // Per-frame thumbnail budgets, so scrolling a large folder spreads the work over frames.
+    static constexpr size_t MAX_THUMBNAIL_TASKS_IN_FLIGHT = 4; // queued on the thumbnail thread
+    static constexpr size_t MAX_THUMBNAIL_UPLOADS_PER_FRAME = 8;
+    static constexpr size_t MAX_THUMBNAIL_PREPARES_PER_FRAME = 2;
+    static constexpr size_t MAX_THUMBNAIL_CAPTURES_PER_FRAME = PreviewAssetsRenderGraphPass::MAX_CAPTURES_PER_SUBMIT;
+    // Queued work is dropped once its cell has not been drawn for this many frames.
+    static constexpr uint64_t THUMBNAIL_VISIBILITY_FRAMES = 2;
+    static constexpr uint64_t THUMBNAIL_CAPTURE_TIMEOUT_FRAMES = 120;
+
     struct PendingDescriptorFree
     {
         VkDescriptorSet descriptorSet{VK_NULL_HANDLE};
         uint64_t releaseFrame{0};
+        engine::Texture::SharedPtr texture{nullptr}; // kept alive while the descriptor may still be drawn
+    };
+
+    enum class ThumbnailState : uint8_t
+    {
+        None,      // not requested since the last reset
+        Queued,    // waiting for a worker; dropped back to None when scrolled out of view
+        Working,   // a worker reads the cached thumbnail or the source asset
+        Upload,    // pixels ready, waiting for the upload budget
+        Prepare,   // cache miss: GPU preview resources are created on this thread
+        Render,    // waiting for a capture slot in the preview pass
+        Capturing, // rendered, pixels on their way back
+        Ready,
+        Live, // rendered every frame: caller-provided asset, or the preview target cannot be read back
+        Failed
+    };
+
+    struct ThumbnailSlot
+    {
+        ThumbnailState state{ThumbnailState::None};
+        uint64_t contentHash{0};
+        uint64_t serial{0}; // identifies the request; results for older serials are ignored
+        uint64_t lastRequestedFrame{0};
+        uint64_t stateFrame{0};
+
+        ThumbnailImage pendingImage;
+        std::optional<engine::CPUMaterial> pendingMaterial;
+        std::optional<engine::CPUMesh> pendingMesh;
+        glm::mat4 pendingTransform{1.0f};
+
+        engine::Texture::SharedPtr texture{nullptr};
+    };
+
+    struct ThumbnailKey
+    {
+        PreviewKind kind{PreviewKind::Material};
+        std::string path;
+        uint64_t serial{0};
+    };
+
+    struct ThumbnailTask
+    {
+        PreviewKind kind{PreviewKind::Material};
+        std::string path;
+        uint64_t contentHash{0};
+        uint64_t serial{0};
+        ThumbnailCache cache;
+        // Set: encode this readback instead of loading the source asset.
+        std::optional<PreviewAssetsRenderGraphPass::CapturedPreview> capture{std::nullopt};
+    };
+
+    struct ThumbnailResult
+    {
+        PreviewKind kind{PreviewKind::Material};
+        std::string path;
+        uint64_t serial{0};
+        bool success{false};
+
+        ThumbnailImage image; // valid: upload as is
+        std::optional<engine::CPUMaterial> material;
+        std::optional<engine::CPUMesh> mesh;
+        glm::mat4 meshTransform{1.0f};
+    };
+
+    // Shared with thumbnail tasks, which may outlive this system.
+    struct ThumbnailWork
+    {
+        std::mutex mutex;
+        std::vector<ThumbnailResult> results;
+        size_t tasksInFlight{0};
     };
 
     struct MaterialPreviewEntry
@@ -370,6 +524,8 @@ private:
         bool dirty = true;
         bool ready = false;
         uint64_t lastRequestedFrame = 0;
+
+        ThumbnailSlot thumbnail;
     };
 
     struct ModelPreviewEntry
@@ -386,6 +542,8 @@ private:
 
         bool requestedThisFrame = false;
         uint64_t lastRequestedFrame = 0;
+
+        ThumbnailSlot thumbnail;
     };
 
     struct TexturePreviewEntry
@@ -397,6 +555,8 @@ private:
         VkDescriptorSet imguiDescriptorSet = VK_NULL_HANDLE;
 
         uint64_t lastRequestedFrame = 0;
+
+        ThumbnailSlot thumbnail;
     };
 
     bool isPreviewEnabled(PreviewKind kind) const
@@ -439,14 +599,15 @@ private:
         descriptorSet = ImGui_ImplVulkan_AddTexture(sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
     }
 
-    void queueDescriptorRelease(VkDescriptorSet &descriptorSet)
+    void queueDescriptorRelease(VkDescriptorSet &descriptorSet, engine::Texture::SharedPtr texture = nullptr)
     {
         if (descriptorSet == VK_NULL_HANDLE)
             return;
 
         m_pendingDescriptorFrees.push_back(PendingDescriptorFree{
             .descriptorSet = descriptorSet,
-            .releaseFrame = m_frameIndex + DESCRIPTOR_RELEASE_DELAY_FRAMES});
+            .releaseFrame = m_frameIndex + DESCRIPTOR_RELEASE_DELAY_FRAMES,
+            .texture = std::move(texture)});
 
         descriptorSet = VK_NULL_HANDLE;
     }
@@ -470,7 +631,7 @@ private:
             }
 
             if (writeIndex != readIndex)
-                m_pendingDescriptorFrees[writeIndex] = pending;
+                m_pendingDescriptorFrees[writeIndex] = std::move(pending);
 
             ++writeIndex;
         }
@@ -498,14 +659,18 @@ private:
         queueDescriptorRelease(m_placeholder);
         queueDescriptorRelease(m_thumbnailDisabledIcon);
 
+        // Worker results still in flight no longer find their entry and are dropped.
         m_materialEntries.clear();
         m_modelEntries.clear();
         m_textureEntries.clear();
-        m_previewModelsByPath.clear();
         m_failedTexturePaths.clear();
         m_thumbnailDisabledIconTexture.reset();
         m_requestedRenderItemsThisFrame.clear();
         m_inFlightRenderItems.clear();
+        m_thumbnailQueue.clear();
+        m_thumbnailUploads.clear();
+        m_thumbnailPrepares.clear();
+        m_captureTargets.clear();
 
         flushDeferredDescriptorReleases();
     }
@@ -852,51 +1017,9 @@ private:
         return glm::length(maxPos - minPos);
     }
 
-    bool ensureMaterialLoaded(const std::string &materialPath, engine::Material::SharedPtr &outMaterial)
-    {
-        if (outMaterial)
-            return true;
-
-        if (!m_project)
-            return false;
-
-        const std::string normalizedMaterialPath = resolveMaterialPathForProject(materialPath);
-
-        auto it = m_project->cache.materialsByPath.find(normalizedMaterialPath);
-        if (it != m_project->cache.materialsByPath.end() && it->second.gpu)
-        {
-            outMaterial = it->second.gpu;
-            return true;
-        }
-
-        auto materialAsset = engine::AssetsLoader::loadMaterial(normalizedMaterialPath);
-        if (!materialAsset.has_value())
-        {
-            VX_EDITOR_ERROR_STREAM("Failed to load material asset: " << normalizedMaterialPath << '\n');
-            return false;
-        }
-
-        auto materialCPU = materialAsset.value().material;
-        outMaterial = createPreviewMaterialFromCpu(materialCPU, normalizedMaterialPath, false);
-        if (!outMaterial)
-            return false;
-
-        auto &record = m_project->cache.materialsByPath[normalizedMaterialPath];
-        record.path = normalizedMaterialPath;
-        record.cpuData = materialCPU;
-        record.gpu = outMaterial;
-        record.texture = outMaterial->getAlbedoTexture();
-
-        return outMaterial != nullptr;
-    }
-
-    bool ensureModelLoaded(const std::string &modelPath, ModelPreviewEntry &entry)
+    static bool buildPreviewMesh(const engine::ModelAsset &model, engine::CPUMesh &outMesh, glm::mat4 &outTransform)
     {
-        const auto *model = loadOrGetModelAsset(modelPath);
-        if (!model)
-            return false;
-
-        if (model->meshes.empty())
+        if (model.meshes.empty())
             return false;
 
         std::vector<engine::vertex::Vertex3D> previewVertices;
@@ -904,7 +1027,7 @@ private:
         engine::CPUMesh previewMesh;
         bool foundPreviewMesh = false;
         float bestMeshScore = -1.0f;
-        for (const auto &sourceMesh : model->meshes)
+        for (const auto &sourceMesh : model.meshes)
         {
             if (!tryDecodePreviewVertices(sourceMesh, candidateVertices))
                 continue;
@@ -928,33 +1051,590 @@ private:
         if (!foundPreviewMesh)
             return false;
 
-        entry.previewTransform = buildNormalizationTransform(previewVertices);
-        entry.mesh = engine::GPUMesh::createFromMesh(previewMesh);
-        entry.material = createPreviewMaterialFromCpu(previewMesh.material, modelPath, true);
-        if (!entry.material)
-            entry.material = engine::Material::getDefaultMaterial();
+        outTransform = buildNormalizationTransform(previewVertices);
+        outMesh = std::move(previewMesh);
+        return true;
+    }
 
-        return entry.mesh != nullptr && entry.material != nullptr;
+    static uint8_t encodeSrgb(float linearValue)
+    {
+        const float value = std::isfinite(linearValue) ? std::clamp(linearValue, 0.0f, 1.0f) : 0.0f;
+        const float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        return static_cast<uint8_t>(encoded * 255.0f + 0.5f);
     }
 
-    const engine::ModelAsset *loadOrGetModelAsset(const std::string &modelPath)
+    // Returns false for block-compressed textures, which have no CPU-readable pixels.
+    static bool buildTextureThumbnail(const engine::TextureAsset &texture, ThumbnailImage &outImage)
     {
-        if (modelPath.empty() || !m_project)
-            return nullptr;
+        using PixelEncoding = engine::TextureAsset::PixelEncoding;
+
+        if (texture.width == 0u || texture.height == 0u || texture.channels != 4u)
+            return false;
+
+        size_t bytesPerPixel = 0u;
+        if (texture.encoding == PixelEncoding::RGBA8)
+            bytesPerPixel = 4u;
+        else if (texture.encoding == PixelEncoding::RGBA32F)
+            bytesPerPixel = 16u;
+        else
+            return false;
+
+        // Start from the smallest mip that still covers the thumbnail; mipChain starts at level 1.
+        const uint8_t *levelPixels = texture.pixels.data();
+        uint32_t levelWidth = texture.width;
+        uint32_t levelHeight = texture.height;
+        if (texture.pixels.size() < static_cast<size_t>(levelWidth) * levelHeight * bytesPerPixel)
+            return false;
+
+        for (size_t mipIndex = 0; mipIndex < texture.mipChain.size(); ++mipIndex)
+        {
+            const uint32_t mipWidth = std::max(1u, texture.width >> (mipIndex + 1u));
+            const uint32_t mipHeight = std::max(1u, texture.height >> (mipIndex + 1u));
+            if (std::max(mipWidth, mipHeight) < ThumbnailCache::THUMBNAIL_SIZE ||
+                texture.mipChain[mipIndex].size() < static_cast<size_t>(mipWidth) * mipHeight * bytesPerPixel)
+                break;
+
+            levelPixels = texture.mipChain[mipIndex].data();
+            levelWidth = mipWidth;
+            levelHeight = mipHeight;
+        }
+
+        if (texture.encoding == PixelEncoding::RGBA8)
+        {
+            outImage = ThumbnailCache::downsample(levelPixels, levelWidth, levelHeight, static_cast<size_t>(levelWidth) * 4u, true);
+            return outImage.isValid();
+        }
+
+        const size_t pixelCount = static_cast<size_t>(levelWidth) * levelHeight;
+        std::vector<float> floatPixels(pixelCount * 4u);
+        std::memcpy(floatPixels.data(), levelPixels, floatPixels.size() * sizeof(float));
+
+        std::vector<uint8_t> encodedPixels(pixelCount * 4u);
+        for (size_t i = 0; i < pixelCount; ++i)
+        {
+            encodedPixels[i * 4u + 0u] = encodeSrgb(floatPixels[i * 4u + 0u]);
+            encodedPixels[i * 4u + 1u] = encodeSrgb(floatPixels[i * 4u + 1u]);
+            encodedPixels[i * 4u + 2u] = encodeSrgb(floatPixels[i * 4u + 2u]);
+            const float alpha = std::isfinite(floatPixels[i * 4u + 3u]) ? std::clamp(floatPixels[i * 4u + 3u], 0.0f, 1.0f) : 1.0f;
+            encodedPixels[i * 4u + 3u] = static_cast<uint8_t>(alpha * 255.0f + 0.5f);
+        }
+
+        outImage = ThumbnailCache::downsample(encodedPixels.data(), levelWidth, levelHeight, static_cast<size_t>(levelWidth) * 4u, true);
+        return outImage.isValid();
+    }
+
+    static bool buildCaptureThumbnail(const PreviewAssetsRenderGraphPass::CapturedPreview &capture, ThumbnailImage &outImage)
+    {
+        if (!PreviewAssetsRenderGraphPass::isCaptureFormatSupported(capture.format) ||
+            capture.pixels.size() < static_cast<size_t>(capture.width) * capture.height * 4u)
+            return false;
+
+        const bool srgb = capture.format == VK_FORMAT_R8G8B8A8_SRGB || capture.format == VK_FORMAT_B8G8R8A8_SRGB;
+        outImage = ThumbnailCache::downsample(capture.pixels.data(), capture.width, capture.height,
+                                              static_cast<size_t>(capture.width) * 4u, srgb);
 
-        auto previewModelIt = m_previewModelsByPath.find(modelPath);
-        if (previewModelIt != m_previewModelsByPath.end())
-            return &previewModelIt->second;
+        // The box filter treats channels alike, so swizzling the small image is enough.
+        if (capture.format == VK_FORMAT_B8G8R8A8_UNORM || capture.format == VK_FORMAT_B8G8R8A8_SRGB)
+            for (size_t i = 0; i + 3u < outImage.pixels.size(); i += 4u)
+                std::swap(outImage.pixels[i], outImage.pixels[i + 2u]);
 
-        auto modelAsset = engine::AssetsLoader::loadModel(modelPath);
-        if (!modelAsset.has_value())
+        return outImage.isValid();
+    }
+
+    // Runs on a worker: no access to `this`, the project or the GPU.
+    static ThumbnailResult runThumbnailTask(const ThumbnailTask &task)
+    {
+        ThumbnailResult result{.kind = task.kind, .path = task.path, .serial = task.serial};
+
+        if (task.capture.has_value())
+        {
+            result.success = buildCaptureThumbnail(task.capture.value(), result.image);
+            if (result.success)
+                task.cache.store(task.contentHash, result.image);
+            return result;
+        }
+
+        if (task.cache.load(task.contentHash, result.image))
+        {
+            result.success = true;
+            return result;
+        }
+
+        switch (task.kind)
+        {
+        case PreviewKind::Texture:
+        {
+            auto textureAsset = engine::AssetsLoader::loadTexture(task.path);
+            if (!textureAsset.has_value())
+            {
+                VX_EDITOR_WARNING_STREAM("Failed to load texture for preview: " << task.path << '\n');
+                break;
+            }
+
+            // Without an image the editor thread uploads the texture itself.
+            result.success = true;
+            if (buildTextureThumbnail(textureAsset.value(), result.image))
+                task.cache.store(task.contentHash, result.image);
+            break;
+        }
+        case PreviewKind::Material:
+        {
+            auto materialAsset = engine::AssetsLoader::loadMaterial(task.path);
+            if (!materialAsset.has_value())
+            {
+                VX_EDITOR_ERROR_STREAM("Failed to load material asset: " << task.path << '\n');
+                break;
+            }
+
+            result.material = std::move(materialAsset.value().material);
+            result.success = true;
+            break;
+        }
+        case PreviewKind::Model:
+        {
+            auto modelAsset = engine::AssetsLoader::loadModel(task.path);
+            if (!modelAsset.has_value())
+            {
+                VX_EDITOR_ERROR_STREAM("Failed to load model for preview: " << task.path << '\n');
+                break;
+            }
+
+            engine::CPUMesh previewMesh;
+            if (buildPreviewMesh(modelAsset.value(), previewMesh, result.meshTransform))
+            {
+                result.mesh = std::move(previewMesh);
+                result.success = true;
+            }
+            break;
+        }
+        }
+
+        return result;
+    }
+
+    void submitThumbnailTask(ThumbnailTask &&task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_thumbnailWork->mutex);
+            ++m_thumbnailWork->tasksInFlight;
+        }
+
+        const std::string path = task.path;
+        m_thumbnailWorker.enqueue({.path = path,
+                                   .execute = [work = m_thumbnailWork, task = std::move(task)]()
+                                   {
+                                       ThumbnailResult result = runThumbnailTask(task);
+
+                                       std::lock_guard<std::mutex> lock(work->mutex);
+                                       --work->tasksInFlight;
+                                       work->results.push_back(std::move(result));
+                                   }});
+    }
+
+    ThumbnailSlot *findThumbnailSlot(PreviewKind kind, const std::string &path)
+    {
+        switch (kind)
+        {
+        case PreviewKind::Material:
+        {
+            auto it = m_materialEntries.find(path);
+            return it != m_materialEntries.end() ? &it->second.thumbnail : nullptr;
+        }
+        case PreviewKind::Model:
         {
-            VX_EDITOR_ERROR_STREAM("Failed to load model for preview: " << modelPath << '\n');
+            auto it = m_modelEntries.find(path);
+            return it != m_modelEntries.end() ? &it->second.thumbnail : nullptr;
+        }
+        case PreviewKind::Texture:
+        {
+            auto it = m_textureEntries.find(path);
+            return it != m_textureEntries.end() ? &it->second.thumbnail : nullptr;
+        }
+        }
+
+        return nullptr;
+    }
+
+    // The slot `key` was queued for, if it is still in `state`.
+    ThumbnailSlot *findPendingThumbnail(const ThumbnailKey &key, ThumbnailState state)
+    {
+        ThumbnailSlot *thumbnail = findThumbnailSlot(key.kind, key.path);
+        if (!thumbnail || thumbnail->serial != key.serial || thumbnail->state != state)
             return nullptr;
+
+        return thumbnail;
+    }
+
+    bool isThumbnailVisible(const ThumbnailSlot &thumbnail) const
+    {
+        return thumbnail.lastRequestedFrame + THUMBNAIL_VISIBILITY_FRAMES >= m_frameIndex;
+    }
+
+    uint64_t findContentHash(const std::string &path) const
+    {
+        if (!m_project || !m_project->assetDatabase)
+            return 0u;
+
+        const AssetRecord *record = m_project->assetDatabase->find(path);
+        return record ? record->contentHash : 0u;
+    }
+
+    void requestThumbnail(PreviewKind kind, const std::string &path, ThumbnailSlot &thumbnail)
+    {
+        thumbnail.lastRequestedFrame = m_frameIndex;
+
+        // The asset database rehashes edited files, which starts a new thumbnail.
+        const uint64_t contentHash = findContentHash(path);
+        if (thumbnail.state != ThumbnailState::None && thumbnail.contentHash != contentHash)
+            resetThumbnail(kind, path, thumbnail);
+
+        if (thumbnail.state != ThumbnailState::None)
+            return;
+
+        thumbnail.state = ThumbnailState::Queued;
+        thumbnail.contentHash = contentHash;
+        thumbnail.serial = ++m_thumbnailSerial;
+        thumbnail.lastRequestedFrame = m_frameIndex;
+        m_thumbnailQueue.push_back(ThumbnailKey{kind, path, thumbnail.serial});
+    }
+
+    void resetThumbnail(PreviewKind kind, const std::string &path, ThumbnailSlot &thumbnail)
+    {
+        if (kind == PreviewKind::Texture)
+        {
+            auto &entry = m_textureEntries[path];
+            queueDescriptorRelease(entry.imguiDescriptorSet, entry.texture);
+            entry.texture.reset();
+        }
+        else if (kind == PreviewKind::Material)
+        {
+            auto &entry = m_materialEntries[path];
+            queueDescriptorRelease(entry.imguiDescriptorSet, thumbnail.texture);
+            entry.previewImageView = VK_NULL_HANDLE;
+            entry.material.reset();
+        }
+        else if (kind == PreviewKind::Model)
+        {
+            auto &entry = m_modelEntries[path];
+            queueDescriptorRelease(entry.imguiDescriptorSet, thumbnail.texture);
+            entry.previewImageView = VK_NULL_HANDLE;
+            entry.material.reset();
+            entry.mesh.reset();
+        }
+
+        const uint64_t lastRequestedFrame = thumbnail.lastRequestedFrame;
+        thumbnail = ThumbnailSlot{};
+        thumbnail.lastRequestedFrame = lastRequestedFrame;
+    }
+
+    uint32_t nextCaptureId()
+    {
+        if (++m_lastCaptureId == 0u)
+            ++m_lastCaptureId;
+
+        return m_lastCaptureId;
+    }
+
+    void requestRenderIfNeeded(PreviewKind kind, const std::string &path, ThumbnailSlot &thumbnail, bool &requestedThisFrame)
+    {
+        if (requestedThisFrame)
+            return;
+
+        uint32_t captureId = 0u;
+        if (thumbnail.state == ThumbnailState::Render)
+        {
+            if (m_captureRequestsThisFrame >= MAX_THUMBNAIL_CAPTURES_PER_FRAME)
+                return;
+
+            ++m_captureRequestsThisFrame;
+            captureId = nextCaptureId();
+        }
+        else if (thumbnail.state != ThumbnailState::Live)
+            return;
+
+        requestedThisFrame = true;
+        m_requestedRenderItemsThisFrame.push_back({kind, path, captureId});
+    }
+
+    VkDescriptorSet getPreviewDescriptor(VkDescriptorSet &descriptorSet, VkSampler sampler, VkImageView imageView, const ThumbnailSlot &thumbnail)
+    {
+        // Stale thumbnails lose their descriptor; live views are only valid when just rendered.
+        if (descriptorSet == VK_NULL_HANDLE && thumbnail.state == ThumbnailState::Ready &&
+            sampler != VK_NULL_HANDLE && imageView != VK_NULL_HANDLE)
+            descriptorSet = ImGui_ImplVulkan_AddTexture(sampler, imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+        if (descriptorSet)
+            return descriptorSet;
+
+        return getPlaceholder();
+    }
+
+    void updateThumbnails()
+    {
+        collectThumbnailResults();
+        expireThumbnailCaptures();
+        uploadThumbnails();
+        prepareThumbnailSources();
+        dispatchThumbnailTasks();
+    }
+
+    void collectThumbnailResults()
+    {
+        std::vector<ThumbnailResult> results;
+        {
+            std::lock_guard<std::mutex> lock(m_thumbnailWork->mutex);
+            results.swap(m_thumbnailWork->results);
+        }
+
+        for (auto &result : results)
+        {
+            const ThumbnailKey key{result.kind, result.path, result.serial};
+            ThumbnailSlot *thumbnail = findPendingThumbnail(key, ThumbnailState::Working);
+            if (!thumbnail)
+                continue;
+
+            thumbnail->stateFrame = m_frameIndex;
+
+            if (!result.success)
+                thumbnail->state = ThumbnailState::Failed;
+            else if (result.image.isValid())
+            {
+                thumbnail->pendingImage = std::move(result.image);
+                thumbnail->state = ThumbnailState::Upload;
+                m_thumbnailUploads.push_back(key);
+            }
+            else
+            {
+                thumbnail->pendingMaterial = std::move(result.material);
+                thumbnail->pendingMesh = std::move(result.mesh);
+                thumbnail->pendingTransform = result.meshTransform;
+                thumbnail->state = ThumbnailState::Prepare;
+                m_thumbnailPrepares.push_back(key);
+            }
+        }
+    }
+
+    void expireThumbnailCaptures()
+    {
+        for (auto it = m_captureTargets.begin(); it != m_captureTargets.end();)
+        {
+            ThumbnailSlot *thumbnail = findPendingThumbnail(it->second, ThumbnailState::Capturing);
+            if (thumbnail && m_frameIndex - thumbnail->stateFrame <= THUMBNAIL_CAPTURE_TIMEOUT_FRAMES)
+            {
+                ++it;
+                continue;
+            }
+
+            // The readback never came back (e.g. the preview pass did not run): render again.
+            if (thumbnail)
+                thumbnail->state = ThumbnailState::Render;
+
+            it = m_captureTargets.erase(it);
+        }
+    }
+
+    void uploadThumbnails()
+    {
+        size_t uploadCount = 0;
+        size_t writeIndex = 0;
+
+        for (size_t readIndex = 0; readIndex < m_thumbnailUploads.size(); ++readIndex)
+        {
+            const ThumbnailKey &key = m_thumbnailUploads[readIndex];
+            ThumbnailSlot *thumbnail = findPendingThumbnail(key, ThumbnailState::Upload);
+            if (!thumbnail)
+                continue;
+
+            if (uploadCount >= MAX_THUMBNAIL_UPLOADS_PER_FRAME)
+            {
+                if (writeIndex != readIndex)
+                    m_thumbnailUploads[writeIndex] = std::move(m_thumbnailUploads[readIndex]);
+                ++writeIndex;
+                continue;
+            }
+
+            ++uploadCount;
+            uploadThumbnail(key, *thumbnail);
+        }
+
+        m_thumbnailUploads.resize(writeIndex);
+    }
+
+    void uploadThumbnail(const ThumbnailKey &key, ThumbnailSlot &thumbnail)
+    {
+        const ThumbnailImage image = std::move(thumbnail.pendingImage);
+        thumbnail.pendingImage = ThumbnailImage{};
+
+        auto texture = std::make_shared<engine::Texture>();
+        if (!texture->createFromMemory(image.pixels.data(), image.pixels.size(), image.width, image.height,
+                                       image.srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM, 4u))
+        {
+            thumbnail.state = ThumbnailState::Failed;
+            return;
+        }
+
+        thumbnail.texture = texture;
+        thumbnail.state = ThumbnailState::Ready;
+
+        if (key.kind == PreviewKind::Texture)
+        {
+            auto &entry = m_textureEntries[key.path];
+            entry.texture = texture;
+            if (entry.imguiDescriptorSet != VK_NULL_HANDLE)
+                replaceDescriptor(entry.imguiDescriptorSet, texture->vkSampler(), texture->vkImageView());
+        }
+        else if (key.kind == PreviewKind::Material)
+        {
+            // The captured image replaces the preview material; nothing has to be rendered again.
+            auto &entry = m_materialEntries[key.path];
+            entry.material.reset();
+            entry.previewSampler = texture->vkSampler();
+            entry.previewImageView = texture->vkImageView();
+            replaceDescriptor(entry.imguiDescriptorSet, entry.previewSampler, entry.previewImageView);
+        }
+        else if (key.kind == PreviewKind::Model)
+        {
+            auto &entry = m_modelEntries[key.path];
+            entry.mesh.reset();
+            entry.material.reset();
+            entry.previewSampler = texture->vkSampler();
+            entry.previewImageView = texture->vkImageView();
+            replaceDescriptor(entry.imguiDescriptorSet, entry.previewSampler, entry.previewImageView);
+        }
+    }
+
+    void prepareThumbnailSources()
+    {
+        size_t prepareCount = 0;
+        size_t writeIndex = 0;
+
+        for (size_t readIndex = 0; readIndex < m_thumbnailPrepares.size(); ++readIndex)
+        {
+            const ThumbnailKey &key = m_thumbnailPrepares[readIndex];
+            ThumbnailSlot *thumbnail = findPendingThumbnail(key, ThumbnailState::Prepare);
+            if (!thumbnail)
+                continue;
+
+            // GPU resources are only worth creating for cells on screen; the request starts over later.
+            if (!isThumbnailVisible(*thumbnail))
+            {
+                thumbnail->pendingMaterial.reset();
+                thumbnail->pendingMesh.reset();
+                thumbnail->state = ThumbnailState::None;
+                continue;
+            }
+
+            if (prepareCount >= MAX_THUMBNAIL_PREPARES_PER_FRAME)
+            {
+                if (writeIndex != readIndex)
+                    m_thumbnailPrepares[writeIndex] = std::move(m_thumbnailPrepares[readIndex]);
+                ++writeIndex;
+                continue;
+            }
+
+            ++prepareCount;
+            prepareThumbnailSource(key, *thumbnail);
+        }
+
+        m_thumbnailPrepares.resize(writeIndex);
+    }
+
+    void prepareThumbnailSource(const ThumbnailKey &key, ThumbnailSlot &thumbnail)
+    {
+        thumbnail.stateFrame = m_frameIndex;
+
+        if (key.kind == PreviewKind::Texture)
+        {
+            // Block-compressed textures are shown through the texture itself, uncached.
+            auto &entry = m_textureEntries[key.path];
+            entry.texture = loadOrGetTexture(key.path, TextureUsage::PreviewColor);
+            thumbnail.state = entry.texture ? ThumbnailState::Ready : ThumbnailState::Failed;
         }
+        else if (key.kind == PreviewKind::Material)
+        {
+            auto &entry = m_materialEntries[key.path];
+            if (thumbnail.pendingMaterial.has_value())
+            {
+                // Built from the file just read, so an edited material never renders a stale cached copy.
+                entry.material = createPreviewMaterialFromCpu(thumbnail.pendingMaterial.value(), key.path, false);
+
+                if (entry.material && m_project)
+                {
+                    auto &record = m_project->cache.materialsByPath[key.path];
+                    if (!record.gpu)
+                    {
+                        record.path = key.path;
+                        record.cpuData = thumbnail.pendingMaterial.value();
+                        record.gpu = entry.material;
+                        record.texture = entry.material->getAlbedoTexture();
+                    }
+                }
+            }
 
-        const auto [insertedIt, _] = m_previewModelsByPath.emplace(modelPath, std::move(modelAsset.value()));
-        return &insertedIt->second;
+            thumbnail.state = entry.material ? ThumbnailState::Render : ThumbnailState::Failed;
+        }
+        else if (key.kind == PreviewKind::Model)
+        {
+            auto &entry = m_modelEntries[key.path];
+            if (thumbnail.pendingMesh.has_value())
+            {
+                entry.previewTransform = thumbnail.pendingTransform;
+                entry.mesh = engine::GPUMesh::createFromMesh(thumbnail.pendingMesh.value());
+                entry.material = createPreviewMaterialFromCpu(thumbnail.pendingMesh->material, key.path, true);
+                if (!entry.material)
+                    entry.material = engine::Material::getDefaultMaterial();
+            }
+
+            thumbnail.state = entry.mesh && entry.material ? ThumbnailState::Render : ThumbnailState::Failed;
+        }
+
+        thumbnail.pendingMaterial.reset();
+        thumbnail.pendingMesh.reset();
+    }
+
+    void dispatchThumbnailTasks()
+    {
+        size_t tasksInFlight = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_thumbnailWork->mutex);
+            tasksInFlight = m_thumbnailWork->tasksInFlight;
+        }
+
+        // Requests are queued in the order cells were first drawn.
+        size_t writeIndex = 0;
+        for (size_t readIndex = 0; readIndex < m_thumbnailQueue.size(); ++readIndex)
+        {
+            const ThumbnailKey &key = m_thumbnailQueue[readIndex];
+            ThumbnailSlot *thumbnail = findPendingThumbnail(key, ThumbnailState::Queued);
+            if (!thumbnail)
+                continue;
+
+            if (!isThumbnailVisible(*thumbnail))
+            {
+                thumbnail->state = ThumbnailState::None;
+                continue;
+            }
+
+            if (tasksInFlight >= MAX_THUMBNAIL_TASKS_IN_FLIGHT)
+            {
+                if (writeIndex != readIndex)
+                    m_thumbnailQueue[writeIndex] = std::move(m_thumbnailQueue[readIndex]);
+                ++writeIndex;
+                continue;
+            }
+
+            ++tasksInFlight;
+            thumbnail->state = ThumbnailState::Working;
+            thumbnail->stateFrame = m_frameIndex;
+            submitThumbnailTask(ThumbnailTask{
+                .kind = key.kind,
+                .path = key.path,
+                .contentHash = thumbnail->contentHash,
+                .serial = thumbnail->serial,
+                .cache = m_thumbnailCache});
+        }
+
+        m_thumbnailQueue.resize(writeIndex);
     }
 
     Project *m_project = nullptr;
@@ -968,12 +1648,23 @@ private:
     std::unordered_map<std::string, MaterialPreviewEntry> m_materialEntries;
     std::unordered_map<std::string, ModelPreviewEntry> m_modelEntries;
     std::unordered_map<std::string, TexturePreviewEntry> m_textureEntries;
-    std::unordered_map<std::string, engine::ModelAsset> m_previewModelsByPath;
     std::unordered_set<std::string> m_failedTexturePaths;
 
+    ThumbnailCache m_thumbnailCache;
+    std::shared_ptr<ThumbnailWork> m_thumbnailWork{std::make_shared<ThumbnailWork>()};
+    std::vector<ThumbnailKey> m_thumbnailQueue;
+    std::vector<ThumbnailKey> m_thumbnailUploads;
+    std::vector<ThumbnailKey> m_thumbnailPrepares;
+    std::unordered_map<uint32_t, ThumbnailKey> m_captureTargets;
+    uint64_t m_thumbnailSerial{0};
+    uint32_t m_lastCaptureId{0};
+    size_t m_captureRequestsThisFrame{0};
+
     VkDescriptorSet m_placeholder{VK_NULL_HANDLE};
     engine::Texture::SharedPtr m_thumbnailDisabledIconTexture{nullptr};
     VkDescriptorSet m_thumbnailDisabledIcon{VK_NULL_HANDLE};
+
+    engine::AssetStreamingWorker m_thumbnailWorker; // last member: joined before the rest is destroyed
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -12,6 +12,7 @@
 #include "Editor/AssetsPreviewSystem.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <string>
 #include <filesystem>
 #include <unordered_set>
@@ -94,10 +95,26 @@ private:
         TreeNode(const std::string &n, const std::filesystem::path &p) : name(n), path(p) {}
     };
 
+    struct AssetGridEntry
+    {
+        std::filesystem::path path;
+        bool isDirectory{false};
+        uint64_t size{0};
+        engine::Asset::AssetType type{engine::Asset::AssetType::NONE};
+        // Precomputed so drawing a cell allocates nothing.
+        std::string pathString;
+        std::string fileName;
+        std::string displayName;
+        std::string extensionLower;
+    };
+
     void drawSearchBar();
     void drawTreeView();
     void drawAssetGrid();
-    std::vector<std::filesystem::directory_entry> getFilteredEntries();
+    // Current folder from the asset database, filtered and sorted; rebuilt only when the folder,
+    // search or database revision changes.
+    const std::vector<AssetGridEntry> &getFilteredEntries();
+    AssetDatabase *getAssetDatabase() const;
 
     void buildDirectoryTree();
     void buildTreeNode(TreeNode *node, const std::filesystem::path &path);
@@ -128,13 +145,13 @@ private:
     char m_searchBuffer[256] = "";
     std::string m_searchQuery;
 
-    std::unordered_set<std::string> m_excludedDirectories = {
-        "build", "cmake-build-debug", "cmake-build-release",
-        ".git", ".vs", ".vscode", "node_modules",
-        "__pycache__", ".idea", "out", "bin", "obj",
-        "Debug", "Release", "x64", "x86", "temp"};
-
     std::shared_ptr<TreeNode> m_treeRoot;
+    uint64_t m_treeRevision{0};
+
+    std::vector<AssetGridEntry> m_gridEntries;
+    std::filesystem::path m_gridEntriesDirectory;
+    std::string m_gridEntriesSearchQuery;
+    uint64_t m_gridEntriesRevision{UINT64_MAX};
     TreeNode *m_selectedTreeNode = nullptr;
     std::filesystem::path m_selectedAssetPath;
     std::filesystem::path m_contextAssetPath;
@@ -11,6 +11,7 @@
 #include "Editor/Project.hpp"
 #include "Editor/Notification.hpp"
 #include "Editor/Actions/EditorActionHistory.hpp"
+#include "Editor/Actions/Commands/EntityPropertyCommand.hpp"
 #include "Editor/Panels/MaterialEditor.hpp"
 #include "Editor/Panels/AnimationTreePanel.hpp"
 #include "Editor/Panels/HierarchyPanel.hpp"
@@ -217,6 +218,11 @@ public:
         m_assetsPreviewSystem.consumeRenderedJobs(views, m_defaultSampler->vk());
     }
 
+    void setCapturedPreviews(std::vector<PreviewAssetsRenderGraphPass::CapturedPreview> &&captures)
+    {
+        m_assetsPreviewSystem.consumeCapturedPreviews(std::move(captures));
+    }
+
     bool consumeShaderReloadRequest()
     {
         const bool requested = m_pendingShaderReloadRequest;
@@ -324,6 +330,11 @@ private:
     bool executeEditorCommand(std::unique_ptr<actions::IEditorCommand> command);
     bool recordExecutedEditorCommand(std::unique_ptr<actions::IEditorCommand> command);
     bool recordCreatedEntityCommand(engine::Entity *entity, const std::string &label);
+    bool recordEntityPropertyCommand(engine::Entity *entity,
+                                     actions::PropertySetter setter,
+                                     actions::PropertyValue oldValue,
+                                     actions::PropertyValue newValue,
+                                     const std::string &label);
     bool performUndoAction();
     bool performRedoAction();
     bool performCopyAction();
@@ -6,11 +6,17 @@
 #include "Engine/Entity.hpp"
 #include "Engine/Scene.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(editor)
 
+// Draws the scene hierarchy as a flat list of visible rows, clipped to the scroll region.
+// The rows and the search index are rebuilt only when the scene's hierarchy revision, the
+// expanded set or the search changes, so idle frames cost only the rows on screen.
 class HierarchyPanel
 {
 public:
@@ -24,7 +30,26 @@ public:
     void setScene(engine::Scene *scene);
 
 private:
-    void drawHierarchyEntityNode(engine::Entity *entity);
+    struct Row
+    {
+        engine::Entity *entity{nullptr};
+        uint32_t depth{0};
+        bool hasChildren{false};
+        bool expanded{false};
+    };
+
+    struct SearchEntry
+    {
+        engine::Entity *entity{nullptr};
+        std::string lowerName;
+    };
+
+    void refreshRows();
+    void rebuildSearchIndex();
+    void appendRows(engine::Entity *entity, uint32_t depth);
+    void appendSearchRows();
+    void drawRow(const Row &row);
+    void reparentEntity(engine::Entity *draggedEntity, engine::Entity *newParent);
 
     std::function<void(engine::Entity *)> m_setSelectedEntityCallback{nullptr};
     std::function<void(const std::string &)> m_addEmptyEntityCallback{nullptr};
@@ -32,8 +57,17 @@ private:
 
     engine::Entity *m_selectedEntity{nullptr};
     engine::Scene *m_scene{nullptr};
+
+    std::vector<Row> m_rows;
+    std::vector<SearchEntry> m_searchIndex;
+    std::unordered_set<uint32_t> m_expandedEntityIds;
+    uint64_t m_rowsRevision{0};
+    bool m_rowsDirty{true};
+
+    char m_searchBuffer[128]{};
+    std::string m_searchQuery;
 };
 
 ELIX_NESTED_NAMESPACE_END
 
-#endif // ELIX_HIERARCHY_PANEL_HPP
\ No newline at end of file
+#endif // ELIX_HIERARCHY_PANEL_HPP
@@ -7,9 +7,12 @@
 #include <cstdint>
 #include <optional>
 #include <filesystem>
+#include <memory>
 
 #include "Core/Macros.hpp"
 
+#include "Editor/AssetDatabase.hpp"
+
 #include "Engine/PluginSystem/PluginLoader.hpp"
 #include "Engine/Assets/AssetsCache.hpp"
 #include "Engine/Assets/IAssetLoader.hpp"
@@ -107,6 +110,7 @@ struct Project
 {
 public:
     ProjectCache cache;
+    std::shared_ptr<AssetDatabase> assetDatabase{nullptr};
     engine::LibraryHandle projectLibrary{nullptr};
     std::filesystem::path loadedProjectLibraryPath;
     bool loadedProjectLibraryIsTemporaryCopy{false};
@@ -2,6 +2,7 @@
 #define ELIX_PREVIEW_ASSETS_RENDER_GRAPH_PASS_HPP
 
 #include "Engine/Render/GraphPasses/IRenderGraphPass.hpp"
+#include "Core/Buffer.hpp"
 #include "Core/PipelineLayout.hpp"
 
 #include <vector>
@@ -19,9 +20,23 @@ public:
         engine::GPUMesh *mesh{nullptr};
         glm::mat4 modelTransform{1.0f};
         bool rotate{true};
+        // Non-zero: the rendered image is read back by submitCaptures() under this id.
+        uint32_t captureId{0};
     };
 
+    struct CapturedPreview
+    {
+        uint32_t captureId{0};
+        uint32_t width{0};
+        uint32_t height{0};
+        VkFormat format{VK_FORMAT_UNDEFINED};
+        std::vector<uint8_t> pixels; // 4 bytes per pixel in `format`; empty if the capture was dropped
+    };
+
+    static constexpr uint32_t MAX_CAPTURES_PER_SUBMIT = 8u;
+
     PreviewAssetsRenderGraphPass(VkExtent2D extent);
+    ~PreviewAssetsRenderGraphPass() override;
 
     int addPreviewJob(const PreviewJob &previewJob);
 
@@ -50,7 +65,18 @@ public:
 
     void clearJobs();
 
+    // Copies this frame's capture jobs into a host-visible buffer. Call after the frame was submitted.
+    // Jobs that cannot be captured now (a copy is still in flight, or over the limit) are dropped.
+    void submitCaptures();
+    // Hands over finished and dropped captures without waiting on the GPU.
+    bool collectCaptures(std::vector<CapturedPreview> &outCaptures);
+    // Whether captured pixels of the preview target format can be turned into RGBA8 thumbnails.
+    static bool isCaptureFormatSupported(VkFormat format);
+    VkFormat getColorFormat() const;
+
 private:
+    void waitForCaptures();
+
     std::array<PreviewJob, MAX_RENDER_JOBS> m_renderJobs;
     std::array<const engine::RenderTarget *, MAX_RENDER_JOBS> m_renderTargets;
     std::array<engine::renderGraph::RGPResourceHandler, MAX_RENDER_JOBS> m_resourceHandlers;
@@ -65,6 +91,12 @@ private:
 
     uint32_t m_indexBusyJobs{0};
     uint32_t m_currentJob{0};
+
+    core::Buffer::SharedPtr m_captureBuffer{nullptr};
+    core::CommandBuffer::SharedPtr m_captureCommandBuffer{nullptr};
+    VkFence m_captureFence{VK_NULL_HANDLE};
+    std::vector<uint32_t> m_inFlightCaptureIds; // one buffer slot each, in order
+    std::vector<uint32_t> m_droppedCaptureIds;
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -67,6 +67,8 @@ public:
 
     bool init() override;
     void tick(float deltaTime) override;
+    void fixedTick(float fixedDelta) override;
+    void setFixedStepAlpha(float alpha) override;
     void shutdown() override;
 
     void openSceneFromFile(const std::filesystem::path &path);
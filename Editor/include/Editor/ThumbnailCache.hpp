@@ -0,0 +1,61 @@
+#ifndef ELIX_THUMBNAIL_CACHE_HPP
+#define ELIX_THUMBNAIL_CACHE_HPP
+
+#include "Core/Macros.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+
+struct ThumbnailImage
+{
+    uint32_t width{0};
+    uint32_t height{0};
+    bool srgb{true}; // RGBA8 values are sRGB-encoded; upload with an _SRGB format
+    std::vector<uint8_t> pixels; // RGBA8, tightly packed
+
+    bool isValid() const
+    {
+        return width != 0u && height != 0u && pixels.size() == static_cast<size_t>(width) * height * 4u;
+    }
+};
+
+// Small compressed RGBA8 previews under <project>/.velixcache/thumbnails, one file per asset
+// content hash, so later sessions show thumbnails without loading the source asset. An edited
+// asset gets a new hash and therefore a new thumbnail; stale files are simply never read again.
+//
+// Every method is const and safe to call from worker threads.
+class ThumbnailCache
+{
+public:
+    static constexpr uint32_t FILE_VERSION = 1u;
+    static constexpr uint32_t THUMBNAIL_SIZE = 128u;
+
+    ThumbnailCache() = default;
+    explicit ThumbnailCache(const std::filesystem::path &projectRoot);
+
+    bool isEnabled() const { return !m_directory.empty(); }
+    const std::filesystem::path &getDirectory() const { return m_directory; }
+
+    bool load(uint64_t contentHash, ThumbnailImage &outImage) const;
+    bool store(uint64_t contentHash, const ThumbnailImage &image) const;
+
+    // Box-filters RGBA8 pixels so the longer side is at most `maxSize`. `rowPitch` is in bytes.
+    static ThumbnailImage downsample(const uint8_t *rgbaPixels,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     size_t rowPitch,
+                                     bool srgb,
+                                     uint32_t maxSize = THUMBNAIL_SIZE);
+
+private:
+    std::filesystem::path getFilePath(uint64_t contentHash) const;
+
+    std::filesystem::path m_directory;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_THUMBNAIL_CACHE_HPP
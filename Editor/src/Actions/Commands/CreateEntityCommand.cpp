@@ -10,7 +10,7 @@ namespace actions
                                              uint32_t rootEntityId,
                                              std::string label)
         : m_scene(scene),
-          m_serializedHierarchy(std::move(serializedHierarchy)),
+          m_serializedHierarchy(serializedHierarchy),
           m_rootEntityId(rootEntityId),
           m_label(std::move(label))
     {
@@ -33,7 +33,7 @@ namespace actions
             return false;
 
         uint32_t restoredRootEntityId = 0u;
-        engine::Entity *entity = m_scene->restoreEntityHierarchy(m_serializedHierarchy, &restoredRootEntityId);
+        engine::Entity *entity = m_scene->restoreEntityHierarchy(m_serializedHierarchy.decompress(), &restoredRootEntityId);
         if (!entity)
         {
             VX_EDITOR_WARNING_STREAM("CreateEntityCommand failed to restore entity hierarchy for '" << m_label << "'.\n");
@@ -61,6 +61,11 @@ namespace actions
         return m_label.c_str();
     }
 
+    std::size_t CreateEntityCommand::getMemoryUsage() const
+    {
+        return sizeof(*this) + m_serializedHierarchy.getMemoryUsage() + m_label.capacity();
+    }
+
     uint32_t CreateEntityCommand::getRootEntityId() const
     {
         return m_rootEntityId;
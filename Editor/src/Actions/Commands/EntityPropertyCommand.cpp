@@ -0,0 +1,116 @@
+#include "Editor/Actions/Commands/EntityPropertyCommand.hpp"
+
+#include "Core/Logger.hpp"
+#include "Engine/Components/Transform3DComponent.hpp"
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+namespace actions
+{
+    EntityPropertyCommand::EntityPropertyCommand(engine::Scene *scene,
+                                                 uint32_t entityId,
+                                                 PropertySetter setter,
+                                                 PropertyValue oldValue,
+                                                 PropertyValue newValue,
+                                                 std::string label)
+        : m_scene(scene),
+          m_entityId(entityId),
+          m_setter(setter),
+          m_oldValue(std::move(oldValue)),
+          m_newValue(std::move(newValue)),
+          m_label(std::move(label))
+    {
+    }
+
+    bool EntityPropertyCommand::apply(const PropertyValue &value) const
+    {
+        if (!m_scene || !m_setter)
+            return false;
+
+        engine::Entity *entity = m_scene->getEntityById(m_entityId);
+        if (!entity)
+            return false;
+
+        if (!m_setter(*entity, value))
+        {
+            VX_EDITOR_WARNING_STREAM("EntityPropertyCommand failed to apply '" << m_label << "'.\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    bool EntityPropertyCommand::execute()
+    {
+        return apply(m_newValue);
+    }
+
+    bool EntityPropertyCommand::undo()
+    {
+        return apply(m_oldValue);
+    }
+
+    const char *EntityPropertyCommand::getName() const
+    {
+        return m_label.c_str();
+    }
+
+    bool EntityPropertyCommand::mergeWith(const IEditorCommand &next)
+    {
+        const auto *nextCommand = dynamic_cast<const EntityPropertyCommand *>(&next);
+        if (!nextCommand ||
+            nextCommand->m_scene != m_scene ||
+            nextCommand->m_entityId != m_entityId ||
+            nextCommand->m_setter != m_setter ||
+            nextCommand->m_newValue.index() != m_newValue.index())
+            return false;
+
+        m_newValue = nextCommand->m_newValue;
+        return true;
+    }
+
+    std::size_t EntityPropertyCommand::getMemoryUsage() const
+    {
+        std::size_t memoryUsage = sizeof(*this) + m_label.capacity();
+
+        if (const auto *text = std::get_if<std::string>(&m_oldValue))
+            memoryUsage += text->capacity();
+        if (const auto *text = std::get_if<std::string>(&m_newValue))
+            memoryUsage += text->capacity();
+
+        return memoryUsage;
+    }
+
+    bool setTransformPosition(engine::Entity &entity, const PropertyValue &value)
+    {
+        auto *transform = entity.getComponent<engine::Transform3DComponent>();
+        const auto *position = std::get_if<glm::vec3>(&value);
+        if (!transform || !position)
+            return false;
+
+        transform->setPosition(*position);
+        return true;
+    }
+
+    bool setTransformRotation(engine::Entity &entity, const PropertyValue &value)
+    {
+        auto *transform = entity.getComponent<engine::Transform3DComponent>();
+        const auto *rotation = std::get_if<glm::quat>(&value);
+        if (!transform || !rotation)
+            return false;
+
+        transform->setRotation(*rotation);
+        return true;
+    }
+
+    bool setTransformScale(engine::Entity &entity, const PropertyValue &value)
+    {
+        auto *transform = entity.getComponent<engine::Transform3DComponent>();
+        const auto *scale = std::get_if<glm::vec3>(&value);
+        if (!transform || !scale)
+            return false;
+
+        transform->setScale(*scale);
+        return true;
+    }
+} // namespace actions
+ELIX_NESTED_NAMESPACE_END
@@ -8,25 +8,30 @@ namespace actions
                                    std::string afterState,
                                    std::string label)
         : m_scene(scene),
-          m_beforeState(std::move(beforeState)),
-          m_afterState(std::move(afterState)),
+          m_beforeState(beforeState),
+          m_afterState(afterState),
           m_label(std::move(label))
     {
     }
 
     bool UIStateCommand::execute()
     {
-        return m_scene && m_scene->restoreUIState(m_afterState);
+        return m_scene && m_scene->restoreUIState(m_afterState.decompress());
     }
 
     bool UIStateCommand::undo()
     {
-        return m_scene && m_scene->restoreUIState(m_beforeState);
+        return m_scene && m_scene->restoreUIState(m_beforeState.decompress());
     }
 
     const char *UIStateCommand::getName() const
     {
         return m_label.c_str();
     }
+
+    std::size_t UIStateCommand::getMemoryUsage() const
+    {
+        return sizeof(*this) + m_beforeState.getMemoryUsage() + m_afterState.getMemoryUsage() + m_label.capacity();
+    }
 } // namespace actions
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,47 @@
+#include "Editor/Actions/CompressedSnapshot.hpp"
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+namespace actions
+{
+    namespace
+    {
+        // Small payloads do not win enough to pay for the compressor.
+        constexpr std::size_t MIN_COMPRESSED_PAYLOAD_SIZE = 256u;
+    } // namespace
+
+    CompressedSnapshot::CompressedSnapshot(const std::string &payload)
+        : m_uncompressedSize(payload.size())
+    {
+        const auto *bytes = reinterpret_cast<const std::uint8_t *>(payload.data());
+
+        if (payload.size() >= MIN_COMPRESSED_PAYLOAD_SIZE)
+        {
+            // LZ4 keeps undo recording cheap on large hierarchies; JSON still shrinks several times.
+            for (const auto algorithm : {engine::Compressor::Algorithm::LZ4, engine::Compressor::Algorithm::Deflate})
+            {
+                if (engine::Compressor::compress(bytes, payload.size(), m_bytes, algorithm) && m_bytes.size() < payload.size())
+                {
+                    m_algorithm = algorithm;
+                    m_bytes.shrink_to_fit();
+                    return;
+                }
+            }
+        }
+
+        m_algorithm = engine::Compressor::Algorithm::None;
+        m_bytes.assign(bytes, bytes + payload.size());
+    }
+
+    std::string CompressedSnapshot::decompress() const
+    {
+        if (m_algorithm == engine::Compressor::Algorithm::None)
+            return std::string(m_bytes.begin(), m_bytes.end());
+
+        std::vector<std::uint8_t> bytes;
+        if (!engine::Compressor::decompress(m_bytes, m_uncompressedSize, bytes, m_algorithm))
+            return {};
+
+        return std::string(bytes.begin(), bytes.end());
+    }
+} // namespace actions
+ELIX_NESTED_NAMESPACE_END
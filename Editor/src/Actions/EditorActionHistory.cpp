@@ -183,8 +183,9 @@ namespace actions
         }
     } // namespace
 
-    EditorCommandHistory::EditorCommandHistory(std::size_t maxEntries)
-        : m_maxEntries(std::max<std::size_t>(maxEntries, 1u))
+    EditorCommandHistory::EditorCommandHistory(std::size_t maxEntries, std::size_t maxMemoryBytes)
+        : m_maxEntries(std::max<std::size_t>(maxEntries, 1u)),
+          m_maxMemoryBytes(maxMemoryBytes)
     {
     }
 
@@ -193,7 +194,10 @@ namespace actions
     void EditorCommandHistory::clear()
     {
         m_commands.clear();
+        m_commandMemoryUsage.clear();
         m_nextCommandIndex = 0u;
+        m_memoryUsage = 0u;
+        m_coalescing = false;
     }
 
     void EditorCommandHistory::setMaxEntries(std::size_t maxEntries)
@@ -202,13 +206,18 @@ namespace actions
         trimHistoryToLimit();
     }
 
+    void EditorCommandHistory::setMaxMemoryBytes(std::size_t maxMemoryBytes)
+    {
+        m_maxMemoryBytes = maxMemoryBytes;
+        trimHistoryToLimit();
+    }
+
     bool EditorCommandHistory::execute(std::unique_ptr<IEditorCommand> command)
     {
         if (!command)
             return false;
 
-        if (m_nextCommandIndex < m_commands.size())
-            m_commands.erase(m_commands.begin() + static_cast<std::ptrdiff_t>(m_nextCommandIndex), m_commands.end());
+        discardRedoCommands();
 
         if (!command->execute())
         {
@@ -216,9 +225,9 @@ namespace actions
             return false;
         }
 
-        m_commands.push_back(std::move(command));
-        m_nextCommandIndex = m_commands.size();
-        trimHistoryToLimit();
+        if (!tryMergeIntoLast(*command))
+            pushCommand(std::move(command));
+
         return true;
     }
 
@@ -227,13 +236,54 @@ namespace actions
         if (!command)
             return false;
 
-        if (m_nextCommandIndex < m_commands.size())
-            m_commands.erase(m_commands.begin() + static_cast<std::ptrdiff_t>(m_nextCommandIndex), m_commands.end());
+        discardRedoCommands();
+
+        if (!tryMergeIntoLast(*command))
+            pushCommand(std::move(command));
+
+        return true;
+    }
+
+    void EditorCommandHistory::breakCoalescing()
+    {
+        m_coalescing = false;
+    }
+
+    void EditorCommandHistory::discardRedoCommands()
+    {
+        if (m_nextCommandIndex >= m_commands.size())
+            return;
+
+        for (std::size_t index = m_nextCommandIndex; index < m_commands.size(); ++index)
+            m_memoryUsage -= m_commandMemoryUsage[index];
+
+        m_commands.erase(m_commands.begin() + static_cast<std::ptrdiff_t>(m_nextCommandIndex), m_commands.end());
+        m_commandMemoryUsage.resize(m_nextCommandIndex);
+        m_coalescing = false;
+    }
+
+    bool EditorCommandHistory::tryMergeIntoLast(const IEditorCommand &command)
+    {
+        if (!m_coalescing || m_commands.empty() || !m_commands.back()->mergeWith(command))
+        {
+            m_coalescing = true;
+            return false;
+        }
+
+        const std::size_t memoryUsage = m_commands.back()->getMemoryUsage();
+        m_memoryUsage = m_memoryUsage - m_commandMemoryUsage.back() + memoryUsage;
+        m_commandMemoryUsage.back() = memoryUsage;
+        return true;
+    }
 
+    void EditorCommandHistory::pushCommand(std::unique_ptr<IEditorCommand> command)
+    {
+        const std::size_t memoryUsage = command->getMemoryUsage();
         m_commands.push_back(std::move(command));
+        m_commandMemoryUsage.push_back(memoryUsage);
+        m_memoryUsage += memoryUsage;
         m_nextCommandIndex = m_commands.size();
         trimHistoryToLimit();
-        return true;
     }
 
     bool EditorCommandHistory::canUndo() const
@@ -259,6 +309,7 @@ namespace actions
         }
 
         m_nextCommandIndex = commandIndex;
+        m_coalescing = false;
         return true;
     }
 
@@ -274,17 +325,29 @@ namespace actions
         }
 
         ++m_nextCommandIndex;
+        m_coalescing = false;
         return true;
     }
 
     void EditorCommandHistory::trimHistoryToLimit()
     {
-        while (m_commands.size() > m_maxEntries)
+        // The newest command is always kept, even if it alone exceeds the memory budget.
+        std::size_t dropCount = 0u;
+        std::size_t memoryUsage = m_memoryUsage;
+        while (m_commands.size() - dropCount > 1u &&
+               (m_commands.size() - dropCount > m_maxEntries || memoryUsage > m_maxMemoryBytes))
         {
-            m_commands.erase(m_commands.begin());
-            if (m_nextCommandIndex > 0u)
-                --m_nextCommandIndex;
+            memoryUsage -= m_commandMemoryUsage[dropCount];
+            ++dropCount;
         }
+
+        if (dropCount == 0u)
+            return;
+
+        m_commands.erase(m_commands.begin(), m_commands.begin() + static_cast<std::ptrdiff_t>(dropCount));
+        m_commandMemoryUsage.erase(m_commandMemoryUsage.begin(), m_commandMemoryUsage.begin() + static_cast<std::ptrdiff_t>(dropCount));
+        m_memoryUsage = memoryUsage;
+        m_nextCommandIndex = m_nextCommandIndex > dropCount ? m_nextCommandIndex - dropCount : 0u;
     }
 
     EditorEntityClipboard::EditorEntityClipboard() = default;
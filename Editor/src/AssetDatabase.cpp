@@ -0,0 +1,869 @@
+#include "Editor/AssetDatabase.hpp"
+
+#include "Core/Logger.hpp"
+#include "Engine/Assets/AssetsSerializer.hpp"
+#include "Engine/Threads/ThreadPoolManager.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+
+namespace
+{
+    constexpr char DATABASE_FILE_MAGIC[4] = {'V', 'X', 'A', 'D'};
+    constexpr const char *DATABASE_DIRECTORY = ".velixcache";
+    constexpr const char *DATABASE_FILE_NAME = "AssetDatabase.bin";
+
+    std::string toLowerCopy(std::string value)
+    {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char character)
+                       { return static_cast<char>(std::tolower(character)); });
+        return value;
+    }
+
+    bool isHiddenName(const std::string &name)
+    {
+        return !name.empty() && name.front() == '.';
+    }
+
+    bool isUnderPath(const std::string &path, const std::string &root)
+    {
+        if (root.empty())
+            return true;
+
+        return path.size() >= root.size() && path.compare(0, root.size(), root) == 0 &&
+               (path.size() == root.size() || path[root.size()] == '/');
+    }
+
+    std::string parentKey(const std::string &path)
+    {
+        const size_t separator = path.find_last_of('/');
+        return separator == std::string::npos ? std::string{} : path.substr(0, separator);
+    }
+
+    std::string joinKey(const std::string &parent, const std::string &name)
+    {
+        return parent.empty() ? name : parent + '/' + name;
+    }
+
+    // 64-bit FNV-1a over 8-byte words, so hashing a freshly imported project stays I/O bound.
+    uint64_t hashFileContents(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open())
+            return 0u;
+
+        constexpr uint64_t fnvPrime = 1099511628211ull;
+        uint64_t hash = 14695981039346656037ull;
+
+        std::vector<char> buffer(256u * 1024u);
+        while (file)
+        {
+            file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            const size_t readCount = static_cast<size_t>(file.gcount());
+
+            size_t offset = 0u;
+            for (; offset + sizeof(uint64_t) <= readCount; offset += sizeof(uint64_t))
+            {
+                uint64_t word = 0u;
+                std::memcpy(&word, buffer.data() + offset, sizeof(word));
+                hash = (hash ^ word) * fnvPrime;
+            }
+
+            for (; offset < readCount; ++offset)
+                hash = (hash ^ static_cast<unsigned char>(buffer[offset])) * fnvPrime;
+        }
+
+        return hash;
+    }
+
+    bool isDependencyReference(const std::string &value)
+    {
+        static const std::array<const char *, 4> assetExtensions = {".elixasset", ".elixmat", ".elixterrain", ".elixscene"};
+
+        if (value.empty() || value.size() > 1024u)
+            return false;
+
+        const std::string lower = toLowerCopy(value);
+        return std::any_of(assetExtensions.begin(), assetExtensions.end(), [&lower](const char *extension)
+                           {
+                               const size_t length = std::strlen(extension);
+                               return lower.size() > length && lower.compare(lower.size() - length, length, extension) == 0; });
+    }
+
+    void collectDependencies(const nlohmann::json &value, std::vector<std::string> &outDependencies)
+    {
+        if (value.is_string())
+        {
+            const std::string &text = value.get_ref<const std::string &>();
+            if (isDependencyReference(text) && std::find(outDependencies.begin(), outDependencies.end(), text) == outDependencies.end())
+                outDependencies.push_back(text);
+            return;
+        }
+
+        if (value.is_structured())
+        {
+            for (const auto &child : value)
+                collectDependencies(child, outDependencies);
+        }
+    }
+
+    // Materials, scenes and JSON terrains name the assets they use; binary assets are leaves.
+    bool hasJsonDependencies(const std::string &fileNameLower)
+    {
+        const auto endsWith = [&fileNameLower](const char *suffix)
+        {
+            const size_t length = std::strlen(suffix);
+            return fileNameLower.size() >= length && fileNameLower.compare(fileNameLower.size() - length, length, suffix) == 0;
+        };
+
+        return endsWith(".elixmat") || endsWith(".elixscene") || endsWith(".scene") || endsWith(".elixterrain.json");
+    }
+
+    // Size and modification time with a single stat where the platform allows it; validating a
+    // cached project is mostly this call.
+    bool readFileStamp(const std::filesystem::path &path, uint64_t &outSize, int64_t &outModifiedTime)
+    {
+#if defined(__linux__)
+        struct stat fileStatus{};
+        if (::stat(path.c_str(), &fileStatus) != 0)
+            return false;
+
+        outSize = static_cast<uint64_t>(fileStatus.st_size);
+        outModifiedTime = static_cast<int64_t>(fileStatus.st_mtim.tv_sec) * 1000000000ll + fileStatus.st_mtim.tv_nsec;
+        return true;
+#else
+        std::error_code errorCode;
+        outSize = static_cast<uint64_t>(std::filesystem::file_size(path, errorCode));
+        if (errorCode)
+            return false;
+
+        const auto writeTime = std::filesystem::last_write_time(path, errorCode);
+        outModifiedTime = errorCode ? 0 : static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+#endif
+    }
+
+    template <typename T>
+    void writeValue(std::ofstream &stream, const T &value)
+    {
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    void writeString(std::ofstream &stream, const std::string &value)
+    {
+        writeValue(stream, static_cast<uint32_t>(value.size()));
+        stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream &stream, T &outValue)
+    {
+        return static_cast<bool>(stream.read(reinterpret_cast<char *>(&outValue), sizeof(T)));
+    }
+
+    bool readString(std::ifstream &stream, std::string &outValue)
+    {
+        uint32_t length = 0u;
+        if (!readValue(stream, length) || length > (1u << 20u))
+            return false;
+
+        outValue.resize(length);
+        return static_cast<bool>(stream.read(outValue.data(), static_cast<std::streamsize>(length)));
+    }
+} // namespace
+
+std::string AssetRecord::getFileName() const
+{
+    const size_t separator = path.find_last_of('/');
+    return separator == std::string::npos ? path : path.substr(separator + 1u);
+}
+
+#if defined(__linux__)
+
+// Owns the inotify descriptor and its thread. inotify is not recursive, so every indexed
+// folder gets its own watch; folders created later are added as their events arrive.
+struct AssetDatabase::Watcher
+{
+    std::filesystem::path root;
+    int inotifyFd{-1};
+    std::unordered_map<int, std::string> foldersByWatch;
+    std::thread thread;
+    std::atomic<bool> stopRequested{false};
+    bool reportedWatchLimit{false};
+
+    std::mutex mutex;
+    std::unordered_set<std::string> changedPaths;
+    bool overflowed{false};
+
+    static constexpr uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB |
+                                           IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+
+    bool start(const std::filesystem::path &projectRoot)
+    {
+        root = projectRoot;
+        inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd < 0)
+        {
+            VX_EDITOR_WARNING_STREAM("Asset database: inotify is unavailable (" << std::strerror(errno) << "), changes need a manual refresh\n");
+            return false;
+        }
+
+        thread = std::thread([this]()
+                             { run(); });
+        return true;
+    }
+
+    void stop()
+    {
+        stopRequested.store(true, std::memory_order_release);
+        if (thread.joinable())
+            thread.join();
+
+        if (inotifyFd >= 0)
+            ::close(inotifyFd);
+        inotifyFd = -1;
+    }
+
+    void watchTree(const std::string &relativeFolder)
+    {
+        std::vector<std::string> pending{relativeFolder};
+        while (!pending.empty())
+        {
+            const std::string folder = std::move(pending.back());
+            pending.pop_back();
+
+            const std::filesystem::path absoluteFolder = folder.empty() ? root : root / folder;
+            const int watch = inotify_add_watch(inotifyFd, absoluteFolder.c_str(), WATCH_MASK | IN_ONLYDIR);
+            if (watch < 0)
+            {
+                if (errno == ENOSPC && !reportedWatchLimit)
+                {
+                    reportedWatchLimit = true;
+                    VX_EDITOR_WARNING_STREAM("Asset database: inotify watch limit reached (fs.inotify.max_user_watches), "
+                                             "some folders need a manual refresh\n");
+                }
+                continue;
+            }
+
+            foldersByWatch[watch] = folder;
+
+            std::error_code errorCode;
+            for (std::filesystem::directory_iterator iterator(absoluteFolder, errorCode);
+                 !errorCode && iterator != std::filesystem::directory_iterator();
+                 iterator.increment(errorCode))
+            {
+                std::error_code typeError;
+                if (!iterator->is_directory(typeError) || typeError || iterator->is_symlink(typeError))
+                    continue;
+
+                const std::string name = iterator->path().filename().string();
+                if (isHiddenName(name) || AssetDatabase::isExcludedDirectoryName(name))
+                    continue;
+
+                pending.push_back(joinKey(folder, name));
+            }
+        }
+    }
+
+    void run()
+    {
+        watchTree({});
+
+        alignas(inotify_event) std::array<char, 64u * 1024u> buffer{};
+        while (!stopRequested.load(std::memory_order_acquire))
+        {
+            pollfd descriptor{inotifyFd, POLLIN, 0};
+            if (::poll(&descriptor, 1, 100) <= 0)
+                continue;
+
+            const ssize_t readCount = ::read(inotifyFd, buffer.data(), buffer.size());
+            if (readCount <= 0)
+                continue;
+
+            std::vector<std::string> changes;
+            bool queueOverflowed = false;
+
+            for (ssize_t offset = 0; offset < readCount;)
+            {
+                const auto *event = reinterpret_cast<const inotify_event *>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    queueOverflowed = true;
+                    continue;
+                }
+
+                const auto folderIt = foldersByWatch.find(event->wd);
+                if (folderIt == foldersByWatch.end())
+                    continue;
+
+                const std::string folder = folderIt->second;
+                if (event->mask & IN_IGNORED)
+                {
+                    foldersByWatch.erase(folderIt);
+                    continue;
+                }
+
+                if (event->len == 0u)
+                {
+                    // The watched folder itself was deleted or moved away.
+                    changes.push_back(folder);
+                    continue;
+                }
+
+                const std::string name = event->name;
+                const bool isFolder = (event->mask & IN_ISDIR) != 0u;
+                if (isHiddenName(name) || (isFolder && AssetDatabase::isExcludedDirectoryName(name)))
+                    continue;
+
+                const std::string path = joinKey(folder, name);
+                if (isFolder && (event->mask & (IN_CREATE | IN_MOVED_TO)))
+                    watchTree(path);
+
+                changes.push_back(path);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            changedPaths.insert(changes.begin(), changes.end());
+            overflowed = overflowed || queueOverflowed;
+        }
+    }
+
+    void takeChanges(std::unordered_set<std::string> &outChangedPaths, bool &outOverflowed)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        outChangedPaths.merge(changedPaths);
+        changedPaths.clear();
+        outOverflowed = std::exchange(overflowed, false);
+    }
+};
+
+#else
+
+// No watcher on this platform yet; markChanged() and rescan() keep the index current.
+struct AssetDatabase::Watcher
+{
+    bool start(const std::filesystem::path &) { return false; }
+    void stop() {}
+    void takeChanges(std::unordered_set<std::string> &, bool &outOverflowed) { outOverflowed = false; }
+};
+
+#endif
+
+AssetDatabase::AssetDatabase() = default;
+
+AssetDatabase::~AssetDatabase()
+{
+    close();
+}
+
+bool AssetDatabase::isExcludedDirectoryName(const std::string &name)
+{
+    static const std::unordered_set<std::string> excludedNames = {
+        "build", "cmake-build-debug", "cmake-build-release",
+        "node_modules", "__pycache__", "out", "bin", "obj",
+        "Debug", "Release", "x64", "x86", "temp"};
+
+    return excludedNames.find(name) != excludedNames.end();
+}
+
+bool AssetDatabase::open(const std::filesystem::path &projectRoot)
+{
+    close();
+
+    std::error_code errorCode;
+    if (projectRoot.empty() || !std::filesystem::is_directory(projectRoot, errorCode) || errorCode)
+        return false;
+
+    m_projectRoot = std::filesystem::absolute(projectRoot, errorCode).lexically_normal();
+    if (errorCode)
+        m_projectRoot = projectRoot.lexically_normal();
+    if (!m_projectRoot.has_filename() && m_projectRoot.has_parent_path())
+        m_projectRoot = m_projectRoot.parent_path();
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const bool loaded = load();
+    const size_t cachedCount = m_records.size();
+
+    // Watch before validating, so nothing written during the scan is missed.
+    auto watcher = std::make_unique<Watcher>();
+    if (watcher->start(m_projectRoot))
+        m_watcher = std::move(watcher);
+
+    reconcile({});
+
+    const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+    VX_EDITOR_INFO_STREAM("Asset database: " << m_records.size() << " entries in " << elapsedMs << " ms"
+                                             << (loaded ? " (" + std::to_string(cachedCount) + " cached)" : std::string(" (new)")) << '\n');
+
+    if (m_dirty)
+        save();
+
+    return true;
+}
+
+void AssetDatabase::close()
+{
+    if (m_watcher)
+    {
+        m_watcher->stop();
+        m_watcher.reset();
+    }
+
+    if (isOpen() && m_dirty)
+        save();
+
+    m_records.clear();
+    m_children.clear();
+    m_markedPaths.clear();
+    m_projectRoot.clear();
+    m_dirty = false;
+    ++m_revision;
+}
+
+bool AssetDatabase::isWatching() const
+{
+    return m_watcher != nullptr;
+}
+
+std::filesystem::path AssetDatabase::getDatabaseFilePath() const
+{
+    return m_projectRoot / DATABASE_DIRECTORY / DATABASE_FILE_NAME;
+}
+
+bool AssetDatabase::load()
+{
+    std::ifstream file(getDatabaseFilePath(), std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    char magic[4]{};
+    uint32_t version = 0u;
+    uint64_t recordCount = 0u;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, DATABASE_FILE_MAGIC, sizeof(magic)) != 0 ||
+        !readValue(file, version) || version != FILE_VERSION || !readValue(file, recordCount))
+    {
+        VX_EDITOR_WARNING_STREAM("Asset database: ignoring incompatible " << getDatabaseFilePath() << '\n');
+        return false;
+    }
+
+    m_records.reserve(static_cast<size_t>(recordCount));
+    for (uint64_t recordIndex = 0; recordIndex < recordCount; ++recordIndex)
+    {
+        AssetRecord record;
+        uint8_t isDirectory = 0u;
+        uint8_t type = 0u;
+        uint32_t dependencyCount = 0u;
+
+        bool valid = readString(file, record.path) && readValue(file, isDirectory) && readValue(file, type) &&
+                     readValue(file, record.size) && readValue(file, record.modifiedTime) &&
+                     readValue(file, record.contentHash) && readValue(file, dependencyCount) && dependencyCount <= 4096u;
+
+        record.dependencies.resize(valid ? dependencyCount : 0u);
+        for (auto &dependency : record.dependencies)
+            valid = valid && readString(file, dependency);
+
+        if (!valid)
+        {
+            VX_EDITOR_WARNING_STREAM("Asset database: " << getDatabaseFilePath() << " is truncated, rebuilding\n");
+            m_records.clear();
+            m_children.clear();
+            return false;
+        }
+
+        record.isDirectory = isDirectory != 0u;
+        record.type = static_cast<engine::Asset::AssetType>(type);
+        insertRecord(std::move(record));
+    }
+
+    return true;
+}
+
+bool AssetDatabase::save()
+{
+    if (!isOpen())
+        return false;
+
+    const std::filesystem::path databasePath = getDatabaseFilePath();
+    const std::filesystem::path temporaryPath = databasePath.string() + ".tmp";
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(databasePath.parent_path(), errorCode);
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            VX_EDITOR_WARNING_STREAM("Asset database: cannot write " << temporaryPath << '\n');
+            return false;
+        }
+
+        file.write(DATABASE_FILE_MAGIC, sizeof(DATABASE_FILE_MAGIC));
+        writeValue(file, FILE_VERSION);
+        writeValue(file, static_cast<uint64_t>(m_records.size()));
+
+        for (const auto &[_, record] : m_records)
+        {
+            writeString(file, record.path);
+            writeValue(file, static_cast<uint8_t>(record.isDirectory ? 1u : 0u));
+            writeValue(file, static_cast<uint8_t>(record.type));
+            writeValue(file, record.size);
+            writeValue(file, record.modifiedTime);
+            writeValue(file, record.contentHash);
+            writeValue(file, static_cast<uint32_t>(record.dependencies.size()));
+            for (const auto &dependency : record.dependencies)
+                writeString(file, dependency);
+        }
+
+        if (!file)
+            return false;
+    }
+
+    // Replace atomically so a crash mid-write leaves the previous index intact.
+    std::filesystem::rename(temporaryPath, databasePath, errorCode);
+    if (errorCode)
+    {
+        VX_EDITOR_WARNING_STREAM("Asset database: cannot replace " << databasePath << ": " << errorCode.message() << '\n');
+        return false;
+    }
+
+    m_dirty = false;
+    return true;
+}
+
+void AssetDatabase::rescan()
+{
+    if (!isOpen())
+        return;
+
+    m_markedPaths.clear();
+    reconcile({});
+}
+
+void AssetDatabase::markChanged(const std::filesystem::path &path)
+{
+    if (!isOpen())
+        return;
+
+    const std::string key = toRelativeKey(path);
+    if (key != "..")
+        m_markedPaths.insert(key);
+}
+
+bool AssetDatabase::processChanges()
+{
+    if (!isOpen())
+        return false;
+
+    std::unordered_set<std::string> changedPaths = std::move(m_markedPaths);
+    m_markedPaths.clear();
+
+    bool overflowed = false;
+    if (m_watcher)
+        m_watcher->takeChanges(changedPaths, overflowed);
+
+    if (overflowed)
+    {
+        VX_EDITOR_WARNING_STREAM("Asset database: watcher queue overflowed, rescanning\n");
+        return reconcile({});
+    }
+
+    if (changedPaths.empty())
+        return false;
+
+    // A folder's reconcile covers everything under it.
+    std::vector<std::string> roots(changedPaths.begin(), changedPaths.end());
+    std::sort(roots.begin(), roots.end());
+
+    bool changed = false;
+    std::string lastRoot;
+    bool hasLastRoot = false;
+    for (const auto &root : roots)
+    {
+        if (hasLastRoot && isUnderPath(root, lastRoot))
+            continue;
+
+        changed = reconcile(root) || changed;
+        lastRoot = root;
+        hasLastRoot = true;
+    }
+
+    return changed;
+}
+
+void AssetDatabase::gatherEntries(const std::string &relativePath, std::vector<ScanEntry> &outEntries) const
+{
+    const std::filesystem::path absolutePath = relativePath.empty() ? m_projectRoot : m_projectRoot / relativePath;
+
+    std::error_code errorCode;
+    const auto status = std::filesystem::status(absolutePath, errorCode);
+    if (errorCode || !std::filesystem::exists(status))
+        return;
+
+    if (!relativePath.empty())
+    {
+        // Changes inside skipped folders are not indexed.
+        for (const auto &part : std::filesystem::path(relativePath))
+        {
+            const std::string name = part.string();
+            if (isHiddenName(name) || AssetDatabase::isExcludedDirectoryName(name))
+                return;
+        }
+    }
+
+    if (!std::filesystem::is_directory(status))
+    {
+        if (std::filesystem::is_regular_file(status))
+            outEntries.push_back({relativePath, false});
+        return;
+    }
+
+    outEntries.push_back({relativePath, true});
+
+    const size_t rootLength = m_projectRoot.generic_string().size() + 1u;
+    for (std::filesystem::recursive_directory_iterator iterator(absolutePath, std::filesystem::directory_options::skip_permission_denied, errorCode);
+         !errorCode && iterator != std::filesystem::recursive_directory_iterator();
+         iterator.increment(errorCode))
+    {
+        const auto &entry = *iterator;
+        const std::string name = entry.path().filename().string();
+
+        std::error_code typeError;
+        const bool isDirectory = entry.is_directory(typeError) && !typeError;
+        if (isHiddenName(name) || (isDirectory && isExcludedDirectoryName(name)))
+        {
+            if (isDirectory)
+                iterator.disable_recursion_pending();
+            continue;
+        }
+
+        if (!isDirectory && !(entry.is_regular_file(typeError) && !typeError))
+            continue;
+
+        outEntries.push_back({entry.path().generic_string().substr(rootLength), isDirectory});
+    }
+}
+
+AssetRecord AssetDatabase::validateEntry(const ScanEntry &entry) const
+{
+    AssetRecord record;
+    record.path = entry.path;
+    record.isDirectory = entry.isDirectory;
+    if (entry.isDirectory)
+        return record;
+
+    const std::filesystem::path absolutePath = m_projectRoot / entry.path;
+    if (!readFileStamp(absolutePath, record.size, record.modifiedTime))
+        return record;
+
+    const auto cached = m_records.find(entry.path);
+    if (cached != m_records.end() && !cached->second.isDirectory &&
+        cached->second.size == record.size && cached->second.modifiedTime == record.modifiedTime)
+        return cached->second;
+
+    const std::string fileNameLower = toLowerCopy(absolutePath.filename().string());
+    if (absolutePath.extension() == ".elixasset")
+    {
+        engine::AssetsSerializer serializer;
+        if (const auto header = serializer.readHeader(absolutePath.string()); header.has_value())
+            record.type = static_cast<engine::Asset::AssetType>(header->type);
+    }
+    else if (hasJsonDependencies(fileNameLower))
+    {
+        std::ifstream file(absolutePath);
+        const nlohmann::json json = nlohmann::json::parse(file, nullptr, false);
+        if (!json.is_discarded())
+            collectDependencies(json, record.dependencies);
+    }
+
+    record.contentHash = hashFileContents(absolutePath);
+    return record;
+}
+
+bool AssetDatabase::reconcile(const std::string &relativePath)
+{
+    std::vector<ScanEntry> entries;
+    gatherEntries(relativePath, entries);
+
+    // Stat, and read only what changed, on the job system. m_records is only read here.
+    std::vector<AssetRecord> validated(entries.size());
+    engine::ThreadPoolManager::instance().parallelFor(entries.size(), [&](size_t begin, size_t end)
+                                                      {
+                                                          for (size_t entryIndex = begin; entryIndex < end; ++entryIndex)
+                                                              validated[entryIndex] = validateEntry(entries[entryIndex]); });
+
+    bool changed = false;
+
+    std::unordered_set<std::string> presentPaths;
+    presentPaths.reserve(entries.size());
+    for (const auto &entry : entries)
+        presentPaths.insert(entry.path);
+
+    std::vector<std::string> removedPaths;
+    for (const auto &[path, _] : m_records)
+    {
+        if (isUnderPath(path, relativePath) && presentPaths.find(path) == presentPaths.end())
+            removedPaths.push_back(path);
+    }
+
+    for (const auto &path : removedPaths)
+        eraseRecord(path);
+    changed = !removedPaths.empty();
+
+    for (auto &record : validated)
+    {
+        const auto existing = m_records.find(record.path);
+        if (existing != m_records.end() &&
+            existing->second.isDirectory == record.isDirectory &&
+            existing->second.size == record.size &&
+            existing->second.modifiedTime == record.modifiedTime &&
+            existing->second.contentHash == record.contentHash)
+            continue;
+
+        insertRecord(std::move(record));
+        changed = true;
+    }
+
+    if (changed)
+    {
+        ++m_revision;
+        m_dirty = true;
+    }
+
+    return changed;
+}
+
+void AssetDatabase::insertRecord(AssetRecord &&record)
+{
+    const std::string path = record.path;
+    const auto [it, inserted] = m_records.insert_or_assign(path, std::move(record));
+    (void)it;
+
+    if (inserted && !path.empty())
+        m_children[parentKey(path)].push_back(path);
+}
+
+void AssetDatabase::eraseRecord(const std::string &relativePath)
+{
+    if (m_records.erase(relativePath) == 0u)
+        return;
+
+    m_children.erase(relativePath);
+    if (relativePath.empty())
+        return;
+
+    const auto siblings = m_children.find(parentKey(relativePath));
+    if (siblings == m_children.end())
+        return;
+
+    auto &paths = siblings->second;
+    paths.erase(std::remove(paths.begin(), paths.end(), relativePath), paths.end());
+}
+
+std::string AssetDatabase::toRelativeKey(const std::filesystem::path &path) const
+{
+    if (path.is_relative())
+    {
+        const std::string key = path.lexically_normal().generic_string();
+        return key == "." ? std::string{} : key;
+    }
+
+    const std::filesystem::path relative = path.lexically_normal().lexically_relative(m_projectRoot);
+    const std::string key = relative.generic_string();
+    if (relative.empty() || key.rfind("..", 0) == 0)
+        return "..";
+
+    return key == "." ? std::string{} : key;
+}
+
+std::filesystem::path AssetDatabase::getAbsolutePath(const AssetRecord &record) const
+{
+    return record.path.empty() ? m_projectRoot : m_projectRoot / record.path;
+}
+
+const AssetRecord *AssetDatabase::find(const std::filesystem::path &path) const
+{
+    const auto it = m_records.find(toRelativeKey(path));
+    return it == m_records.end() ? nullptr : &it->second;
+}
+
+std::vector<const AssetRecord *> AssetDatabase::getChildren(const std::filesystem::path &directory) const
+{
+    std::vector<const AssetRecord *> children;
+
+    const auto it = m_children.find(toRelativeKey(directory));
+    if (it == m_children.end())
+        return children;
+
+    children.reserve(it->second.size());
+    for (const auto &childPath : it->second)
+    {
+        if (const auto record = m_records.find(childPath); record != m_records.end())
+            children.push_back(&record->second);
+    }
+
+    return children;
+}
+
+std::vector<const AssetRecord *> AssetDatabase::findByType(engine::Asset::AssetType type) const
+{
+    std::vector<const AssetRecord *> records;
+    for (const auto &[_, record] : m_records)
+    {
+        if (!record.isDirectory && record.type == type)
+            records.push_back(&record);
+    }
+
+    return records;
+}
+
+std::vector<const AssetRecord *> AssetDatabase::findDependents(const std::filesystem::path &path) const
+{
+    std::vector<const AssetRecord *> dependents;
+
+    const std::string key = toRelativeKey(path);
+    const std::string fileName = std::filesystem::path(key).filename().string();
+    for (const auto &[_, record] : m_records)
+    {
+        // References are stored as written: project-relative, absolute or next to the referencing file.
+        const bool references = std::any_of(record.dependencies.begin(), record.dependencies.end(), [&](const std::string &dependency)
+                                            {
+                                                if (dependency == key)
+                                                    return true;
+
+                                                const std::filesystem::path dependencyPath(dependency);
+                                                if (dependencyPath.is_absolute())
+                                                    return toRelativeKey(dependencyPath) == key;
+
+                                                return dependencyPath.filename() == fileName &&
+                                                       joinKey(parentKey(record.path), dependency) == key; });
+        if (references)
+            dependents.push_back(&record);
+    }
+
+    return dependents;
+}
+
+ELIX_NESTED_NAMESPACE_END
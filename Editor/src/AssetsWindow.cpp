@@ -600,6 +600,13 @@ void AssetsWindow::draw()
     if (!m_currentProject)
         return;
 
+    if (auto *assetDatabase = getAssetDatabase(); assetDatabase && assetDatabase->getRevision() != m_treeRevision)
+    {
+        buildDirectoryTree();
+        if (!m_selectedAssetPath.empty() && !assetDatabase->find(m_selectedAssetPath))
+            setSelectedAssetPath({});
+    }
+
     drawSearchBar();
 
     ImGui::Separator();
@@ -756,6 +763,9 @@ void AssetsWindow::drawSearchBar()
 
     if (ImGui::Button("Refresh"))
     {
+        if (auto *assetDatabase = getAssetDatabase())
+            assetDatabase->rescan();
+
         refreshCurrentDirectory();
         refreshTree();
     }
@@ -900,9 +910,6 @@ void AssetsWindow::drawTreeView()
         if (!node)
             return;
 
-        if (m_excludedDirectories.find(node->name) != m_excludedDirectories.end())
-            return;
-
         ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow |
                                    ImGuiTreeNodeFlags_OpenOnDoubleClick |
                                    ImGuiTreeNodeFlags_SpanFullWidth;
@@ -946,10 +953,7 @@ void AssetsWindow::drawTreeView()
 void AssetsWindow::drawAssetGrid()
 {
     const bool showAssetThumbnails = engine::EngineConfig::instance().getShowAssetThumbnails();
-    auto entries = getFilteredEntries();
-
-    if (!m_selectedAssetPath.empty() && !std::filesystem::exists(m_selectedAssetPath))
-        setSelectedAssetPath({});
+    const auto &entries = getFilteredEntries();
 
     const bool assetGridFocused = ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows);
     if (assetGridFocused && !m_selectedAssetPath.empty() && ImGui::IsKeyPressed(ImGuiKey_F2, false))
@@ -969,198 +973,221 @@ void AssetsWindow::drawAssetGrid()
     }
     else
     {
-        float windowWidth = ImGui::GetContentRegionAvail().x;
-        float itemWidth = 80.0f;
-        int columns = std::max(1, (int)(windowWidth / itemWidth));
+        constexpr float itemWidth = 80.0f;
+        constexpr float iconSize = 58.0f; // drawAssetGridIcon's button
+        constexpr int labelLines = 2;
+        const ImVec2 cellSpacing(8.0f, 8.0f);
 
-        ImGui::Columns(columns, "AssetsColumns", false);
+        const int columns = std::max(1, static_cast<int>(ImGui::GetContentRegionAvail().x / itemWidth));
+        const int rowCount = static_cast<int>((entries.size() + static_cast<size_t>(columns) - 1u) / static_cast<size_t>(columns));
+        const float labelWidth = itemWidth - cellSpacing.x;
+        const float labelHeight = ImGui::GetTextLineHeight() * static_cast<float>(labelLines);
+        const float rowHeight = iconSize + cellSpacing.y + labelHeight + cellSpacing.y;
+        const float rowStartX = ImGui::GetCursorPosX();
 
-        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(8, 8));
+        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, cellSpacing);
 
-        for (const auto &entry : entries)
+        // Only rows in view are submitted, so thumbnails are requested only for visible cells.
+        ImGuiListClipper clipper;
+        clipper.Begin(rowCount, rowHeight);
+        while (clipper.Step())
         {
-            const auto assetPath = entry.path();
-            std::string id = assetPath.string();
-            ImGui::PushID(id.c_str());
+            for (int rowIndex = clipper.DisplayStart; rowIndex < clipper.DisplayEnd; ++rowIndex)
+            {
+                for (int columnIndex = 0; columnIndex < columns; ++columnIndex)
+                {
+                    const size_t entryIndex = static_cast<size_t>(rowIndex) * static_cast<size_t>(columns) + static_cast<size_t>(columnIndex);
+                    if (entryIndex >= entries.size())
+                        break;
 
-            ImGui::BeginGroup();
+                    const auto &entry = entries[entryIndex];
 
-            VkDescriptorSet icon = VK_NULL_HANDLE;
-            BuiltinAssetIcon builtinIcon = entry.is_directory() ? BuiltinAssetIcon::Folder : BuiltinAssetIcon::File;
-            std::string filename = assetPath.filename().string();
-            std::string extension = assetPath.extension().string();
-            std::string extensionLower = toLowerCopy(extension);
-            const auto serializedAssetType = entry.is_directory()
-                                                 ? engine::Asset::AssetType::NONE
-                                                 : readSerializedAssetType(assetPath).value_or(engine::Asset::AssetType::NONE);
+                    if (columnIndex > 0)
+                        ImGui::SameLine(rowStartX + static_cast<float>(columnIndex) * itemWidth);
 
-            if (entry.is_directory())
-            {
-                icon = VK_NULL_HANDLE;
-            }
-            else
-            {
-                if (showAssetThumbnails)
-                {
-                    if (extensionLower == ".elixmat")
-                        icon = m_assetsPreviewSystem.getOrRequestMaterialPreview(assetPath.string());
-                    else if (serializedAssetType == engine::Asset::AssetType::TEXTURE)
-                        icon = m_assetsPreviewSystem.getOrRequestTexturePreview(assetPath.string());
-                    else if (serializedAssetType == engine::Asset::AssetType::MODEL)
-                        icon = m_assetsPreviewSystem.getOrRequestModelPreview(assetPath.string());
-                }
-            }
+                    const auto &assetPath = entry.path;
+                    ImGui::PushID(entry.pathString.c_str());
 
-            const bool isSelected = (!m_selectedAssetPath.empty() && m_selectedAssetPath == assetPath)
-                                    || m_multiSelectedPaths.count(assetPath.string()) > 0;
+                    ImGui::BeginGroup();
 
-            drawAssetGridIcon(icon, builtinIcon, isSelected);
+                    VkDescriptorSet icon = VK_NULL_HANDLE;
+                    BuiltinAssetIcon builtinIcon = entry.isDirectory ? BuiltinAssetIcon::Folder : BuiltinAssetIcon::File;
+                    const std::string &filename = entry.fileName;
+                    const std::string &extensionLower = entry.extensionLower;
+                    const auto serializedAssetType = entry.type;
 
-            if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
-            {
-                if (entry.is_directory())
-                    navigateToDirectory(assetPath);
-                else
-                {
-                    if (extensionLower == ".elixmat" && m_onMaterialOpenRequestFunction)
-                        m_onMaterialOpenRequestFunction(assetPath);
-                    else if ((extensionLower == ".elixscene" || extensionLower == ".scene") && m_onSceneOpenRequestFunction)
-                        m_onSceneOpenRequestFunction(assetPath);
-                    else if (serializedAssetType == engine::Asset::AssetType::ANIMATION_TREE && m_onAnimationTreeOpenRequestFunction)
-                        m_onAnimationTreeOpenRequestFunction(assetPath);
+                    if (entry.isDirectory)
+                    {
+                        icon = VK_NULL_HANDLE;
+                    }
                     else
                     {
-                        const bool isTextEditable =
-                            m_shaderExtensions.find(extensionLower) != m_shaderExtensions.end() ||
-                            m_cppExtensions.find(extensionLower) != m_cppExtensions.end() ||
-                            m_headerExtensions.find(extensionLower) != m_headerExtensions.end() ||
-                            m_configExtensions.find(extensionLower) != m_configExtensions.end() ||
-                            (m_sceneExtensions.find(extensionLower) != m_sceneExtensions.end() && !m_onSceneOpenRequestFunction) ||
-                            m_velixExtensions.find(extensionLower) != m_velixExtensions.end();
-
-                        if (isTextEditable && m_onTextAssetOpenRequestFunction)
-                            m_onTextAssetOpenRequestFunction(assetPath);
+                        if (showAssetThumbnails)
+                        {
+                            if (extensionLower == ".elixmat")
+                                icon = m_assetsPreviewSystem.getOrRequestMaterialPreview(entry.pathString);
+                            else if (serializedAssetType == engine::Asset::AssetType::TEXTURE)
+                                icon = m_assetsPreviewSystem.getOrRequestTexturePreview(entry.pathString);
+                            else if (serializedAssetType == engine::Asset::AssetType::MODEL)
+                                icon = m_assetsPreviewSystem.getOrRequestModelPreview(entry.pathString);
+                        }
+                    }
+
+                    const bool isSelected = (!m_selectedAssetPath.empty() && m_selectedAssetPath == assetPath)
+                                            || m_multiSelectedPaths.count(entry.pathString) > 0;
+
+                    drawAssetGridIcon(icon, builtinIcon, isSelected);
+
+                    if (ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left))
+                    {
+                        if (entry.isDirectory)
+                            navigateToDirectory(assetPath);
+                        else
+                        {
+                            if (extensionLower == ".elixmat" && m_onMaterialOpenRequestFunction)
+                                m_onMaterialOpenRequestFunction(assetPath);
+                            else if ((extensionLower == ".elixscene" || extensionLower == ".scene") && m_onSceneOpenRequestFunction)
+                                m_onSceneOpenRequestFunction(assetPath);
+                            else if (serializedAssetType == engine::Asset::AssetType::ANIMATION_TREE && m_onAnimationTreeOpenRequestFunction)
+                                m_onAnimationTreeOpenRequestFunction(assetPath);
+                            else
+                            {
+                                const bool isTextEditable =
+                                    m_shaderExtensions.find(extensionLower) != m_shaderExtensions.end() ||
+                                    m_cppExtensions.find(extensionLower) != m_cppExtensions.end() ||
+                                    m_headerExtensions.find(extensionLower) != m_headerExtensions.end() ||
+                                    m_configExtensions.find(extensionLower) != m_configExtensions.end() ||
+                                    (m_sceneExtensions.find(extensionLower) != m_sceneExtensions.end() && !m_onSceneOpenRequestFunction) ||
+                                    m_velixExtensions.find(extensionLower) != m_velixExtensions.end();
+
+                                if (isTextEditable && m_onTextAssetOpenRequestFunction)
+                                    m_onTextAssetOpenRequestFunction(assetPath);
+                            }
+                        }
                     }
-                }
-            }
 
-            const std::string displayName = entry.is_directory() ? filename : makeDisplayName(assetPath);
-            ImGui::TextWrapped("%s", displayName.c_str());
+                    // Fixed-height label so every row has the same height, which the clipper relies on.
+                    const ImVec2 labelMin = ImGui::GetCursorScreenPos();
+                    const ImVec4 labelClip(labelMin.x, labelMin.y, labelMin.x + labelWidth, labelMin.y + labelHeight);
+                    ImGui::GetWindowDrawList()->AddText(ImGui::GetFont(), ImGui::GetFontSize(), labelMin,
+                                                        ImGui::GetColorU32(ImGuiCol_Text),
+                                                        entry.displayName.c_str(), entry.displayName.c_str() + entry.displayName.size(),
+                                                        labelWidth, &labelClip);
+                    ImGui::Dummy(ImVec2(labelWidth, labelHeight));
 
-            ImGui::EndGroup();
+                    ImGui::EndGroup();
 
-            const bool selectOnReleaseWithoutDrag =
-                ImGui::IsItemHovered() &&
-                ImGui::IsMouseReleased(ImGuiMouseButton_Left) &&
-                !ImGui::IsMouseDragPastThreshold(ImGuiMouseButton_Left);
+                    const bool selectOnReleaseWithoutDrag =
+                        ImGui::IsItemHovered() &&
+                        ImGui::IsMouseReleased(ImGuiMouseButton_Left) &&
+                        !ImGui::IsMouseDragPastThreshold(ImGuiMouseButton_Left);
 
-            if (selectOnReleaseWithoutDrag)
-            {
-                ImGuiIO &io = ImGui::GetIO();
-                if (io.KeyCtrl)
-                {
-                    // Ctrl+click: toggle this item in multi-selection
-                    const std::string key = assetPath.string();
-                    if (m_multiSelectedPaths.count(key))
-                        m_multiSelectedPaths.erase(key);
-                    else
+                    if (selectOnReleaseWithoutDrag)
                     {
-                        m_multiSelectedPaths.insert(key);
-                        m_multiSelectedPaths.insert(m_selectedAssetPath.string());
+                        ImGuiIO &io = ImGui::GetIO();
+                        if (io.KeyCtrl)
+                        {
+                            // Ctrl+click: toggle this item in multi-selection
+                            const std::string &key = entry.pathString;
+                            if (m_multiSelectedPaths.count(key))
+                                m_multiSelectedPaths.erase(key);
+                            else
+                            {
+                                m_multiSelectedPaths.insert(key);
+                                m_multiSelectedPaths.insert(m_selectedAssetPath.string());
+                            }
+                            setSelectedAssetPath(assetPath);
+                        }
+                        else if (io.KeyShift && !m_lastClickedPath.empty())
+                        {
+                            // Shift+click: range select between last clicked and current
+                            m_multiSelectedPaths.clear();
+                            bool inRange = false;
+                            for (const auto &rangeEntry : entries)
+                            {
+                                const auto &rp = rangeEntry.path;
+                                const bool isAnchor = rp == m_lastClickedPath;
+                                const bool isCurrent = rp == assetPath;
+                                if (isAnchor || isCurrent)
+                                {
+                                    m_multiSelectedPaths.insert(rp.string());
+                                    if (inRange)
+                                        break;
+                                    inRange = true;
+                                }
+                                else if (inRange)
+                                    m_multiSelectedPaths.insert(rp.string());
+                            }
+                            setSelectedAssetPath(assetPath);
+                        }
+                        else
+                        {
+                            // Plain click: clear multi-selection
+                            m_multiSelectedPaths.clear();
+                            setSelectedAssetPath(assetPath);
+                            m_lastClickedPath = assetPath;
+                        }
                     }
-                    setSelectedAssetPath(assetPath);
-                }
-                else if (io.KeyShift && !m_lastClickedPath.empty())
-                {
-                    // Shift+click: range select between last clicked and current
-                    m_multiSelectedPaths.clear();
-                    bool inRange = false;
-                    for (const auto &rangeEntry : entries)
+
+                    if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
                     {
-                        const auto &rp = rangeEntry.path();
-                        const bool isAnchor = rp == m_lastClickedPath;
-                        const bool isCurrent = rp == assetPath;
-                        if (isAnchor || isCurrent)
+                        // If right-clicking on an item not in multi-selection, reset to single
+                        if (m_multiSelectedPaths.empty() || m_multiSelectedPaths.count(entry.pathString) == 0)
                         {
-                            m_multiSelectedPaths.insert(rp.string());
-                            if (inRange)
-                                break;
-                            inRange = true;
+                            m_multiSelectedPaths.clear();
+                            setSelectedAssetPath(assetPath);
                         }
-                        else if (inRange)
-                            m_multiSelectedPaths.insert(rp.string());
+                        m_contextAssetPath = assetPath;
+                        ImGui::OpenPopup("AssetItemContextMenu");
                     }
-                    setSelectedAssetPath(assetPath);
-                }
-                else
-                {
-                    // Plain click: clear multi-selection
-                    m_multiSelectedPaths.clear();
-                    setSelectedAssetPath(assetPath);
-                    m_lastClickedPath = assetPath;
-                }
-            }
 
-            if (ImGui::IsItemClicked(ImGuiMouseButton_Right))
-            {
-                // If right-clicking on an item not in multi-selection, reset to single
-                if (m_multiSelectedPaths.empty() || m_multiSelectedPaths.count(assetPath.string()) == 0)
-                {
-                    m_multiSelectedPaths.clear();
-                    setSelectedAssetPath(assetPath);
-                }
-                m_contextAssetPath = assetPath;
-                ImGui::OpenPopup("AssetItemContextMenu");
-            }
+                    if (ImGui::IsItemHovered())
+                    {
+                        ImGui::BeginTooltip();
 
-            if (ImGui::IsItemHovered())
-            {
-                ImGui::BeginTooltip();
+                        if (entry.isDirectory)
+                        {
+                            ImGui::Text("Folder: %s", filename.c_str());
+                            ImGui::Text("Path: %s", assetPath.parent_path().string().c_str());
+                        }
+                        else
+                        {
+                            ImGui::Text("File: %s", filename.c_str());
+                            ImGui::Text("Size: %s", formatFileSize(entry.size).c_str());
+
+                            std::string typeLabel = assetPath.extension().string();
+                            if (serializedAssetType == engine::Asset::AssetType::TEXTURE)
+                                typeLabel = "Texture Asset";
+                            else if (serializedAssetType == engine::Asset::AssetType::MODEL)
+                                typeLabel = "Model Asset";
+                            else if (serializedAssetType == engine::Asset::AssetType::MATERIAL)
+                                typeLabel = "Material Asset";
+                            else if (serializedAssetType == engine::Asset::AssetType::AUDIO)
+                                typeLabel = "Audio Asset";
+                            else if (serializedAssetType == engine::Asset::AssetType::ANIMATION)
+                                typeLabel = "Animation Asset";
+                            else if (serializedAssetType == engine::Asset::AssetType::ANIMATION_TREE)
+                                typeLabel = "Animation Tree Asset";
+
+                            ImGui::Text("Type: %s", typeLabel.c_str());
+                        }
 
-                if (entry.is_directory())
-                {
-                    ImGui::Text("Folder: %s", filename.c_str());
-                    ImGui::Text("Path: %s", assetPath.parent_path().string().c_str());
-                }
-                else
-                {
-                    ImGui::Text("File: %s", filename.c_str());
-                    ImGui::Text("Size: %s", formatFileSize(entry.file_size()).c_str());
-
-                    std::string typeLabel = extension;
-                    if (serializedAssetType == engine::Asset::AssetType::TEXTURE)
-                        typeLabel = "Texture Asset";
-                    else if (serializedAssetType == engine::Asset::AssetType::MODEL)
-                        typeLabel = "Model Asset";
-                    else if (serializedAssetType == engine::Asset::AssetType::MATERIAL)
-                        typeLabel = "Material Asset";
-                    else if (serializedAssetType == engine::Asset::AssetType::AUDIO)
-                        typeLabel = "Audio Asset";
-                    else if (serializedAssetType == engine::Asset::AssetType::ANIMATION)
-                        typeLabel = "Animation Asset";
-                    else if (serializedAssetType == engine::Asset::AssetType::ANIMATION_TREE)
-                        typeLabel = "Animation Tree Asset";
-
-                    ImGui::Text("Type: %s", typeLabel.c_str());
-                }
+                        ImGui::EndTooltip();
+                    }
 
-                ImGui::EndTooltip();
-            }
+                    if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_SourceAllowNullID))
+                    {
+                        ImGui::SetDragDropPayload("ASSET_PATH", entry.pathString.c_str(), entry.pathString.size() + 1);
+                        ImGui::Text("Dragging: %s", filename.c_str());
+                        ImGui::EndDragDropSource();
+                    }
 
-            if (ImGui::BeginDragDropSource(ImGuiDragDropFlags_SourceAllowNullID))
-            {
-                const std::string filePath = assetPath.string();
-                ImGui::SetDragDropPayload("ASSET_PATH", filePath.c_str(), filePath.size() + 1);
-                ImGui::Text("Dragging: %s", filename.c_str());
-                ImGui::EndDragDropSource();
+                    ImGui::PopID();
+                }
             }
-
-            ImGui::PopID();
-            ImGui::NextColumn();
         }
 
         ImGui::PopStyleVar();
-        ImGui::Columns(1);
     }
 
     if (ImGui::BeginPopup("AssetItemContextMenu"))
@@ -2045,56 +2072,65 @@ bool AssetsWindow::createMaterialFromTexture(const std::filesystem::path &textur
     return true;
 }
 
-std::vector<std::filesystem::directory_entry> AssetsWindow::getFilteredEntries()
+AssetDatabase *AssetsWindow::getAssetDatabase() const
 {
-    std::vector<std::filesystem::directory_entry> entries;
-
-    try
-    {
-        for (const auto &entry : std::filesystem::directory_iterator(m_currentDirectory))
-        {
-            // Skip hidden files/directories
-            std::string filename = entry.path().filename().string();
+    return m_currentProject ? m_currentProject->assetDatabase.get() : nullptr;
+}
 
-            if (!filename.empty() && filename[0] == '.')
-                continue;
+const std::vector<AssetsWindow::AssetGridEntry> &AssetsWindow::getFilteredEntries()
+{
+    auto *assetDatabase = getAssetDatabase();
+    const uint64_t revision = assetDatabase ? assetDatabase->getRevision() : 0u;
+    if (revision == m_gridEntriesRevision && m_currentDirectory == m_gridEntriesDirectory && m_searchQuery == m_gridEntriesSearchQuery)
+        return m_gridEntries;
 
-            // Skip excluded directories
-            if (entry.is_directory() &&
-                m_excludedDirectories.find(filename) != m_excludedDirectories.end())
-                continue;
+    m_gridEntriesRevision = revision;
+    m_gridEntriesDirectory = m_currentDirectory;
+    m_gridEntriesSearchQuery = m_searchQuery;
+    m_gridEntries.clear();
 
-            if (entry.is_regular_file())
-            {
-                const std::string extensionLower = toLowerCopy(entry.path().extension().string());
-                if (m_textureExtensions.find(extensionLower) != m_textureExtensions.end() ||
-                    m_modelExtensions.find(extensionLower) != m_modelExtensions.end())
-                    continue;
-            }
+    if (!assetDatabase)
+        return m_gridEntries;
 
-            const std::string searchableName = entry.is_directory() ? filename : makeDisplayName(entry.path());
+    // Hidden and excluded folders are never indexed.
+    for (const auto *record : assetDatabase->getChildren(m_currentDirectory))
+    {
+        const std::filesystem::path path = assetDatabase->getAbsolutePath(*record);
 
-            // Apply search filter if query exists
-            if (!m_searchQuery.empty() && !matchesSearch(searchableName))
+        if (!record->isDirectory)
+        {
+            const std::string extensionLower = toLowerCopy(path.extension().string());
+            if (m_textureExtensions.find(extensionLower) != m_textureExtensions.end() ||
+                m_modelExtensions.find(extensionLower) != m_modelExtensions.end())
                 continue;
-
-            entries.push_back(entry);
         }
 
-        std::sort(entries.begin(), entries.end(),
-                  [](const std::filesystem::directory_entry &a, const std::filesystem::directory_entry &b)
-                  {
-                      if (a.is_directory() != b.is_directory())
-                          return a.is_directory(); // Directories first
-                      return a.path().filename() < b.path().filename();
-                  });
-    }
-    catch (const std::filesystem::filesystem_error &e)
-    {
-        VX_EDITOR_ERROR_STREAM("Error reading directory: " << e.what() << std::endl);
+        const std::string searchableName = record->isDirectory ? record->getFileName() : makeDisplayName(path);
+
+        // Apply search filter if query exists
+        if (!m_searchQuery.empty() && !matchesSearch(searchableName))
+            continue;
+
+        AssetGridEntry &entry = m_gridEntries.emplace_back();
+        entry.path = path;
+        entry.isDirectory = record->isDirectory;
+        entry.size = record->size;
+        entry.type = record->type;
+        entry.pathString = path.string();
+        entry.fileName = record->getFileName();
+        entry.displayName = searchableName;
+        entry.extensionLower = record->isDirectory ? std::string{} : toLowerCopy(path.extension().string());
     }
 
-    return entries;
+    std::sort(m_gridEntries.begin(), m_gridEntries.end(),
+              [](const AssetGridEntry &a, const AssetGridEntry &b)
+              {
+                  if (a.isDirectory != b.isDirectory)
+                      return a.isDirectory; // Directories first
+                  return a.fileName < b.fileName;
+              });
+
+    return m_gridEntries;
 }
 
 bool AssetsWindow::matchesSearch(const std::string &filename) const
@@ -2132,49 +2168,38 @@ void AssetsWindow::buildDirectoryTree()
         m_currentProject->name,
         projectRoot);
 
+    if (auto *assetDatabase = getAssetDatabase())
+        m_treeRevision = assetDatabase->getRevision();
+
     buildTreeNode(m_treeRoot.get(), projectRoot);
     syncTreeWithCurrentDirectory();
 }
 
 void AssetsWindow::buildTreeNode(TreeNode *node, const std::filesystem::path &path)
 {
-    try
-    {
-        for (const auto &entry : std::filesystem::directory_iterator(path))
-        {
-            if (!entry.is_directory())
-                continue;
-
-            std::string dirName = entry.path().filename().string();
-
-            // Skip excluded directories
-            if (m_excludedDirectories.find(dirName) != m_excludedDirectories.end())
-                continue;
-
-            // Skip hidden directories
-            if (!dirName.empty() && dirName[0] == '.')
-                continue;
-
-            auto child = std::make_shared<TreeNode>(dirName, entry.path());
-            child->parent = node;
-            node->children.push_back(child);
-
-            // Recursively build tree (optional - can be done on demand)
-            // buildTreeNode(child.get(), entry.path());
-        }
+    auto *assetDatabase = getAssetDatabase();
+    if (!assetDatabase)
+        return;
 
-        // Sort children alphabetically
-        std::sort(node->children.begin(), node->children.end(),
-                  [](const std::shared_ptr<TreeNode> &a,
-                     const std::shared_ptr<TreeNode> &b)
-                  {
-                      return a->name < b->name;
-                  });
-    }
-    catch (const std::filesystem::filesystem_error &e)
+    // The whole hierarchy comes from memory, so nested folders are built up front.
+    for (const auto *record : assetDatabase->getChildren(path))
     {
-        VX_EDITOR_ERROR_STREAM("Error building tree node: " << e.what() << std::endl);
+        if (!record->isDirectory)
+            continue;
+
+        auto child = std::make_shared<TreeNode>(record->getFileName(), assetDatabase->getAbsolutePath(*record));
+        child->parent = node;
+        buildTreeNode(child.get(), child->path);
+        node->children.push_back(child);
     }
+
+    // Sort children alphabetically
+    std::sort(node->children.begin(), node->children.end(),
+              [](const std::shared_ptr<TreeNode> &a,
+                 const std::shared_ptr<TreeNode> &b)
+              {
+                  return a->name < b->name;
+              });
 }
 
 void AssetsWindow::syncTreeWithCurrentDirectory()
@@ -2223,10 +2248,18 @@ void AssetsWindow::goUpOneDirectory()
 
 void AssetsWindow::refreshTree()
 {
-    if (m_currentProject)
+    if (!m_currentProject)
+        return;
+
+    // Without a filesystem watcher our own edits are picked up here; with one they arrive on their own.
+    auto *assetDatabase = getAssetDatabase();
+    if (assetDatabase && !assetDatabase->isWatching())
     {
-        buildDirectoryTree();
+        assetDatabase->markChanged(m_currentDirectory);
+        assetDatabase->processChanges();
     }
+
+    buildDirectoryTree();
 }
 
 std::string AssetsWindow::formatFileSize(uintmax_t size) const
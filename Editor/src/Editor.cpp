@@ -30,6 +30,8 @@
 #include "Engine/Render/RenderQualitySettings.hpp"
 #include "Engine/Assets/AssetManager.hpp"
 #include "Engine/Assets/ElixBundle.hpp"
+#include "Engine/Diagnostics.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include "Editor/FileHelper.hpp"
 #include "Editor/Actions/Commands/CreateEntityCommand.hpp"
@@ -2407,9 +2409,34 @@ void Editor::drawGuizmo()
                 glm::value_ptr(rotation),
                 glm::value_ptr(scale));
 
-            tc->setPosition(translation);
-            tc->setEulerDegrees(rotation);
-            tc->setScale(scale);
+            // Only the manipulated property is written, so the others don't pick up decomposition drift.
+            switch (m_currentGuizmoOperation)
+            {
+            case GuizmoOperation::TRANSLATE:
+            {
+                const glm::vec3 oldPosition = tc->getPosition();
+                tc->setPosition(translation);
+                if (tc->getPosition() != oldPosition)
+                    recordEntityPropertyCommand(m_selectedEntity, actions::setTransformPosition, oldPosition, tc->getPosition(), "Move entity");
+                break;
+            }
+            case GuizmoOperation::ROTATE:
+            {
+                const glm::quat oldRotation = tc->getRotation();
+                tc->setEulerDegrees(rotation);
+                if (tc->getRotation() != oldRotation)
+                    recordEntityPropertyCommand(m_selectedEntity, actions::setTransformRotation, oldRotation, tc->getRotation(), "Rotate entity");
+                break;
+            }
+            case GuizmoOperation::SCALE:
+            {
+                const glm::vec3 oldScale = tc->getScale();
+                tc->setScale(scale);
+                if (tc->getScale() != oldScale)
+                    recordEntityPropertyCommand(m_selectedEntity, actions::setTransformScale, oldScale, tc->getScale(), "Scale entity");
+                break;
+            }
+            }
         }
     }
 }
@@ -5823,6 +5850,9 @@ void Editor::drawFrame(VkDescriptorSet viewportDescriptorSet,
 {
     updateSceneAutosave(ImGui::GetIO().DeltaTime);
 
+    if (auto project = m_currentProject.lock(); project && project->assetDatabase)
+        project->assetDatabase->processChanges();
+
     if (m_renderOnlyViewport && viewportDescriptorSet)
     {
         drawViewport(viewportDescriptorSet);
@@ -6394,6 +6424,10 @@ void Editor::handleInput()
     const bool deleteShortcutBlocked =
         assetsWindowConsumesDelete || animationTreeConsumesDelete || shortcutBlockedByTextInput;
 
+    // A drag (gizmo, slider) is one undo step: property edits coalesce until the mouse is released.
+    if (!ImGui::IsMouseDown(ImGuiMouseButton_Left))
+        m_commandHistory.breakCoalescing();
+
     if (isCtrlDown && !shortcutBlockedByTextInput && ImGui::IsKeyPressed(ImGuiKey_Z, false))
     {
         if (isShiftDown)
@@ -6549,6 +6583,19 @@ bool Editor::recordCreatedEntityCommand(engine::Entity *entity, const std::strin
     return recordExecutedEditorCommand(std::move(createCommand));
 }
 
+bool Editor::recordEntityPropertyCommand(engine::Entity *entity,
+                                         actions::PropertySetter setter,
+                                         actions::PropertyValue oldValue,
+                                         actions::PropertyValue newValue,
+                                         const std::string &label)
+{
+    if (!m_scene || !entity || m_currentMode != EditorMode::EDIT)
+        return false;
+
+    return recordExecutedEditorCommand(std::make_unique<actions::EntityPropertyCommand>(
+        m_scene.get(), entity->getId(), setter, std::move(oldValue), std::move(newValue), label));
+}
+
 bool Editor::performUndoAction()
 {
     if (!m_scene)
@@ -8454,6 +8501,62 @@ void Editor::drawBenchmark()
         ImGui::Text("  CPU mem  : %.1f MB", static_cast<double>(stats.cpuMemoryBytes) / (1024.0 * 1024.0));
     }
 
+#if VX_PROFILER_ENABLED
+    {
+        ImGui::Separator();
+        ImGui::Text("CPU timeline");
+
+        static int traceFrameCount = 120;
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::InputInt("Frames", &traceFrameCount);
+        traceFrameCount = std::clamp(traceFrameCount, 1, 2000);
+
+        ImGui::BeginDisabled(engine::profiling::CpuProfiler::isCapturing());
+        if (ImGui::Button("Capture CPU trace"))
+        {
+            const auto tracePath = engine::diagnostics::ensureLogsDirectory() / "cpu_trace.json";
+            engine::profiling::CpuProfiler::requestCapture(static_cast<uint32_t>(traceFrameCount), tracePath.string());
+        }
+        ImGui::EndDisabled();
+        ImGui::SetItemTooltip("Records VX_PROFILE_SCOPE regions on all threads; open the file in ui.perfetto.dev or chrome://tracing.");
+
+        const std::string lastTracePath = engine::profiling::CpuProfiler::getLastTracePath();
+        if (!lastTracePath.empty())
+            ImGui::TextDisabled("  Last trace: %s", lastTracePath.c_str());
+    }
+#endif
+
+    {
+        ImGui::Separator();
+        ImGui::Text("Physics");
+
+        bool asyncPhysics = engineConfig.getAsyncPhysicsEnabled();
+        if (ImGui::Checkbox("Async simulation", &asyncPhysics))
+        {
+            engineConfig.setAsyncPhysicsEnabled(asyncPhysics);
+            if (!engineConfig.save())
+                VX_EDITOR_WARNING_STREAM("Failed to persist async physics setting to engine config\n");
+        }
+        ImGui::SetItemTooltip("Overlap each fixed physics step with frame update and rendering; results are fetched at the next fixed step.");
+
+        if (m_scene)
+        {
+            const auto &physicsScene = m_scene->getPhysicsScene();
+            const auto &lastStep = physicsScene.getLastStepTimings();
+            const auto &totals = physicsScene.getTimingTotals();
+
+            ImGui::Text("  Last step: simulate %.3f ms, overlapped %.3f ms, blocked %.3f ms",
+                        lastStep.simulateCallMs, lastStep.overlappedMs, lastStep.fetchWaitMs);
+            ImGui::SetItemTooltip("Overlapped = main-thread work done while the step ran (hidden physics time, upper bound when nothing blocked).");
+
+            if (totals.asyncSteps > 0)
+                ImGui::Text("  Avg hidden: %.3f ms/step, avg blocked: %.3f ms/step (%llu async steps)",
+                            totals.overlappedMs / static_cast<double>(totals.steps),
+                            totals.fetchWaitMs / static_cast<double>(totals.steps),
+                            static_cast<unsigned long long>(totals.asyncSteps));
+        }
+    }
+
     ImGui::Separator();
 
     ImGui::Text("CPU prepare frame : %.3f ms", profilingData.cpuPrepareFrameMs);
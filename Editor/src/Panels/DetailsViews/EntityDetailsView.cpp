@@ -1504,7 +1504,11 @@ void EntityDetailsView::draw(Editor &editor)
                 ImGui::SameLine(kLabelW);
                 ImGui::SetNextItemWidth(-1);
                 if (drawVec3Control("##tfPos", position, 0.0f, 0.01f))
+                {
+                    const glm::vec3 oldPosition = transformComponent->getPosition();
                     transformComponent->setPosition(position);
+                    editor.recordEntityPropertyCommand(m_selectedEntity, actions::setTransformPosition, oldPosition, position, "Edit position");
+                }
 
                 ImGui::Spacing();
                 ImGui::AlignTextToFramePadding();
@@ -1512,7 +1516,12 @@ void EntityDetailsView::draw(Editor &editor)
                 ImGui::SameLine(kLabelW);
                 ImGui::SetNextItemWidth(-1);
                 if (drawVec3Control("##tfRot", euler, 0.0f, 0.1f))
+                {
+                    const glm::quat oldRotation = transformComponent->getRotation();
                     transformComponent->setEulerDegrees(euler);
+                    editor.recordEntityPropertyCommand(m_selectedEntity, actions::setTransformRotation, oldRotation,
+                                                       transformComponent->getRotation(), "Edit rotation");
+                }
 
                 ImGui::Spacing();
                 ImGui::AlignTextToFramePadding();
@@ -1520,7 +1529,11 @@ void EntityDetailsView::draw(Editor &editor)
                 ImGui::SameLine(kLabelW);
                 ImGui::SetNextItemWidth(-1);
                 if (drawVec3Control("##tfScl", scale, 1.0f, 0.01f))
+                {
+                    const glm::vec3 oldScale = transformComponent->getScale();
                     transformComponent->setScale(scale);
+                    editor.recordEntityPropertyCommand(m_selectedEntity, actions::setTransformScale, oldScale, scale, "Edit scale");
+                }
 
                 ImGui::Spacing();
             }
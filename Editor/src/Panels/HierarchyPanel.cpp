@@ -7,8 +7,22 @@
 #include "glm/gtc/type_ptr.hpp"
 #include "ImGuizmo.h"
 
+#include <algorithm>
+#include <cctype>
+#include <unordered_set>
+
 ELIX_NESTED_NAMESPACE_BEGIN(editor)
 
+namespace
+{
+    std::string toLowerCopy(std::string text)
+    {
+        std::transform(text.begin(), text.end(), text.begin(), [](unsigned char character)
+                       { return static_cast<char>(std::tolower(character)); });
+        return text;
+    }
+} // namespace
+
 void HierarchyPanel::setSetSelectedEntityCallback(const std::function<void(engine::Entity *)> &function)
 {
     m_setSelectedEntityCallback = function;
@@ -31,7 +45,116 @@ void HierarchyPanel::setAddPrimitiveEntityCallback(const std::function<void(cons
 
 void HierarchyPanel::setScene(engine::Scene *scene)
 {
+    if (m_scene == scene)
+        return;
+
     m_scene = scene;
+    m_rows.clear();
+    m_searchIndex.clear();
+    m_expandedEntityIds.clear();
+    m_rowsDirty = true;
+}
+
+void HierarchyPanel::refreshRows()
+{
+    const uint64_t revision = m_scene->getHierarchyRevision();
+    const bool hierarchyChanged = revision != m_rowsRevision;
+    if (!hierarchyChanged && !m_rowsDirty)
+        return;
+
+    m_rowsRevision = revision;
+    m_rowsDirty = false;
+    m_rows.clear();
+
+    if (m_searchQuery.empty())
+    {
+        m_searchIndex.clear();
+
+        for (const auto &entity : m_scene->getEntities())
+            if (entity && !entity->getParent())
+                appendRows(entity.get(), 0u);
+
+        return;
+    }
+
+    if (hierarchyChanged || m_searchIndex.empty())
+        rebuildSearchIndex();
+
+    appendSearchRows();
+}
+
+void HierarchyPanel::rebuildSearchIndex()
+{
+    m_searchIndex.clear();
+    m_searchIndex.reserve(m_scene->getEntities().size());
+
+    for (const auto &entity : m_scene->getEntities())
+        if (entity)
+            m_searchIndex.push_back({entity.get(), toLowerCopy(entity->getName())});
+}
+
+void HierarchyPanel::appendRows(engine::Entity *root, uint32_t depth)
+{
+    // Explicit stack: deep chains would overflow a recursive walk.
+    std::vector<std::pair<engine::Entity *, uint32_t>> stack{{root, depth}};
+
+    while (!stack.empty())
+    {
+        const auto [entity, entityDepth] = stack.back();
+        stack.pop_back();
+
+        const auto &children = entity->getChildren();
+        const bool expanded = !children.empty() && m_expandedEntityIds.contains(entity->getId());
+        m_rows.push_back({entity, entityDepth, !children.empty(), expanded});
+
+        if (!expanded)
+            continue;
+
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+            if (*it)
+                stack.push_back({*it, entityDepth + 1u});
+    }
+}
+
+void HierarchyPanel::appendSearchRows()
+{
+    const std::string lowerQuery = toLowerCopy(m_searchQuery);
+
+    // Matches keep their ancestors visible so results stay in context.
+    std::unordered_set<const engine::Entity *> visibleEntities;
+    for (const auto &entry : m_searchIndex)
+    {
+        if (entry.lowerName.find(lowerQuery) == std::string::npos)
+            continue;
+
+        // Stop at the first ancestor already added by an earlier match.
+        const engine::Entity *entity = entry.entity;
+        while (entity && visibleEntities.insert(entity).second)
+            entity = entity->getParent();
+    }
+
+    if (visibleEntities.empty())
+        return;
+
+    std::vector<std::pair<engine::Entity *, uint32_t>> stack;
+    for (auto it = m_scene->getEntities().rbegin(); it != m_scene->getEntities().rend(); ++it)
+        if (*it && !(*it)->getParent() && visibleEntities.contains(it->get()))
+            stack.push_back({it->get(), 0u});
+
+    while (!stack.empty())
+    {
+        const auto [entity, depth] = stack.back();
+        stack.pop_back();
+
+        const auto &children = entity->getChildren();
+        const bool hasVisibleChildren = std::any_of(children.begin(), children.end(), [&visibleEntities](const engine::Entity *child)
+                                                    { return visibleEntities.contains(child); });
+        m_rows.push_back({entity, depth, hasVisibleChildren, hasVisibleChildren});
+
+        for (auto it = children.rbegin(); it != children.rend(); ++it)
+            if (visibleEntities.contains(*it))
+                stack.push_back({*it, depth + 1u});
+    }
 }
 
 void HierarchyPanel::drawContents()
@@ -39,44 +162,38 @@ void HierarchyPanel::drawContents()
     if (!m_scene)
         return;
 
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint("##HierarchySearch", "Search entities...", m_searchBuffer, sizeof(m_searchBuffer)))
+    {
+        m_searchQuery = m_searchBuffer;
+        m_rowsDirty = true;
+    }
+
+    refreshRows();
+
     ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(4, 2));
     ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4, 2));
 
-    for (auto &entity : m_scene->getEntities())
-        if (entity && !entity->getParent())
-            drawHierarchyEntityNode(entity.get());
+    if (m_rows.empty() && !m_searchQuery.empty())
+        ImGui::TextDisabled("No entities match your search.");
+
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(m_rows.size()));
+    while (clipper.Step())
+        for (int rowIndex = clipper.DisplayStart; rowIndex < clipper.DisplayEnd; ++rowIndex)
+            drawRow(m_rows[static_cast<size_t>(rowIndex)]);
+
+    // The empty space below the rows takes drops that move an entity back to the root.
+    const ImVec2 availableSpace = ImGui::GetContentRegionAvail();
+    ImGui::InvisibleButton("##HierarchyRootDropTarget",
+                           ImVec2(std::max(availableSpace.x, 1.0f), std::max(availableSpace.y, ImGui::GetFrameHeight())));
 
     if (ImGui::BeginDragDropTarget())
     {
         if (const ImGuiPayload *payload = ImGui::AcceptDragDropPayload("HIERARCHY_ENTITY_ID"))
         {
             const uint32_t draggedId = *static_cast<const uint32_t *>(payload->Data);
-
-            if (auto *draggedEntity = m_scene->getEntityById(draggedId))
-            {
-                if (draggedEntity->getParent())
-                {
-                    glm::mat4 worldMatrix(1.0f);
-                    if (auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>())
-                        worldMatrix = transform->getMatrix();
-
-                    draggedEntity->clearParent();
-
-                    if (auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>())
-                    {
-                        glm::vec3 translation, rotation, scale;
-                        ImGuizmo::DecomposeMatrixToComponents(
-                            glm::value_ptr(worldMatrix),
-                            glm::value_ptr(translation),
-                            glm::value_ptr(rotation),
-                            glm::value_ptr(scale));
-
-                        transform->setPosition(translation);
-                        transform->setEulerDegrees(rotation);
-                        transform->setScale(scale);
-                    }
-                }
-            }
+            reparentEntity(m_scene->getEntityById(draggedId), nullptr);
         }
 
         ImGui::EndDragDropTarget();
@@ -128,18 +245,21 @@ void HierarchyPanel::drawContents()
 
 }
 
-void HierarchyPanel::drawHierarchyEntityNode(engine::Entity *entity)
+void HierarchyPanel::drawRow(const Row &row)
 {
-    if (!entity)
-        return;
+    engine::Entity *entity = row.entity;
 
     ImGui::PushID(static_cast<int>(entity->getId()));
 
+    const float indent = static_cast<float>(row.depth) * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.0f)
+        ImGui::Indent(indent);
+
     const bool selected = (entity == m_selectedEntity);
-    const bool hasChildren = !entity->getChildren().empty();
 
-    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth;
-    if (!hasChildren)
+    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanFullWidth |
+                                   ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    if (!row.hasChildren)
         nodeFlags |= ImGuiTreeNodeFlags_Leaf;
     if (selected)
         nodeFlags |= ImGuiTreeNodeFlags_Selected;
@@ -154,8 +274,20 @@ void HierarchyPanel::drawHierarchyEntityNode(engine::Entity *entity)
     if (!entity->isEnabled())
         nodeLabel += " (Disabled)";
 
+    // Open state lives in m_expandedEntityIds, not in ImGui storage; search results are always expanded.
+    ImGui::SetNextItemOpen(row.expanded, ImGuiCond_Always);
     const bool nodeOpen = ImGui::TreeNodeEx(nodeLabel.c_str(), nodeFlags);
 
+    if (nodeOpen != row.expanded && m_searchQuery.empty())
+    {
+        if (nodeOpen)
+            m_expandedEntityIds.insert(entity->getId());
+        else
+            m_expandedEntityIds.erase(entity->getId());
+
+        m_rowsDirty = true;
+    }
+
     if (ImGui::IsItemClicked())
         if (m_setSelectedEntityCallback)
             m_setSelectedEntityCallback(entity);
@@ -173,49 +305,58 @@ void HierarchyPanel::drawHierarchyEntityNode(engine::Entity *entity)
         if (const ImGuiPayload *payload = ImGui::AcceptDragDropPayload("HIERARCHY_ENTITY_ID"))
         {
             const uint32_t draggedId = *static_cast<const uint32_t *>(payload->Data);
-            if (auto *draggedEntity = m_scene ? m_scene->getEntityById(draggedId) : nullptr)
-            {
+            if (auto *draggedEntity = m_scene->getEntityById(draggedId))
                 if (draggedEntity != entity && !entity->isDescendantOf(draggedEntity))
-                {
-                    glm::mat4 worldMatrix(1.0f);
-                    if (auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>())
-                        worldMatrix = transform->getMatrix();
-
-                    if (!draggedEntity->setParent(entity))
-                        VX_EDITOR_WARNING_STREAM("Failed to parent entity '" << draggedEntity->getName() << "' under '" << entity->getName() << "'.");
-                    else if (auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>())
-                    {
-                        glm::mat4 localMatrix = worldMatrix;
-                        if (auto *parentTransform = entity->getComponent<engine::Transform3DComponent>())
-                            localMatrix = glm::inverse(parentTransform->getMatrix()) * worldMatrix;
-
-                        glm::vec3 translation, rotation, scale;
-                        ImGuizmo::DecomposeMatrixToComponents(
-                            glm::value_ptr(localMatrix),
-                            glm::value_ptr(translation),
-                            glm::value_ptr(rotation),
-                            glm::value_ptr(scale));
-
-                        transform->setPosition(translation);
-                        transform->setEulerDegrees(rotation);
-                        transform->setScale(scale);
-                    }
-                }
-            }
+                    reparentEntity(draggedEntity, entity);
         }
 
         ImGui::EndDragDropTarget();
     }
 
-    if (nodeOpen)
-    {
-        for (auto *child : entity->getChildren())
-            drawHierarchyEntityNode(child);
+    if (indent > 0.0f)
+        ImGui::Unindent(indent);
+
+    ImGui::PopID();
+}
+
+void HierarchyPanel::reparentEntity(engine::Entity *draggedEntity, engine::Entity *newParent)
+{
+    if (!draggedEntity || draggedEntity->getParent() == newParent)
+        return;
+
+    glm::mat4 worldMatrix(1.0f);
+    if (auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>())
+        worldMatrix = transform->getMatrix();
 
-        ImGui::TreePop();
+    if (!draggedEntity->setParent(newParent))
+    {
+        VX_EDITOR_WARNING_STREAM("Failed to parent entity '" << draggedEntity->getName() << "' under '" << newParent->getName() << "'.");
+        return;
     }
 
-    ImGui::PopID();
+    auto *transform = draggedEntity->getComponent<engine::Transform3DComponent>();
+    if (!transform)
+        return;
+
+    glm::mat4 localMatrix = worldMatrix;
+    if (newParent)
+        if (auto *parentTransform = newParent->getComponent<engine::Transform3DComponent>())
+            localMatrix = glm::inverse(parentTransform->getMatrix()) * worldMatrix;
+
+    glm::vec3 translation, rotation, scale;
+    ImGuizmo::DecomposeMatrixToComponents(
+        glm::value_ptr(localMatrix),
+        glm::value_ptr(translation),
+        glm::value_ptr(rotation),
+        glm::value_ptr(scale));
+
+    transform->setPosition(translation);
+    transform->setEulerDegrees(rotation);
+    transform->setScale(scale);
+
+    // Reveal the moved entity under its new parent.
+    if (newParent)
+        m_expandedEntityIds.insert(newParent->getId());
 }
 
 ELIX_NESTED_NAMESPACE_END
@@ -328,31 +328,52 @@ namespace
             texturePaths.push_back(normalized);
         };
 
+        // The asset database answers from memory; this runs every frame while the texture picker is open.
+        const auto *assetDatabase = project.assetDatabase.get();
+        auto isTextureAsset = [assetDatabase](const std::filesystem::path &path)
+        {
+            if (assetDatabase && assetDatabase->isOpen())
+            {
+                const auto *record = assetDatabase->find(path);
+                return record && record->type == engine::Asset::AssetType::TEXTURE;
+            }
+
+            auto type = readSerializedAssetType(path);
+            return type.has_value() && type.value() == engine::Asset::AssetType::TEXTURE;
+        };
+
         for (const auto &[cachedPath, _] : project.cache.texturesByPath)
         {
             const std::string resolved = resolveTexturePathAgainstProjectRoot(cachedPath, projectRoot);
             const std::filesystem::path resolvedPath = std::filesystem::path(resolved).lexically_normal();
-            auto type = readSerializedAssetType(resolvedPath);
-            if (type.has_value() && type.value() == engine::Asset::AssetType::TEXTURE)
+            if (isTextureAsset(resolvedPath))
                 addTexturePath(resolvedPath);
         }
 
-        std::error_code scanError;
-        for (std::filesystem::recursive_directory_iterator iterator(
-                 projectRoot,
-                 std::filesystem::directory_options::skip_permission_denied,
-                 scanError);
-             canScanDirectory && !scanError && iterator != std::filesystem::recursive_directory_iterator();
-             iterator.increment(scanError))
+        if (assetDatabase && assetDatabase->isOpen())
         {
-            std::error_code fileError;
-            if (!iterator->is_regular_file(fileError) || fileError)
-                continue;
+            for (const auto *record : assetDatabase->findByType(engine::Asset::AssetType::TEXTURE))
+                addTexturePath(assetDatabase->getAbsolutePath(*record).lexically_normal());
+        }
+        else
+        {
+            std::error_code scanError;
+            for (std::filesystem::recursive_directory_iterator iterator(
+                     projectRoot,
+                     std::filesystem::directory_options::skip_permission_denied,
+                     scanError);
+                 canScanDirectory && !scanError && iterator != std::filesystem::recursive_directory_iterator();
+                 iterator.increment(scanError))
+            {
+                std::error_code fileError;
+                if (!iterator->is_regular_file(fileError) || fileError)
+                    continue;
 
-            const std::filesystem::path path = iterator->path().lexically_normal();
-            auto type = readSerializedAssetType(path);
-            if (type.has_value() && type.value() == engine::Asset::AssetType::TEXTURE)
-                addTexturePath(path);
+                const std::filesystem::path path = iterator->path().lexically_normal();
+                auto type = readSerializedAssetType(path);
+                if (type.has_value() && type.value() == engine::Asset::AssetType::TEXTURE)
+                    addTexturePath(path);
+            }
         }
 
         std::sort(texturePaths.begin(), texturePaths.end(), [](const std::string &left, const std::string &right)
@@ -18,7 +18,6 @@
 #endif
 
 #include "Engine/Assets/AssetsLoader.hpp"
-#include "Engine/Assets/AssetsSerializer.hpp"
 
 #include "nlohmann/json.hpp"
 
@@ -301,36 +300,18 @@ std::shared_ptr<Project> ProjectLoader::loadProject(const std::string &projectPa
         return nullptr;
     }
 
-    engine::AssetsSerializer serializer;
-    std::error_code cacheScanError;
-    for (auto it = std::filesystem::recursive_directory_iterator(
-             project->fullPath,
-             std::filesystem::directory_options::skip_permission_denied,
-             cacheScanError);
-         !cacheScanError && it != std::filesystem::recursive_directory_iterator();
-         ++it)
+    project->assetDatabase = std::make_shared<AssetDatabase>();
+    if (!project->assetDatabase->open(project->fullPath))
     {
-        auto &entry = *it;
-        std::error_code fileError;
-        if (!entry.is_regular_file(fileError) || fileError)
-            continue;
-
-        const auto header = serializer.readHeader(entry.path().string());
-        if (!header.has_value() ||
-            static_cast<engine::Asset::AssetType>(header->type) != engine::Asset::AssetType::TEXTURE)
-            continue;
-
-        const std::string relativeTexturePath = std::filesystem::relative(entry.path(), project->fullPath).lexically_normal().string();
-        // VX_EDITOR_INFO_STREAM("Found texture asset: " << relativeTexturePath);
-
-        TextureAssetRecord texture;
-        texture.path = relativeTexturePath;
-        assetsCache.texturesByPath[texture.path] = texture;
+        VX_EDITOR_WARNING_STREAM("Failed to index project assets in '" << project->fullPath << "'\n");
+        return project;
     }
 
-    if (cacheScanError)
+    for (const auto *record : project->assetDatabase->findByType(engine::Asset::AssetType::TEXTURE))
     {
-        VX_EDITOR_WARNING_STREAM("Failed to scan project assets in '" << project->fullPath << "': " << cacheScanError.message() << '\n');
+        TextureAssetRecord texture;
+        texture.path = std::filesystem::path(record->path).make_preferred().string();
+        assetsCache.texturesByPath[texture.path] = texture;
     }
 
     return project;
@@ -9,6 +9,7 @@
 #include "Engine/Primitives.hpp"
 #include "Engine/Builders/GraphicsPipelineManager.hpp"
 #include "Engine/Render/RenderGraph/RenderGraphDrawProfiler.hpp"
+#include "Engine/Utilities/ImageUtilities.hpp"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -39,6 +40,14 @@ PreviewAssetsRenderGraphPass::PreviewAssetsRenderGraphPass(VkExtent2D extent) :
     this->setDebugName("Preview assets render graph pass");
 }
 
+PreviewAssetsRenderGraphPass::~PreviewAssetsRenderGraphPass()
+{
+    waitForCaptures();
+
+    if (m_captureFence != VK_NULL_HANDLE)
+        vkDestroyFence(core::VulkanContext::getContext()->getDevice(), m_captureFence, nullptr);
+}
+
 int PreviewAssetsRenderGraphPass::addPreviewJob(const PreviewJob &previewJob)
 {
     if (m_indexBusyJobs >= MAX_RENDER_JOBS)
@@ -56,7 +65,7 @@ int PreviewAssetsRenderGraphPass::addMaterialPreviewJob(const PreviewJob &previe
 
 void PreviewAssetsRenderGraphPass::setup(engine::renderGraph::RGPResourcesBuilder &builder)
 {
-    const auto format = core::VulkanContext::getContext()->getSwapchain()->getImageFormat();
+    const auto format = getColorFormat();
     const auto device = core::VulkanContext::getContext()->getDevice();
 
     m_pipelineLayout = core::PipelineLayout::createShared(
@@ -101,7 +110,7 @@ void PreviewAssetsRenderGraphPass::record(core::CommandBuffer::SharedPtr command
     key.depthCompare = VK_COMPARE_OP_LESS;
     key.polygonMode = VK_POLYGON_MODE_FILL;
     key.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-    key.colorFormats = {core::VulkanContext::getContext()->getSwapchain()->getImageFormat()};
+    key.colorFormats = {getColorFormat()};
     key.depthFormat = VK_FORMAT_UNDEFINED;
     key.pipelineLayout = m_pipelineLayout;
 
@@ -163,6 +172,173 @@ void PreviewAssetsRenderGraphPass::clearJobs()
     m_currentJob = 0;
 }
 
+VkFormat PreviewAssetsRenderGraphPass::getColorFormat() const
+{
+    return core::VulkanContext::getContext()->getSwapchain()->getImageFormat();
+}
+
+bool PreviewAssetsRenderGraphPass::isCaptureFormatSupported(VkFormat format)
+{
+    switch (format)
+    {
+    case VK_FORMAT_R8G8B8A8_UNORM:
+    case VK_FORMAT_R8G8B8A8_SRGB:
+    case VK_FORMAT_B8G8R8A8_UNORM:
+    case VK_FORMAT_B8G8R8A8_SRGB:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void PreviewAssetsRenderGraphPass::submitCaptures()
+{
+    std::vector<uint32_t> jobIndices;
+    for (uint32_t index = 0; index < m_indexBusyJobs; ++index)
+    {
+        const uint32_t captureId = m_renderJobs[index].captureId;
+        if (captureId == 0u)
+            continue;
+
+        if (!m_inFlightCaptureIds.empty() || jobIndices.size() >= MAX_CAPTURES_PER_SUBMIT || !isCaptureFormatSupported(getColorFormat()))
+            m_droppedCaptureIds.push_back(captureId);
+        else
+            jobIndices.push_back(index);
+    }
+
+    if (jobIndices.empty())
+        return;
+
+    const auto context = core::VulkanContext::getContext();
+    const VkDeviceSize imageByteSize = static_cast<VkDeviceSize>(m_extent.width) * m_extent.height * 4u;
+
+    if (!m_captureBuffer)
+        m_captureBuffer = core::Buffer::createShared(imageByteSize * MAX_CAPTURES_PER_SUBMIT, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                                                     core::memory::MemoryUsage::GPU_TO_CPU);
+
+    if (m_captureFence == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo fenceCreateInfo{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+        if (vkCreateFence(context->getDevice(), &fenceCreateInfo, nullptr, &m_captureFence) != VK_SUCCESS)
+            m_captureFence = VK_NULL_HANDLE;
+    }
+
+    const auto dropAll = [this, &jobIndices]()
+    {
+        for (const uint32_t index : jobIndices)
+            m_droppedCaptureIds.push_back(m_renderJobs[index].captureId);
+    };
+
+    if (m_captureFence == VK_NULL_HANDLE)
+    {
+        dropAll();
+        return;
+    }
+
+    m_captureCommandBuffer = core::CommandBuffer::createShared(*context->getGraphicsCommandPool());
+    m_captureCommandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+
+    const VkImageSubresourceRange subresourceRange{VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+
+    for (size_t slot = 0; slot < jobIndices.size(); ++slot)
+    {
+        auto image = m_renderTargets[jobIndices[slot]]->getImage();
+
+        engine::utilities::ImageUtilities::insertImageMemoryBarrier(
+            *image,
+            *m_captureCommandBuffer,
+            VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+            VK_ACCESS_2_TRANSFER_READ_BIT,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+            VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+            subresourceRange);
+
+        VkBufferImageCopy region{};
+        region.bufferOffset = imageByteSize * slot;
+        region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        region.imageExtent = {m_extent.width, m_extent.height, 1};
+
+        vkCmdCopyImageToBuffer(*m_captureCommandBuffer, *image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, *m_captureBuffer, 1, &region);
+
+        engine::utilities::ImageUtilities::insertImageMemoryBarrier(
+            *image,
+            *m_captureCommandBuffer,
+            VK_ACCESS_2_TRANSFER_READ_BIT,
+            VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+            subresourceRange);
+    }
+
+    m_captureCommandBuffer->end();
+
+    vkResetFences(context->getDevice(), 1, &m_captureFence);
+    if (!m_captureCommandBuffer->submit(context->getGraphicsQueue(), {}, {}, {}, m_captureFence))
+    {
+        m_captureCommandBuffer.reset();
+        dropAll();
+        return;
+    }
+
+    for (const uint32_t index : jobIndices)
+        m_inFlightCaptureIds.push_back(m_renderJobs[index].captureId);
+}
+
+bool PreviewAssetsRenderGraphPass::collectCaptures(std::vector<CapturedPreview> &outCaptures)
+{
+    outCaptures.clear();
+
+    for (const uint32_t captureId : m_droppedCaptureIds)
+        outCaptures.push_back(CapturedPreview{.captureId = captureId, .format = getColorFormat()});
+    m_droppedCaptureIds.clear();
+
+    if (!m_inFlightCaptureIds.empty() &&
+        vkGetFenceStatus(core::VulkanContext::getContext()->getDevice(), m_captureFence) == VK_SUCCESS)
+    {
+        const size_t imageByteSize = static_cast<size_t>(m_extent.width) * m_extent.height * 4u;
+
+        void *mapped = nullptr;
+        m_captureBuffer->map(mapped);
+
+        for (size_t slot = 0; slot < m_inFlightCaptureIds.size(); ++slot)
+        {
+            CapturedPreview capture{
+                .captureId = m_inFlightCaptureIds[slot],
+                .width = m_extent.width,
+                .height = m_extent.height,
+                .format = getColorFormat()};
+
+            if (mapped)
+            {
+                const auto *source = static_cast<const uint8_t *>(mapped) + imageByteSize * slot;
+                capture.pixels.assign(source, source + imageByteSize);
+            }
+
+            outCaptures.push_back(std::move(capture));
+        }
+
+        m_captureBuffer->unmap();
+        m_captureCommandBuffer.reset();
+        m_inFlightCaptureIds.clear();
+    }
+
+    return !outCaptures.empty();
+}
+
+void PreviewAssetsRenderGraphPass::waitForCaptures()
+{
+    if (m_inFlightCaptureIds.empty() || m_captureFence == VK_NULL_HANDLE)
+        return;
+
+    vkWaitForFences(core::VulkanContext::getContext()->getDevice(), 1, &m_captureFence, VK_TRUE, UINT64_MAX);
+    m_captureCommandBuffer.reset();
+    m_inFlightCaptureIds.clear();
+}
+
 std::vector<engine::renderGraph::IRenderGraphPass::RenderPassExecution> PreviewAssetsRenderGraphPass::getRenderPassExecutions(const engine::RenderGraphPassContext &renderContext) const
 {
     if (m_indexBusyJobs == 0)
@@ -187,7 +363,7 @@ std::vector<engine::renderGraph::IRenderGraphPass::RenderPassExecution> PreviewA
         renderPassExecution.colorsRenderingItems = {color0};
         renderPassExecution.useDepth = false;
 
-        renderPassExecution.colorFormats = {core::VulkanContext::getContext()->getSwapchain()->getImageFormat()};
+        renderPassExecution.colorFormats = {getColorFormat()};
         renderPassExecution.depthFormat = VK_FORMAT_UNDEFINED;
 
         renderPassExecution.targets[m_resourceHandlers[i]] = m_renderTargets[i];
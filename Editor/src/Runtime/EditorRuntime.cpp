@@ -1729,6 +1729,21 @@ void EditorRuntime::addLoadingRenderToImGui()
                                 });
 }
 
+void EditorRuntime::fixedTick(float fixedDelta)
+{
+    if (!m_activeScene || !m_shouldUpdate)
+        return;
+
+    m_activeScene->setAsyncPhysicsEnabled(engine::EngineConfig::instance().getAsyncPhysicsEnabled());
+    m_activeScene->fixedUpdate(fixedDelta);
+}
+
+void EditorRuntime::setFixedStepAlpha(float alpha)
+{
+    if (m_activeScene)
+        m_activeScene->setPhysicsInterpolationAlpha(alpha);
+}
+
 void EditorRuntime::tick(float deltaTime)
 {
     if (!m_activeScene || !m_editor || !m_renderGraph)
@@ -1764,7 +1779,10 @@ void EditorRuntime::tick(float deltaTime)
     }
 
     if (m_shouldUpdate)
+    {
+        m_activeScene->setParallelScriptUpdateEnabled(engine::EngineConfig::instance().getParallelScriptUpdateEnabled());
         m_activeScene->update(deltaTime);
+    }
     else
     {
         m_editor->updateAnimationPreview(deltaTime);
@@ -1794,6 +1812,9 @@ void EditorRuntime::tick(float deltaTime)
         job.material = previewJob.material;
         job.mesh = previewJob.mesh;
         job.modelTransform = previewJob.modelTransform;
+        // Thumbnail captures use a fixed pose so the cached image does not depend on the frame.
+        job.rotate = previewJob.captureId == 0u;
+        job.captureId = previewJob.captureId;
         m_previewAssetsRenderGraphPass->addPreviewJob(job);
     }
 
@@ -1916,6 +1937,11 @@ void EditorRuntime::tick(float deltaTime)
     m_editor->processPendingObjectSelection();
 
     m_editor->setDonePreviewJobs(m_previewAssetsRenderGraphPass->getRenderedImages());
+
+    m_previewAssetsRenderGraphPass->submitCaptures();
+    std::vector<PreviewAssetsRenderGraphPass::CapturedPreview> capturedPreviews;
+    if (m_previewAssetsRenderGraphPass->collectCaptures(capturedPreviews))
+        m_editor->setCapturedPreviews(std::move(capturedPreviews));
 }
 
 void EditorRuntime::captureReflectionProbe(engine::Entity *entity)
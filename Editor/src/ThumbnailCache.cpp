@@ -0,0 +1,210 @@
+#include "Editor/ThumbnailCache.hpp"
+
+#include "Engine/Assets/Compressor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+ELIX_NESTED_NAMESPACE_BEGIN(editor)
+
+namespace
+{
+    constexpr char THUMBNAIL_FILE_MAGIC[4] = {'V', 'X', 'T', 'H'};
+    constexpr const char *THUMBNAIL_DIRECTORY = ".velixcache/thumbnails";
+    constexpr uint32_t MAX_THUMBNAIL_DIMENSION = 1024u;
+
+    std::atomic<uint64_t> g_temporaryFileCounter{0u};
+
+    template <typename T>
+    void writeValue(std::ofstream &stream, const T &value)
+    {
+        stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    bool readValue(std::ifstream &stream, T &outValue)
+    {
+        return static_cast<bool>(stream.read(reinterpret_cast<char *>(&outValue), sizeof(T)));
+    }
+} // namespace
+
+ThumbnailCache::ThumbnailCache(const std::filesystem::path &projectRoot)
+{
+    if (!projectRoot.empty())
+        m_directory = projectRoot / THUMBNAIL_DIRECTORY;
+}
+
+std::filesystem::path ThumbnailCache::getFilePath(uint64_t contentHash) const
+{
+    char fileName[32];
+    std::snprintf(fileName, sizeof(fileName), "%016llx.vxthumb", static_cast<unsigned long long>(contentHash));
+    return m_directory / fileName;
+}
+
+bool ThumbnailCache::load(uint64_t contentHash, ThumbnailImage &outImage) const
+{
+    if (!isEnabled() || contentHash == 0u)
+        return false;
+
+    std::ifstream file(getFilePath(contentHash), std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    char magic[sizeof(THUMBNAIL_FILE_MAGIC)]{};
+    uint32_t version = 0u;
+    uint32_t width = 0u;
+    uint32_t height = 0u;
+    uint8_t srgb = 0u;
+    uint8_t algorithm = 0u;
+    uint32_t compressedSize = 0u;
+
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, THUMBNAIL_FILE_MAGIC, sizeof(magic)) != 0)
+        return false;
+
+    if (!readValue(file, version) || version != FILE_VERSION ||
+        !readValue(file, width) || !readValue(file, height) ||
+        !readValue(file, srgb) || !readValue(file, algorithm) ||
+        !readValue(file, compressedSize))
+        return false;
+
+    if (width == 0u || height == 0u || width > MAX_THUMBNAIL_DIMENSION || height > MAX_THUMBNAIL_DIMENSION)
+        return false;
+
+    const size_t pixelByteCount = static_cast<size_t>(width) * height * 4u;
+    if (compressedSize > pixelByteCount * 2u + 1024u)
+        return false;
+
+    std::vector<uint8_t> compressed(compressedSize);
+    if (!file.read(reinterpret_cast<char *>(compressed.data()), static_cast<std::streamsize>(compressed.size())))
+        return false;
+
+    ThumbnailImage image;
+    image.width = width;
+    image.height = height;
+    image.srgb = srgb != 0u;
+    if (!engine::Compressor::decompress(compressed, pixelByteCount, image.pixels, static_cast<engine::Compressor::Algorithm>(algorithm)) ||
+        !image.isValid())
+        return false;
+
+    outImage = std::move(image);
+    return true;
+}
+
+bool ThumbnailCache::store(uint64_t contentHash, const ThumbnailImage &image) const
+{
+    if (!isEnabled() || contentHash == 0u || !image.isValid())
+        return false;
+
+    // Deflate gives the smallest files; fall back to whatever this build was compiled with.
+    std::vector<uint8_t> compressed;
+    auto algorithm = engine::Compressor::Algorithm::Deflate;
+    if (!engine::Compressor::compress(image.pixels, compressed, algorithm))
+    {
+        algorithm = engine::Compressor::Algorithm::LZ4;
+        if (!engine::Compressor::compress(image.pixels, compressed, algorithm))
+        {
+            algorithm = engine::Compressor::Algorithm::None;
+            compressed = image.pixels;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(m_directory, errorCode);
+
+    const std::filesystem::path filePath = getFilePath(contentHash);
+    // Unique per write: two assets with identical contents may be stored at the same time.
+    const std::filesystem::path temporaryPath =
+        filePath.string() + ".tmp" + std::to_string(g_temporaryFileCounter.fetch_add(1u, std::memory_order_relaxed));
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+            return false;
+
+        file.write(THUMBNAIL_FILE_MAGIC, sizeof(THUMBNAIL_FILE_MAGIC));
+        writeValue(file, FILE_VERSION);
+        writeValue(file, image.width);
+        writeValue(file, image.height);
+        writeValue(file, static_cast<uint8_t>(image.srgb ? 1u : 0u));
+        writeValue(file, static_cast<uint8_t>(algorithm));
+        writeValue(file, static_cast<uint32_t>(compressed.size()));
+        file.write(reinterpret_cast<const char *>(compressed.data()), static_cast<std::streamsize>(compressed.size()));
+
+        if (!file)
+        {
+            file.close();
+            std::filesystem::remove(temporaryPath, errorCode);
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, filePath, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(temporaryPath, errorCode);
+        return false;
+    }
+
+    return true;
+}
+
+ThumbnailImage ThumbnailCache::downsample(const uint8_t *rgbaPixels,
+                                          uint32_t width,
+                                          uint32_t height,
+                                          size_t rowPitch,
+                                          bool srgb,
+                                          uint32_t maxSize)
+{
+    ThumbnailImage image;
+    if (!rgbaPixels || width == 0u || height == 0u || maxSize == 0u)
+        return image;
+
+    const uint32_t longerSide = std::max(width, height);
+    const double scale = longerSide > maxSize ? static_cast<double>(maxSize) / static_cast<double>(longerSide) : 1.0;
+
+    image.width = std::max(1u, static_cast<uint32_t>(static_cast<double>(width) * scale + 0.5));
+    image.height = std::max(1u, static_cast<uint32_t>(static_cast<double>(height) * scale + 0.5));
+    image.srgb = srgb;
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4u);
+
+    // Each destination pixel averages the source rectangle it covers; every source pixel is read once.
+    for (uint32_t y = 0u; y < image.height; ++y)
+    {
+        const uint32_t sourceY0 = static_cast<uint32_t>(static_cast<uint64_t>(y) * height / image.height);
+        const uint32_t sourceY1 = std::max(sourceY0 + 1u, static_cast<uint32_t>(static_cast<uint64_t>(y + 1u) * height / image.height));
+
+        for (uint32_t x = 0u; x < image.width; ++x)
+        {
+            const uint32_t sourceX0 = static_cast<uint32_t>(static_cast<uint64_t>(x) * width / image.width);
+            const uint32_t sourceX1 = std::max(sourceX0 + 1u, static_cast<uint32_t>(static_cast<uint64_t>(x + 1u) * width / image.width));
+
+            uint64_t sum[4] = {0u, 0u, 0u, 0u};
+            for (uint32_t sourceY = sourceY0; sourceY < sourceY1; ++sourceY)
+            {
+                const uint8_t *row = rgbaPixels + sourceY * rowPitch;
+                for (uint32_t sourceX = sourceX0; sourceX < sourceX1; ++sourceX)
+                {
+                    const uint8_t *pixel = row + static_cast<size_t>(sourceX) * 4u;
+                    sum[0] += pixel[0];
+                    sum[1] += pixel[1];
+                    sum[2] += pixel[2];
+                    sum[3] += pixel[3];
+                }
+            }
+
+            const uint64_t count = static_cast<uint64_t>(sourceX1 - sourceX0) * (sourceY1 - sourceY0);
+            uint8_t *destination = image.pixels.data() + (static_cast<size_t>(y) * image.width + x) * 4u;
+            for (int channel = 0; channel < 4; ++channel)
+                destination[channel] = static_cast<uint8_t>((sum[channel] + count / 2u) / count);
+        }
+    }
+
+    return image;
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -28,6 +28,19 @@ public:
                            size_t expectedSize,
                            std::vector<uint8_t> &output,
                            Algorithm algorithm);
+
+    // Raw-pointer variants for callers reading straight out of a mapped file.
+    static bool compress(const uint8_t *input,
+                         size_t inputSize,
+                         std::vector<uint8_t> &output,
+                         Algorithm algorithm = Algorithm::Deflate,
+                         int compressionLevel = 6);
+
+    static bool decompress(const uint8_t *input,
+                           size_t inputSize,
+                           size_t expectedSize,
+                           std::vector<uint8_t> &output,
+                           Algorithm algorithm);
 };
 
 ELIX_NESTED_NAMESPACE_END
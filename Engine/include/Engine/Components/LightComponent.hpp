@@ -106,10 +106,10 @@ public:
 
         m_light->position = transform->getWorldPosition();
 
-        if (auto *directional = dynamic_cast<DirectionalLight *>(m_light.get()))
-            directional->direction = computeWorldForward(*transform);
-        else if (auto *spot = dynamic_cast<SpotLight *>(m_light.get()))
-            spot->direction = computeWorldForward(*transform);
+        if (m_light->getType() == BaseLight::Type::Directional)
+            static_cast<DirectionalLight *>(m_light.get())->direction = computeWorldForward(*transform);
+        else if (m_light->getType() == BaseLight::Type::Spot)
+            static_cast<SpotLight *>(m_light.get())->direction = computeWorldForward(*transform);
     }
 
 protected:
@@ -133,14 +133,20 @@ private:
 
     LightType getLightTypeFromLight(BaseLight *light)
     {
-        if (auto directionalLight = dynamic_cast<DirectionalLight *>(light))
+        if (!light)
+            return LightType::NONE;
+
+        switch (light->getType())
+        {
+        case BaseLight::Type::Directional:
             return LightType::DIRECTIONAL;
-        else if (auto pointLight = dynamic_cast<PointLight *>(light))
+        case BaseLight::Type::Point:
             return LightType::POINT;
-        else if (auto spotLight = dynamic_cast<SpotLight *>(light))
+        case BaseLight::Type::Spot:
             return LightType::SPOT;
-        else
-            return LightType::NONE;
+        }
+
+        return LightType::NONE;
     }
 
     LightType m_lightType{LightType::NONE};
@@ -9,6 +9,8 @@
 
 #include <glm/vec3.hpp>
 
+#include <memory>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 class Transform3DComponent;
@@ -22,6 +24,24 @@ public:
     void update(float deltaTime) override;
     void syncFromPhysics();
 
+    // Called by the scene for bodies PhysX reported as active after a fixed step.
+    void capturePhysicsState(uint64_t stepIndex);
+    uint64_t getLastCapturedStep() const
+    {
+        return m_lastCapturedStep;
+    }
+    // Called for a body that went to sleep: the next interpolation lands exactly on its last pose.
+    void settlePhysicsState();
+    // Places the transform between the last two captured poses.
+    void interpolateTransform(float alpha);
+    bool isInterpolated() const;
+
+    // Expires with the component; lets the scene keep raw pointers to moving bodies across frames.
+    std::weak_ptr<const void> getLifetimeToken() const
+    {
+        return m_lifetimeToken;
+    }
+
     void setKinematic(bool isKinematic);
     bool isKinematic() const;
     void setGravityEnable(bool enable);
@@ -50,6 +70,11 @@ private:
 
     Transform3DComponent *m_transformComponent{nullptr};
     physx::PxRigidActor *m_rigidActor{nullptr};
+    physx::PxTransform m_previousPose{physx::PxIdentity};
+    physx::PxTransform m_currentPose{physx::PxIdentity};
+    bool m_hasPhysicsState{false};
+    uint64_t m_lastCapturedStep{0u};
+    std::shared_ptr<const void> m_lifetimeToken{std::make_shared<char>(0)};
 };
 
 ELIX_NESTED_NAMESPACE_END
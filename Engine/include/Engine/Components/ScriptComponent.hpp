@@ -17,12 +17,17 @@ public:
     void onAttach() override;
 
     void update(float deltaTime) override;
+    void fixedUpdate(float fixedDelta) override;
+    // Scripts that opted into parallel update are skipped by update() and driven by the scene through this.
+    void parallelUpdate(float deltaTime);
 
     void onDetach() override;
 
     [[nodiscard]] const std::string &getScriptName() const;
     [[nodiscard]] Script *getScript() const;
     [[nodiscard]] bool isAttached() const;
+    [[nodiscard]] bool hasParallelUpdate() const;
+    [[nodiscard]] const ScriptAccess &getParallelUpdateAccess() const;
     // True when the script name is set but no script instance exists (e.g. plugin not loaded).
     [[nodiscard]] bool isBroken() const;
     void setSerializedVariables(const Script::ExposedVariablesMap &variables);
@@ -40,7 +45,9 @@ private:
     Script *m_script{nullptr};
     std::string m_scriptName;
     Script::ExposedVariablesMap m_serializedVariables;
+    ScriptAccess m_parallelUpdateAccess;
     bool m_isAttached{false};
+    bool m_parallelUpdate{false};
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -6,9 +6,16 @@
 #include "Engine/Components/ECS.hpp"
 #include "Engine/Mesh.hpp"
 #include "Engine/Terrain/TerrainAsset.hpp"
+#include "Engine/Terrain/TerrainMeshBuilder.hpp"
+#include "Engine/Terrain/TerrainQuadtree.hpp"
+#include "Engine/Terrain/TerrainQuery.hpp"
 
+#include <glm/vec3.hpp>
+
+#include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -19,6 +26,8 @@ public:
     TerrainComponent();
     explicit TerrainComponent(std::shared_ptr<TerrainAsset> terrainAsset);
 
+    void update(float deltaTime) override;
+
     void setTerrainAsset(std::shared_ptr<TerrainAsset> terrainAsset);
     std::shared_ptr<TerrainAsset> getTerrainAsset() const;
 
@@ -31,13 +40,51 @@ public:
     void setQuadsPerChunk(uint32_t quadsPerChunk);
     uint32_t getQuadsPerChunk() const;
 
+    // With LOD enabled (default) the chunk meshes are the quadtree patches selected for the
+    // camera; otherwise every chunk is built at full heightmap resolution.
+    void setLodEnabled(bool enabled);
+    bool isLodEnabled() const;
+
+    void setLodSettings(const TerrainLodSettings &settings);
+    const TerrainLodSettings &getLodSettings() const;
+
+    // Full rebuild, e.g. after the asset or chunk layout changed.
     void setChunksDirty();
+
+    // Call after editing height samples inside `region` (sculpting, runtime deformation). Only the
+    // chunks or LOD patches reading those samples are rebuilt, on the job system; the previous
+    // meshes keep rendering until the whole batch is ready. Edits made meanwhile queue up.
+    void markHeightsDirty(const TerrainRegion &region);
+    bool isRebuildPending() const;
+
     void ensureChunkMeshesBuilt();
 
+    // Rebuilds dirty data, then reselects LOD patches for a camera in terrain-local space.
+    // Cheap when the selection is unchanged; new patches are built on the job system.
+    void updateLod(const glm::vec3 &localCameraPosition);
+
     const std::vector<CPUMesh> &getChunkMeshes() const;
 
+    // Height, normal and ray queries in world space, following the owner's transform as of the last
+    // update(). Reads the asset directly, so sculpted heights are visible as soon as they are marked.
+    const TerrainQuery &getQuery() const;
+
+    // Geometry of meshes replaced by partial rebuilds, for MeshGeometryRegistry::retireGeometry.
+    std::vector<MeshGeometryHash> takeRetiredGeometry();
+
 private:
+    struct RebuildBatch
+    {
+        std::vector<uint64_t> keys; // chunk index, or patch key in LOD mode
+        std::vector<TerrainMeshSource> sources;
+        std::vector<CPUMesh> meshes;
+        std::atomic<uint32_t> pendingTasks{0u};
+    };
+
     void rebuildChunkMeshes();
+    void launchRegionRebuild();
+    void applyFinishedRebuild();
+    uint32_t getPatchQuads() const;
 
 private:
     std::shared_ptr<TerrainAsset> m_terrainAsset{nullptr};
@@ -47,6 +94,19 @@ private:
     uint32_t m_quadsPerChunk{63u};
     bool m_chunkMeshesDirty{true};
     std::vector<CPUMesh> m_chunkMeshes;
+
+    bool m_lodEnabled{true};
+    TerrainLodSettings m_lodSettings{};
+    TerrainQuadtree m_quadtree;
+    std::vector<TerrainLodSelection> m_lodSelection;
+    std::vector<uint64_t> m_selectedPatchKeys; // parallel to m_chunkMeshes in LOD mode
+    std::unordered_map<uint64_t, CPUMesh> m_patchCache;
+
+    TerrainRegion m_dirtyRegion{};
+    std::shared_ptr<RebuildBatch> m_rebuildBatch{nullptr}; // back buffer, owned jointly with its jobs
+    std::vector<MeshGeometryHash> m_retiredGeometry;
+
+    TerrainQuery m_query;
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -33,15 +33,27 @@ public:
     glm::quat getWorldRotation() const;
     void setWorldPosition(const glm::vec3 &position);
     void setWorldRotation(const glm::quat &rotation);
+    // Same as setWorldPosition + setWorldRotation with one parent lookup and inverse.
+    void setWorldPose(const glm::vec3 &position, const glm::quat &rotation);
 
     glm::mat4 getLocalMatrix() const;
     glm::mat4 getMatrix() const;
+
+    // Called by Scene before the parallel script phase. During the phase the const getters return
+    // this copy to every job except the one running this entity's scripts, so jobs can read other
+    // entities' transforms while their owners move them.
+    void captureParallelReadSnapshot();
 private:
     const Transform3DComponent *getParentTransform() const;
+    bool readsParallelSnapshot() const;
 
     glm::vec3 m_position{0.0f};
     glm::vec3 m_scale{1.0f};
     glm::quat m_rotation{1.0f, 0.0f, 0.0f, 0.0f};
+
+    glm::vec3 m_snapshotPosition{0.0f};
+    glm::vec3 m_snapshotScale{1.0f};
+    glm::quat m_snapshotRotation{1.0f, 0.0f, 0.0f, 0.0f};
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -68,7 +68,18 @@ public:
                 component->update(deltaTime);
     }
 
-    virtual void fixedUpdate(float fixedDelta) {}
+    virtual void fixedUpdate(float fixedDelta)
+    {
+        if (!m_enabled)
+            return;
+
+        for (auto &component : m_components)
+            component.second->fixedUpdate(fixedDelta);
+
+        for (auto &[_, components] : m_multiComponents)
+            for (auto &component : components)
+                component->fixedUpdate(fixedDelta);
+    }
 
     virtual void postPhysicsUpdate(float deltaTime)
     {
@@ -99,6 +110,7 @@ public:
             m_multiComponents[type].emplace_back(std::move(comp));
         else
             m_components[type] = std::move(comp);
+        markComponentsChanged();
         return ptr;
     }
 
@@ -136,6 +148,8 @@ public:
             it->second->onDetach();
             m_components.erase(it);
         }
+
+        markComponentsChanged();
     }
 
     const std::unordered_map<std::type_index, std::shared_ptr<ECS>> &getSingleComponents() const
@@ -143,6 +157,24 @@ public:
         return m_components;
     }
 
+    const std::unordered_map<std::type_index, std::vector<std::shared_ptr<ECS>>> &getMultiComponents() const
+    {
+        return m_multiComponents;
+    }
+
+    // Type-erased lookups for callers that resolved the component type at runtime (scripting API).
+    ECS *findComponentByType(std::type_index type) const
+    {
+        auto it = m_components.find(type);
+        return it != m_components.end() ? it->second.get() : nullptr;
+    }
+
+    const std::vector<std::shared_ptr<ECS>> *findMultiComponentsByType(std::type_index type) const
+    {
+        auto it = m_multiComponents.find(type);
+        return it != m_multiComponents.end() ? &it->second : nullptr;
+    }
+
     template <typename T>
     std::vector<T *> getComponents()
     {
@@ -202,9 +234,16 @@ public:
     const std::vector<Entity *> &getChildren() const;
     bool isDescendantOf(const Entity *possibleAncestor) const;
 
+    // Bumped whenever any entity is renamed, reparented or destroyed, so views can cache the hierarchy.
+    static uint64_t getHierarchyRevision();
+    // Bumped whenever a component is added to or removed from any entity.
+    static uint64_t getComponentRevision();
+
     virtual ~Entity();
 
 private:
+    static void markComponentsChanged();
+
     std::unordered_map<std::type_index, std::shared_ptr<ECS>> m_components;
     std::unordered_map<std::type_index, std::vector<std::shared_ptr<ECS>>> m_multiComponents;
 
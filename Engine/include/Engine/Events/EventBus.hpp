@@ -3,15 +3,21 @@
 
 #include "Core/Macros.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <functional>
-#include <typeindex>
-#include <unordered_map>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+// Each event type gets its own static channel, so there is no type lookup at emit time.
+// emit() reads an immutable handler snapshot (no lock, no copy); subscribe/unsubscribe publish a new one.
+// queue() may be called from any thread; queued events are delivered on the thread calling flush()/flushAll(),
+// which the application loop does once per frame before the runtime tick.
 class EventBus
 {
 public:
@@ -20,72 +26,177 @@ public:
     template <typename EventType>
     static SubscriptionToken subscribe(std::function<void(const EventType &)> handler)
     {
-        auto &bucket = getBucket(typeid(EventType));
-        const SubscriptionToken token = bucket.nextToken++;
-        bucket.handlers.push_back({token, [h = std::move(handler)](const void *data)
-                                   {
-                                       h(*static_cast<const EventType *>(data));
-                                   }});
+        auto &channel = Channel<EventType>::get();
+
+        std::lock_guard<std::mutex> lock(channel.writeMutex);
+        const SubscriptionToken token = channel.nextToken++;
+
+        auto handlers = std::make_shared<HandlerList<EventType>>(*channel.handlers.load(std::memory_order_acquire));
+        handlers->push_back({token, std::move(handler)});
+        channel.handlers.store(std::shared_ptr<const HandlerList<EventType>>(std::move(handlers)), std::memory_order_release);
+
         return token;
     }
 
     template <typename EventType>
     static void emit(const EventType &event)
     {
-        auto it = s_buckets.find(typeid(EventType));
-        if (it == s_buckets.end())
-            return;
+        // Holding the snapshot keeps handlers alive even if a handler unsubscribes during dispatch.
+        const auto handlers = Channel<EventType>::get().handlers.load(std::memory_order_acquire);
+        for (const auto &entry : *handlers)
+            entry.handler(event);
+    }
+
+    // Thread-safe; the event is delivered at the next flush.
+    template <typename EventType>
+    static void queue(EventType event)
+    {
+        auto &channel = Channel<EventType>::get();
+
+        std::lock_guard<std::mutex> lock(channel.queueMutex);
+        channel.queued.push_back(std::move(event));
+    }
+
+    template <typename EventType>
+    static void flush()
+    {
+        Channel<EventType>::get().flushQueued();
+    }
 
-        const auto snapshot = it->second.handlers;
-        for (const auto &entry : snapshot)
-            entry.invoke(&event);
+    // Delivers queued events of every channel, in channel creation order.
+    static void flushAll()
+    {
+        for (size_t index = 0; auto *channel = channelAt(index); ++index)
+            channel->flushQueued();
     }
 
     template <typename EventType>
     static void unsubscribe(SubscriptionToken token)
     {
-        auto it = s_buckets.find(typeid(EventType));
-        if (it == s_buckets.end())
-            return;
-
-        auto &handlers = it->second.handlers;
-        handlers.erase(
-            std::remove_if(handlers.begin(), handlers.end(),
-                           [token](const HandlerEntry &e)
-                           { return e.token == token; }),
-            handlers.end());
+        auto &channel = Channel<EventType>::get();
+
+        std::lock_guard<std::mutex> lock(channel.writeMutex);
+        const auto current = channel.handlers.load(std::memory_order_acquire);
+
+        auto handlers = std::make_shared<HandlerList<EventType>>();
+        handlers->reserve(current->size());
+        std::copy_if(current->begin(), current->end(), std::back_inserter(*handlers),
+                     [token](const HandlerEntry<EventType> &e)
+                     { return e.token != token; });
+
+        channel.handlers.store(std::shared_ptr<const HandlerList<EventType>>(std::move(handlers)), std::memory_order_release);
     }
 
     template <typename EventType>
     static void clear()
     {
-        s_buckets.erase(typeid(EventType));
+        Channel<EventType>::get().clear();
     }
 
     static void clearAll()
     {
-        s_buckets.clear();
+        for (size_t index = 0; auto *channel = channelAt(index); ++index)
+            channel->clear();
     }
 
 private:
+    template <typename EventType>
     struct HandlerEntry
     {
         SubscriptionToken token{0};
-        std::function<void(const void *)> invoke;
+        std::function<void(const EventType &)> handler;
+    };
+
+    template <typename EventType>
+    using HandlerList = std::vector<HandlerEntry<EventType>>;
+
+    struct ChannelBase
+    {
+        virtual void flushQueued() = 0;
+        virtual void clear() = 0;
+        virtual ~ChannelBase() = default;
     };
 
-    struct Bucket
+    template <typename EventType>
+    struct Channel final : ChannelBase
     {
+        std::mutex writeMutex;
         SubscriptionToken nextToken{1};
-        std::vector<HandlerEntry> handlers;
+        std::atomic<std::shared_ptr<const HandlerList<EventType>>> handlers{std::make_shared<const HandlerList<EventType>>()};
+
+        std::mutex queueMutex;
+        std::vector<EventType> queued;
+        std::vector<EventType> delivering;
+
+        static Channel &get()
+        {
+            static Channel *channel = []
+            {
+                auto *created = new Channel();
+                registerChannel(created);
+                return created;
+            }();
+
+            return *channel;
+        }
+
+        void flushQueued() override
+        {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                // Empty queue, or a handler flushing its own channel again.
+                if (queued.empty() || !delivering.empty())
+                    return;
+
+                delivering.swap(queued);
+            }
+
+            // Both buffers keep their capacity, so steady-state flushing does not allocate.
+            const auto snapshot = handlers.load(std::memory_order_acquire);
+            for (const auto &event : delivering)
+                for (const auto &entry : *snapshot)
+                    entry.handler(event);
+
+            delivering.clear();
+        }
+
+        void clear() override
+        {
+            {
+                std::lock_guard<std::mutex> lock(writeMutex);
+                handlers.store(std::make_shared<const HandlerList<EventType>>(), std::memory_order_release);
+            }
+
+            std::lock_guard<std::mutex> lock(queueMutex);
+            queued.clear();
+        }
     };
 
-    static Bucket &getBucket(const std::type_index &type)
+    // Channels live for the whole program (never destroyed) so handlers can run during static teardown.
+    static void registerChannel(ChannelBase *channel)
     {
-        return s_buckets[type];
+        std::lock_guard<std::mutex> lock(registryMutex());
+        channels().push_back(channel);
     }
 
-    static inline std::unordered_map<std::type_index, Bucket> s_buckets;
+    // Indexed access so handlers may create new channels while flushAll() walks the list.
+    static ChannelBase *channelAt(size_t index)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        return index < channels().size() ? channels()[index] : nullptr;
+    }
+
+    static std::mutex &registryMutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<ChannelBase *> &channels()
+    {
+        static std::vector<ChannelBase *> registered;
+        return registered;
+    }
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -5,32 +5,59 @@
 
 #include <glm/glm.hpp>
 
+#include <cstdint>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 struct BaseLight
 {
+    // Lets per-frame code classify lights with a switch + static_cast instead of dynamic_cast chains.
+    enum class Type : uint8_t
+    {
+        Directional,
+        Point,
+        Spot
+    };
+
     glm::vec3 color{1.0f};
     glm::vec3 position{1.0f};
     float strength{1.0f};
     bool castsShadows{true};
 
+    Type getType() const
+    {
+        return m_type;
+    }
+
     virtual ~BaseLight() = default;
+
+protected:
+    explicit BaseLight(Type type) : m_type(type) {}
+
+private:
+    Type m_type;
 };
 
 struct DirectionalLight : BaseLight
 {
+    DirectionalLight() : BaseLight(Type::Directional) {}
+
     glm::vec3 direction{-0.5f, -1.0f, -0.3f};
     bool skyLightEnabled{true};
 };
 
 struct PointLight : BaseLight
 {
+    PointLight() : BaseLight(Type::Point) {}
+
     float radius{10.0f};
     float falloff{10.0f};
 };
 
 struct SpotLight : BaseLight
 {
+    SpotLight() : BaseLight(Type::Spot) {}
+
     glm::vec3 direction{-0.5f, -1.0f, -0.3f};
     float innerAngle{15.0f};
     float outerAngle{30.0f};
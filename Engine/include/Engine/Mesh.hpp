@@ -162,8 +162,9 @@ struct GPUMesh
     Material::SharedPtr material{nullptr};
 
     // Unified geometry buffer registration (set when the mesh is registered
-    // in UnifiedGeometryBuffer; INVALID_VERTEX_OFFSET means not registered).
+    // in a GeometryPoolManager pool; INVALID_VERTEX_OFFSET means not registered).
     static constexpr int32_t INVALID_VERTEX_OFFSET = INT32_MIN;
+    VkBuffer unifiedVertexBuffer{VK_NULL_HANDLE};        // VB of the pool for this vertex layout
     int32_t unifiedVertexOffset{INVALID_VERTEX_OFFSET}; // vertex index offset in unified VB
     uint32_t unifiedFirstIndex{0};                      // index offset in unified IB
     bool inUnifiedBuffer{false};
@@ -4,11 +4,13 @@
 #include "Core/Macros.hpp"
 
 #include <cstdint>
+#include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 struct Particle;
 class PhysicsScene;
+class TerrainQuery;
 
 enum class ParticleModuleType : uint8_t
 {
@@ -37,8 +39,15 @@ public:
 
     virtual void onParticleUpdate(Particle & /*particle*/, float /*deltaTime*/) {}
 
+    // Runs once per emitter update after the per-particle pass, over the whole pool (check alive).
+    // For modules that batch work across particles, e.g. physics queries.
+    virtual void onEmitterUpdate(std::vector<Particle> & /*particles*/, float /*deltaTime*/) {}
+
     virtual void setPhysicsScene(PhysicsScene * /*scene*/) {}
 
+    // Terrain under the emitter, or nullptr. Lets collision avoid physics queries against the ground.
+    virtual void setTerrainQuery(const TerrainQuery * /*terrainQuery*/) {}
+
     bool isEnabled() const { return m_enabled; }
     void setEnabled(bool value) { m_enabled = value; }
 
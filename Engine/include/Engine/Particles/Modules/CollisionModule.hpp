@@ -24,18 +24,34 @@ public:
 
     uint32_t splashCount{6};
 
+    // Test the ground with height samples instead of physics rays. Particles that reach the
+    // terrain are not raycast against the physics scene.
+    bool collideWithTerrain{true};
+
     ParticleModuleType getType() const override { return ParticleModuleType::Collision; }
 
     void setPhysicsScene(PhysicsScene *scene) override { m_physicsScene = scene; }
+    void setTerrainQuery(const TerrainQuery *terrainQuery) override { m_terrainQuery = terrainQuery; }
 
-    void onParticleUpdate(Particle &p, float dt) override;
+    // Samples the terrain for all moving particles at once, then casts one ray per remaining
+    // particle as a single batch on the job system.
+    void onEmitterUpdate(std::vector<Particle> &particles, float dt) override;
 
     const std::vector<glm::vec3> &getHitPositions() const { return m_hitPositions; }
     void clearHits() { m_hitPositions.clear(); }
 
 private:
     PhysicsScene *m_physicsScene{nullptr};
+    const TerrainQuery *m_terrainQuery{nullptr};
     std::vector<glm::vec3> m_hitPositions;
+
+    PhysicsRaycastBatch m_rayBatch;
+    std::vector<uint32_t> m_rayParticleIndices;
+    PhysicsQueryResults m_rayResults;
+
+    std::vector<glm::vec3> m_probePositions; // look-ahead end point per moving particle
+    std::vector<uint32_t> m_probeParticleIndices;
+    std::vector<float> m_probeTerrainHeights;
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -65,6 +65,9 @@ public:
     /// Propagates the physics scene pointer to all modules that support collision.
     void setPhysicsScene(PhysicsScene *scene);
 
+    /// Propagates the terrain under the system to all modules that support collision.
+    void setTerrainQuery(const TerrainQuery *terrainQuery);
+
     /// Spawns a burst of particles at an explicit world position, bypassing the emitter's
     /// shape module. Used for splash effects driven by CollisionModule hit positions.
     void spawnParticleAt(const glm::vec3 &worldPos, uint32_t count = 1);
@@ -34,6 +34,9 @@ public:
     /// Injects the physics scene into all emitters so CollisionModules can raycast.
     void setPhysicsScene(PhysicsScene *scene);
 
+    /// Injects the terrain under the system so CollisionModules can test the ground analytically.
+    void setTerrainQuery(const TerrainQuery *terrainQuery);
+
     void play();
     void stop();
     void pause();
@@ -3,9 +3,14 @@
 
 #include "Engine/Physics/PhysXCore.hpp"
 #include "Engine/Physics/PhysicsContactListener.hpp"
+#include "Engine/Physics/PhysicsTaskDispatcher.hpp"
 
 #include <glm/vec3.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 struct PhysicsRaycastHit
@@ -16,6 +21,129 @@ struct PhysicsRaycastHit
     float distance{0.0f};
 };
 
+// Batched scene queries take their inputs and return their results as parallel arrays (SoA), one entry
+// per query. Directions don't need to be normalized; zero-length directions and non-positive distances miss.
+struct PhysicsRaycastBatch
+{
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    std::vector<float> maxDistances;
+
+    void add(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance)
+    {
+        origins.push_back(origin);
+        directions.push_back(direction);
+        maxDistances.push_back(maxDistance);
+    }
+
+    void clear()
+    {
+        origins.clear();
+        directions.clear();
+        maxDistances.clear();
+    }
+
+    size_t size() const
+    {
+        return origins.size();
+    }
+};
+
+// Sphere sweeps.
+struct PhysicsSweepBatch
+{
+    std::vector<glm::vec3> origins;
+    std::vector<glm::vec3> directions;
+    std::vector<float> maxDistances;
+    std::vector<float> radii;
+
+    void add(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, float radius)
+    {
+        origins.push_back(origin);
+        directions.push_back(direction);
+        maxDistances.push_back(maxDistance);
+        radii.push_back(radius);
+    }
+
+    void clear()
+    {
+        origins.clear();
+        directions.clear();
+        maxDistances.clear();
+        radii.clear();
+    }
+
+    size_t size() const
+    {
+        return origins.size();
+    }
+};
+
+// Sphere overlaps; only hit flags and the first touching actor are reported.
+struct PhysicsOverlapBatch
+{
+    std::vector<glm::vec3> centers;
+    std::vector<float> radii;
+
+    void add(const glm::vec3 &center, float radius)
+    {
+        centers.push_back(center);
+        radii.push_back(radius);
+    }
+
+    void clear()
+    {
+        centers.clear();
+        radii.clear();
+    }
+
+    size_t size() const
+    {
+        return centers.size();
+    }
+};
+
+struct PhysicsQueryResults
+{
+    std::vector<uint8_t> hits;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<float> distances;
+    std::vector<void *> actorUserData;
+
+    void resize(size_t count)
+    {
+        hits.assign(count, 0u);
+        positions.resize(count);
+        normals.resize(count);
+        distances.resize(count);
+        actorUserData.assign(count, nullptr);
+    }
+
+    size_t size() const
+    {
+        return hits.size();
+    }
+};
+
+// Main-thread cost of one physics step. For an async step, overlappedMs is the main-thread work done
+// between simulate() and fetchResults(): all of it was hidden if fetchWaitMs > 0, otherwise it is an upper bound.
+struct PhysicsStepTimings
+{
+    double simulateCallMs{0.0};
+    double overlappedMs{0.0};
+    double fetchWaitMs{0.0};
+    bool async{false};
+};
+
+struct PhysicsTimingTotals
+{
+    uint64_t steps{0};
+    uint64_t asyncSteps{0};
+    double overlappedMs{0.0};
+    double fetchWaitMs{0.0};
+};
+
 class PhysicsScene
 {
 public:
@@ -26,10 +154,38 @@ public:
     explicit PhysicsScene(physx::PxPhysics *physics);
 #endif
 
+    // Simulates one step and blocks until it is done.
     void update(float deltaTime);
 
+    // Split-phase stepping: beginStep() kicks simulate() and returns, finishStep() blocks on fetchResults().
+    // Reads and buffered writes to the scene stay legal in between; actor removal syncs first.
+    void beginStep(float deltaTime);
+    bool finishStep();
+    bool isStepInFlight() const
+    {
+        return m_stepInFlight;
+    }
+
+    // Actors that moved in the last finished step (eENABLE_ACTIVE_ACTORS). Valid until the next beginStep().
+    physx::PxActor **getActiveActors(uint32_t &count) const;
+
+    const PhysicsStepTimings &getLastStepTimings() const
+    {
+        return m_lastStepTimings;
+    }
+
+    const PhysicsTimingTotals &getTimingTotals() const
+    {
+        return m_timingTotals;
+    }
+
     bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, PhysicsRaycastHit *outHit = nullptr) const;
 
+    // Run every query of the batch in parallel chunks on the job system and block until all are done.
+    void raycastBatch(const PhysicsRaycastBatch &batch, PhysicsQueryResults &results) const;
+    void sweepBatch(const PhysicsSweepBatch &batch, PhysicsQueryResults &results) const;
+    void overlapBatch(const PhysicsOverlapBatch &batch, PhysicsQueryResults &results) const;
+
     physx::PxRigidDynamic *createDynamic(const physx::PxTransform &transform);
 
     physx::PxShape *createShape(const physx::PxGeometry &geometry);
@@ -51,11 +207,16 @@ public:
 private:
     physx::PxPhysics *m_physics = nullptr;
 
-    physx::PxDefaultCpuDispatcher *m_defaultCpuDispatcher = nullptr;
+    PhysicsTaskDispatcher m_taskDispatcher;
     physx::PxMaterial *m_defaultMaterial = nullptr;
     physx::PxScene *m_scene = nullptr;
     physx::PxControllerManager *m_controllerManager = nullptr;
     PhysicsContactListener m_contactListener;
+
+    bool m_stepInFlight{false};
+    std::chrono::steady_clock::time_point m_stepKickTime{};
+    PhysicsStepTimings m_lastStepTimings{};
+    PhysicsTimingTotals m_timingTotals{};
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,19 @@
+#ifndef ELIX_PHYSICS_TASK_DISPATCHER_HPP
+#define ELIX_PHYSICS_TASK_DISPATCHER_HPP
+
+#include "Engine/Physics/PhysXCore.hpp"
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Runs PhysX tasks on the engine's ThreadPoolManager workers, so physics shares one set of
+// threads with the rest of the engine instead of spawning its own.
+class PhysicsTaskDispatcher final : public physx::PxCpuDispatcher
+{
+public:
+    void submitTask(physx::PxBaseTask &task) override;
+    uint32_t getWorkerCount() const override;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_PHYSICS_TASK_DISPATCHER_HPP
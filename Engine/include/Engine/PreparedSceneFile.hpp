@@ -0,0 +1,67 @@
+#ifndef ELIX_PREPARED_SCENE_FILE_HPP
+#define ELIX_PREPARED_SCENE_FILE_HPP
+
+#include "Core/Macros.hpp"
+
+#include "Engine/Assets/Asset.hpp"
+#include "Engine/Assets/AssetHandle.hpp"
+#include "Engine/Terrain/TerrainAsset.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Scene file read off the main thread, together with the assets its entities reference.
+// Scene builds entities from it with beginIncrementalLoad() / continueIncrementalLoad().
+class PreparedSceneFile
+{
+public:
+    using SharedPtr = std::shared_ptr<PreparedSceneFile>;
+
+    // Reads and parses the file. With prefetchAssets it also loads terrain and animation assets and
+    // queues every referenced model on AssetManager. nullptr on failure. Safe off the main thread, but not on a
+    // ThreadPoolManager worker: terrain decoding runs its own parallelFor.
+    static SharedPtr load(const std::string &filePath, bool prefetchAssets);
+
+    PreparedSceneFile(const PreparedSceneFile &) = delete;
+    PreparedSceneFile &operator=(const PreparedSceneFile &) = delete;
+
+    const std::string &getFilePath() const { return m_filePath; }
+    const nlohmann::json &getJson() const { return m_json; }
+
+    // Paths in scene files are relative to the scene's directory.
+    std::string resolvePath(const std::string &rawPath) const;
+
+    // Models still streaming in. The file must stay alive until this reaches zero.
+    std::size_t getPendingModelCount() const;
+    std::size_t getPrefetchedModelCount() const { return m_modelHandles.size(); }
+    bool isModelPrefetched(const std::string &path) const;
+
+    // Hands out the prefetched terrain once; later requests for the same path return nullptr.
+    std::shared_ptr<TerrainAsset> takeTerrainAsset(const std::string &path);
+    std::shared_ptr<const AnimationAsset> findAnimationAsset(const std::string &path) const;
+
+private:
+    PreparedSceneFile() = default;
+
+    void prefetchAssets();
+
+    std::string m_filePath;
+    std::filesystem::path m_sceneDirectory;
+    nlohmann::json m_json;
+
+    // Handles hold the streamed data so mesh components created from this file resolve from AssetManager's cache.
+    std::unordered_map<std::string, std::unique_ptr<AssetHandle<ModelAsset>>> m_modelHandles;
+    std::unordered_map<std::string, std::shared_ptr<TerrainAsset>> m_terrainAssets;
+    std::unordered_map<std::string, std::shared_ptr<const AnimationAsset>> m_animationAssets;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_PREPARED_SCENE_FILE_HPP
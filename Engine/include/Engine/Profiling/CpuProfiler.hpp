@@ -0,0 +1,90 @@
+#ifndef ELIX_CPU_PROFILER_HPP
+#define ELIX_CPU_PROFILER_HPP
+
+#include "Core/Macros.hpp"
+
+#include <cstdint>
+#include <string>
+
+// Shipping builds (ELIX_SHIPPING_BUILD) compile every VX_PROFILE_* macro to nothing.
+#ifndef VX_PROFILER_ENABLED
+#if defined(ELIX_SHIPPING_BUILD)
+#define VX_PROFILER_ENABLED 0
+#else
+#define VX_PROFILER_ENABLED 1
+#endif
+#endif
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+ELIX_CUSTOM_NAMESPACE_BEGIN(profiling)
+
+// Timeline capture of VX_PROFILE_SCOPE regions on every thread, exported as Chrome trace JSON
+// (chrome://tracing, ui.perfetto.dev). Each thread records into its own buffer without locks;
+// recording is skipped entirely while no capture is running.
+class CpuProfiler
+{
+public:
+    // Starts a capture that ends after `frameCount` calls to endFrame() and is then written to `outputPath`.
+    static void requestCapture(uint32_t frameCount, const std::string &outputPath);
+    static void beginCapture();
+    static void endCapture();
+    static bool isCapturing();
+
+    // Called once per frame by the application loop; finishes a requested capture.
+    static void endFrame();
+
+    static bool writeChromeTrace(const std::string &outputPath);
+    static std::string getLastTracePath();
+
+    // Name shown for the calling thread in the trace.
+    static void setThreadName(const char *name);
+
+    static uint64_t nowNs();
+    static void recordEvent(const char *name, uint64_t startNs, uint64_t endNs);
+};
+
+class ProfileScope
+{
+public:
+    // `name` must outlive the capture (string literal or __func__).
+    explicit ProfileScope(const char *name)
+    {
+        if (CpuProfiler::isCapturing())
+        {
+            m_name = name;
+            m_startNs = CpuProfiler::nowNs();
+        }
+    }
+
+    ~ProfileScope()
+    {
+        if (m_name)
+            CpuProfiler::recordEvent(m_name, m_startNs, CpuProfiler::nowNs());
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+    const char *m_name{nullptr};
+    uint64_t m_startNs{0};
+};
+
+ELIX_CUSTOM_NAMESPACE_END
+ELIX_NESTED_NAMESPACE_END
+
+#if VX_PROFILER_ENABLED
+#define VX_PROFILE_CONCAT_INNER(a, b) a##b
+#define VX_PROFILE_CONCAT(a, b) VX_PROFILE_CONCAT_INNER(a, b)
+#define VX_PROFILE_SCOPE(name) ::elix::engine::profiling::ProfileScope VX_PROFILE_CONCAT(__vx_profile_scope_, __LINE__)(name)
+#define VX_PROFILE_FUNCTION() VX_PROFILE_SCOPE(__func__)
+#define VX_PROFILE_THREAD_NAME(name) ::elix::engine::profiling::CpuProfiler::setThreadName(name)
+#define VX_PROFILE_FRAME_END() ::elix::engine::profiling::CpuProfiler::endFrame()
+#else
+#define VX_PROFILE_SCOPE(name) ((void)0)
+#define VX_PROFILE_FUNCTION() ((void)0)
+#define VX_PROFILE_THREAD_NAME(name) ((void)0)
+#define VX_PROFILE_FRAME_END() ((void)0)
+#endif
+
+#endif // ELIX_CPU_PROFILER_HPP
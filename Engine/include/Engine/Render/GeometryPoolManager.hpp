@@ -0,0 +1,85 @@
+#ifndef ELIX_GEOMETRY_POOL_MANAGER_HPP
+#define ELIX_GEOMETRY_POOL_MANAGER_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Mesh.hpp"
+#include "Engine/Render/UnifiedGeometryBuffer.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// One UnifiedGeometryBuffer per vertex layout (keyed by CPUMesh::vertexLayoutHash),
+// all sharing a single index buffer. Static, skinned and terrain geometry therefore
+// live in a handful of big buffers: draws only rebind the vertex buffer when the
+// layout changes and the index buffer is bound once per pass.
+// Pools are created lazily on the first mesh of a given layout.
+class GeometryPoolManager
+{
+public:
+    struct PoolAllocation
+    {
+        uint64_t vertexLayoutHash{0u};
+        UnifiedGeometryBuffer::MeshAllocation allocation{};
+
+        bool isValid() const { return allocation.isValid(); }
+    };
+
+    struct PoolStatistics
+    {
+        uint64_t vertexLayoutHash{0u};
+        uint32_t vertexStride{0u};
+        UnifiedGeometryBuffer::Statistics statistics{};
+    };
+
+    static constexpr VkDeviceSize STATIC_POOL_VERTEX_BYTES = 512ULL * 1024 * 1024;  // Vertex3D (static meshes, terrain)
+    static constexpr VkDeviceSize SKINNED_POOL_VERTEX_BYTES = 256ULL * 1024 * 1024; // VertexSkinned
+    static constexpr VkDeviceSize DEFAULT_POOL_VERTEX_BYTES = 64ULL * 1024 * 1024;  // any other layout
+
+    // maxIndices: capacity of the shared index buffer (uint32 indices). The GPU
+    // buffer is allocated with the first pool.
+    void init(uint32_t maxIndices);
+
+    // Overrides the vertex budget of a layout; only affects pools created afterwards.
+    void setPoolVertexBudget(uint64_t vertexLayoutHash, VkDeviceSize maxVertexBytes);
+
+    // Registers the mesh in the pool of its vertex layout. On success fills the
+    // offsets, the allocation and the pool's vertex buffer.
+    bool registerMesh(const CPUMesh &mesh, int32_t &outVertexOffset, uint32_t &outFirstIndex,
+                      PoolAllocation &outAllocation, VkBuffer &outVertexBuffer);
+
+    void releaseMesh(const PoolAllocation &allocation);
+    // Copies are recorded into one command buffer for all pools; submitRelocations()
+    // sends them and returns the completion value to store in each relocated allocation.
+    bool relocateMesh(PoolAllocation &allocation, int32_t &outVertexOffset, uint32_t &outFirstIndex);
+    bool submitRelocations(uint64_t &outCompletionValue);
+
+    // Call once per frame after the frame fence wait.
+    void advanceFrame();
+
+    UnifiedGeometryBuffer *findPool(uint64_t vertexLayoutHash);
+    const UnifiedGeometryBuffer *findPool(uint64_t vertexLayoutHash) const;
+
+    VkBuffer getIndexBuffer() const { return m_indexStorage && m_indexStorage->buffer ? m_indexStorage->buffer->vk() : VK_NULL_HANDLE; }
+
+    std::vector<PoolStatistics> getStatistics() const;
+
+private:
+    UnifiedGeometryBuffer *getOrCreatePool(uint64_t vertexLayoutHash, uint32_t vertexStride);
+    VkDeviceSize getPoolVertexBudget(uint64_t vertexLayoutHash) const;
+
+    UnifiedGeometryBuffer::IndexStorage::SharedPtr m_indexStorage{nullptr};
+    uint32_t m_maxIndices{0u};
+
+    std::unordered_map<uint64_t, std::unique_ptr<UnifiedGeometryBuffer>> m_pools;
+    std::unordered_map<uint64_t, VkDeviceSize> m_vertexBudgets;
+
+    core::CommandBuffer::SharedPtr m_relocationCommandBuffer{nullptr};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_GEOMETRY_POOL_MANAGER_HPP
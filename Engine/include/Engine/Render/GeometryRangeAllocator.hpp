@@ -0,0 +1,114 @@
+#ifndef ELIX_GEOMETRY_RANGE_ALLOCATOR_HPP
+#define ELIX_GEOMETRY_RANGE_ALLOCATOR_HPP
+
+#include "Core/Macros.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// TLSF (two-level segregated fit) range allocator over an abstract linear space.
+// Units are whatever the caller decides (vertices, indices, bytes) - the allocator
+// never touches memory, so it is CPU-only and can be exercised without a device.
+// allocate()/free() are O(1); adjacent free ranges are coalesced on free().
+// Not thread-safe: the owner is expected to serialize access.
+class GeometryRangeAllocator
+{
+public:
+    using AllocationId = uint32_t;
+    static constexpr AllocationId INVALID_ALLOCATION = UINT32_MAX;
+
+    struct Allocation
+    {
+        AllocationId id{INVALID_ALLOCATION};
+        uint64_t offset{0u};
+        uint64_t size{0u};
+
+        bool isValid() const { return id != INVALID_ALLOCATION; }
+    };
+
+    struct Statistics
+    {
+        uint64_t capacity{0u};
+        uint64_t usedSize{0u};
+        uint64_t freeSize{0u};
+        uint64_t largestFreeRange{0u};
+        uint32_t allocationCount{0u};
+        uint32_t freeRangeCount{0u};
+
+        // 0 = all free space is one contiguous range, -> 1 = free space is scattered.
+        float fragmentation() const
+        {
+            return freeSize > 0u ? 1.0f - static_cast<float>(largestFreeRange) / static_cast<float>(freeSize) : 0.0f;
+        }
+    };
+
+    void init(uint64_t capacity);
+
+    // Drops every allocation and returns the whole space to a single free range.
+    void reset();
+
+    // Returns an invalid allocation when no free range can hold `size` units.
+    Allocation allocate(uint64_t size);
+
+    // Lowest-address fit that ends at or before `endLimit`. Used by compaction to
+    // pull live ranges towards the start of the space. O(number of ranges).
+    Allocation allocateLowest(uint64_t size, uint64_t endLimit);
+
+    void free(AllocationId id);
+
+    Allocation getAllocation(AllocationId id) const;
+    Statistics getStatistics() const;
+
+    uint64_t getCapacity() const { return m_capacity; }
+    bool isInitialized() const { return m_capacity > 0u; }
+
+private:
+    static constexpr uint32_t SECOND_LEVEL_BITS = 4u;
+    static constexpr uint32_t SECOND_LEVEL_COUNT = 1u << SECOND_LEVEL_BITS;
+    static constexpr uint32_t FIRST_LEVEL_COUNT = 64u - SECOND_LEVEL_BITS + 1u;
+    static constexpr uint32_t INVALID_BLOCK = UINT32_MAX;
+
+    struct Block
+    {
+        uint64_t offset{0u};
+        uint64_t size{0u};
+        uint32_t prevPhysical{INVALID_BLOCK};
+        uint32_t nextPhysical{INVALID_BLOCK};
+        uint32_t prevFree{INVALID_BLOCK};
+        uint32_t nextFree{INVALID_BLOCK};
+        bool free{false};
+        bool used{false}; // slot in m_blocks is occupied (free or allocated)
+    };
+
+    static void mapping(uint64_t size, uint32_t &outFirstLevel, uint32_t &outSecondLevel);
+    static void mappingSearch(uint64_t size, uint32_t &outFirstLevel, uint32_t &outSecondLevel);
+
+    uint32_t findSuitableBlock(uint32_t firstLevel, uint32_t secondLevel) const;
+    void insertFreeBlock(uint32_t blockIndex);
+    void removeFreeBlock(uint32_t blockIndex);
+    uint32_t splitBlock(uint32_t blockIndex, uint64_t size);
+    void mergeIntoPrevious(uint32_t blockIndex);
+    Allocation markAllocated(uint32_t blockIndex, uint64_t size);
+
+    uint32_t acquireBlockSlot();
+    void releaseBlockSlot(uint32_t blockIndex);
+
+    std::vector<Block> m_blocks;
+    std::vector<uint32_t> m_freeSlots;
+    std::array<std::array<uint32_t, SECOND_LEVEL_COUNT>, FIRST_LEVEL_COUNT> m_freeLists{};
+    std::array<uint32_t, FIRST_LEVEL_COUNT> m_secondLevelBitmaps{};
+    uint64_t m_firstLevelBitmap{0u};
+
+    uint64_t m_capacity{0u};
+    uint64_t m_usedSize{0u};
+    uint32_t m_allocationCount{0u};
+    uint32_t m_freeRangeCount{0u};
+    uint32_t m_firstBlock{INVALID_BLOCK};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_GEOMETRY_RANGE_ALLOCATOR_HPP
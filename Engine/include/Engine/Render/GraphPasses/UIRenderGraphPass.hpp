@@ -24,6 +24,12 @@ ELIX_CUSTOM_NAMESPACE_BEGIN(renderGraph)
 ///
 /// The render graph orchestrator is responsible for collecting ui::UIRenderData
 /// from the scene each frame and calling setRenderData() before record() runs.
+///
+/// Text geometry is retained per UI object and only rebuilt when its text, font, scale
+/// or transform changes. All quads and glyphs of a frame are written into one
+/// persistently mapped vertex ring (one region per frame in flight), so the pass binds
+/// a single vertex buffer and adjacent text runs sharing an atlas and colour collapse
+/// into one draw.
 class UIRenderGraphPass : public IRenderGraphPass
 {
 public:
@@ -82,10 +88,44 @@ private:
     void recordUIText(core::CommandBuffer::SharedPtr commandBuffer);
     void recordUIButtons(core::CommandBuffer::SharedPtr commandBuffer);
 
+    // Everything besides the string that affects the glyph quads of a text run. A cached
+    // mesh is reused as long as its text and key compare equal.
+    struct TextMeshKey
+    {
+        const ui::Font *font{nullptr};
+        const ui::FontAtlas *atlas{nullptr};
+        float scale{0.0f};
+        glm::vec2 position{0.0f};
+        glm::vec2 size{0.0f}; // non-zero: centre the text in the [position, position + size] box
+        float rotation{0.0f};
+        float aspectCorrection{1.0f};
+
+        bool operator==(const TextMeshKey &other) const = default;
+    };
+
+    struct CachedTextMesh
+    {
+        std::string text;
+        TextMeshKey key;
+        std::vector<vertex::Vertex2D> vertices;
+        uint64_t lastUsedFrame{0};
+    };
+
+    // Cached text meshes not used for this many frames are dropped.
+    static constexpr uint64_t TEXT_MESH_EVICTION_FRAMES = 120u;
+    static constexpr uint32_t INITIAL_VERTEX_RING_CAPACITY = 16384u; // vertices per frame region
+
     ui::FontAtlas *getOrBuildAtlas(const ui::Font *font);
-    core::Buffer::SharedPtr uploadVertices(const std::vector<vertex::Vertex2D> &verts, uint32_t currentFrame);
     VkDescriptorSet getTextureDescriptorSet(VkImageView view, VkSampler sampler);
 
+    const std::vector<vertex::Vertex2D> &getOrBuildTextMesh(const void *owner, const std::string &text, const TextMeshKey &key);
+    static void buildTextMesh(const std::string &text, const TextMeshKey &key, std::vector<vertex::Vertex2D> &vertices);
+
+    // Appends to this frame's vertex stream and returns the first vertex.
+    uint32_t appendVertices(const vertex::Vertex2D *vertices, size_t count);
+    void uploadFrameVertices(uint32_t currentFrame);
+    void releaseVertexRing();
+
     struct PreparedBillboardDraw
     {
         VkDescriptorSet descriptorSet{VK_NULL_HANDLE};
@@ -95,20 +135,20 @@ private:
     struct PreparedTextDraw
     {
         VkDescriptorSet descriptorSet{VK_NULL_HANDLE};
-        core::Buffer::SharedPtr vertexBuffer{nullptr};
+        uint32_t firstVertex{0};
         uint32_t vertexCount{0};
         UITextPC pushConstants{};
     };
 
     struct PreparedButtonDraw
     {
-        core::Buffer::SharedPtr backgroundVertexBuffer{nullptr};
+        uint32_t backgroundFirstVertex{0};
         uint32_t backgroundVertexCount{0};
         UIQuadPC backgroundPushConstants{};
 
         bool hasLabel{false};
         VkDescriptorSet labelDescriptorSet{VK_NULL_HANDLE};
-        core::Buffer::SharedPtr labelVertexBuffer{nullptr};
+        uint32_t labelFirstVertex{0};
         uint32_t labelVertexCount{0};
         UITextPC labelPushConstants{};
     };
@@ -141,7 +181,19 @@ private:
 
     std::unordered_map<std::string, std::unique_ptr<ui::FontAtlas>> m_fontAtlases;
     std::unordered_map<VkImageView, VkDescriptorSet>                m_texDescriptorSets;
-    std::vector<std::vector<core::Buffer::SharedPtr>>               m_transientVertexBuffersByFrame;
+    std::unordered_map<const void *, CachedTextMesh>                m_textMeshCache;
+    uint64_t                                                        m_uiFrameIndex{0};
+
+    // Persistently mapped ring: m_vertexRingFrameCount regions of m_vertexRingCapacity vertices.
+    core::Buffer::SharedPtr                                         m_vertexRing{nullptr};
+    vertex::Vertex2D                                               *m_vertexRingMapped{nullptr};
+    uint32_t                                                        m_vertexRingCapacity{0};
+    uint32_t                                                        m_vertexRingFrameCount{2};
+    VkDeviceSize                                                    m_vertexRingFrameOffset{0};
+    // Rings replaced by a grow, kept until their frame slot comes around again.
+    std::vector<std::vector<core::Buffer::SharedPtr>>               m_retiredVertexRingsByFrame;
+    std::vector<vertex::Vertex2D>                                   m_frameVertices;
+
     std::vector<PreparedBillboardDraw>                              m_preparedBillboards;
     std::vector<PreparedTextDraw>                                   m_preparedTexts;
     std::vector<PreparedButtonDraw>                                 m_preparedButtons;
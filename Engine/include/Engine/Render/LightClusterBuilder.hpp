@@ -0,0 +1,124 @@
+#ifndef ELIX_LIGHT_CLUSTER_BUILDER_HPP
+#define ELIX_LIGHT_CLUSTER_BUILDER_HPP
+
+#include "Core/Macros.hpp"
+
+#include "Engine/Render/RenderGraphPassPerFrameData.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// CPU clustered (froxel) light assignment.
+// The view frustum is split into GRID_X x GRID_Y screen tiles and GRID_Z exponential
+// depth slices. Every point/spot light is binned into the clusters touched by its
+// bounding sphere, so the lighting pass only shades against the lights of the pixel's
+// cluster. Directional lights affect everything and are kept in a separate list.
+//
+// build() tests four clusters at a time with SSE and bins depth slices in parallel on
+// ThreadPoolManager; buildReference() is the scalar brute-force version with identical
+// output, which velix_bench's light_clusters benchmark verifies.
+// CPU-only (no device access).
+class LightClusterBuilder
+{
+public:
+    static constexpr uint32_t GRID_X = 16u;
+    static constexpr uint32_t GRID_Y = 9u;
+    static constexpr uint32_t GRID_Z = 24u;
+    static constexpr uint32_t TILES_PER_SLICE = GRID_X * GRID_Y;
+    static constexpr uint32_t CLUSTER_COUNT = TILES_PER_SLICE * GRID_Z;
+
+    // Lights beyond these budgets are dropped (counted in getOverflowCount()).
+    static constexpr uint32_t MAX_LIGHTS_PER_CLUSTER = 128u;
+    static constexpr uint32_t MAX_LIGHT_INDICES = CLUSTER_COUNT * 32u;
+
+    // Mirrors the LightClusterSSBO header in lighting.frag / lighting_rt.frag.
+    struct GpuHeader
+    {
+        glm::uvec4 gridSize{GRID_X, GRID_Y, GRID_Z, 0u}; // w = directional light count
+        glm::vec4 depthParams{0.0f};                      // x = near, y = far, z = slice scale, w = slice bias
+    };
+
+    // Size of the GPU buffer holding the header followed by getData().
+    static constexpr VkDeviceSize GPU_BUFFER_SIZE =
+        sizeof(GpuHeader) + static_cast<VkDeviceSize>(CLUSTER_COUNT * 2u + MAX_LIGHT_INDICES) * sizeof(uint32_t);
+
+    // lights: view-space light data as uploaded to the light SSBO.
+    // projection: camera projection (not Vulkan-flipped).
+    void build(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane);
+    void buildReference(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane);
+
+    const GpuHeader &getHeader() const
+    {
+        return m_header;
+    }
+
+    // [CLUSTER_COUNT * 2] (offset, count) pairs with offsets into this array, followed
+    // by the directional light indices (header.gridSize.w of them) and the per-cluster
+    // light index lists.
+    const std::vector<uint32_t> &getData() const
+    {
+        return m_data;
+    }
+
+    uint32_t getOverflowCount() const
+    {
+        return m_overflowCount;
+    }
+
+    // Cluster a view-space depth falls into (same formula as the shaders).
+    uint32_t getSliceForDepth(float viewDepth) const;
+
+private:
+    struct LocalLight
+    {
+        uint32_t lightIndex{0u};
+        glm::vec3 center{0.0f};
+        float radiusSquared{0.0f};
+        uint32_t firstSlice{0u};
+        uint32_t lastSlice{0u};
+    };
+
+    // View-space AABBs of the tiles of one depth slice, structure-of-arrays for SIMD.
+    struct SliceBounds
+    {
+        alignas(16) std::array<float, TILES_PER_SLICE> minX{};
+        alignas(16) std::array<float, TILES_PER_SLICE> minY{};
+        alignas(16) std::array<float, TILES_PER_SLICE> minZ{};
+        alignas(16) std::array<float, TILES_PER_SLICE> maxX{};
+        alignas(16) std::array<float, TILES_PER_SLICE> maxY{};
+        alignas(16) std::array<float, TILES_PER_SLICE> maxZ{};
+    };
+
+    void prepare(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane);
+    void updateClusterBounds(const glm::mat4 &projection, float nearPlane, float farPlane);
+    void binSlice(uint32_t slice);
+    void compact();
+
+    static bool sphereIntersectsTile(const SliceBounds &bounds, uint32_t tile, const LocalLight &light);
+
+    GpuHeader m_header{};
+    std::vector<SliceBounds> m_sliceBounds;
+    std::vector<LocalLight> m_localLights;
+    std::vector<uint32_t> m_directionalLights;
+
+    // Per cluster: up to MAX_LIGHTS_PER_CLUSTER light indices, filled by binSlice().
+    std::vector<uint32_t> m_clusterLights;
+    std::vector<uint32_t> m_clusterCounts;
+    std::array<uint32_t, GRID_Z> m_sliceOverflow{};
+
+    std::vector<uint32_t> m_data;
+    uint32_t m_overflowCount{0u};
+
+    glm::mat4 m_boundsProjection{0.0f};
+    float m_boundsNear{0.0f};
+    float m_boundsFar{0.0f};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_LIGHT_CLUSTER_BUILDER_HPP
@@ -3,9 +3,10 @@
 
 #include "Core/Macros.hpp"
 #include "Engine/Mesh.hpp"
-#include "Engine/Render/UnifiedGeometryBuffer.hpp"
+#include "Engine/Render/GeometryPoolManager.hpp"
 
 #include <unordered_map>
+#include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
@@ -16,11 +17,21 @@ public:
     {
         MeshGeometryHash geometryHash{};
         GPUMesh::SharedPtr sharedMesh{nullptr};
+        GeometryPoolManager::PoolAllocation unifiedAllocation{};
+        std::vector<std::weak_ptr<GPUMesh>> instances; // patched when the unified ranges move
+        uint32_t unusedFrames{0u};
+        bool retired{false};
     };
 
-    void setUnifiedGeometryBuffer(UnifiedGeometryBuffer *unifiedGeometryBuffer,
-                                  VkDeviceSize unifiedVertexBufferSize,
-                                  uint32_t unifiedIndexBufferCount);
+    // Entries without live draw instances for this many frames are evicted and
+    // their unified buffer ranges released (hysteresis for streaming in/out).
+    static constexpr uint32_t UNUSED_GEOMETRY_EVICTION_FRAMES = 120u;
+    // Retired geometry only waits out the frames in flight.
+    static constexpr uint32_t RETIRED_GEOMETRY_EVICTION_FRAMES = 3u;
+    // Compaction kicks in once this share of free unified space is not in the largest free range.
+    static constexpr float UNIFIED_COMPACTION_FRAGMENTATION_THRESHOLD = 0.25f;
+
+    void setGeometryPools(GeometryPoolManager *geometryPools);
 
     const Entry *find(MeshGeometryHash geometryHash) const;
     Entry *find(MeshGeometryHash geometryHash);
@@ -30,14 +41,39 @@ public:
     GPUMesh::SharedPtr getOrCreateSharedGeometryMesh(const CPUMesh &mesh);
     GPUMesh::SharedPtr createDrawMeshInstance(const CPUMesh &mesh);
 
+    // Geometry its owner replaced for good (e.g. a terrain chunk rebuilt after a height edit) skips
+    // the eviction hysteresis. Requesting the same geometry again revives it.
+    void retireGeometry(MeshGeometryHash geometryHash);
+
+    // Once per frame, after draw items were synced.
+    void collectUnusedGeometry();
+    // Relocates up to maxRelocations meshes towards the start of their pool when the
+    // pool is fragmented, patching unifiedVertexOffset/unifiedFirstIndex of all users.
+    void compactUnifiedGeometry(uint32_t maxRelocations);
+
+    void setUnifiedGeometryCompactionEnabled(bool enabled)
+    {
+        m_unifiedGeometryCompactionEnabled = enabled;
+    }
+
+    // Headless tools run draw preparation without a device: entries then carry index count and
+    // vertex layout only, and geometry with the same counts and layout batches together.
+    void setGpuUploadEnabled(bool enabled)
+    {
+        m_gpuUploadEnabled = enabled;
+    }
+
     void clear();
     std::size_t size() const;
 
 private:
+    void releaseEntry(Entry &entry);
+    static void patchUnifiedOffsets(Entry &entry, int32_t vertexOffset, uint32_t firstIndex);
+
     std::unordered_map<MeshGeometryHash, Entry, MeshGeometryHashHasher> m_entries;
-    UnifiedGeometryBuffer *m_unifiedGeometryBuffer{nullptr};
-    VkDeviceSize m_unifiedVertexBufferSize{0u};
-    uint32_t m_unifiedIndexBufferCount{0u};
+    GeometryPoolManager *m_geometryPools{nullptr};
+    bool m_unifiedGeometryCompactionEnabled{true};
+    bool m_gpuUploadEnabled{true};
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -104,6 +104,7 @@ struct RGPPassInfo
 {
     std::vector<RGPResourceAccess> reads;
     std::vector<RGPResourceAccess> writes;
+    std::vector<RGPResourceHandler> createdTextures; // owned by the pass, released with it
 };
 
 struct SharedRGPResourceHandler
@@ -22,6 +22,8 @@ public:
     const RGPTextureDescription *getTextureDescription(const RGPResourceHandler &handler) const;
     RGPTextureDescription *getTextureDescriptionMutable(const RGPResourceHandler &handler);
 
+    void removeTexture(const RGPResourceHandler &handler);
+
     const std::unordered_map<RGPResourceHandler, RGPTextureDescription> &getAllTextureDescriptions() const;
 
 private:
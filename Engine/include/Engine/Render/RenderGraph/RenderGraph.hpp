@@ -23,8 +23,9 @@
 #include "Engine/RayTracing/SkinnedBlasBuilder.hpp"
 #include "Engine/Render/MeshGeometryRegistry.hpp"
 #include "Engine/Render/SceneMaterialResolver.hpp"
-#include "Engine/Render/UnifiedGeometryBuffer.hpp"
+#include "Engine/Render/GeometryPoolManager.hpp"
 #include "Engine/Render/GpuCullingSystem.hpp"
+#include "Engine/Render/LightClusterBuilder.hpp"
 #include "Engine/Render/BindlessRegistry.hpp"
 
 #include <typeindex>
@@ -71,13 +72,33 @@ public:
 
         RenderGraphPassData renderGraphPassInfo{};
         renderGraphPassInfo.renderGraphPass = std::move(renderPass);
-        renderGraphPassInfo.id = m_renderGraphPasses.size(); //! For static ok, for dynamic - no
+        renderGraphPassInfo.id = m_nextPassId++;
+
+        // Added at runtime: set up by the next applyTopologyChanges().
+        if (m_isSetup)
+            m_pendingSetupPassIds.push_back(renderGraphPassInfo.id);
 
         m_renderGraphPasses[type] = renderGraphPassInfo;
 
         return ptr;
     }
 
+    /// Removes a pass at runtime. Textures the pass created are released and passes
+    /// reading them are flagged for recompilation. Call applyTopologyChanges() once the
+    /// graph edit is complete.
+    template <typename T>
+    void removePass()
+    {
+        const auto type = std::type_index(typeid(T));
+        if (m_renderGraphPasses.find(type) != m_renderGraphPasses.end())
+            removePassData(type);
+    }
+
+    /// Sets up passes added since setup() and compiles only what the edit touched:
+    /// textures of the new passes plus new and dirty passes. Falls back to a full
+    /// compile when the edit changes which existing textures share memory.
+    void applyTopologyChanges();
+
     template <typename T>
     void connect(RGPOutputSlot<T> &from, RGPInputSlot<T> &to)
     {
@@ -203,6 +224,9 @@ private:
 
     void disablePassData(RenderGraphPassData &data);
     void enablePassData(RenderGraphPassData &data);
+    void removePassData(std::type_index type);
+    void setupPass(RenderGraphPassData &data);
+    void submitBootstrapBarriers(const std::vector<VkImageMemoryBarrier2> &barriers);
     void prepareFrameDataFromScene(Scene *scene, const glm::mat4 &view, const glm::mat4 &projection, bool enableFrustumCulling);
 
     void recreateSwapChain();
@@ -233,6 +257,8 @@ private:
     core::DescriptorPool::SharedPtr m_descriptorPool{VK_NULL_HANDLE};
 
     std::vector<core::Buffer::SharedPtr> m_lightSSBOs;
+    std::vector<core::Buffer::SharedPtr> m_lightClusterSSBOs;
+    LightClusterBuilder m_lightClusterBuilder;
 
     std::vector<core::Buffer::SharedPtr> m_bonesSSBOs;
     std::vector<core::Buffer::SharedPtr> m_instanceSSBOs;
@@ -270,10 +296,11 @@ private:
     rayTracing::RayTracingScene m_rayTracingScene{MAX_FRAMES_IN_FLIGHT};
     rayTracing::SkinnedBlasBuilder m_skinnedBlasBuilder;
 
-    // Unified geometry buffer for static meshes – eliminates per-draw VB/IB rebinds.
-    UnifiedGeometryBuffer m_staticUnifiedGeometry;
-    static constexpr VkDeviceSize UNIFIED_VERTEX_BUFFER_SIZE = 512ULL * 1024 * 1024; // 512 MB
-    static constexpr uint32_t UNIFIED_INDEX_BUFFER_COUNT = 64 * 1024 * 1024;         // 64 M indices
+    // Unified geometry buffers, one per vertex layout with a shared index buffer –
+    // eliminates per-draw VB/IB rebinds for static, skinned and terrain meshes.
+    GeometryPoolManager m_geometryPools;
+    static constexpr uint32_t UNIFIED_INDEX_BUFFER_COUNT = 64 * 1024 * 1024; // 64 M indices
+    static constexpr uint32_t MAX_UNIFIED_RELOCATIONS_PER_FRAME = 8;
 
     GpuCullingSystem m_gpuCulling;
 
@@ -307,6 +334,13 @@ private:
 
     std::unordered_map<std::string, PassGroup> m_passGroups;
 
+    uint32_t m_nextPassId{0};
+    bool m_isSetup{false};
+    bool m_topologyChanged{false};
+    std::vector<uint32_t> m_pendingSetupPassIds;
+    // Alias roots the storage was last compiled with (handler -> texture whose memory it uses).
+    std::unordered_map<RGPResourceHandler, RGPResourceHandler> m_textureAliasRoots;
+
     std::atomic<bool> m_swapchainResizeRequested{false};
     bool m_hasWindowResizeCallback{false};
 };
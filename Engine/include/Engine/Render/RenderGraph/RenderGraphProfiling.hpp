@@ -121,6 +121,8 @@ public:
 
     void initTimestampQueryPool();
     void destroyTimestampQueryPool();
+    // Grows the timestamp pool when passes were added at runtime. Requires an idle device.
+    void setRenderGraphPassCount(uint32_t renderGraphPassSize);
 
     void syncDetailedProfilingMode();
     bool isDetailedProfilingEnabled() const;
@@ -174,11 +174,10 @@ public:
     // VK_NULL_HANDLE when not yet initialised.
     VkBuffer indirectDrawBuffer{VK_NULL_HANDLE};
 
-    // Unified geometry buffer handles (VK_NULL_HANDLE when not available).
-    // GBuffer binds these once instead of rebinding per-batch when all static
-    // batches use the unified layout.
-    VkBuffer unifiedStaticVertexBuffer{VK_NULL_HANDLE};
-    VkBuffer unifiedStaticIndexBuffer{VK_NULL_HANDLE};
+    // Index buffer shared by all unified geometry pools (VK_NULL_HANDLE when not
+    // available). The vertex buffer of a batch's pool is GPUMesh::unifiedVertexBuffer,
+    // so passes only rebind the VB when the vertex layout changes.
+    VkBuffer unifiedIndexBuffer{VK_NULL_HANDLE};
 
     // Bindless material descriptor set — holds all textures (binding 0) and
     // the MaterialParams SSBO (binding 1). Bound once at Set 1 in GBuffer.
@@ -3,58 +3,147 @@
 
 #include "Core/Macros.hpp"
 #include "Core/Buffer.hpp"
+#include "Core/CommandBuffer.hpp"
+
+#include "Engine/Render/GeometryRangeAllocator.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
-// Append-only, pre-allocated unified vertex + index buffer for static meshes.
-// All registered meshes must share the same vertex stride.
+// Pre-allocated unified vertex + index buffer.
+// All registered meshes must share the same vertex stride (one buffer per vertex
+// layout, see GeometryPoolManager); the index storage can be shared between buffers.
+// Vertex and index space are sub-allocated with GeometryRangeAllocator, so ranges of
+// released meshes are reused and can be compacted by relocating live meshes.
 // Falls back gracefully (returns false) when the buffer is full or stride mismatches.
 class UnifiedGeometryBuffer
 {
 public:
+    // GPU index buffer + its range allocator. Shared by every pool of a
+    // GeometryPoolManager so all pools draw with a single bound index buffer.
+    struct IndexStorage
+    {
+        using SharedPtr = std::shared_ptr<IndexStorage>;
+
+        core::Buffer::SharedPtr buffer{nullptr};
+        GeometryRangeAllocator allocator; // units: indices
+        std::mutex mutex;
+
+        // maxIndices: total index buffer capacity (uint32 indices).
+        static SharedPtr create(uint32_t maxIndices);
+    };
+
     // Value stored in GPUMesh::unifiedVertexOffset when NOT registered.
     static constexpr int32_t INVALID_VERTEX_OFFSET = INT32_MIN;
 
+    // Released ranges stay reserved this many advanceFrame() calls, so command
+    // buffers still in flight never read geometry that was overwritten.
+    static constexpr uint32_t RELEASE_FRAME_LATENCY = 3u;
+
+    struct MeshAllocation
+    {
+        GeometryRangeAllocator::AllocationId vertexAllocation{GeometryRangeAllocator::INVALID_ALLOCATION};
+        GeometryRangeAllocator::AllocationId indexAllocation{GeometryRangeAllocator::INVALID_ALLOCATION};
+
+        // Last GPU write into the ranges (upload or relocation copy): its AsyncGpuUpload
+        // timeline value, or 0 without timeline support, then uploadFrame is used instead.
+        uint64_t uploadCompletionValue{0u};
+        uint64_t uploadFrame{0u};
+
+        bool isValid() const
+        {
+            return vertexAllocation != GeometryRangeAllocator::INVALID_ALLOCATION &&
+                   indexAllocation != GeometryRangeAllocator::INVALID_ALLOCATION;
+        }
+    };
+
+    struct Statistics
+    {
+        GeometryRangeAllocator::Statistics vertices{}; // in vertices
+        GeometryRangeAllocator::Statistics indices{};  // in indices
+        uint32_t pendingReleases{0u};
+        uint64_t relocatedMeshes{0u};
+    };
+
     // Allocate GPU-only vertex and index buffers.
     // vertexStride: bytes per vertex (fixed for all meshes in this buffer).
     // maxVertexBytes: total vertex buffer capacity in bytes.
     // maxIndices: total index buffer capacity (uint32 indices).
     void init(uint32_t vertexStride, VkDeviceSize maxVertexBytes, uint32_t maxIndices);
+    // Same, but index ranges are allocated from shared storage.
+    void init(uint32_t vertexStride, VkDeviceSize maxVertexBytes, IndexStorage::SharedPtr indexStorage);
 
     // Register mesh geometry into the unified buffer.
     // Uploads data asynchronously (safe to call before the first frame).
-    // Returns true on success and fills outVertexOffset / outFirstIndex.
+    // Returns true on success and fills outVertexOffset / outFirstIndex / outAllocation.
     // Returns false if the buffer is full, not initialised, or stride mismatches.
     bool registerMesh(const uint8_t *vertexData, VkDeviceSize vertexBytes,
                       const uint32_t *indexData, uint32_t indexCount,
+                      int32_t &outVertexOffset, uint32_t &outFirstIndex,
+                      MeshAllocation &outAllocation);
+
+    // Returns the mesh ranges to the allocator after RELEASE_FRAME_LATENCY frames.
+    void releaseMesh(const MeshAllocation &allocation);
+
+    // Call once per frame after the frame fence wait; frees ranges whose latency expired.
+    void advanceFrame();
+
+    // Moves the mesh into the lowest free ranges that lie below its current ones
+    // (GPU-side copy, old ranges are released with the usual latency). The copies are
+    // recorded into commandBuffer, which is created and begun on first use, so all
+    // relocations of a frame go out with one submitRelocations(). Meshes whose last
+    // upload has not finished on the GPU are skipped.
+    // Returns true if either range moved; outputs are then the new offsets.
+    bool relocateMesh(MeshAllocation &allocation, core::CommandBuffer::SharedPtr &commandBuffer,
                       int32_t &outVertexOffset, uint32_t &outFirstIndex);
 
+    // Ends and submits a command buffer filled by relocateMesh(). outCompletionValue
+    // belongs in MeshAllocation::uploadCompletionValue of every relocated mesh.
+    static bool submitRelocations(core::CommandBuffer::SharedPtr commandBuffer, uint64_t &outCompletionValue);
+
     VkBuffer getVertexBuffer() const { return m_vertexBuffer ? m_vertexBuffer->vk() : VK_NULL_HANDLE; }
-    VkBuffer getIndexBuffer() const { return m_indexBuffer ? m_indexBuffer->vk() : VK_NULL_HANDLE; }
+    VkBuffer getIndexBuffer() const { return m_indexStorage && m_indexStorage->buffer ? m_indexStorage->buffer->vk() : VK_NULL_HANDLE; }
 
     uint32_t getVertexStride() const { return m_vertexStride; }
-    bool isInitialized() const { return m_vertexBuffer != nullptr; }
+    bool isInitialized() const { return m_vertexBuffer != nullptr && m_indexStorage != nullptr; }
 
     // Returns total capacity in vertices / indices.
     uint32_t vertexCapacity() const { return m_vertexStride > 0 ? static_cast<uint32_t>(m_maxVertexBytes / m_vertexStride) : 0u; }
-    uint32_t indexCapacity() const { return m_maxIndices; }
-    uint32_t verticesUsed() const { return m_vertexStride > 0 ? static_cast<uint32_t>(m_vertexBytesUsed / m_vertexStride) : 0u; }
-    uint32_t indicesUsed() const { return m_indicesUsed; }
+    uint32_t indexCapacity() const { return m_indexStorage ? static_cast<uint32_t>(m_indexStorage->allocator.getCapacity()) : 0u; }
+    uint32_t verticesUsed() const;
+    uint32_t indicesUsed() const;
+
+    Statistics getStatistics() const;
 
 private:
+    struct PendingRelease
+    {
+        MeshAllocation allocation{};
+        uint64_t releaseFrame{0u};
+    };
+
+    // Requires m_mutex.
+    bool isUploadComplete(const MeshAllocation &allocation) const;
+
+    static core::CommandBuffer::SharedPtr beginRelocationCommands();
+
     core::Buffer::SharedPtr m_vertexBuffer{nullptr};
-    core::Buffer::SharedPtr m_indexBuffer{nullptr};
+    IndexStorage::SharedPtr m_indexStorage{nullptr};
 
     uint32_t m_vertexStride{0};
-    VkDeviceSize m_vertexBytesUsed{0};
     VkDeviceSize m_maxVertexBytes{0};
-    uint32_t m_indicesUsed{0};
-    uint32_t m_maxIndices{0};
 
-    std::mutex m_mutex;
+    GeometryRangeAllocator m_vertexAllocator; // units: vertices
+
+    std::vector<PendingRelease> m_pendingReleases;
+    uint64_t m_frameCounter{0u};
+    uint64_t m_relocatedMeshes{0u};
+
+    mutable std::mutex m_mutex;
 };
 
 ELIX_NESTED_NAMESPACE_END
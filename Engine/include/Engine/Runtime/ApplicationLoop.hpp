@@ -6,6 +6,7 @@
 #include "Core/Window.hpp"
 
 #include "Engine/Runtime/ApplicationConfig.hpp"
+#include "Engine/Runtime/FixedTimestep.hpp"
 #include "Engine/Runtime/IRuntime.hpp"
 
 #include <functional>
@@ -29,6 +30,7 @@ private:
     platform::Window::SharedPtr m_window{nullptr};
     std::string m_graphicsPipelineCachePath;
     std::unique_ptr<IRuntime> m_runtime{nullptr};
+    FixedTimestep m_fixedTimestep;
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -89,6 +89,25 @@ public:
     float getSSRRoughnessCutoff() const;
     void setSSRRoughnessCutoff(float cutoff);
 
+    // Fixed physics step rate and the most steps one frame may run before time is dropped.
+    float getPhysicsFixedRateHz() const;
+    void setPhysicsFixedRateHz(float rateHz);
+
+    int getPhysicsMaxSubsteps() const;
+    void setPhysicsMaxSubsteps(int substeps);
+
+    bool getAsyncPhysicsEnabled() const;
+    void setAsyncPhysicsEnabled(bool enabled);
+
+    // Run scripts that declare parallel update on the job system (off = same phase, main thread only).
+    bool getParallelScriptUpdateEnabled() const;
+    void setParallelScriptUpdateEnabled(bool enabled);
+
+    // Worker threads of the shared job pool (physics, animation, render prep). 0 = hardware threads - 1.
+    // Read once when the pool starts; changes apply on the next launch.
+    int getWorkerThreadCount() const;
+    void setWorkerThreadCount(int count);
+
     // ── Plugin enable/disable state ─────────────────────────────────────────
     // pluginStem = filename without extension (e.g. "TerrainPlugin").
     // Returns true by default for unknown plugins (new plugins start enabled).
@@ -130,6 +149,11 @@ private:
     float m_ssrStrength{1.0f};
     int m_ssrSteps{48};
     float m_ssrRoughnessCutoff{0.4f};
+    float m_physicsFixedRateHz{60.0f};
+    int m_physicsMaxSubsteps{4};
+    bool m_asyncPhysicsEnabled{false};
+    bool m_parallelScriptUpdateEnabled{true};
+    int m_workerThreadCount{0};
     std::vector<IdeInfo> m_detectedIdes;
     std::unordered_map<std::string, bool> m_pluginEnabledStates;
 };
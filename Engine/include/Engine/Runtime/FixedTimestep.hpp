@@ -0,0 +1,49 @@
+#ifndef ELIX_FIXED_TIMESTEP_HPP
+#define ELIX_FIXED_TIMESTEP_HPP
+
+#include "Core/Macros.hpp"
+
+#include <cstdint>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Accumulates frame time and hands it out in fixed-size steps.
+// At most maxSubsteps run per frame; any backlog beyond that is dropped so a slow
+// frame can't schedule more simulation than the next frame can pay for.
+class FixedTimestep
+{
+public:
+    void configure(float rateHz, uint32_t maxSubsteps);
+
+    // Adds the frame delta and returns how many fixed steps to run this frame.
+    uint32_t advance(float frameDelta);
+
+    float getFixedDelta() const
+    {
+        return m_fixedDelta;
+    }
+
+    // Fraction of a step left in the accumulator, in [0, 1). Used to blend the last two physics states.
+    float getAlpha() const
+    {
+        return m_accumulator / m_fixedDelta;
+    }
+
+    uint64_t getDroppedSteps() const
+    {
+        return m_droppedSteps;
+    }
+
+private:
+    // Frame deltas above this (debugger breaks, window drags) are clamped before accumulating.
+    static constexpr float MAX_FRAME_DELTA = 0.25f;
+
+    float m_fixedDelta{1.0f / 60.0f};
+    uint32_t m_maxSubsteps{4u};
+    float m_accumulator{0.0f};
+    uint64_t m_droppedSteps{0u};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_FIXED_TIMESTEP_HPP
@@ -34,6 +34,8 @@
 #include "Engine/Render/GraphPasses/VolumetricFogLightingRenderGraphPass.hpp"
 #include "Engine/Render/GraphPasses/VolumetricFogTemporalRenderGraphPass.hpp"
 #include "Engine/Render/RenderGraph/RenderGraph.hpp"
+#include "Engine/Render/RenderQualitySettings.hpp"
+#include "Engine/Runtime/RenderGraphHitchBenchmark.hpp"
 #include "Engine/Runtime/ApplicationConfig.hpp"
 #include "Engine/Runtime/IRuntime.hpp"
 #include "Engine/Scene.hpp"
@@ -57,14 +59,59 @@ public:
 
     bool init() override;
     void tick(float deltaTime) override;
+    void fixedTick(float fixedDelta) override;
+    void setFixedStepAlpha(float alpha) override;
     void shutdown() override;
 
 private:
+    // Passes are added stage by stage in this order. Each stage only consumes outputs of
+    // earlier ones, so a configuration change rebuilds the graph in place from the first
+    // affected stage while the passes (and textures) of earlier stages are kept.
+    enum class RenderGraphStage : uint8_t
+    {
+        Core, // G-buffer, shadows, SSAO
+        Lighting,
+        ScreenSpaceReflections,
+        RayTracedReflections,
+        VolumetricFog,
+        Particles,
+        PostProcess,
+        AntiAliasing,
+        UI, // UI and present
+        None
+    };
+
+    // Everything that decides which passes exist and how they are wired.
+    struct RenderGraphFeatures
+    {
+        uint32_t msaaSamples{1u};
+        bool rtShadows{false};
+        bool rtao{false};
+        bool ssr{false};
+        bool rtReflections{false};
+        bool volumetricFog{false};
+        RenderQualitySettings::VolumetricFogQuality volumetricFogQuality{RenderQualitySettings::VolumetricFogQuality::Off};
+        bool particles{false};
+        bool postProcessing{true};
+        RenderQualitySettings::AntiAliasingMode antiAliasing{RenderQualitySettings::AntiAliasingMode::NONE};
+        bool ui{false};
+
+        bool operator==(const RenderGraphFeatures &other) const = default;
+    };
+
+    static RenderGraphFeatures captureRenderGraphFeatures(const Scene *scene);
+    static RenderGraphStage firstChangedStage(const RenderGraphFeatures &previous, const RenderGraphFeatures &current);
+
     bool resolveLaunchPaths(std::string *errorMessage);
     bool loadProjectModule(std::string *errorMessage);
     bool extractPacket(std::string *errorMessage);
     void bindSceneToPasses();
     void initRenderGraph();
+    void rebuildRenderGraph(RenderGraphStage firstStage);
+    void addRenderGraphPasses(RenderGraphStage firstStage);
+    void removeRenderGraphPasses(RenderGraphStage firstStage);
+    VkExtent2D computeViewportExtent() const;
+    void applyViewportExtent(VkExtent2D extent, RenderGraphStage firstStage);
     void syncViewportExtent();
     void refreshActiveCamera();
     void collectAndSubmitUIRenderData();
@@ -120,7 +167,8 @@ private:
     renderGraph::PresentRenderGraphPass *m_presentRenderGraphPass{nullptr};
 
     VkExtent2D m_lastExtent{0u, 0u};
-    size_t m_renderGraphTopologyHash{0u};
+    RenderGraphFeatures m_renderGraphFeatures{};
+    std::unique_ptr<RenderGraphHitchBenchmark> m_hitchBenchmark{nullptr};
     bool m_scriptsAttached{false};
     bool m_initialized{false};
 };
@@ -13,6 +13,11 @@ public:
     virtual bool init() = 0;
     virtual void tick(float deltaTime) = 0;
     virtual void shutdown() = 0;
+
+    // Called zero or more times per frame, before tick(), at the fixed physics rate.
+    virtual void fixedTick(float fixedDelta) {}
+    // Fraction of a fixed step not yet simulated when tick() runs; used for render interpolation.
+    virtual void setFixedStepAlpha(float alpha) {}
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,67 @@
+#ifndef ELIX_RENDER_GRAPH_HITCH_BENCHMARK_HPP
+#define ELIX_RENDER_GRAPH_HITCH_BENCHMARK_HPP
+
+#include "Core/Macros.hpp"
+
+#include "Engine/Render/RenderQualitySettings.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Toggles render-graph features one at a time and records the frame-time spike each topology
+// change causes. Enabled with --render-graph-hitch-benchmark; results go to the engine log.
+class RenderGraphHitchBenchmark
+{
+public:
+    RenderGraphHitchBenchmark();
+
+    // Call once per frame, before the runtime checks for render-graph topology changes.
+    void update(float deltaTime);
+    void recordRebuild(double rebuildMs);
+
+    bool isFinished() const
+    {
+        return m_stepIndex >= m_steps.size();
+    }
+
+private:
+    static constexpr uint32_t WARMUP_FRAMES = 120;
+    static constexpr uint32_t OBSERVATION_FRAMES = 60;
+
+    struct Step
+    {
+        std::string name;
+        void (*apply)();
+        double worstFrameMs{0.0};
+        double rebuildMs{0.0};
+    };
+
+    // What the steps change, captured before the first one and restored after the last.
+    struct SavedSettings
+    {
+        bool enableSSR{false};
+        bool enablePostProcessing{true};
+        bool overrideVolumetricFogSceneSetting{false};
+        bool volumetricFogOverrideEnabled{true};
+        RenderQualitySettings::AntiAliasingMode antiAliasingMode{RenderQualitySettings::AntiAliasingMode::FXAA};
+    };
+
+    void saveSettings();
+    void restoreSettings() const;
+    void report() const;
+
+    std::vector<Step> m_steps;
+    SavedSettings m_savedSettings{};
+    std::vector<double> m_warmupFrameTimesMs;
+    double m_baselineFrameMs{0.0};
+    size_t m_stepIndex{0};
+    uint32_t m_frameInStep{0};
+    bool m_reported{false};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_RENDER_GRAPH_HITCH_BENCHMARK_HPP
@@ -29,6 +29,8 @@ public:
     void loadScene(const std::string &path) { scripting::loadScene(path.c_str()); }
     void loadSceneAdditive(const std::string &path) { scripting::loadSceneAdditive(path.c_str()); }
     void unloadGroup(const std::string &tag) { scripting::unloadGroup(tag.c_str()); }
+    bool isSceneLoading() const { return scripting::isSceneLoading(); }
+    float getSceneLoadProgress() const { return scripting::getSceneLoadProgress(); }
     void setDontDestroyOnLoad(Entity *entity) { scripting::setDontDestroyOnLoad(entity); }
     void clearDontDestroyOnLoad(Entity *entity) { scripting::clearDontDestroyOnLoad(entity); }
 
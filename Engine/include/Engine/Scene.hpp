@@ -6,6 +6,8 @@
 #include "Engine/Entity.hpp"
 #include "Engine/EnvironmentSettings.hpp"
 #include "Engine/Lights.hpp"
+#include "Engine/SceneCommandBuffer.hpp"
+#include "Engine/Scripting/ScriptAccess.hpp"
 
 #include "Engine/Physics/PhysicsScene.hpp"
 
@@ -16,12 +18,22 @@
 #include <vector>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <functional>
+#include <limits>
+
+#include "nlohmann/json_fwd.hpp"
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+class RigidBodyComponent;
+class ScriptComponent;
+class TerrainComponent;
+class PreparedSceneFile;
+
 class Scene
 {
 public:
@@ -33,10 +45,19 @@ public:
     Scene::SharedPtr copy();
 
     const std::vector<Entity::SharedPtr> &getEntities() const;
+    // Changes whenever an entity is added, removed, renamed or reparented.
+    uint64_t getHierarchyRevision() const;
+
+    // Terrain components in the scene. Rebuilt only after entities or components were added or removed;
+    // the parallel script phase reads the list built before it started.
+    const std::vector<TerrainComponent *> &getTerrainComponents();
 
     std::vector<std::shared_ptr<BaseLight>> getLights();
 
     bool doesEntityNameExist(const std::string &name) const;
+    // First entity with this name in list order. Served from an index rebuilt after entities are added,
+    // removed or renamed; the parallel script phase sees the names from before it started.
+    Entity *findEntityByName(std::string_view name);
 
     Entity::SharedPtr
     addEntity(const std::string &name);
@@ -49,6 +70,14 @@ public:
 
     bool loadSceneFromFile(const std::string &filePath, const LoadStatusCallback &statusCallback = {}, bool additive = false);
     bool loadEntitiesFromFile(const std::string &filePath, const LoadStatusCallback &statusCallback = {});
+    // Builds the scene over several calls: beginIncrementalLoad() resets the scene (unless additive) and restores
+    // environment and UI, then each continueIncrementalLoad() creates up to maxGameObjects entities and
+    // returns true once hierarchy and post-load fixups are done.
+    void beginIncrementalLoad(std::shared_ptr<PreparedSceneFile> preparedFile, bool additive, const LoadStatusCallback &statusCallback = {});
+    bool continueIncrementalLoad(size_t maxGameObjects);
+    bool isIncrementalLoadInProgress() const;
+    size_t getIncrementalLoadedGameObjectCount() const;
+    size_t getIncrementalLoadGameObjectCount() const;
     void saveSceneToFile(const std::string &filePath);
     bool serializeEntityHierarchy(uint32_t rootEntityId, std::string &outPayload) const;
     Entity *restoreEntityHierarchy(const std::string &payload, uint32_t *outRootEntityId = nullptr);
@@ -74,9 +103,30 @@ public:
 
     void update(float deltaTime);
     void fixedUpdate(float fixedDelta);
+    // Blend factor between the last two fixed steps used by update() for rigid-body transforms.
+    void setPhysicsInterpolationAlpha(float alpha);
+    // Async mode leaves each fixed step running while the frame is updated and rendered; it is
+    // fetched at the start of the next fixed step. Rendering blends the two poses captured before it.
+    void setAsyncPhysicsEnabled(bool enabled);
+    bool isAsyncPhysicsEnabled() const;
+    // Sync point for async mode: blocks on the running step and captures its rigid-body poses.
+    void finishPhysicsStep();
 
     PhysicsScene &getPhysicsScene();
 
+    // Structural changes recorded during update (required from parallel scripts); applied at the end of update().
+    SceneCommandBuffer &getCommandBuffer();
+    // Scripts that declare parallel update run in conflict-free batches on the job system.
+    // When disabled they still run in their own phase, but serially on the calling thread.
+    void setParallelScriptUpdateEnabled(bool enabled);
+    bool isParallelScriptUpdateEnabled() const;
+    // True on the thread running a parallel script's onUpdate.
+    static bool isInParallelScriptUpdate();
+    // Entity whose parallel scripts the calling thread is running, nullptr outside the parallel phase.
+    static const Entity *getParallelScriptJobOwner();
+    // Batches built by the last parallel script phase.
+    size_t getParallelScriptBatchCount() const;
+
     // --- UI game objects ---
     ui::UIText   *addUIText();
     ui::UIButton *addUIButton();
@@ -91,15 +141,69 @@ public:
     const std::vector<std::unique_ptr<ui::Billboard>> &getBillboards() const;
 
 private:
+    struct IncrementalLoad;
+
+    void loadGameObject(const nlohmann::json &objectJson);
+    void finishIncrementalLoad();
+    void capturePhysicsStates();
+    void buildParallelScriptBatches();
+    struct ParallelScriptBatch;
+    bool conflictsWithParallelScriptBatch(const ParallelScriptBatch &batch) const;
+    void runParallelScriptUpdates(float deltaTime);
+    void refreshTerrainComponents();
+    void refreshEntityNameIndex();
+
     std::vector<Entity::SharedPtr> m_entities;
+    uint64_t m_entityListRevision{0u};
+    std::vector<TerrainComponent *> m_terrainComponents;
+    uint64_t m_terrainComponentsRevision{std::numeric_limits<uint64_t>::max()};
+
+    struct EntityNameHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+    std::unordered_map<std::string, Entity *, EntityNameHash, std::equal_to<>> m_entityNameIndex;
+    uint64_t m_entityNameIndexRevision{std::numeric_limits<uint64_t>::max()};
     std::string m_name;
     PhysicsScene m_physicsScene;
+    float m_physicsInterpolationAlpha{1.0f};
+    bool m_asyncPhysicsEnabled{false};
+
+    // Bodies PhysX reported active in the last step, plus ones that just fell asleep (written once more).
+    struct MovingRigidBody
+    {
+        RigidBodyComponent *component{nullptr};
+        std::weak_ptr<const void> lifetime;
+        bool settling{false};
+    };
+    std::vector<MovingRigidBody> m_movingRigidBodies;
+    std::vector<MovingRigidBody> m_nextMovingRigidBodies;
+    uint64_t m_physicsStepIndex{0u};
+
+    // One job per entity (all its parallel scripts, in order); jobs in a batch have non-conflicting access.
+    struct ParallelScriptBatch
+    {
+        ScriptAccess access;      // declared access to other entities
+        ScriptAccess ownerAccess; // component types on the jobs' own entities (see buildParallelScriptBatches)
+        std::vector<ScriptComponent *> scripts;
+        std::vector<size_t> jobOffsets; // jobOffsets[i]..jobOffsets[i + 1] are the scripts of job i
+    };
+    std::vector<ParallelScriptBatch> m_parallelScriptBatches;
+    size_t m_parallelScriptBatchCount{0u};
+    std::vector<ScriptComponent *> m_entityParallelScripts;
+    ScriptAccess m_entityParallelAccess;
+    ScriptAccess m_entityOwnerAccess;
+    bool m_parallelScriptUpdateEnabled{true};
+    SceneCommandBuffer m_commandBuffer;
     uint32_t m_nextEntityId{0};
     SceneEnvironmentSettings m_environmentSettings{};
 
     std::vector<std::unique_ptr<ui::UIText>>    m_uiTexts;
     std::vector<std::unique_ptr<ui::UIButton>>  m_uiButtons;
     std::vector<std::unique_ptr<ui::Billboard>> m_billboards;
+
+    std::unique_ptr<IncrementalLoad> m_incrementalLoad;
 };
 
 ELIX_NESTED_NAMESPACE_END
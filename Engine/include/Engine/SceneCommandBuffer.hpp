@@ -0,0 +1,67 @@
+#ifndef ELIX_SCENE_COMMAND_BUFFER_HPP
+#define ELIX_SCENE_COMMAND_BUFFER_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Entity.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+class Scene;
+
+// Structural scene changes recorded from parallel script updates and applied by the scene at its
+// next sync point, in recording order. Entities are referenced by id, so a command whose target was
+// destroyed in the meantime is skipped. Safe to record from any thread.
+class SceneCommandBuffer
+{
+public:
+    using Command = std::function<void(Scene &)>;
+
+    void enqueue(Command command);
+
+    void spawnEntity(const std::string &name, std::function<void(Entity &)> onSpawned = {});
+    void destroyEntity(const Entity *entity);
+
+    template <typename T, typename... Args>
+    void addComponent(const Entity *entity, Args &&...args)
+    {
+        if (!entity)
+            return;
+
+        enqueueForEntity(entity, [... capturedArgs = std::forward<Args>(args)](Entity &target) mutable
+                         { target.addComponent<T>(std::move(capturedArgs)...); });
+    }
+
+    template <typename T>
+    void removeComponent(const Entity *entity)
+    {
+        if (!entity)
+            return;
+
+        enqueueForEntity(entity, [](Entity &target)
+                         { target.removeComponent<T>(); });
+    }
+
+    // Runs the recorded commands on the calling thread and clears the buffer.
+    // Commands recorded while applying are kept for the next call.
+    void apply(Scene &scene);
+
+    bool isEmpty() const;
+
+private:
+    void enqueueForEntity(const Entity *entity, std::function<void(Entity &)> command);
+
+    mutable std::mutex m_mutex;
+    std::vector<Command> m_commands;
+    std::vector<Command> m_applying;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_SCENE_COMMAND_BUFFER_HPP
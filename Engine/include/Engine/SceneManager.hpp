@@ -3,9 +3,13 @@
 
 #include "Core/Macros.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -13,10 +17,32 @@ ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 class Scene;
 class Entity;
+class PreparedSceneFile;
 
 class SceneManager
 {
 public:
+    enum class LoadStage
+    {
+        None,
+        Reading,   // worker thread is parsing the file and loading terrain/animation assets
+        Streaming, // waiting for prefetched models on AssetManager
+        Activating // entities are built on the main thread, a time slice per frame
+    };
+
+    struct LoadProgress
+    {
+        LoadStage stage{LoadStage::None};
+        std::string filePath;
+        size_t streamedModelCount{0u};
+        size_t prefetchedModelCount{0u};
+        size_t builtGameObjectCount{0u};
+        size_t gameObjectCount{0u};
+
+        // Whole load in [0, 1]: reading is the first 10%, streaming runs up to 40%, activation the rest.
+        float getFraction() const;
+    };
+
     static SceneManager &instance();
 
     void requestLoadScene(const std::string &filePath);
@@ -28,16 +54,28 @@ public:
     void setDontDestroyOnLoad(Entity *entity);
     void clearDontDestroyOnLoad(Entity *entity);
 
+    // True while requests are queued or a load is still in progress.
     bool hasPendingRequests() const;
+    bool isLoading() const;
+    LoadProgress getLoadProgress() const;
+
+    // Main-thread time spent building entities per processRequests() call. At least one batch is always built.
+    void setActivationBudgetMs(float milliseconds);
+    float getActivationBudgetMs() const;
 
     using SceneChangedCallback = std::function<void(std::shared_ptr<Scene>)>;
+    // Call once per frame. Loads are read on a worker and activated over several calls; the active scene keeps
+    // running meanwhile and requests queued behind a load wait for it. onSceneChanging runs right before a
+    // finished request is applied to the active scene, onSceneChanged right after.
     void processRequests(std::shared_ptr<Scene> &activeScene,
-                         const SceneChangedCallback &onSceneChanged = {});
+                         const SceneChangedCallback &onSceneChanged = {},
+                         const SceneChangedCallback &onSceneChanging = {});
 
 private:
     SceneManager() = default;
 
     static constexpr const char *k_dontDestroyTag = "__dontdestroy__";
+    static constexpr size_t k_activationBatchSize = 8u;
 
     struct Request
     {
@@ -50,7 +88,37 @@ private:
         std::string payload;
     };
 
-    std::vector<Request> m_pendingRequests;
+    // Written by the worker; preparedFile is valid once finished is set.
+    struct ReadJob
+    {
+        std::shared_ptr<PreparedSceneFile> preparedFile;
+        std::atomic<bool> finished{false};
+    };
+
+    struct ActiveLoad
+    {
+        ~ActiveLoad();
+
+        Request request;
+        LoadStage stage{LoadStage::Reading};
+        std::shared_ptr<ReadJob> readJob;
+        // Dedicated thread rather than a pool job: terrain decoding inside the read runs its own parallelFor,
+        // and a pool worker must never wait on other pool tasks.
+        std::thread readThread;
+        std::shared_ptr<PreparedSceneFile> preparedFile;
+        // New scene for LoadScene, the active scene for LoadAdditive.
+        std::shared_ptr<Scene> scene;
+    };
+
+    void beginLoad(const Request &request);
+    // Returns true once the load has finished or failed.
+    bool advanceLoad(std::shared_ptr<Scene> &activeScene,
+                     const SceneChangedCallback &onSceneChanged,
+                     const SceneChangedCallback &onSceneChanging);
+
+    std::deque<Request> m_pendingRequests;
+    std::unique_ptr<ActiveLoad> m_activeLoad;
+    float m_activationBudgetMs{4.0f};
 };
 
 ELIX_NESTED_NAMESPACE_END
@@ -2,6 +2,7 @@
 #define ELIX_SCRIPT_HPP
 
 #include "Core/Macros.hpp"
+#include "Engine/Scripting/ScriptAccess.hpp"
 
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
@@ -163,9 +164,17 @@ public:
     }
 
     virtual void onUpdate(float deltaTime) {}
+    // Runs at the fixed physics rate, before the physics step. Apply forces here.
+    virtual void onFixedUpdate(float fixedDelta) {}
     virtual void onStart() {}
     virtual void onStop() {}
 
+    // Opt into the parallel update phase: return true and onUpdate runs on the job system, after the
+    // serial entity update. The script may freely touch its own entity, only the declared component
+    // types on other entities, and must record spawn/destroy/add/remove through the scene command buffer.
+    // Queried once when the script is attached.
+    virtual bool declareParallelUpdate(ScriptAccess & /*access*/) const { return false; }
+
     // Physics collision callbacks (fired when this entity's rigid body contacts another)
     virtual void onCollisionEnter(Entity * /*other*/, const CollisionInfo & /*info*/) {}
     virtual void onCollisionStay(Entity * /*other*/, const CollisionInfo & /*info*/) {}
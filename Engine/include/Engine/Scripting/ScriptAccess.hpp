@@ -0,0 +1,98 @@
+#ifndef ELIX_SCRIPT_ACCESS_HPP
+#define ELIX_SCRIPT_ACCESS_HPP
+
+#include "Core/Macros.hpp"
+
+#include <algorithm>
+#include <typeindex>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Component types a parallel script touches on entities other than its own owner.
+// The owner entity needs no declaration: the scheduler treats every component on it as written.
+// Transforms of other entities (parents included) are read from a snapshot taken when the parallel
+// phase starts, so reads<Transform3DComponent>() never conflicts with owners moving themselves.
+// Two scripts conflict when one writes a type the other reads or writes; conflicting scripts are
+// placed in different batches and never run at the same time.
+class ScriptAccess
+{
+public:
+    template <typename T>
+    ScriptAccess &reads()
+    {
+        addUnique(m_reads, std::type_index(typeid(T)));
+        return *this;
+    }
+
+    template <typename T>
+    ScriptAccess &writes()
+    {
+        addUnique(m_writes, std::type_index(typeid(T)));
+        return *this;
+    }
+
+    ScriptAccess &reads(std::type_index type)
+    {
+        addUnique(m_reads, type);
+        return *this;
+    }
+
+    ScriptAccess &writes(std::type_index type)
+    {
+        addUnique(m_writes, type);
+        return *this;
+    }
+
+    bool conflictsWith(const ScriptAccess &other) const
+    {
+        for (const auto &type : m_writes)
+            if (contains(other.m_writes, type) || contains(other.m_reads, type))
+                return true;
+
+        for (const auto &type : m_reads)
+            if (contains(other.m_writes, type))
+                return true;
+
+        return false;
+    }
+
+    void merge(const ScriptAccess &other)
+    {
+        for (const auto &type : other.m_reads)
+            addUnique(m_reads, type);
+
+        for (const auto &type : other.m_writes)
+            addUnique(m_writes, type);
+    }
+
+    bool isEmpty() const
+    {
+        return m_reads.empty() && m_writes.empty();
+    }
+
+    void clear()
+    {
+        m_reads.clear();
+        m_writes.clear();
+    }
+
+private:
+    static bool contains(const std::vector<std::type_index> &types, const std::type_index &type)
+    {
+        return std::find(types.begin(), types.end(), type) != types.end();
+    }
+
+    static void addUnique(std::vector<std::type_index> &types, const std::type_index &type)
+    {
+        if (!contains(types, type))
+            types.push_back(type);
+    }
+
+    std::vector<std::type_index> m_reads;
+    std::vector<std::type_index> m_writes;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_SCRIPT_ACCESS_HPP
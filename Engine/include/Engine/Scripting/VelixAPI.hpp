@@ -16,8 +16,11 @@ ELIX_NESTED_NAMESPACE_END
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 class Entity;
 class ECS;
+class SceneCommandBuffer;
 class InputManager;
 class RenderQualitySettings;
+class TerrainQuery;
+struct TerrainRayHit;
 ELIX_NESTED_NAMESPACE_END
 
 ELIX_NESTED_NAMESPACE_BEGIN(platform)
@@ -27,6 +30,10 @@ ELIX_NESTED_NAMESPACE_END
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 ELIX_CUSTOM_NAMESPACE_BEGIN(scripting)
 
+// Interned component type handle. Resolve once (e.g. in onStart) and reuse it for per-frame lookups.
+using ComponentTypeId = uint32_t;
+inline constexpr ComponentTypeId INVALID_COMPONENT_TYPE = 0u;
+
 void setActiveScene(Scene *scene);
 Scene *const getActiveScene();
 
@@ -35,8 +42,10 @@ platform::Window *const getActiveWindow();
 
 void beginFrame(float deltaTime);
 
+// From a parallel script update both are deferred to the scene command buffer; spawnEntity then returns nullptr.
 Entity *spawnEntity(const char *name, Scene *scene = nullptr);
 bool destroyEntity(Entity *entity, Scene *scene = nullptr);
+SceneCommandBuffer *getCommandBuffer(Scene *scene = nullptr);
 Entity *findEntityById(uint32_t id, Scene *scene = nullptr);
 Entity *findEntityByName(const char *name, Scene *scene = nullptr);
 uint64_t getEntitiesCount(Scene *scene = nullptr);
@@ -44,6 +53,14 @@ Entity *getEntityByIndex(uint64_t index, Scene *scene = nullptr);
 
 std::string getEntityName(const Entity *entity);
 
+// Accepts the same aliases as the name-based lookups ("RigidBodyComponent", "RigidBody", "rigidbody", ...).
+ComponentTypeId resolveComponentType(const char *componentTypeName);
+
+ECS *getEntitySingleComponent(Entity *entity, ComponentTypeId componentType);
+uint64_t getEntityComponentsCount(Entity *entity, ComponentTypeId componentType);
+ECS *getEntityComponentByIndex(Entity *entity, ComponentTypeId componentType, uint64_t index);
+bool entityHasComponent(Entity *entity, ComponentTypeId componentType);
+
 ECS *getEntitySingleComponent(Entity *entity, const char *componentTypeName);
 uint64_t getEntityComponentsCount(Entity *entity, const char *componentTypeName);
 ECS *getEntityComponentByIndex(Entity *entity, const char *componentTypeName, uint64_t index);
@@ -52,6 +69,8 @@ bool entityHasComponent(Entity *entity, const char *componentTypeName);
 void loadScene(const char *filePath);
 void loadSceneAdditive(const char *filePath);
 void unloadGroup(const char *tag);
+bool isSceneLoading();
+float getSceneLoadProgress();
 void setDontDestroyOnLoad(Entity *entity);
 void clearDontDestroyOnLoad(Entity *entity);
 
@@ -61,6 +80,15 @@ const RenderQualitySettings *getRenderQualitySettingsConst();
 
 bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance,
              PhysicsRaycastHit *outHit = nullptr, Scene *scene = nullptr);
+// Many rays at once, run in parallel; results[i] answers batch[i]. Prefer this over looping raycast().
+void raycastBatch(const PhysicsRaycastBatch &batch, PhysicsQueryResults &results, Scene *scene = nullptr);
+
+// Terrain surface queries answered from the heightmap, without the physics scene. Much cheaper
+// than raycast() for ground snapping, foot placement or spawning on the terrain.
+const TerrainQuery *findTerrainQuery(float worldX, float worldZ, Scene *scene = nullptr);
+bool sampleTerrainHeight(float worldX, float worldZ, float &outHeight, glm::vec3 *outNormal = nullptr, Scene *scene = nullptr);
+bool raycastTerrain(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance,
+                    TerrainRayHit *outHit = nullptr, Scene *scene = nullptr);
 
 void addImpulse(Entity *entity, const glm::vec3 &impulse);
 void addForce(Entity *entity, const glm::vec3 &force);
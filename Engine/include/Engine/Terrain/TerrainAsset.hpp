@@ -22,6 +22,47 @@ struct TerrainLayerInfo
     float blendHardness{0.5f};
 };
 
+// Rectangle in heightmap sample space: [x, x + width) x [y, y + height).
+struct TerrainRegion
+{
+    uint32_t x{0};
+    uint32_t y{0};
+    uint32_t width{0};
+    uint32_t height{0};
+
+    [[nodiscard]] bool isEmpty() const
+    {
+        return width == 0u || height == 0u;
+    }
+
+    [[nodiscard]] bool intersects(const TerrainRegion &other) const
+    {
+        return !isEmpty() && !other.isEmpty() &&
+               x < other.x + other.width && other.x < x + width &&
+               y < other.y + other.height && other.y < y + height;
+    }
+
+    // Grows to the bounding rectangle of both.
+    void merge(const TerrainRegion &other)
+    {
+        if (other.isEmpty())
+            return;
+
+        if (isEmpty())
+        {
+            *this = other;
+            return;
+        }
+
+        const uint32_t maxX = std::max(x + width, other.x + other.width);
+        const uint32_t maxY = std::max(y + height, other.y + other.height);
+        x = std::min(x, other.x);
+        y = std::min(y, other.y);
+        width = maxX - x;
+        height = maxY - y;
+    }
+};
+
 class TerrainAsset : public IAsset
 {
 public:
@@ -3,15 +3,25 @@
 
 #include "Core/Macros.hpp"
 #include "Engine/Terrain/TerrainAsset.hpp"
+#include "Engine/Terrain/TerrainTileFile.hpp"
 
 #include <optional>
 #include <string>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
-bool saveTerrainAssetToFile(const TerrainAsset &terrainAsset, const std::string &filePath);
+// Writes the binary tiled container (TerrainTileFile).
+bool saveTerrainAssetToFile(const TerrainAsset &terrainAsset, const std::string &filePath,
+                            uint32_t tileSize = TerrainTileFile::DEFAULT_TILE_SIZE);
+// Legacy pretty-printed JSON layout; kept for inspection and diffing.
+bool saveTerrainAssetToJsonFile(const TerrainAsset &terrainAsset, const std::string &filePath);
+// Accepts both the binary container and legacy JSON files. Binary files are decoded in full.
 std::optional<TerrainAsset> loadTerrainAssetFromFile(const std::string &filePath);
 
+// Name, source path and layers as a small JSON document (no sample data).
+std::string serializeTerrainMetadata(const TerrainAsset &terrainAsset);
+bool deserializeTerrainMetadata(const std::string &metadata, TerrainAsset &outTerrainAsset);
+
 ELIX_NESTED_NAMESPACE_END
 
 #endif // ELIX_TERRAIN_ASSET_IO_HPP
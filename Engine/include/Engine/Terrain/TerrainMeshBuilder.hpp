@@ -4,8 +4,11 @@
 #include "Core/Macros.hpp"
 #include "Engine/Mesh.hpp"
 #include "Engine/Terrain/TerrainAsset.hpp"
+#include "Engine/Terrain/TerrainQuadtree.hpp"
 
 #include <cstdint>
+#include <optional>
+#include <string>
 #include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -16,11 +19,71 @@ struct TerrainMeshBuildSettings
     bool generateFlatShadingNormals{false};
 };
 
+struct TerrainChunkLayout
+{
+    uint32_t quadsPerChunk{0};
+    uint32_t chunkCountX{0};
+    uint32_t chunkCountY{0};
+
+    size_t getChunkCount() const { return static_cast<size_t>(chunkCountX) * chunkCountY; }
+};
+
+// Everything one chunk or LOD patch mesh is built from, copied out of the asset so the mesh can be
+// built on a worker while the heightmap keeps changing. Heights are taken every `step` samples over
+// (quadsX + 3) x (quadsY + 3) points: the mesh grid plus a one-point ring for normals. Sample
+// coordinates past the terrain edge clamp to it.
+struct TerrainMeshSource
+{
+    std::string name;
+    uint32_t x{0};
+    uint32_t y{0};
+    uint32_t quadsX{0};
+    uint32_t quadsY{0};
+    uint32_t step{1};
+    std::vector<float> heights;
+    const std::vector<uint32_t> *indices{nullptr}; // shared pattern, owned by TerrainMeshBuilder
+
+    uint32_t terrainQuadsX{1};
+    uint32_t terrainQuadsY{1};
+    float worldMinX{0.0f};
+    float worldMinZ{0.0f};
+    float gridStepX{1.0f};
+    float gridStepZ{1.0f};
+    std::optional<TerrainLayerInfo> baseLayer;
+};
+
 class TerrainMeshBuilder
 {
 public:
+    // Builds every chunk on the job system; geometry info is computed there as well.
     static std::vector<CPUMesh> buildChunkMeshes(const TerrainAsset &terrainAsset,
                                                  const TerrainMeshBuildSettings &settings = TerrainMeshBuildSettings{});
+
+    // Chunks are laid out row-major; edge chunks may be smaller than quadsPerChunk.
+    static TerrainChunkLayout computeChunkLayout(const TerrainAsset &terrainAsset, uint32_t quadsPerChunk);
+
+    // One LOD patch: (patchQuads + 1)^2 vertices sampled every 2^level heightmap samples.
+    static CPUMesh buildPatchMesh(const TerrainAsset &terrainAsset,
+                                  const TerrainQuadtree &quadtree,
+                                  const TerrainLodSelection &selection);
+
+    // Gathering reads the asset and must not race with height edits; building does not touch it.
+    static TerrainMeshSource gatherChunkSource(const TerrainAsset &terrainAsset,
+                                               const TerrainChunkLayout &layout,
+                                               uint32_t chunkX,
+                                               uint32_t chunkY);
+    static TerrainMeshSource gatherPatchSource(const TerrainAsset &terrainAsset,
+                                               const TerrainQuadtree &quadtree,
+                                               const TerrainLodSelection &selection);
+    static CPUMesh buildMesh(const TerrainMeshSource &source);
+
+    // Index pattern shared by every patch with the same resolution and stitch mask (16 variants
+    // per resolution), built once. Each 2x2 quad block is a fan around its centre; on a stitched
+    // edge the fan skips the edge midpoint so it lines up with the coarser neighbour.
+    static const std::vector<uint32_t> &getPatchIndices(uint32_t patchQuads, uint32_t stitchMask);
+
+    // Plain two-triangles-per-quad pattern for full-resolution chunks, built once per chunk size.
+    static const std::vector<uint32_t> &getGridIndices(uint32_t quadsX, uint32_t quadsY);
 };
 
 ELIX_NESTED_NAMESPACE_END
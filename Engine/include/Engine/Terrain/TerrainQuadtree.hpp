@@ -0,0 +1,112 @@
+#ifndef ELIX_TERRAIN_QUADTREE_HPP
+#define ELIX_TERRAIN_QUADTREE_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Terrain/TerrainAsset.hpp"
+
+#include <glm/vec3.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+struct TerrainLodSettings
+{
+    // A node of level L is split while the camera is closer than
+    // leafWorldSize * distanceScale * 2^(L-1) to its bounds.
+    float distanceScale{2.0f};
+    // Upper bound on selected patches (each patch is patchQuads^2 * 2 triangles).
+    uint32_t maxPatches{256u};
+};
+
+// Patch edges that border a coarser neighbour and must skip their odd vertices.
+enum TerrainStitchEdge : uint32_t
+{
+    TERRAIN_STITCH_NEG_X = 1u << 0u,
+    TERRAIN_STITCH_POS_X = 1u << 1u,
+    TERRAIN_STITCH_NEG_Z = 1u << 2u,
+    TERRAIN_STITCH_POS_Z = 1u << 3u,
+};
+
+struct TerrainLodSelection
+{
+    uint32_t nodeIndex{0};
+    uint32_t stitchMask{0};
+};
+
+// Quadtree over the heightmap for distance-based LOD. Every node is drawn as the same
+// patchQuads x patchQuads grid, sampling the heightmap every 2^level samples, so the
+// triangle count per patch is constant and the total is bounded by the patch budget.
+// Nodes keep only their sample rectangle and height bounds; heights stay in the asset.
+class TerrainQuadtree
+{
+public:
+    static constexpr int32_t INVALID_NODE = -1;
+
+    struct Node
+    {
+        // Covered quads in heightmap sample space: [x, x + size] x [y, y + size], clipped to the terrain.
+        uint32_t x{0};
+        uint32_t y{0};
+        uint32_t size{0};
+        uint32_t level{0}; // 0 = finest
+
+        // Terrain-local height bounds in meters.
+        float minHeight{0.0f};
+        float maxHeight{0.0f};
+
+        std::array<int32_t, 4> children{INVALID_NODE, INVALID_NODE, INVALID_NODE, INVALID_NODE};
+
+        bool isLeaf() const { return level == 0u; }
+    };
+
+    // `patchQuads` must be a power of two.
+    void build(const TerrainAsset &terrainAsset, uint32_t patchQuads);
+    void clear();
+
+    bool isEmpty() const { return m_nodes.empty(); }
+    uint32_t getPatchQuads() const { return m_patchQuads; }
+    uint32_t getLevelCount() const { return m_levelCount; }
+    const std::vector<Node> &getNodes() const { return m_nodes; }
+    const Node &getNode(uint32_t nodeIndex) const { return m_nodes[nodeIndex]; }
+
+    // Selects the nodes to draw for a camera in terrain-local space, with stitch masks
+    // towards coarser neighbours. The output is sorted by node index.
+    void select(const glm::vec3 &localCameraPosition,
+                const TerrainLodSettings &settings,
+                std::vector<TerrainLodSelection> &outSelection) const;
+
+    // Recomputes the height bounds of nodes covering `region` after its samples changed.
+    void refreshHeightBounds(const TerrainAsset &terrainAsset, const TerrainRegion &region);
+
+    // Samples a node's patch reads, including the ring used for its normals.
+    TerrainRegion getNodeFootprint(uint32_t nodeIndex) const;
+
+private:
+    int32_t buildNode(const TerrainAsset &terrainAsset, uint32_t x, uint32_t y, uint32_t level);
+    void computeLeafBounds(const TerrainAsset &terrainAsset, Node &node) const;
+    void refreshNode(const TerrainAsset &terrainAsset, uint32_t nodeIndex, const TerrainRegion &region);
+    float distanceToNode(const Node &node, const glm::vec3 &localCameraPosition) const;
+    void computeStitchMasks(std::vector<TerrainLodSelection> &selection) const;
+
+    std::vector<Node> m_nodes;
+    uint32_t m_patchQuads{64u};
+    uint32_t m_levelCount{0};
+    uint32_t m_quadsX{0};
+    uint32_t m_quadsY{0};
+    uint32_t m_leafCountX{0};
+    uint32_t m_leafCountY{0};
+    float m_worldMinX{0.0f};
+    float m_worldMinZ{0.0f};
+    float m_gridStepX{1.0f};
+    float m_gridStepZ{1.0f};
+
+    // Scratch for stitch computation: selected level per leaf cell.
+    mutable std::vector<int32_t> m_leafLevels;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_TERRAIN_QUADTREE_HPP
@@ -0,0 +1,119 @@
+#ifndef ELIX_TERRAIN_QUERY_HPP
+#define ELIX_TERRAIN_QUERY_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Terrain/TerrainAsset.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+enum class TerrainFilter : uint8_t
+{
+    Bilinear = 0,
+    // Catmull-Rom over 4x4 samples: smooth normals across sample boundaries, may overshoot slightly.
+    Bicubic
+};
+
+struct TerrainSurfaceSample
+{
+    glm::vec3 position{0.0f}; // world space, on the surface
+    glm::vec3 normal{0.0f, 1.0f, 0.0f};
+};
+
+struct TerrainRayHit
+{
+    glm::vec3 position{0.0f};
+    glm::vec3 normal{0.0f, 1.0f, 0.0f};
+    float distance{0.0f};
+};
+
+// Height, normal and ray queries against a terrain heightmap, answered with arithmetic on the
+// samples instead of physics scene queries.
+//
+// Heights are taken along the terrain's up axis at a world (x, z), so transforms are expected to
+// be translation, scale and rotation about Y (as placed in the editor). Rays use a min/max pyramid
+// over the heightmap cells to skip empty space and hit the bilinear surface exactly.
+//
+// Queries are const and safe from any thread. setTransform(), rebuild() and refreshRegion() are not,
+// and must not run concurrently with queries.
+class TerrainQuery
+{
+public:
+    TerrainQuery() = default;
+    explicit TerrainQuery(std::shared_ptr<const TerrainAsset> terrainAsset, const glm::mat4 &localToWorld = glm::mat4(1.0f));
+
+    void setTerrainAsset(std::shared_ptr<const TerrainAsset> terrainAsset);
+    const std::shared_ptr<const TerrainAsset> &getTerrainAsset() const { return m_terrainAsset; }
+
+    void setTransform(const glm::mat4 &localToWorld);
+    const glm::mat4 &getTransform() const { return m_localToWorld; }
+
+    // Rebuilds the min/max pyramid from the whole heightmap.
+    void rebuild();
+    // Updates the pyramid after the samples inside `region` changed.
+    void refreshRegion(const TerrainRegion &region);
+
+    bool isValid() const { return !m_levels.empty(); }
+
+    bool contains(float worldX, float worldZ) const;
+
+    // World-space surface height at (x, z). Returns false outside the terrain.
+    bool sampleHeight(float worldX, float worldZ, float &outHeight, TerrainFilter filter = TerrainFilter::Bilinear) const;
+    // Surface point and normal at (x, z). Returns false outside the terrain.
+    bool sampleSurface(float worldX, float worldZ, TerrainSurfaceSample &outSample, TerrainFilter filter = TerrainFilter::Bilinear) const;
+
+    // Bilinear heights for many points at once (y is ignored), four at a time with SSE where available.
+    // Points outside the terrain get `outsideHeight`.
+    void sampleHeights(const glm::vec3 *worldPositions,
+                       size_t count,
+                       float *outHeights,
+                       float outsideHeight = std::numeric_limits<float>::lowest()) const;
+
+    // First hit of the ray with the bilinear surface, from above. Direction need not be normalized;
+    // distances are in world units along it.
+    bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, TerrainRayHit &outHit) const;
+
+private:
+    struct HeightRange
+    {
+        uint16_t minValue{0};
+        uint16_t maxValue{0};
+    };
+
+    // Grid space: x, z in heightmap samples from the terrain's first sample, y in local meters.
+    glm::vec2 worldToGrid(float worldX, float worldZ) const;
+    bool sampleGrid(float gridX, float gridZ, TerrainFilter filter, float &outHeight, glm::vec2 &outGradient) const;
+    glm::vec3 gridToWorldPoint(float gridX, float localHeight, float gridZ) const;
+    glm::vec3 gridGradientToWorldNormal(const glm::vec2 &gradient) const;
+    float sampleAt(int32_t x, int32_t z) const;
+
+    void refreshLevels(uint32_t minCellX, uint32_t minCellZ, uint32_t maxCellX, uint32_t maxCellZ);
+
+    std::shared_ptr<const TerrainAsset> m_terrainAsset{nullptr};
+
+    glm::mat4 m_localToWorld{1.0f};
+    glm::mat4 m_worldToLocal{1.0f};
+    glm::mat3 m_normalMatrix{1.0f};
+
+    uint32_t m_quadsX{0};
+    uint32_t m_quadsZ{0};
+    float m_worldMinX{0.0f};
+    float m_worldMinZ{0.0f};
+    float m_gridStepX{1.0f};
+    float m_gridStepZ{1.0f};
+    float m_heightScale{0.0f}; // meters per raw sample unit
+
+    // m_levels[0] holds one range per heightmap cell (quad); each next level halves both dimensions.
+    std::vector<std::vector<HeightRange>> m_levels;
+    std::vector<glm::uvec2> m_levelSizes;
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_TERRAIN_QUERY_HPP
@@ -0,0 +1,124 @@
+#ifndef ELIX_TERRAIN_TILE_FILE_HPP
+#define ELIX_TERRAIN_TILE_FILE_HPP
+
+#include "Core/Macros.hpp"
+#include "Engine/Terrain/TerrainAsset.hpp"
+#include "Engine/Utilities/MappedFile.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+struct TerrainTileCoord
+{
+    uint32_t x{0};
+    uint32_t y{0};
+};
+
+// Sample rectangle of one tile. Edge tiles may be smaller than the tile size.
+struct TerrainTileRect
+{
+    uint32_t x{0};
+    uint32_t y{0};
+    uint32_t width{0};
+    uint32_t height{0};
+};
+
+// Binary terrain container (.elixterrain). Layout:
+//   header | metadata (name, layers) | height tile table | weight tile table | tile payloads
+// Height and weightmap data are split into square tiles. Each tile is delta-encoded and LZ4-compressed,
+// and its table entry carries the tile's min/max height, so culling and LOD selection can run before
+// anything is decoded. The file is memory-mapped when possible (streamed reads otherwise). Single tiles
+// can be decoded from any thread, but the runtime loads terrain through loadAll(): the collider, mesh
+// and TerrainQuery all need the whole heightfield, so nothing streams tiles near the camera yet.
+class TerrainTileFile
+{
+public:
+    static constexpr uint32_t FORMAT_VERSION = 1u;
+    static constexpr uint32_t DEFAULT_TILE_SIZE = 128u;
+
+    // Cheap magic check; used to tell binary terrain files from legacy JSON ones.
+    static bool isTerrainTileFile(const std::string &filePath);
+
+    // `terrainAsset` is expected to be sanitized already (see saveTerrainAssetToFile).
+    static bool write(const TerrainAsset &terrainAsset, const std::string &filePath, uint32_t tileSize = DEFAULT_TILE_SIZE);
+
+    TerrainTileFile() = default;
+    TerrainTileFile(const TerrainTileFile &) = delete;
+    TerrainTileFile &operator=(const TerrainTileFile &) = delete;
+
+    bool open(const std::string &filePath);
+    void close();
+    bool isOpen() const { return m_isOpen; }
+    bool isMemoryMapped() const { return m_mappedFile.isOpen(); }
+
+    // Everything but the sample data: dimensions, world size, height scale, layers.
+    const TerrainAsset &getDescription() const { return m_description; }
+
+    uint32_t getTileSize() const { return m_tileSize; }
+    uint32_t getHeightTileCountX() const { return m_heightTilesX; }
+    uint32_t getHeightTileCountY() const { return m_heightTilesY; }
+    uint32_t getWeightTileCountX() const { return m_weightTilesX; }
+    uint32_t getWeightTileCountY() const { return m_weightTilesY; }
+
+    TerrainTileRect getHeightTileRect(uint32_t tileX, uint32_t tileY) const;
+    TerrainTileRect getWeightTileRect(uint32_t tileX, uint32_t tileY) const;
+
+    // Raw u16 min/max of a height tile, read from the tile table (no decoding).
+    bool getHeightTileRange(uint32_t tileX, uint32_t tileY, uint16_t &outMin, uint16_t &outMax) const;
+
+    // Height tiles whose XZ footprint lies within `radius` of the point, in terrain-local meters
+    // (the terrain is centered on its origin, as built by TerrainMeshBuilder). For tools; unused at runtime.
+    void collectHeightTilesInRadius(float localX, float localZ, float radius, std::vector<TerrainTileCoord> &outTiles) const;
+
+    // Decodes one tile into a row-major width*height (times channels for weights) buffer.
+    bool decodeHeightTile(uint32_t tileX, uint32_t tileY, std::vector<uint16_t> &outSamples) const;
+    bool decodeWeightTile(uint32_t tileX, uint32_t tileY, std::vector<uint8_t> &outData) const;
+
+    // Decodes every tile (in parallel) into a complete asset.
+    std::optional<TerrainAsset> loadAll() const;
+
+private:
+    struct TileEntry
+    {
+        uint64_t offset{0};
+        uint32_t compressedSize{0};
+        uint32_t rawSize{0};
+        uint16_t minValue{0};
+        uint16_t maxValue{0};
+        uint8_t compression{0};
+        uint8_t reserved[3]{};
+    };
+
+    static_assert(sizeof(TileEntry) == 24u, "TileEntry is part of the on-disk format");
+
+    const uint8_t *readPayload(const TileEntry &entry, std::vector<uint8_t> &scratch) const;
+    bool decompressTile(const TileEntry &entry, std::vector<uint8_t> &outRaw) const;
+
+    TerrainAsset m_description;
+
+    uint32_t m_tileSize{DEFAULT_TILE_SIZE};
+    uint32_t m_heightTilesX{0};
+    uint32_t m_heightTilesY{0};
+    uint32_t m_weightTilesX{0};
+    uint32_t m_weightTilesY{0};
+
+    std::vector<TileEntry> m_heightTiles;
+    std::vector<TileEntry> m_weightTiles;
+
+    MappedFile m_mappedFile;
+    // Fallback when mapping is unavailable; reads are serialized.
+    mutable std::ifstream m_stream;
+    mutable std::mutex m_streamMutex;
+    uint64_t m_fileSize{0};
+    bool m_isOpen{false};
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_TERRAIN_TILE_FILE_HPP
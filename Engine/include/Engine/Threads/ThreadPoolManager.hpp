@@ -31,8 +31,15 @@ public:
     std::size_t getWorkerCount() const;
     std::size_t getMaxThreads() const;
 
+    // Splits [0, taskCount) into chunks; the caller runs the first one and waits for the rest.
+    // Called from a pool worker (e.g. a parallel script issuing a batched raycast) it runs the
+    // whole range inline: a worker blocked on chunks queued behind it could deadlock the pool.
     void parallelFor(std::size_t taskCount, const RangeTask &task, std::size_t maxThreadCount = 0u);
 
+    // Queues a task for a worker and returns immediately. Runs it inline when there are no workers.
+    // Used by PhysX through PhysicsTaskDispatcher; the task owns its own completion signalling.
+    void submit(std::function<void()> task);
+
 private:
     struct TaskBatchState
     {
@@ -22,8 +22,11 @@ public:
 
     // Submit a single command buffer immediately (one vkQueueSubmit per call).
     // Use only for infrequent one-off uploads (skybox, IBL, etc.).
+    // outCompletionValue receives the upload timeline value the submission signals
+    // (0 when the device has no timeline semaphores).
     static bool submit(core::CommandBuffer::SharedPtr commandBuffer, VkQueue queue,
-                       std::vector<core::Buffer::SharedPtr> stagingBuffers = {});
+                       std::vector<core::Buffer::SharedPtr> stagingBuffers = {},
+                       uint64_t *outCompletionValue = nullptr);
 
     static bool submitAndWait(core::CommandBuffer::SharedPtr commandBuffer, VkQueue queue);
 
@@ -39,6 +42,8 @@ public:
     static bool batchFlush(VkQueue queue);
 
     static void collectFinished(VkDevice device);
+    // True once the upload timeline reached completionValue (as returned by submit()).
+    static bool isComplete(uint64_t completionValue);
     static TimelineWait acquireReadyTimelineWait();
     static std::vector<VkSemaphore> acquireReadySemaphores();
     static void releaseSemaphores(VkDevice device, const std::vector<VkSemaphore> &semaphores);
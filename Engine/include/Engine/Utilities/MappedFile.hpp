@@ -0,0 +1,45 @@
+#ifndef ELIX_MAPPED_FILE_HPP
+#define ELIX_MAPPED_FILE_HPP
+
+#include "Core/Macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+// Read-only memory mapping of a whole file. Pages are faulted in on access, so reading a few
+// ranges of a large file only touches those ranges.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    bool open(const std::string &filePath);
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+    const uint8_t *data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    const uint8_t *m_data{nullptr};
+    size_t m_size{0u};
+
+#if defined(_WIN32)
+    void *m_fileHandle{nullptr};
+    void *m_mappingHandle{nullptr};
+#endif
+};
+
+ELIX_NESTED_NAMESPACE_END
+
+#endif // ELIX_MAPPED_FILE_HPP
@@ -1,4 +1,5 @@
 #include "Engine/Assets/AssetStreamingWorker.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
@@ -41,6 +42,8 @@ void AssetStreamingWorker::shutdown()
 
 void AssetStreamingWorker::workerLoop()
 {
+    VX_PROFILE_THREAD_NAME("Asset Streaming");
+
     while (true)
     {
         LoadJob job;
@@ -57,7 +60,10 @@ void AssetStreamingWorker::workerLoop()
         }
 
         if (job.execute)
+        {
+            VX_PROFILE_SCOPE("AssetStreaming::job");
             job.execute();
+        }
 
         m_pending.fetch_sub(1u, std::memory_order_relaxed);
     }
@@ -13,14 +13,24 @@
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 bool Compressor::compress(const std::vector<uint8_t> &input, std::vector<uint8_t> &output, Algorithm algorithm, int compressionLevel)
+{
+    return compress(input.data(), input.size(), output, algorithm, compressionLevel);
+}
+
+bool Compressor::decompress(const std::vector<uint8_t> &input, size_t expectedSize, std::vector<uint8_t> &output, Algorithm algorithm)
+{
+    return decompress(input.data(), input.size(), expectedSize, output, algorithm);
+}
+
+bool Compressor::compress(const uint8_t *input, size_t inputSize, std::vector<uint8_t> &output, Algorithm algorithm, int compressionLevel)
 {
     if (algorithm == Algorithm::None)
     {
-        output = input;
+        output.assign(input, input + inputSize);
         return true;
     }
 
-    if (input.empty())
+    if (inputSize == 0u)
     {
         output.clear();
         return true;
@@ -29,7 +39,7 @@ bool Compressor::compress(const std::vector<uint8_t> &input, std::vector<uint8_t
 #if defined(ELIX_HAS_ZLIB)
     if (algorithm == Algorithm::Deflate)
     {
-        const uLong sourceSize = static_cast<uLong>(input.size());
+        const uLong sourceSize = static_cast<uLong>(inputSize);
         const uLongf boundSize = compressBound(sourceSize);
         output.resize(static_cast<size_t>(boundSize));
 
@@ -37,7 +47,7 @@ bool Compressor::compress(const std::vector<uint8_t> &input, std::vector<uint8_t
         const int level = std::max(-1, std::min(9, compressionLevel));
         const int result = compress2(reinterpret_cast<Bytef *>(output.data()),
                                      &compressedSize,
-                                     reinterpret_cast<const Bytef *>(input.data()),
+                                     reinterpret_cast<const Bytef *>(input),
                                      sourceSize,
                                      level);
         if (result != Z_OK)
@@ -54,12 +64,12 @@ bool Compressor::compress(const std::vector<uint8_t> &input, std::vector<uint8_t
 #if defined(ELIX_HAS_LZ4)
     if (algorithm == Algorithm::LZ4)
     {
-        const int bound = LZ4_compressBound(static_cast<int>(input.size()));
+        const int bound = LZ4_compressBound(static_cast<int>(inputSize));
         output.resize(static_cast<size_t>(bound));
         const int compressed = LZ4_compress_default(
-            reinterpret_cast<const char *>(input.data()),
+            reinterpret_cast<const char *>(input),
             reinterpret_cast<char *>(output.data()),
-            static_cast<int>(input.size()),
+            static_cast<int>(inputSize),
             bound);
         if (compressed <= 0)
         {
@@ -75,21 +85,21 @@ bool Compressor::compress(const std::vector<uint8_t> &input, std::vector<uint8_t
     return false;
 }
 
-bool Compressor::decompress(const std::vector<uint8_t> &input, size_t expectedSize, std::vector<uint8_t> &output, Algorithm algorithm)
+bool Compressor::decompress(const uint8_t *input, size_t inputSize, size_t expectedSize, std::vector<uint8_t> &output, Algorithm algorithm)
 {
     if (algorithm == Algorithm::None)
     {
-        output = input;
+        output.assign(input, input + inputSize);
         return true;
     }
 
     if (expectedSize == 0u)
     {
         output.clear();
-        return input.empty();
+        return inputSize == 0u;
     }
 
-    if (input.empty())
+    if (inputSize == 0u)
         return false;
 
 #if defined(ELIX_HAS_ZLIB)
@@ -100,8 +110,8 @@ bool Compressor::decompress(const std::vector<uint8_t> &input, size_t expectedSi
 
         const int result = uncompress(reinterpret_cast<Bytef *>(output.data()),
                                       &destinationSize,
-                                      reinterpret_cast<const Bytef *>(input.data()),
-                                      static_cast<uLong>(input.size()));
+                                      reinterpret_cast<const Bytef *>(input),
+                                      static_cast<uLong>(inputSize));
         if (result != Z_OK || destinationSize != expectedSize)
         {
             output.clear();
@@ -117,9 +127,9 @@ bool Compressor::decompress(const std::vector<uint8_t> &input, size_t expectedSi
     {
         output.resize(expectedSize);
         const int decompressed = LZ4_decompress_safe(
-            reinterpret_cast<const char *>(input.data()),
+            reinterpret_cast<const char *>(input),
             reinterpret_cast<char *>(output.data()),
-            static_cast<int>(input.size()),
+            static_cast<int>(inputSize),
             static_cast<int>(expectedSize));
         if (decompressed < 0 || static_cast<size_t>(decompressed) != expectedSize)
         {
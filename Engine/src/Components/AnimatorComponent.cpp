@@ -1,6 +1,7 @@
 #include "Engine/Components/AnimatorComponent.hpp"
 #include "Engine/Assets/AssetsLoader.hpp"
 #include "Engine/Entity.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -236,6 +237,8 @@ bool AnimatorComponent::playAnimationByName(const std::string &name, bool repeat
 
 void AnimatorComponent::update(float deltaTime)
 {
+    VX_PROFILE_SCOPE("AnimatorComponent::update");
+
     if (m_tree.has_value())
     {
         ensureTreeActivePath();
@@ -38,7 +38,10 @@ void ParticleSystemComponent::update(float dt)
     }
 
     if (auto *scene = scripting::getActiveScene())
+    {
         m_particleSystem->setPhysicsScene(&scene->getPhysicsScene());
+        m_particleSystem->setTerrainQuery(scripting::findTerrainQuery(worldPos.x, worldPos.z, scene));
+    }
 
     m_particleSystem->update(dt, worldPos);
 }
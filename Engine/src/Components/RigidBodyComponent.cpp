@@ -2,6 +2,8 @@
 #include "Engine/Components/Transform3DComponent.hpp"
 #include "Engine/Entity.hpp"
 
+#include <glm/gtc/quaternion.hpp>
+
 #include <iostream>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -46,6 +48,8 @@ void RigidBodyComponent::setPosition(const physx::PxVec3 &vec)
     transform.p = vec;
 
     m_rigidActor->setGlobalPose(transform);
+    // Teleport: don't blend from the old pose.
+    m_hasPhysicsState = false;
 }
 
 void RigidBodyComponent::setGravityEnable(bool enable)
@@ -88,6 +92,42 @@ void RigidBodyComponent::syncFromPhysics()
     m_transformComponent->setWorldRotation(glm::quat(pose.q.w, pose.q.x, pose.q.y, pose.q.z));
 }
 
+bool RigidBodyComponent::isInterpolated() const
+{
+    return m_rigidActor && m_rigidActor->is<physx::PxRigidDynamic>() && !isKinematic();
+}
+
+void RigidBodyComponent::capturePhysicsState(uint64_t stepIndex)
+{
+    if (!isInterpolated())
+        return;
+
+    const physx::PxTransform pose = m_rigidActor->getGlobalPose();
+    m_previousPose = m_hasPhysicsState ? m_currentPose : pose;
+    m_currentPose = pose;
+    m_hasPhysicsState = true;
+    m_lastCapturedStep = stepIndex;
+}
+
+void RigidBodyComponent::settlePhysicsState()
+{
+    m_previousPose = m_currentPose;
+}
+
+void RigidBodyComponent::interpolateTransform(float alpha)
+{
+    if (!m_hasPhysicsState || !m_transformComponent)
+        return;
+
+    const glm::vec3 previousPosition(m_previousPose.p.x, m_previousPose.p.y, m_previousPose.p.z);
+    const glm::vec3 currentPosition(m_currentPose.p.x, m_currentPose.p.y, m_currentPose.p.z);
+    const glm::quat previousRotation(m_previousPose.q.w, m_previousPose.q.x, m_previousPose.q.y, m_previousPose.q.z);
+    const glm::quat currentRotation(m_currentPose.q.w, m_currentPose.q.x, m_currentPose.q.y, m_currentPose.q.z);
+
+    m_transformComponent->setWorldPose(glm::mix(previousPosition, currentPosition, alpha),
+                                       glm::slerp(previousRotation, currentRotation, alpha));
+}
+
 physx::PxRigidActor *RigidBodyComponent::getRigidActor() const
 {
     return m_rigidActor;
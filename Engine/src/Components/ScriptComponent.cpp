@@ -39,6 +39,9 @@ void ScriptComponent::onAttach()
     m_isAttached = true;
     m_script->onStart();
     syncSerializedVariablesFromScript();
+
+    m_parallelUpdateAccess.clear();
+    m_parallelUpdate = m_script->declareParallelUpdate(m_parallelUpdateAccess);
 }
 
 void ScriptComponent::onDetach()
@@ -56,6 +59,7 @@ void ScriptComponent::onDetach()
     }
 
     m_isAttached = false;
+    m_parallelUpdate = false;
 }
 
 void ScriptComponent::update(float deltaTime)
@@ -65,12 +69,33 @@ void ScriptComponent::update(float deltaTime)
     if (!m_isAttached)
         return;
 
-    if (!m_script)
+    if (!m_script || m_parallelUpdate)
+        return;
+
+    m_script->onUpdate(deltaTime);
+}
+
+void ScriptComponent::parallelUpdate(float deltaTime)
+{
+    if (!m_isAttached || !m_script || !m_parallelUpdate)
         return;
 
     m_script->onUpdate(deltaTime);
 }
 
+void ScriptComponent::fixedUpdate(float fixedDelta)
+{
+    ECS::fixedUpdate(fixedDelta);
+
+    if (!m_isAttached)
+        return;
+
+    if (!m_script)
+        return;
+
+    m_script->onFixedUpdate(fixedDelta);
+}
+
 const std::string &ScriptComponent::getScriptName() const
 {
     return m_scriptName;
@@ -86,6 +111,16 @@ bool ScriptComponent::isAttached() const
     return m_isAttached;
 }
 
+bool ScriptComponent::hasParallelUpdate() const
+{
+    return m_parallelUpdate;
+}
+
+const ScriptAccess &ScriptComponent::getParallelUpdateAccess() const
+{
+    return m_parallelUpdateAccess;
+}
+
 void ScriptComponent::setSerializedVariables(const Script::ExposedVariablesMap &variables)
 {
     m_serializedVariables = variables;
@@ -1,26 +1,66 @@
 #include "Engine/Components/TerrainComponent.hpp"
 
+#include "Engine/Components/Transform3DComponent.hpp"
+#include "Engine/Entity.hpp"
 #include "Engine/Terrain/TerrainMeshBuilder.hpp"
+#include "Engine/Threads/ThreadPoolManager.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <utility>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+namespace
+{
+    uint64_t patchKey(const TerrainLodSelection &selection)
+    {
+        return (static_cast<uint64_t>(selection.nodeIndex) << 4u) | selection.stitchMask;
+    }
+
+    uint32_t patchKeyNode(uint64_t key)
+    {
+        return static_cast<uint32_t>(key >> 4u);
+    }
+
+    // Samples a full-resolution chunk reads, including the ring used for its normals.
+    TerrainRegion chunkFootprint(const TerrainChunkLayout &layout, uint32_t chunkX, uint32_t chunkY)
+    {
+        const uint32_t startX = chunkX * layout.quadsPerChunk;
+        const uint32_t startY = chunkY * layout.quadsPerChunk;
+        const uint32_t minX = startX > 0u ? startX - 1u : 0u;
+        const uint32_t minY = startY > 0u ? startY - 1u : 0u;
+        return {minX, minY, startX + layout.quadsPerChunk + 2u - minX, startY + layout.quadsPerChunk + 2u - minY};
+    }
+} // namespace
+
 TerrainComponent::TerrainComponent()
 {
 }
 
 TerrainComponent::TerrainComponent(std::shared_ptr<TerrainAsset> terrainAsset)
-    : m_terrainAsset(std::move(terrainAsset))
+    : m_terrainAsset(std::move(terrainAsset)), m_query(m_terrainAsset)
 {
 }
 
+void TerrainComponent::update(float deltaTime)
+{
+    (void)deltaTime;
+
+    auto *owner = getOwner<Entity>();
+    auto *transformComponent = owner ? owner->getComponent<Transform3DComponent>() : nullptr;
+    const glm::mat4 transform = transformComponent ? transformComponent->getMatrix() : glm::mat4(1.0f);
+    if (transform != m_query.getTransform())
+        m_query.setTransform(transform);
+}
+
 void TerrainComponent::setTerrainAsset(std::shared_ptr<TerrainAsset> terrainAsset)
 {
     m_terrainAsset = std::move(terrainAsset);
     if (m_terrainAsset && !m_terrainAsset->layers.empty() && m_materialOverridePath.empty())
         m_materialOverridePath = m_terrainAsset->layers.front().materialPath;
 
+    m_query.setTerrainAsset(m_terrainAsset);
     setChunksDirty();
 }
 
@@ -60,17 +100,71 @@ uint32_t TerrainComponent::getQuadsPerChunk() const
     return m_quadsPerChunk;
 }
 
+void TerrainComponent::setLodEnabled(bool enabled)
+{
+    if (m_lodEnabled == enabled)
+        return;
+
+    m_lodEnabled = enabled;
+    setChunksDirty();
+}
+
+bool TerrainComponent::isLodEnabled() const
+{
+    return m_lodEnabled;
+}
+
+void TerrainComponent::setLodSettings(const TerrainLodSettings &settings)
+{
+    m_lodSettings = settings;
+    m_lodSettings.distanceScale = std::max(settings.distanceScale, 0.5f);
+    m_lodSettings.maxPatches = std::clamp(settings.maxPatches, 1u, 4096u);
+}
+
+const TerrainLodSettings &TerrainComponent::getLodSettings() const
+{
+    return m_lodSettings;
+}
+
 void TerrainComponent::setChunksDirty()
 {
     m_chunkMeshesDirty = true;
 }
 
+void TerrainComponent::markHeightsDirty(const TerrainRegion &region)
+{
+    m_dirtyRegion.merge(region);
+    m_query.refreshRegion(region);
+}
+
+bool TerrainComponent::isRebuildPending() const
+{
+    return m_chunkMeshesDirty || !m_dirtyRegion.isEmpty() || m_rebuildBatch != nullptr;
+}
+
 void TerrainComponent::ensureChunkMeshesBuilt()
 {
-    if (!m_chunkMeshesDirty)
+    if (m_chunkMeshesDirty)
+    {
+        rebuildChunkMeshes();
         return;
+    }
+
+    applyFinishedRebuild();
 
-    rebuildChunkMeshes();
+    // One batch in flight at a time; regions marked meanwhile are merged into the next one.
+    if (!m_rebuildBatch && !m_dirtyRegion.isEmpty())
+        launchRegionRebuild();
+}
+
+const TerrainQuery &TerrainComponent::getQuery() const
+{
+    return m_query;
+}
+
+std::vector<MeshGeometryHash> TerrainComponent::takeRetiredGeometry()
+{
+    return std::exchange(m_retiredGeometry, {});
 }
 
 const std::vector<CPUMesh> &TerrainComponent::getChunkMeshes() const
@@ -78,14 +172,206 @@ const std::vector<CPUMesh> &TerrainComponent::getChunkMeshes() const
     return m_chunkMeshes;
 }
 
+void TerrainComponent::updateLod(const glm::vec3 &localCameraPosition)
+{
+    ensureChunkMeshesBuilt();
+
+    if (!m_lodEnabled || m_quadtree.isEmpty() || !m_terrainAsset)
+        return;
+
+    m_quadtree.select(localCameraPosition, m_lodSettings, m_lodSelection);
+
+    std::vector<uint64_t> selectedKeys;
+    selectedKeys.reserve(m_lodSelection.size());
+    for (const auto &selection : m_lodSelection)
+        selectedKeys.push_back(patchKey(selection));
+
+    if (selectedKeys == m_selectedPatchKeys)
+        return;
+
+    // Park the current patches, then take back whatever is still selected. Meshes are moved, so
+    // their cached geometry hash survives and the renderer finds the uploaded geometry again.
+    for (size_t index = 0; index < m_chunkMeshes.size(); ++index)
+        m_patchCache.insert_or_assign(m_selectedPatchKeys[index], std::move(m_chunkMeshes[index]));
+
+    m_chunkMeshes.clear();
+    m_chunkMeshes.resize(selectedKeys.size());
+
+    std::vector<size_t> missingPatches;
+    for (size_t index = 0; index < selectedKeys.size(); ++index)
+    {
+        auto cachedIt = m_patchCache.find(selectedKeys[index]);
+        if (cachedIt == m_patchCache.end())
+        {
+            missingPatches.push_back(index);
+            continue;
+        }
+
+        m_chunkMeshes[index] = std::move(cachedIt->second);
+        m_patchCache.erase(cachedIt);
+    }
+
+    ThreadPoolManager::instance().parallelFor(missingPatches.size(), [&](size_t begin, size_t end)
+                                              {
+        for (size_t missingIndex = begin; missingIndex < end; ++missingIndex)
+        {
+            const size_t patchIndex = missingPatches[missingIndex];
+            m_chunkMeshes[patchIndex] = TerrainMeshBuilder::buildPatchMesh(*m_terrainAsset, m_quadtree, m_lodSelection[patchIndex]);
+            // Hash and bounds are computed here instead of on the render thread.
+            m_chunkMeshes[patchIndex].getGeometryInfo();
+        } });
+
+    m_selectedPatchKeys = std::move(selectedKeys);
+
+    // Parked patches make camera moves back and forth cheap; cap them at one patch budget.
+    const size_t maxCachedPatches = static_cast<size_t>(m_lodSettings.maxPatches);
+    for (auto cachedIt = m_patchCache.begin(); cachedIt != m_patchCache.end() && m_patchCache.size() > maxCachedPatches;)
+        cachedIt = m_patchCache.erase(cachedIt);
+}
+
+uint32_t TerrainComponent::getPatchQuads() const
+{
+    // Stitching needs an even, power-of-two patch resolution; the default 63 quads per chunk maps to 64.
+    return std::bit_ceil(std::clamp(m_quadsPerChunk, 8u, 256u));
+}
+
+void TerrainComponent::launchRegionRebuild()
+{
+    const TerrainRegion dirtyRegion = std::exchange(m_dirtyRegion, {});
+    if (!m_terrainAsset || !m_terrainAsset->isValid())
+        return;
+
+    auto batch = std::make_shared<RebuildBatch>();
+
+    // Sources are gathered here, on the thread that edits the heights; the jobs only read the copies.
+    if (m_lodEnabled)
+    {
+        if (m_quadtree.isEmpty())
+            return;
+
+        m_quadtree.refreshHeightBounds(*m_terrainAsset, dirtyRegion);
+
+        for (auto cachedIt = m_patchCache.begin(); cachedIt != m_patchCache.end();)
+        {
+            if (!m_quadtree.getNodeFootprint(patchKeyNode(cachedIt->first)).intersects(dirtyRegion))
+            {
+                ++cachedIt;
+                continue;
+            }
+
+            m_retiredGeometry.push_back(cachedIt->second.getGeometryInfo().hash);
+            cachedIt = m_patchCache.erase(cachedIt);
+        }
+
+        for (size_t index = 0; index < m_lodSelection.size(); ++index)
+        {
+            if (!m_quadtree.getNodeFootprint(m_lodSelection[index].nodeIndex).intersects(dirtyRegion))
+                continue;
+
+            batch->keys.push_back(m_selectedPatchKeys[index]);
+            batch->sources.push_back(TerrainMeshBuilder::gatherPatchSource(*m_terrainAsset, m_quadtree, m_lodSelection[index]));
+        }
+    }
+    else
+    {
+        const TerrainChunkLayout layout = TerrainMeshBuilder::computeChunkLayout(*m_terrainAsset, m_quadsPerChunk);
+        for (uint32_t chunkY = 0; chunkY < layout.chunkCountY; ++chunkY)
+        {
+            for (uint32_t chunkX = 0; chunkX < layout.chunkCountX; ++chunkX)
+            {
+                if (!chunkFootprint(layout, chunkX, chunkY).intersects(dirtyRegion))
+                    continue;
+
+                batch->keys.push_back(static_cast<uint64_t>(chunkY) * layout.chunkCountX + chunkX);
+                batch->sources.push_back(TerrainMeshBuilder::gatherChunkSource(*m_terrainAsset, layout, chunkX, chunkY));
+            }
+        }
+    }
+
+    if (batch->keys.empty())
+        return;
+
+    batch->meshes.resize(batch->keys.size());
+
+    auto &threadPool = ThreadPoolManager::instance();
+    const size_t meshCount = batch->keys.size();
+    const size_t taskCount = std::min(meshCount, threadPool.getMaxThreads());
+    batch->pendingTasks.store(static_cast<uint32_t>(taskCount), std::memory_order_relaxed);
+    m_rebuildBatch = batch;
+
+    // Separate jobs rather than a parallelFor inside one job: workers never wait on each other.
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        const size_t begin = meshCount * taskIndex / taskCount;
+        const size_t end = meshCount * (taskIndex + 1u) / taskCount;
+        threadPool.submit([batch, begin, end]()
+                          {
+            for (size_t meshIndex = begin; meshIndex < end; ++meshIndex)
+            {
+                batch->meshes[meshIndex] = TerrainMeshBuilder::buildMesh(batch->sources[meshIndex]);
+                batch->meshes[meshIndex].getGeometryInfo();
+            }
+
+            batch->pendingTasks.fetch_sub(1u, std::memory_order_release); });
+    }
+}
+
+void TerrainComponent::applyFinishedRebuild()
+{
+    if (!m_rebuildBatch || m_rebuildBatch->pendingTasks.load(std::memory_order_acquire) != 0u)
+        return;
+
+    const auto batch = std::move(m_rebuildBatch);
+
+    for (size_t index = 0; index < batch->keys.size(); ++index)
+    {
+        const uint64_t key = batch->keys[index];
+        CPUMesh *target = nullptr;
+
+        if (m_lodEnabled)
+        {
+            // Selected keys are sorted. Patches that left the selection meanwhile are only refreshed
+            // if they were parked; anything else gets built from current heights when selected again.
+            const auto selectedIt = std::lower_bound(m_selectedPatchKeys.begin(), m_selectedPatchKeys.end(), key);
+            if (selectedIt != m_selectedPatchKeys.end() && *selectedIt == key)
+                target = &m_chunkMeshes[static_cast<size_t>(selectedIt - m_selectedPatchKeys.begin())];
+            else if (auto cachedIt = m_patchCache.find(key); cachedIt != m_patchCache.end())
+                target = &cachedIt->second;
+        }
+        else if (key < m_chunkMeshes.size())
+            target = &m_chunkMeshes[static_cast<size_t>(key)];
+
+        if (!target)
+            continue;
+
+        const MeshGeometryHash previousHash = target->getGeometryInfo().hash;
+        *target = std::move(batch->meshes[index]);
+        if (target->getGeometryInfo().hash != previousHash)
+            m_retiredGeometry.push_back(previousHash);
+    }
+}
+
 void TerrainComponent::rebuildChunkMeshes()
 {
     m_chunkMeshesDirty = false;
+    m_dirtyRegion = {};
+    m_rebuildBatch.reset();
     m_chunkMeshes.clear();
+    m_lodSelection.clear();
+    m_selectedPatchKeys.clear();
+    m_patchCache.clear();
+    m_quadtree.clear();
 
     if (!m_terrainAsset || !m_terrainAsset->isValid())
         return;
 
+    // Patches are selected per camera in updateLod().
+    if (m_lodEnabled)
+    {
+        m_quadtree.build(*m_terrainAsset, getPatchQuads());
+        return;
+    }
+
     TerrainMeshBuildSettings buildSettings{};
     buildSettings.quadsPerChunk = m_quadsPerChunk;
     m_chunkMeshes = TerrainMeshBuilder::buildChunkMeshes(*m_terrainAsset, buildSettings);
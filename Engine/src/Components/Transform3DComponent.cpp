@@ -1,5 +1,6 @@
 #include "Engine/Components/Transform3DComponent.hpp"
 #include "Engine/Entity.hpp"
+#include "Engine/Scene.hpp"
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
@@ -20,17 +21,17 @@ void Transform3DComponent::setRotation(const glm::quat& quat)
 
 const glm::vec3& Transform3DComponent::getPosition() const
 {
-    return m_position;
+    return readsParallelSnapshot() ? m_snapshotPosition : m_position;
 }
 
 const glm::vec3& Transform3DComponent::getScale() const
 {
-    return m_scale;
+    return readsParallelSnapshot() ? m_snapshotScale : m_scale;
 }
 
 glm::vec3 Transform3DComponent::getEulerDegrees() const
 {
-    return glm::degrees(glm::eulerAngles(m_rotation));
+    return glm::degrees(glm::eulerAngles(getRotation()));
 }
 
 void Transform3DComponent::setEulerDegrees(const glm::vec3& eulerDeg)
@@ -50,7 +51,7 @@ glm::vec3& Transform3DComponent::getPosition()
 
 const glm::quat& Transform3DComponent::getRotation() const
 {
-    return m_rotation;
+    return readsParallelSnapshot() ? m_snapshotRotation : m_rotation;
 }
 
 glm::vec3 Transform3DComponent::getWorldPosition() const
@@ -63,9 +64,9 @@ glm::quat Transform3DComponent::getWorldRotation() const
 {
     const auto *parentTransform = getParentTransform();
     if (!parentTransform)
-        return m_rotation;
+        return getRotation();
 
-    return parentTransform->getWorldRotation() * m_rotation;
+    return parentTransform->getWorldRotation() * getRotation();
 }
 
 void Transform3DComponent::setWorldPosition(const glm::vec3 &position)
@@ -93,11 +94,27 @@ void Transform3DComponent::setWorldRotation(const glm::quat &rotation)
     m_rotation = glm::inverse(parentTransform->getWorldRotation()) * rotation;
 }
 
+void Transform3DComponent::setWorldPose(const glm::vec3 &position, const glm::quat &rotation)
+{
+    const auto *parentTransform = getParentTransform();
+    if (!parentTransform)
+    {
+        m_position = position;
+        m_rotation = rotation;
+        return;
+    }
+
+    const glm::mat4 inverseParentMatrix = glm::inverse(parentTransform->getMatrix());
+    m_position = glm::vec3(inverseParentMatrix * glm::vec4(position, 1.0f));
+    m_rotation = glm::inverse(parentTransform->getWorldRotation()) * rotation;
+}
+
 glm::mat4 Transform3DComponent::getLocalMatrix() const
 {
-    glm::mat4 translation = glm::translate(glm::mat4(1.0f), m_position);
-    glm::mat4 rotationMat = glm::toMat4(m_rotation);
-    glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), m_scale);
+    const bool snapshot = readsParallelSnapshot();
+    glm::mat4 translation = glm::translate(glm::mat4(1.0f), snapshot ? m_snapshotPosition : m_position);
+    glm::mat4 rotationMat = glm::toMat4(snapshot ? m_snapshotRotation : m_rotation);
+    glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), snapshot ? m_snapshotScale : m_scale);
     return translation * rotationMat * scaleMat;
 }
 
@@ -110,6 +127,19 @@ glm::mat4 Transform3DComponent::getMatrix() const
     return parentTransform->getMatrix() * getLocalMatrix();
 }
 
+void Transform3DComponent::captureParallelReadSnapshot()
+{
+    m_snapshotPosition = m_position;
+    m_snapshotScale = m_scale;
+    m_snapshotRotation = m_rotation;
+}
+
+bool Transform3DComponent::readsParallelSnapshot() const
+{
+    const Entity *jobOwner = Scene::getParallelScriptJobOwner();
+    return jobOwner != nullptr && jobOwner != getOwner<Entity>();
+}
+
 const Transform3DComponent *Transform3DComponent::getParentTransform() const
 {
     auto *owner = getOwner<Entity>();
@@ -47,6 +47,8 @@ namespace
     std::atomic_flag g_crashReportWritten = ATOMIC_FLAG_INIT;
     std::once_flag g_stackTraceSymbolsInitFlag;
 
+    constexpr auto CRASH_LOG_FLUSH_TIMEOUT = std::chrono::milliseconds(250);
+
     std::tm makeLocalTime(std::time_t timeValue)
     {
         std::tm localTime{};
@@ -361,6 +363,13 @@ namespace
         return crashFilePath;
     }
 
+    // Best effort: the writer thread may be the one that faulted, so do not wait on it for long.
+    void flushLoggerBeforeExit()
+    {
+        if (auto *logger = elix::core::Logger::getDefaultLogger())
+            logger->flushFor(CRASH_LOG_FLUSH_TIMEOUT);
+    }
+
     void terminateHandler()
     {
         std::ostringstream details;
@@ -373,6 +382,10 @@ namespace
         if (!crashFilePath.empty())
             emitCrashMessage("Crash report written to: " + crashFilePath.string());
 
+        // Logging is asynchronous; write out what is still queued before the process goes away.
+        if (auto *logger = elix::core::Logger::getDefaultLogger())
+            logger->flush();
+
         std::_Exit(EXIT_FAILURE);
     }
 
@@ -390,6 +403,8 @@ namespace
         details << "Backtrace:\n"
                 << captureCurrentStackTrace(1);
 
+        flushLoggerBeforeExit();
+
         const std::filesystem::path crashFilePath = writeCrashReportInternal("Fatal signal", details.str(), true);
         if (!crashFilePath.empty())
             emitCrashMessage("Crash report written to: " + crashFilePath.string());
@@ -405,6 +420,8 @@ namespace
         details << "Backtrace:\n"
                 << captureCurrentStackTrace(1);
 
+        flushLoggerBeforeExit();
+
         const std::filesystem::path crashFilePath = writeCrashReportInternal("Fatal signal", details.str(), true);
         if (!crashFilePath.empty())
             emitCrashMessage("Crash report written to: " + crashFilePath.string());
@@ -1,9 +1,16 @@
 #include "Engine/Entity.hpp"
 
 #include <algorithm>
+#include <atomic>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+namespace
+{
+    std::atomic<uint64_t> g_hierarchyRevision{0u};
+    std::atomic<uint64_t> g_componentRevision{0u};
+} // namespace
+
 Entity::Entity(const std::string &name) : m_name(name)
 {
 }
@@ -40,6 +47,7 @@ const std::string &Entity::getName() const
 void Entity::setName(const std::string &name)
 {
     m_name = name;
+    g_hierarchyRevision.fetch_add(1u, std::memory_order_relaxed);
 }
 
 bool Entity::removeTag(const std::string &tag)
@@ -95,6 +103,7 @@ bool Entity::setParent(Entity *parent)
     }
 
     m_parent = parent;
+    g_hierarchyRevision.fetch_add(1u, std::memory_order_relaxed);
 
     if (m_parent)
     {
@@ -138,9 +147,25 @@ bool Entity::isDescendantOf(const Entity *possibleAncestor) const
     return false;
 }
 
+uint64_t Entity::getHierarchyRevision()
+{
+    return g_hierarchyRevision.load(std::memory_order_relaxed);
+}
+
+uint64_t Entity::getComponentRevision()
+{
+    return g_componentRevision.load(std::memory_order_relaxed);
+}
+
+void Entity::markComponentsChanged()
+{
+    g_componentRevision.fetch_add(1u, std::memory_order_relaxed);
+}
+
 Entity::~Entity()
 {
     clearParent();
+    g_hierarchyRevision.fetch_add(1u, std::memory_order_relaxed);
 
     for (auto *child : m_children)
         if (child)
@@ -1,29 +1,93 @@
 #include "Engine/Particles/Modules/CollisionModule.hpp"
 #include "Engine/Particles/ParticleTypes.hpp"
+#include "Engine/Terrain/TerrainQuery.hpp"
 
 #include <glm/gtc/epsilon.hpp>
 
+#include <algorithm>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
-void CollisionModule::onParticleUpdate(Particle &p, float dt)
+void CollisionModule::onEmitterUpdate(std::vector<Particle> &particles, float dt)
 {
-    if (!m_physicsScene)
+    const TerrainQuery *terrainQuery = collideWithTerrain && m_terrainQuery && m_terrainQuery->isValid() ? m_terrainQuery : nullptr;
+    if (!m_physicsScene && !terrainQuery)
         return;
 
-    const float speed = glm::length(p.velocity);
-    if (speed < 1e-4f)
+    m_probePositions.clear();
+    m_probeParticleIndices.clear();
+
+    for (uint32_t index = 0; index < particles.size(); ++index)
+    {
+        const Particle &p = particles[index];
+        if (!p.alive)
+            continue;
+
+        if (glm::length(p.velocity) < 1e-4f)
+            continue;
+
+        m_probePositions.push_back(p.position + p.velocity * (dt * lookAheadMultiplier));
+        m_probeParticleIndices.push_back(index);
+    }
+
+    if (m_probeParticleIndices.empty())
         return;
 
-    const glm::vec3 dir = p.velocity / speed;
-    const float castDist = speed * dt * lookAheadMultiplier;
+    if (terrainQuery)
+    {
+        m_probeTerrainHeights.resize(m_probePositions.size());
+        terrainQuery->sampleHeights(m_probePositions.data(), m_probePositions.size(), m_probeTerrainHeights.data());
+    }
+
+    m_rayBatch.clear();
+    m_rayParticleIndices.clear();
+
+    for (size_t probe = 0; probe < m_probeParticleIndices.size(); ++probe)
+    {
+        Particle &p = particles[m_probeParticleIndices[probe]];
 
-    PhysicsRaycastHit hit;
-    if (!m_physicsScene->raycast(p.position, dir, castDist, &hit))
+        if (terrainQuery && m_probePositions[probe].y <= m_probeTerrainHeights[probe])
+        {
+            // Land where the look-ahead segment crosses the ground, approximated along the height difference.
+            const glm::vec3 &end = m_probePositions[probe];
+            const float startHeight = p.position.y;
+            const float heightDrop = startHeight - end.y;
+            const float fraction = heightDrop > 1e-6f
+                                       ? glm::clamp((startHeight - m_probeTerrainHeights[probe]) / heightDrop, 0.0f, 1.0f)
+                                       : 1.0f;
+
+            glm::vec3 hitPosition = p.position + (end - p.position) * fraction;
+            hitPosition.y = std::max(hitPosition.y, m_probeTerrainHeights[probe]);
+
+            p.position = hitPosition;
+            p.age = p.lifetime;
+            m_hitPositions.push_back(hitPosition);
+            continue;
+        }
+
+        if (!m_physicsScene)
+            continue;
+
+        const float speed = glm::length(p.velocity);
+        m_rayBatch.add(p.position, p.velocity / speed, speed * dt * lookAheadMultiplier);
+        m_rayParticleIndices.push_back(m_probeParticleIndices[probe]);
+    }
+
+    if (m_rayParticleIndices.empty())
         return;
 
-    p.position = hit.position;
-    p.age = p.lifetime;
-    m_hitPositions.push_back(hit.position);
+    m_physicsScene->raycastBatch(m_rayBatch, m_rayResults);
+
+    for (size_t ray = 0; ray < m_rayParticleIndices.size(); ++ray)
+    {
+        if (!m_rayResults.hits[ray])
+            continue;
+
+        Particle &p = particles[m_rayParticleIndices[ray]];
+        p.position = m_rayResults.positions[ray];
+        p.age = p.lifetime;
+        m_hitPositions.push_back(m_rayResults.positions[ray]);
+    }
 }
 
 ELIX_NESTED_NAMESPACE_END
@@ -68,6 +68,15 @@ void ParticleEmitter::update(float deltaTime, const glm::vec3 &worldPosition)
         }
     }
 
+    if (newAliveCount > 0)
+    {
+        for (auto &[_, mod] : m_modules)
+        {
+            if (mod->isEnabled())
+                mod->onEmitterUpdate(m_particles, deltaTime);
+        }
+    }
+
     const bool countChanged = (newAliveCount != m_aliveCount);
     m_aliveCount = newAliveCount;
     m_dirty = countChanged || (m_aliveCount > 0); // mark dirty when there's anything to render
@@ -82,6 +91,12 @@ void ParticleEmitter::setPhysicsScene(PhysicsScene *scene)
         mod->setPhysicsScene(scene);
 }
 
+void ParticleEmitter::setTerrainQuery(const TerrainQuery *terrainQuery)
+{
+    for (auto &[_, mod] : m_modules)
+        mod->setTerrainQuery(terrainQuery);
+}
+
 void ParticleEmitter::spawnParticleAt(const glm::vec3 &worldPos, uint32_t count)
 {
     for (uint32_t i = 0; i < count; ++i)
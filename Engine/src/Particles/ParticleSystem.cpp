@@ -44,6 +44,12 @@ void ParticleSystem::setPhysicsScene(PhysicsScene *scene)
         emitter->setPhysicsScene(scene);
 }
 
+void ParticleSystem::setTerrainQuery(const TerrainQuery *terrainQuery)
+{
+    for (auto &emitter : m_emitters)
+        emitter->setTerrainQuery(terrainQuery);
+}
+
 void ParticleSystem::update(float deltaTime, const glm::vec3 &worldPosition)
 {
     if (!m_playing || m_paused)
@@ -1,4 +1,6 @@
 #include "Engine/Physics/PhysicsScene.hpp"
+#include "Engine/Threads/ThreadPoolManager.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include <glm/geometric.hpp>
 
@@ -8,6 +10,48 @@
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+namespace
+{
+    // Below this many queries per worker the job overhead outweighs the query cost.
+    constexpr size_t MIN_QUERIES_PER_JOB = 64u;
+
+    template <typename QueryFn>
+    void runQueryBatch(size_t count, QueryFn &&query)
+    {
+        if (count == 0u)
+            return;
+
+        const size_t maxJobs = (count + MIN_QUERIES_PER_JOB - 1u) / MIN_QUERIES_PER_JOB;
+        ThreadPoolManager::instance().parallelFor(count, [&query](size_t begin, size_t end)
+                                                  {
+                                                      for (size_t index = begin; index < end; ++index)
+                                                          query(index); }, maxJobs);
+    }
+
+    bool normalizeQueryDirection(const glm::vec3 &direction, float maxDistance, physx::PxVec3 &outDirection)
+    {
+        if (maxDistance <= 0.0f)
+            return false;
+
+        const float directionLength = glm::length(direction);
+        if (directionLength <= std::numeric_limits<float>::epsilon())
+            return false;
+
+        const glm::vec3 normalizedDirection = direction / directionLength;
+        outDirection = physx::PxVec3(normalizedDirection.x, normalizedDirection.y, normalizedDirection.z);
+        return true;
+    }
+
+    void writeQueryHit(PhysicsQueryResults &results, size_t index, const physx::PxLocationHit &hit)
+    {
+        results.hits[index] = 1u;
+        results.positions[index] = glm::vec3(hit.position.x, hit.position.y, hit.position.z);
+        results.normals[index] = glm::vec3(hit.normal.x, hit.normal.y, hit.normal.z);
+        results.distances[index] = hit.distance;
+        results.actorUserData[index] = hit.actor ? hit.actor->userData : nullptr;
+    }
+} // namespace
+
 #if defined(PHYSX_GPU_ENABLED) && PX_SUPPORT_GPU_PHYSX
 PhysicsScene::PhysicsScene(physx::PxPhysics *physics,
                            physx::PxCudaContextManager *cudaContextManager)
@@ -15,10 +59,10 @@ PhysicsScene::PhysicsScene(physx::PxPhysics *physics,
 {
     physx::PxSceneDesc sceneDesc(m_physics->getTolerancesScale());
     sceneDesc.gravity = physx::PxVec3(0.0f, -9.81f, 0.0f);
-    m_defaultCpuDispatcher = physx::PxDefaultCpuDispatcherCreate(2);
-    sceneDesc.cpuDispatcher = m_defaultCpuDispatcher;
+    sceneDesc.cpuDispatcher = &m_taskDispatcher;
     sceneDesc.filterShader = contactNotifyFilterShader;
     sceneDesc.simulationEventCallback = &m_contactListener;
+    sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
 
     if (cudaContextManager && cudaContextManager->contextIsValid())
     {
@@ -33,10 +77,10 @@ PhysicsScene::PhysicsScene(physx::PxPhysics *physics) : m_physics(physics)
 {
     physx::PxSceneDesc sceneDesc(m_physics->getTolerancesScale());
     sceneDesc.gravity = physx::PxVec3(0.0f, -9.81f, 0.0f);
-    m_defaultCpuDispatcher = physx::PxDefaultCpuDispatcherCreate(2);
-    sceneDesc.cpuDispatcher = m_defaultCpuDispatcher;
+    sceneDesc.cpuDispatcher = &m_taskDispatcher;
     sceneDesc.filterShader = contactNotifyFilterShader;
     sceneDesc.simulationEventCallback = &m_contactListener;
+    sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
     m_scene = m_physics->createScene(sceneDesc);
 #endif
 
@@ -47,8 +91,59 @@ PhysicsScene::PhysicsScene(physx::PxPhysics *physics) : m_physics(physics)
 
 void PhysicsScene::update(float deltaTime)
 {
+    beginStep(deltaTime);
+    m_lastStepTimings.async = false;
+    finishStep();
+}
+
+void PhysicsScene::beginStep(float deltaTime)
+{
+    VX_PROFILE_SCOPE("PhysicsScene::beginStep");
+
+    if (m_stepInFlight)
+        finishStep();
+
+    const auto start = std::chrono::steady_clock::now();
     m_scene->simulate(deltaTime);
+    m_stepKickTime = std::chrono::steady_clock::now();
+
+    m_lastStepTimings = PhysicsStepTimings{};
+    m_lastStepTimings.simulateCallMs = std::chrono::duration<double, std::milli>(m_stepKickTime - start).count();
+    m_lastStepTimings.async = true;
+    m_stepInFlight = true;
+}
+
+bool PhysicsScene::finishStep()
+{
+    VX_PROFILE_SCOPE("PhysicsScene::finishStep");
+
+    if (!m_stepInFlight)
+        return false;
+
+    const auto fetchStart = std::chrono::steady_clock::now();
     m_scene->fetchResults(true);
+    const auto fetchEnd = std::chrono::steady_clock::now();
+    m_stepInFlight = false;
+
+    m_lastStepTimings.overlappedMs = std::chrono::duration<double, std::milli>(fetchStart - m_stepKickTime).count();
+    m_lastStepTimings.fetchWaitMs = std::chrono::duration<double, std::milli>(fetchEnd - fetchStart).count();
+
+    ++m_timingTotals.steps;
+    if (m_lastStepTimings.async)
+        ++m_timingTotals.asyncSteps;
+    m_timingTotals.overlappedMs += m_lastStepTimings.overlappedMs;
+    m_timingTotals.fetchWaitMs += m_lastStepTimings.fetchWaitMs;
+
+    return true;
+}
+
+physx::PxActor **PhysicsScene::getActiveActors(uint32_t &count) const
+{
+    count = 0u;
+    if (!m_scene || m_stepInFlight)
+        return nullptr;
+
+    return m_scene->getActiveActors(count);
 }
 
 bool PhysicsScene::raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, PhysicsRaycastHit *outHit) const
@@ -84,6 +179,83 @@ bool PhysicsScene::raycast(const glm::vec3 &origin, const glm::vec3 &direction,
     return true;
 }
 
+void PhysicsScene::raycastBatch(const PhysicsRaycastBatch &batch, PhysicsQueryResults &results) const
+{
+    VX_PROFILE_SCOPE("PhysicsScene::raycastBatch");
+
+    const size_t count = batch.size();
+    results.resize(count);
+    if (!m_scene)
+        return;
+
+    runQueryBatch(count, [this, &batch, &results](size_t index)
+                  {
+                      physx::PxVec3 direction;
+                      if (!normalizeQueryDirection(batch.directions[index], batch.maxDistances[index], direction))
+                          return;
+
+                      const glm::vec3 &origin = batch.origins[index];
+                      physx::PxRaycastBuffer hitBuffer;
+                      if (m_scene->raycast(physx::PxVec3(origin.x, origin.y, origin.z), direction, batch.maxDistances[index], hitBuffer) &&
+                          hitBuffer.hasBlock)
+                          writeQueryHit(results, index, hitBuffer.block); });
+}
+
+void PhysicsScene::sweepBatch(const PhysicsSweepBatch &batch, PhysicsQueryResults &results) const
+{
+    VX_PROFILE_SCOPE("PhysicsScene::sweepBatch");
+
+    const size_t count = batch.size();
+    results.resize(count);
+    if (!m_scene)
+        return;
+
+    runQueryBatch(count, [this, &batch, &results](size_t index)
+                  {
+                      physx::PxVec3 direction;
+                      if (!normalizeQueryDirection(batch.directions[index], batch.maxDistances[index], direction))
+                          return;
+
+                      const glm::vec3 &origin = batch.origins[index];
+                      const physx::PxSphereGeometry sphere(std::max(batch.radii[index], 1e-4f));
+                      const physx::PxTransform pose(physx::PxVec3(origin.x, origin.y, origin.z));
+
+                      physx::PxSweepBuffer hitBuffer;
+                      if (m_scene->sweep(sphere, pose, direction, batch.maxDistances[index], hitBuffer) && hitBuffer.hasBlock)
+                          writeQueryHit(results, index, hitBuffer.block); });
+}
+
+void PhysicsScene::overlapBatch(const PhysicsOverlapBatch &batch, PhysicsQueryResults &results) const
+{
+    VX_PROFILE_SCOPE("PhysicsScene::overlapBatch");
+
+    const size_t count = batch.size();
+    results.resize(count);
+    if (!m_scene)
+        return;
+
+    runQueryBatch(count, [this, &batch, &results](size_t index)
+                  {
+                      const float radius = batch.radii[index];
+                      if (radius <= 0.0f)
+                          return;
+
+                      const glm::vec3 &center = batch.centers[index];
+                      const physx::PxSphereGeometry sphere(radius);
+                      const physx::PxTransform pose(physx::PxVec3(center.x, center.y, center.z));
+
+                      // Any hit is enough: stop at the first touching shape.
+                      physx::PxOverlapBuffer hitBuffer;
+                      physx::PxQueryFilterData filterData;
+                      filterData.flags |= physx::PxQueryFlag::eANY_HIT;
+                      if (!m_scene->overlap(sphere, pose, hitBuffer, filterData) || !hitBuffer.hasBlock)
+                          return;
+
+                      results.hits[index] = 1u;
+                      results.positions[index] = center;
+                      results.actorUserData[index] = hitBuffer.block.actor ? hitBuffer.block.actor->userData : nullptr; });
+}
+
 physx::PxRigidDynamic *PhysicsScene::createDynamic(const physx::PxTransform &transform)
 {
     auto dynamicBody = m_physics->createRigidDynamic(transform);
@@ -105,6 +277,10 @@ physx::PxD6Joint *PhysicsScene::createD6Joint(physx::PxRigidActor *actor0,
 
 void PhysicsScene::removeActor(physx::PxActor &actor, bool wakeOnLostTouch, bool release)
 {
+    // Released actors must not be referenced by a running step.
+    if (m_stepInFlight)
+        finishStep();
+
     m_scene->removeActor(actor, wakeOnLostTouch);
 
     if (release)
@@ -165,6 +341,8 @@ physx::PxController *PhysicsScene::createController(const physx::PxVec3 &positio
 
 PhysicsScene::~PhysicsScene()
 {
+    finishStep();
+
     if (m_controllerManager)
     {
         m_controllerManager->release();
@@ -182,12 +360,6 @@ PhysicsScene::~PhysicsScene()
         m_defaultMaterial->release();
         m_defaultMaterial = nullptr;
     }
-
-    if (m_defaultCpuDispatcher)
-    {
-        m_defaultCpuDispatcher->release();
-        m_defaultCpuDispatcher = nullptr;
-    }
 }
 
 ELIX_NESTED_NAMESPACE_END
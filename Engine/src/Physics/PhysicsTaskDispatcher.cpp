@@ -0,0 +1,23 @@
+#include "Engine/Physics/PhysicsTaskDispatcher.hpp"
+
+#include "Engine/Threads/ThreadPoolManager.hpp"
+
+#include <algorithm>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void PhysicsTaskDispatcher::submitTask(physx::PxBaseTask &task)
+{
+    // Same contract as PxDefaultCpuDispatcher: run, then release to signal continuations.
+    ThreadPoolManager::instance().submit([&task]()
+                                         {
+                                             task.run();
+                                             task.release(); });
+}
+
+uint32_t PhysicsTaskDispatcher::getWorkerCount() const
+{
+    return static_cast<uint32_t>(std::max<std::size_t>(1u, ThreadPoolManager::instance().getWorkerCount()));
+}
+
+ELIX_NESTED_NAMESPACE_END
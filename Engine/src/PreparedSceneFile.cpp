@@ -0,0 +1,151 @@
+#include "Engine/PreparedSceneFile.hpp"
+
+#include "Engine/Assets/AssetManager.hpp"
+#include "Engine/Assets/AssetsLoader.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <fstream>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+PreparedSceneFile::SharedPtr PreparedSceneFile::load(const std::string &filePath, bool prefetchAssets)
+{
+    std::ifstream file(filePath);
+
+    if (!file.is_open())
+    {
+        VX_ENGINE_ERROR_STREAM("Failed to open file: " << filePath << std::endl);
+        return nullptr;
+    }
+
+    SharedPtr prepared(new PreparedSceneFile());
+    prepared->m_filePath = filePath;
+    prepared->m_sceneDirectory = std::filesystem::path(filePath).parent_path();
+
+    try
+    {
+        file >> prepared->m_json;
+    }
+    catch (const nlohmann::json::parse_error &e)
+    {
+        VX_ENGINE_ERROR_STREAM("Failed to parse scene file " << e.what() << std::endl);
+        return nullptr;
+    }
+
+    if (prefetchAssets)
+        prepared->prefetchAssets();
+
+    return prepared;
+}
+
+std::string PreparedSceneFile::resolvePath(const std::string &rawPath) const
+{
+    if (rawPath.empty())
+        return {};
+
+    std::filesystem::path path(rawPath);
+    if (path.is_relative())
+        path = m_sceneDirectory / path;
+
+    return path.lexically_normal().string();
+}
+
+void PreparedSceneFile::prefetchAssets()
+{
+    if (!m_json.contains("game_objects") || !m_json["game_objects"].is_array())
+        return;
+
+    for (const auto &objectJson : m_json["game_objects"])
+    {
+        if (!objectJson.contains("components") || !objectJson["components"].is_array())
+            continue;
+
+        for (const auto &componentJson : objectJson["components"])
+        {
+            if (!componentJson.is_object())
+                continue;
+
+            const std::string type = componentJson.value("type", std::string{});
+
+            if (type == "static_mesh" || type == "skeletal_mesh")
+            {
+                if (componentJson.value("is_primitive", false))
+                    continue;
+
+                const std::string assetPath = resolvePath(componentJson.value("asset_path", std::string{}));
+                if (assetPath.empty() || m_modelHandles.contains(assetPath))
+                    continue;
+
+                // Models go through the streaming worker first so they load while terrain and animations are read here.
+                auto &handle = m_modelHandles[assetPath];
+                handle = std::make_unique<AssetHandle<ModelAsset>>(assetPath);
+                AssetManager::getInstance().requestLoad(*handle);
+            }
+            else if (type == "terrain")
+            {
+                const std::string assetPath = resolvePath(componentJson.value("asset_path", std::string{}));
+                if (assetPath.empty() || m_terrainAssets.contains(assetPath))
+                    continue;
+
+                if (auto terrainAsset = AssetsLoader::loadTerrain(assetPath))
+                    m_terrainAssets.emplace(assetPath, std::make_shared<TerrainAsset>(std::move(terrainAsset.value())));
+            }
+            else if (type == "animator")
+            {
+                if (!componentJson.contains("animation_asset_paths") || !componentJson["animation_asset_paths"].is_array())
+                    continue;
+
+                for (const auto &pathJson : componentJson["animation_asset_paths"])
+                {
+                    if (!pathJson.is_string())
+                        continue;
+
+                    const std::string assetPath = resolvePath(pathJson.get<std::string>());
+                    if (assetPath.empty() || m_animationAssets.contains(assetPath))
+                        continue;
+
+                    if (auto animationAsset = AssetsLoader::loadAnimationAsset(assetPath))
+                        m_animationAssets.emplace(assetPath, std::make_shared<AnimationAsset>(std::move(animationAsset.value())));
+                }
+            }
+        }
+    }
+}
+
+std::size_t PreparedSceneFile::getPendingModelCount() const
+{
+    std::size_t pendingCount = 0u;
+    for (const auto &[path, handle] : m_modelHandles)
+    {
+        if (handle->state() == AssetState::Loading)
+            ++pendingCount;
+    }
+
+    return pendingCount;
+}
+
+bool PreparedSceneFile::isModelPrefetched(const std::string &path) const
+{
+    const auto it = m_modelHandles.find(path);
+    return it != m_modelHandles.end() && it->second->ready();
+}
+
+std::shared_ptr<TerrainAsset> PreparedSceneFile::takeTerrainAsset(const std::string &path)
+{
+    const auto it = m_terrainAssets.find(path);
+    if (it == m_terrainAssets.end())
+        return nullptr;
+
+    auto terrainAsset = std::move(it->second);
+    m_terrainAssets.erase(it);
+    return terrainAsset;
+}
+
+std::shared_ptr<const AnimationAsset> PreparedSceneFile::findAnimationAsset(const std::string &path) const
+{
+    const auto it = m_animationAssets.find(path);
+    return it != m_animationAssets.end() ? it->second : nullptr;
+}
+
+ELIX_NESTED_NAMESPACE_END
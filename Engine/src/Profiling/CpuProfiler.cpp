@@ -0,0 +1,259 @@
+#include "Engine/Profiling/CpuProfiler.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+ELIX_CUSTOM_NAMESPACE_BEGIN(profiling)
+
+namespace
+{
+    struct ProfileEvent
+    {
+        const char *name{nullptr};
+        uint64_t startNs{0};
+        uint64_t endNs{0};
+    };
+
+    // Written only by its owning thread; the exporter reads [0, count) after the capture has ended.
+    struct ThreadBuffer
+    {
+        static constexpr uint32_t CAPACITY = 1u << 16u;
+
+        uint32_t threadIndex{0};
+        std::string threadName;
+        std::unique_ptr<ProfileEvent[]> events; // allocated on the first recorded event
+        std::atomic<uint32_t> count{0};
+        std::atomic<uint32_t> dropped{0};
+        std::atomic<uint64_t> generation{0};
+    };
+
+    std::atomic<bool> g_capturing{false};
+    std::atomic<uint64_t> g_captureGeneration{0};
+    std::atomic<uint64_t> g_captureStartNs{0};
+
+    std::mutex g_registryMutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> g_threadBuffers;
+    std::string g_lastTracePath;
+
+    std::mutex g_requestMutex;
+    uint32_t g_requestedFramesLeft{0};
+    std::string g_requestedOutputPath;
+
+    ThreadBuffer &localBuffer()
+    {
+        thread_local std::shared_ptr<ThreadBuffer> buffer = []
+        {
+            auto created = std::make_shared<ThreadBuffer>();
+
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            created->threadIndex = static_cast<uint32_t>(g_threadBuffers.size()) + 1u;
+            created->threadName = "Thread " + std::to_string(created->threadIndex);
+            g_threadBuffers.push_back(created);
+            return created;
+        }();
+
+        return *buffer;
+    }
+
+    void writeJsonString(std::ostream &stream, const char *text)
+    {
+        stream << '"';
+        for (const char *character = text ? text : ""; *character; ++character)
+        {
+            switch (*character)
+            {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            case '\n':
+                stream << "\\n";
+                break;
+            default:
+                stream << *character;
+                break;
+            }
+        }
+        stream << '"';
+    }
+} // namespace
+
+uint64_t CpuProfiler::nowNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+bool CpuProfiler::isCapturing()
+{
+    return g_capturing.load(std::memory_order_relaxed);
+}
+
+void CpuProfiler::beginCapture()
+{
+    // Buffers reset lazily on their own thread when they see the new generation.
+    g_captureGeneration.fetch_add(1u, std::memory_order_relaxed);
+    g_captureStartNs.store(nowNs(), std::memory_order_relaxed);
+    g_capturing.store(true, std::memory_order_release);
+}
+
+void CpuProfiler::endCapture()
+{
+    g_capturing.store(false, std::memory_order_release);
+}
+
+void CpuProfiler::requestCapture(uint32_t frameCount, const std::string &outputPath)
+{
+    if (frameCount == 0u || outputPath.empty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(g_requestMutex);
+        g_requestedFramesLeft = frameCount;
+        g_requestedOutputPath = outputPath;
+    }
+
+    beginCapture();
+}
+
+void CpuProfiler::endFrame()
+{
+    std::string outputPath;
+    {
+        std::lock_guard<std::mutex> lock(g_requestMutex);
+        if (g_requestedFramesLeft == 0u || --g_requestedFramesLeft > 0u)
+            return;
+
+        outputPath = std::move(g_requestedOutputPath);
+    }
+
+    endCapture();
+    writeChromeTrace(outputPath);
+}
+
+void CpuProfiler::setThreadName(const char *name)
+{
+    if (!name)
+        return;
+
+    auto &buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    buffer.threadName = name;
+}
+
+void CpuProfiler::recordEvent(const char *name, uint64_t startNs, uint64_t endNs)
+{
+    auto &buffer = localBuffer();
+
+    const uint64_t generation = g_captureGeneration.load(std::memory_order_relaxed);
+    if (buffer.generation.load(std::memory_order_relaxed) != generation)
+    {
+        if (!buffer.events)
+            buffer.events = std::make_unique<ProfileEvent[]>(ThreadBuffer::CAPACITY);
+
+        buffer.count.store(0u, std::memory_order_relaxed);
+        buffer.dropped.store(0u, std::memory_order_relaxed);
+        buffer.generation.store(generation, std::memory_order_release);
+    }
+
+    const uint32_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= ThreadBuffer::CAPACITY)
+    {
+        buffer.dropped.fetch_add(1u, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[index] = {name, startNs, endNs};
+    buffer.count.store(index + 1u, std::memory_order_release);
+}
+
+bool CpuProfiler::writeChromeTrace(const std::string &outputPath)
+{
+    const std::filesystem::path tracePath(outputPath);
+    if (tracePath.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(tracePath.parent_path(), errorCode);
+    }
+
+    std::ofstream file(tracePath, std::ios::trunc);
+    if (!file.is_open())
+    {
+        VX_ENGINE_ERROR_STREAM("CpuProfiler: failed to open trace file " << outputPath << '\n');
+        return false;
+    }
+
+    const uint64_t generation = g_captureGeneration.load(std::memory_order_relaxed);
+    const uint64_t captureStartNs = g_captureStartNs.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+
+    size_t eventCount = 0u;
+    uint64_t droppedCount = 0u;
+    bool first = true;
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    for (const auto &buffer : g_threadBuffers)
+    {
+        // Threads that recorded nothing in this capture still carry an older generation.
+        if (buffer->generation.load(std::memory_order_acquire) != generation)
+            continue;
+
+        if (!first)
+            file << ",\n";
+        first = false;
+
+        file << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->threadIndex << ",\"args\":{\"name\":";
+        writeJsonString(file, buffer->threadName.c_str());
+        file << "}}";
+
+        const uint32_t count = buffer->count.load(std::memory_order_acquire);
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            const auto &event = buffer->events[index];
+            if (event.startNs < captureStartNs)
+                continue;
+
+            // Chrome trace timestamps are microseconds; fractional values keep nanosecond precision.
+            file << ",\n{\"ph\":\"X\",\"cat\":\"cpu\",\"name\":";
+            writeJsonString(file, event.name);
+            file << ",\"pid\":1,\"tid\":" << buffer->threadIndex
+                 << ",\"ts\":" << static_cast<double>(event.startNs - captureStartNs) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(event.endNs - event.startNs) / 1000.0 << '}';
+        }
+
+        eventCount += count;
+        droppedCount += buffer->dropped.load(std::memory_order_relaxed);
+    }
+
+    file << "\n]}\n";
+    g_lastTracePath = outputPath;
+
+    VX_ENGINE_INFO_STREAM("CpuProfiler: wrote " << eventCount << " events to " << outputPath
+                                                << (droppedCount ? " (" + std::to_string(droppedCount) + " dropped, buffer full)" : std::string{})
+                                                << '\n');
+    return true;
+}
+
+std::string CpuProfiler::getLastTracePath()
+{
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    return g_lastTracePath;
+}
+
+ELIX_CUSTOM_NAMESPACE_END
+ELIX_NESTED_NAMESPACE_END
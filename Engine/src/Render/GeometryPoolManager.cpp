@@ -0,0 +1,135 @@
+#include "Engine/Render/GeometryPoolManager.hpp"
+
+#include "Core/Logger.hpp"
+#include "Engine/Vertex.hpp"
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void GeometryPoolManager::init(uint32_t maxIndices)
+{
+    m_maxIndices = maxIndices;
+    m_indexStorage = nullptr;
+    m_pools.clear();
+
+    m_vertexBudgets[vertex::VertexTraits<vertex::Vertex3D>::layout().hash] = STATIC_POOL_VERTEX_BYTES;
+    m_vertexBudgets[vertex::VertexTraits<vertex::VertexSkinned>::layout().hash] = SKINNED_POOL_VERTEX_BYTES;
+}
+
+void GeometryPoolManager::setPoolVertexBudget(uint64_t vertexLayoutHash, VkDeviceSize maxVertexBytes)
+{
+    m_vertexBudgets[vertexLayoutHash] = maxVertexBytes;
+}
+
+bool GeometryPoolManager::registerMesh(const CPUMesh &mesh, int32_t &outVertexOffset, uint32_t &outFirstIndex,
+                                       PoolAllocation &outAllocation, VkBuffer &outVertexBuffer)
+{
+    if (mesh.vertexData.empty() || mesh.indices.empty() || mesh.vertexStride == 0u)
+        return false;
+
+    auto pool = getOrCreatePool(mesh.vertexLayoutHash, mesh.vertexStride);
+    if (!pool || pool->getVertexStride() != mesh.vertexStride)
+        return false;
+
+    if (!pool->registerMesh(mesh.vertexData.data(),
+                            static_cast<VkDeviceSize>(mesh.vertexData.size()),
+                            mesh.indices.data(),
+                            static_cast<uint32_t>(mesh.indices.size()),
+                            outVertexOffset, outFirstIndex,
+                            outAllocation.allocation))
+        return false;
+
+    outAllocation.vertexLayoutHash = mesh.vertexLayoutHash;
+    outVertexBuffer = pool->getVertexBuffer();
+    return true;
+}
+
+void GeometryPoolManager::releaseMesh(const PoolAllocation &allocation)
+{
+    if (auto pool = findPool(allocation.vertexLayoutHash))
+        pool->releaseMesh(allocation.allocation);
+}
+
+bool GeometryPoolManager::relocateMesh(PoolAllocation &allocation, int32_t &outVertexOffset, uint32_t &outFirstIndex)
+{
+    auto pool = findPool(allocation.vertexLayoutHash);
+    return pool && pool->relocateMesh(allocation.allocation, m_relocationCommandBuffer, outVertexOffset, outFirstIndex);
+}
+
+bool GeometryPoolManager::submitRelocations(uint64_t &outCompletionValue)
+{
+    return UnifiedGeometryBuffer::submitRelocations(std::move(m_relocationCommandBuffer), outCompletionValue);
+}
+
+void GeometryPoolManager::advanceFrame()
+{
+    for (auto &[_, pool] : m_pools)
+        pool->advanceFrame();
+}
+
+UnifiedGeometryBuffer *GeometryPoolManager::findPool(uint64_t vertexLayoutHash)
+{
+    const auto it = m_pools.find(vertexLayoutHash);
+    return it != m_pools.end() ? it->second.get() : nullptr;
+}
+
+const UnifiedGeometryBuffer *GeometryPoolManager::findPool(uint64_t vertexLayoutHash) const
+{
+    const auto it = m_pools.find(vertexLayoutHash);
+    return it != m_pools.end() ? it->second.get() : nullptr;
+}
+
+std::vector<GeometryPoolManager::PoolStatistics> GeometryPoolManager::getStatistics() const
+{
+    std::vector<PoolStatistics> statistics;
+    statistics.reserve(m_pools.size());
+
+    for (const auto &[vertexLayoutHash, pool] : m_pools)
+        statistics.push_back(PoolStatistics{.vertexLayoutHash = vertexLayoutHash,
+                                            .vertexStride = pool->getVertexStride(),
+                                            .statistics = pool->getStatistics()});
+
+    return statistics;
+}
+
+UnifiedGeometryBuffer *GeometryPoolManager::getOrCreatePool(uint64_t vertexLayoutHash, uint32_t vertexStride)
+{
+    if (auto pool = findPool(vertexLayoutHash))
+        return pool;
+
+    if (m_maxIndices == 0u)
+        return nullptr;
+
+    if (!m_indexStorage)
+    {
+        m_indexStorage = UnifiedGeometryBuffer::IndexStorage::create(m_maxIndices);
+        if (!m_indexStorage)
+        {
+            // Don't retry every mesh once the shared index buffer could not be allocated.
+            m_maxIndices = 0u;
+            return nullptr;
+        }
+    }
+
+    auto pool = std::make_unique<UnifiedGeometryBuffer>();
+    pool->init(vertexStride, getPoolVertexBudget(vertexLayoutHash), m_indexStorage);
+
+    // Failed pools are kept so the allocation isn't retried for every mesh of the layout;
+    // their meshes keep drawing from their own buffers.
+    if (!pool->isInitialized())
+        VX_ENGINE_WARNING_STREAM("GeometryPoolManager: failed to create geometry pool for vertex layout " << vertexLayoutHash);
+    else
+        VX_ENGINE_INFO_STREAM("GeometryPoolManager: created geometry pool for vertex layout " << vertexLayoutHash
+                              << " (stride " << vertexStride << ", " << getPoolVertexBudget(vertexLayoutHash) / (1024 * 1024) << " MB)");
+
+    auto *poolPtr = pool.get();
+    m_pools.emplace(vertexLayoutHash, std::move(pool));
+    return poolPtr;
+}
+
+VkDeviceSize GeometryPoolManager::getPoolVertexBudget(uint64_t vertexLayoutHash) const
+{
+    const auto it = m_vertexBudgets.find(vertexLayoutHash);
+    return it != m_vertexBudgets.end() ? it->second : DEFAULT_POOL_VERTEX_BYTES;
+}
+
+ELIX_NESTED_NAMESPACE_END
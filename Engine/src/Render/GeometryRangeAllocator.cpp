@@ -0,0 +1,334 @@
+#include "Engine/Render/GeometryRangeAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void GeometryRangeAllocator::init(uint64_t capacity)
+{
+    m_blocks.clear();
+    m_freeSlots.clear();
+
+    for (auto &secondLevelLists : m_freeLists)
+        secondLevelLists.fill(INVALID_BLOCK);
+
+    m_secondLevelBitmaps.fill(0u);
+    m_firstLevelBitmap = 0u;
+
+    m_capacity = capacity;
+    m_usedSize = 0u;
+    m_allocationCount = 0u;
+    m_freeRangeCount = 0u;
+    m_firstBlock = INVALID_BLOCK;
+
+    if (capacity == 0u)
+        return;
+
+    m_firstBlock = acquireBlockSlot();
+    m_blocks[m_firstBlock].offset = 0u;
+    m_blocks[m_firstBlock].size = capacity;
+    insertFreeBlock(m_firstBlock);
+}
+
+void GeometryRangeAllocator::reset()
+{
+    init(m_capacity);
+}
+
+GeometryRangeAllocator::Allocation GeometryRangeAllocator::allocate(uint64_t size)
+{
+    if (size == 0u || size > m_capacity)
+        return {};
+
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mappingSearch(size, firstLevel, secondLevel);
+
+    uint32_t blockIndex = firstLevel < FIRST_LEVEL_COUNT ? findSuitableBlock(firstLevel, secondLevel) : INVALID_BLOCK;
+
+    // Rounding up skips the request's own bucket, which may still hold a block that
+    // fits (e.g. a request for the whole remaining space). Scan it before giving up.
+    if (blockIndex == INVALID_BLOCK)
+    {
+        mapping(size, firstLevel, secondLevel);
+        for (uint32_t candidate = m_freeLists[firstLevel][secondLevel]; candidate != INVALID_BLOCK; candidate = m_blocks[candidate].nextFree)
+        {
+            if (m_blocks[candidate].size >= size)
+            {
+                blockIndex = candidate;
+                break;
+            }
+        }
+    }
+
+    if (blockIndex == INVALID_BLOCK)
+        return {};
+
+    removeFreeBlock(blockIndex);
+    splitBlock(blockIndex, size);
+
+    return markAllocated(blockIndex, size);
+}
+
+GeometryRangeAllocator::Allocation GeometryRangeAllocator::allocateLowest(uint64_t size, uint64_t endLimit)
+{
+    if (size == 0u || size > endLimit)
+        return {};
+
+    for (uint32_t blockIndex = m_firstBlock; blockIndex != INVALID_BLOCK; blockIndex = m_blocks[blockIndex].nextPhysical)
+    {
+        const Block &block = m_blocks[blockIndex];
+        if (block.offset + size > endLimit)
+            break;
+
+        if (!block.free || block.size < size)
+            continue;
+
+        removeFreeBlock(blockIndex);
+        splitBlock(blockIndex, size);
+
+        return markAllocated(blockIndex, size);
+    }
+
+    return {};
+}
+
+void GeometryRangeAllocator::free(AllocationId id)
+{
+    if (id >= m_blocks.size() || !m_blocks[id].used || m_blocks[id].free)
+        return;
+
+    m_usedSize -= m_blocks[id].size;
+    --m_allocationCount;
+
+    uint32_t blockIndex = id;
+    m_blocks[blockIndex].free = true;
+
+    const uint32_t nextIndex = m_blocks[blockIndex].nextPhysical;
+    if (nextIndex != INVALID_BLOCK && m_blocks[nextIndex].free)
+    {
+        removeFreeBlock(nextIndex);
+        mergeIntoPrevious(nextIndex);
+    }
+
+    const uint32_t previousIndex = m_blocks[blockIndex].prevPhysical;
+    if (previousIndex != INVALID_BLOCK && m_blocks[previousIndex].free)
+    {
+        removeFreeBlock(previousIndex);
+        mergeIntoPrevious(blockIndex);
+        blockIndex = previousIndex;
+    }
+
+    insertFreeBlock(blockIndex);
+}
+
+GeometryRangeAllocator::Allocation GeometryRangeAllocator::getAllocation(AllocationId id) const
+{
+    if (id >= m_blocks.size() || !m_blocks[id].used || m_blocks[id].free)
+        return {};
+
+    return Allocation{.id = id, .offset = m_blocks[id].offset, .size = m_blocks[id].size};
+}
+
+GeometryRangeAllocator::Statistics GeometryRangeAllocator::getStatistics() const
+{
+    Statistics statistics{};
+    statistics.capacity = m_capacity;
+    statistics.usedSize = m_usedSize;
+    statistics.freeSize = m_capacity - m_usedSize;
+    statistics.allocationCount = m_allocationCount;
+    statistics.freeRangeCount = m_freeRangeCount;
+
+    if (m_firstLevelBitmap != 0u)
+    {
+        // The largest free range always lives in the highest non-empty bucket.
+        const uint32_t firstLevel = 63u - static_cast<uint32_t>(std::countl_zero(m_firstLevelBitmap));
+        const uint32_t secondLevel = 31u - static_cast<uint32_t>(std::countl_zero(m_secondLevelBitmaps[firstLevel]));
+
+        for (uint32_t blockIndex = m_freeLists[firstLevel][secondLevel]; blockIndex != INVALID_BLOCK; blockIndex = m_blocks[blockIndex].nextFree)
+            statistics.largestFreeRange = std::max(statistics.largestFreeRange, m_blocks[blockIndex].size);
+    }
+
+    return statistics;
+}
+
+void GeometryRangeAllocator::mapping(uint64_t size, uint32_t &outFirstLevel, uint32_t &outSecondLevel)
+{
+    if (size < SECOND_LEVEL_COUNT)
+    {
+        outFirstLevel = 0u;
+        outSecondLevel = static_cast<uint32_t>(size);
+        return;
+    }
+
+    const uint32_t mostSignificantBit = static_cast<uint32_t>(std::bit_width(size)) - 1u;
+    outFirstLevel = mostSignificantBit - SECOND_LEVEL_BITS + 1u;
+    outSecondLevel = static_cast<uint32_t>(size >> (mostSignificantBit - SECOND_LEVEL_BITS)) & (SECOND_LEVEL_COUNT - 1u);
+}
+
+void GeometryRangeAllocator::mappingSearch(uint64_t size, uint32_t &outFirstLevel, uint32_t &outSecondLevel)
+{
+    // Round up to the next bucket boundary so every block in the resulting bucket fits.
+    if (size >= SECOND_LEVEL_COUNT)
+    {
+        const uint32_t mostSignificantBit = static_cast<uint32_t>(std::bit_width(size)) - 1u;
+        size += (1ull << (mostSignificantBit - SECOND_LEVEL_BITS)) - 1u;
+    }
+
+    mapping(size, outFirstLevel, outSecondLevel);
+}
+
+uint32_t GeometryRangeAllocator::findSuitableBlock(uint32_t firstLevel, uint32_t secondLevel) const
+{
+    uint32_t secondLevelMap = m_secondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+
+    if (secondLevelMap == 0u)
+    {
+        if (firstLevel + 1u >= FIRST_LEVEL_COUNT)
+            return INVALID_BLOCK;
+
+        const uint64_t firstLevelMap = m_firstLevelBitmap & (~0ull << (firstLevel + 1u));
+        if (firstLevelMap == 0u)
+            return INVALID_BLOCK;
+
+        firstLevel = static_cast<uint32_t>(std::countr_zero(firstLevelMap));
+        secondLevelMap = m_secondLevelBitmaps[firstLevel];
+    }
+
+    secondLevel = static_cast<uint32_t>(std::countr_zero(secondLevelMap));
+    return m_freeLists[firstLevel][secondLevel];
+}
+
+void GeometryRangeAllocator::insertFreeBlock(uint32_t blockIndex)
+{
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mapping(m_blocks[blockIndex].size, firstLevel, secondLevel);
+
+    Block &block = m_blocks[blockIndex];
+    const uint32_t head = m_freeLists[firstLevel][secondLevel];
+
+    block.free = true;
+    block.prevFree = INVALID_BLOCK;
+    block.nextFree = head;
+
+    if (head != INVALID_BLOCK)
+        m_blocks[head].prevFree = blockIndex;
+
+    m_freeLists[firstLevel][secondLevel] = blockIndex;
+    m_secondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    m_firstLevelBitmap |= 1ull << firstLevel;
+
+    ++m_freeRangeCount;
+}
+
+void GeometryRangeAllocator::removeFreeBlock(uint32_t blockIndex)
+{
+    uint32_t firstLevel = 0u;
+    uint32_t secondLevel = 0u;
+    mapping(m_blocks[blockIndex].size, firstLevel, secondLevel);
+
+    Block &block = m_blocks[blockIndex];
+
+    if (block.prevFree != INVALID_BLOCK)
+        m_blocks[block.prevFree].nextFree = block.nextFree;
+    if (block.nextFree != INVALID_BLOCK)
+        m_blocks[block.nextFree].prevFree = block.prevFree;
+
+    if (m_freeLists[firstLevel][secondLevel] == blockIndex)
+    {
+        m_freeLists[firstLevel][secondLevel] = block.nextFree;
+
+        if (block.nextFree == INVALID_BLOCK)
+        {
+            m_secondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (m_secondLevelBitmaps[firstLevel] == 0u)
+                m_firstLevelBitmap &= ~(1ull << firstLevel);
+        }
+    }
+
+    block.free = false;
+    block.prevFree = INVALID_BLOCK;
+    block.nextFree = INVALID_BLOCK;
+
+    --m_freeRangeCount;
+}
+
+uint32_t GeometryRangeAllocator::splitBlock(uint32_t blockIndex, uint64_t size)
+{
+    if (m_blocks[blockIndex].size <= size)
+        return INVALID_BLOCK;
+
+    // acquireBlockSlot() may grow m_blocks, so only hold indices across it.
+    const uint32_t remainderIndex = acquireBlockSlot();
+
+    Block &block = m_blocks[blockIndex];
+    Block &remainder = m_blocks[remainderIndex];
+
+    remainder.offset = block.offset + size;
+    remainder.size = block.size - size;
+    remainder.prevPhysical = blockIndex;
+    remainder.nextPhysical = block.nextPhysical;
+
+    if (block.nextPhysical != INVALID_BLOCK)
+        m_blocks[block.nextPhysical].prevPhysical = remainderIndex;
+
+    block.nextPhysical = remainderIndex;
+    block.size = size;
+
+    insertFreeBlock(remainderIndex);
+
+    return remainderIndex;
+}
+
+void GeometryRangeAllocator::mergeIntoPrevious(uint32_t blockIndex)
+{
+    const Block &block = m_blocks[blockIndex];
+    Block &previous = m_blocks[block.prevPhysical];
+
+    previous.size += block.size;
+    previous.nextPhysical = block.nextPhysical;
+
+    if (block.nextPhysical != INVALID_BLOCK)
+        m_blocks[block.nextPhysical].prevPhysical = block.prevPhysical;
+
+    releaseBlockSlot(blockIndex);
+}
+
+GeometryRangeAllocator::Allocation GeometryRangeAllocator::markAllocated(uint32_t blockIndex, uint64_t size)
+{
+    m_blocks[blockIndex].free = false;
+    m_usedSize += size;
+    ++m_allocationCount;
+
+    return Allocation{.id = blockIndex, .offset = m_blocks[blockIndex].offset, .size = size};
+}
+
+uint32_t GeometryRangeAllocator::acquireBlockSlot()
+{
+    uint32_t blockIndex = INVALID_BLOCK;
+
+    if (!m_freeSlots.empty())
+    {
+        blockIndex = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        m_blocks[blockIndex] = Block{};
+    }
+    else
+    {
+        blockIndex = static_cast<uint32_t>(m_blocks.size());
+        m_blocks.emplace_back();
+    }
+
+    m_blocks[blockIndex].used = true;
+    return blockIndex;
+}
+
+void GeometryRangeAllocator::releaseBlockSlot(uint32_t blockIndex)
+{
+    m_blocks[blockIndex] = Block{};
+    m_freeSlots.push_back(blockIndex);
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -155,9 +155,7 @@ void DepthPrepassRenderGraphPass::record(core::CommandBuffer::SharedPtr commandB
             ? EngineShaderFamilies::bindlessMeshPipelineLayout
             : static_cast<VkPipelineLayout>(EngineShaderFamilies::meshShaderFamily.pipelineLayout);
 
-    const bool hasUnifiedGeometry =
-        data.unifiedStaticVertexBuffer != VK_NULL_HANDLE &&
-        data.unifiedStaticIndexBuffer  != VK_NULL_HANDLE;
+    const bool hasUnifiedGeometry = data.unifiedIndexBuffer != VK_NULL_HANDLE;
 
     VkPipeline boundPipeline     = VK_NULL_HANDLE;
     VkBuffer   boundVertexBuffer = VK_NULL_HANDLE;
@@ -209,21 +207,21 @@ void DepthPrepassRenderGraphPass::record(core::CommandBuffer::SharedPtr commandB
             boundUnifiedIB    = VK_NULL_HANDLE;
         }
 
-        const bool useUnified = hasUnifiedGeometry && !batch.skinned && batch.mesh->inUnifiedBuffer;
+        const bool useUnified = hasUnifiedGeometry && batch.mesh->inUnifiedBuffer;
 
         if (useUnified)
         {
-            if (data.unifiedStaticVertexBuffer != boundUnifiedVB)
+            if (batch.mesh->unifiedVertexBuffer != boundUnifiedVB)
             {
                 const VkDeviceSize offset = 0;
-                vkCmdBindVertexBuffers(commandBuffer, 0, 1, &data.unifiedStaticVertexBuffer, &offset);
-                boundUnifiedVB    = data.unifiedStaticVertexBuffer;
+                vkCmdBindVertexBuffers(commandBuffer, 0, 1, &batch.mesh->unifiedVertexBuffer, &offset);
+                boundUnifiedVB    = batch.mesh->unifiedVertexBuffer;
                 boundVertexBuffer = VK_NULL_HANDLE;
             }
-            if (data.unifiedStaticIndexBuffer != boundUnifiedIB)
+            if (data.unifiedIndexBuffer != boundUnifiedIB)
             {
-                vkCmdBindIndexBuffer(commandBuffer, data.unifiedStaticIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-                boundUnifiedIB   = data.unifiedStaticIndexBuffer;
+                vkCmdBindIndexBuffer(commandBuffer, data.unifiedIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+                boundUnifiedIB   = data.unifiedIndexBuffer;
                 boundIndexBuffer = VK_NULL_HANDLE;
             }
         }
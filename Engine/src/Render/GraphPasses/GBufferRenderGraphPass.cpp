@@ -175,12 +175,10 @@ void GBufferRenderGraphPass::record(core::CommandBuffer::SharedPtr commandBuffer
             return pipeline;
         };
 
-        // If the unified static geometry buffer is available and all static batches are
-        // registered in it, bind the unified VB/IB once before the loop to avoid per-batch
-        // vertex/index buffer rebinds (the biggest source of CPU draw overhead).
-        const bool hasUnifiedGeometry =
-            data.unifiedStaticVertexBuffer != VK_NULL_HANDLE &&
-            data.unifiedStaticIndexBuffer  != VK_NULL_HANDLE;
+        // Batches registered in a unified geometry pool share one index buffer and one
+        // vertex buffer per vertex layout; batches are sorted by pool, so VB/IB rebinds
+        // (the biggest source of CPU draw overhead) only happen when the layout changes.
+        const bool hasUnifiedGeometry = data.unifiedIndexBuffer != VK_NULL_HANDLE;
 
         VkBuffer boundUnifiedVB = VK_NULL_HANDLE;
         VkBuffer boundUnifiedIB = VK_NULL_HANDLE;
@@ -215,28 +213,28 @@ void GBufferRenderGraphPass::record(core::CommandBuffer::SharedPtr commandBuffer
                 boundUnifiedIB    = VK_NULL_HANDLE;
             }
 
-            // Use the unified buffer path for static meshes that were registered in it.
-            const bool useUnified = hasUnifiedGeometry && !batch.skinned && batch.mesh->inUnifiedBuffer;
+            // Use the unified buffer path for static and skinned meshes that were registered in a pool.
+            const bool useUnified = hasUnifiedGeometry && batch.mesh->inUnifiedBuffer;
 
             if (useUnified)
             {
-                if (data.unifiedStaticVertexBuffer != boundUnifiedVB)
+                if (batch.mesh->unifiedVertexBuffer != boundUnifiedVB)
                 {
                     const VkDeviceSize offset = 0;
-                    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &data.unifiedStaticVertexBuffer, &offset);
-                    boundUnifiedVB    = data.unifiedStaticVertexBuffer;
+                    vkCmdBindVertexBuffers(commandBuffer, 0, 1, &batch.mesh->unifiedVertexBuffer, &offset);
+                    boundUnifiedVB    = batch.mesh->unifiedVertexBuffer;
                     boundVertexBuffer = VK_NULL_HANDLE; // invalidate per-mesh tracking
                 }
-                if (data.unifiedStaticIndexBuffer != boundUnifiedIB)
+                if (data.unifiedIndexBuffer != boundUnifiedIB)
                 {
-                    vkCmdBindIndexBuffer(commandBuffer, data.unifiedStaticIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-                    boundUnifiedIB    = data.unifiedStaticIndexBuffer;
+                    vkCmdBindIndexBuffer(commandBuffer, data.unifiedIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+                    boundUnifiedIB    = data.unifiedIndexBuffer;
                     boundIndexBuffer  = VK_NULL_HANDLE;
                 }
             }
             else
             {
-                // Per-mesh fallback path (skinned, or not yet in unified buffer).
+                // Per-mesh fallback path (not in a unified pool, e.g. pool full).
                 if (boundUnifiedVB != VK_NULL_HANDLE || boundUnifiedIB != VK_NULL_HANDLE)
                 {
                     // Switched from unified → per-mesh; force rebind.
@@ -278,7 +276,8 @@ void GBufferRenderGraphPass::record(core::CommandBuffer::SharedPtr commandBuffer
             // GPU-driven path: use the indirect buffer written by the compute culling pass.
             // The GPU may have zeroed instanceCount for culled batches, so this also
             // implicitly handles frustum culling without CPU readback.
-            const bool useIndirect = useUnified && hasIndirectBuffer;
+            // Skinned bounds follow the animated pose, which the culling pass doesn't see.
+            const bool useIndirect = useUnified && hasIndirectBuffer && !batch.skinned;
             if (useIndirect)
             {
                 const VkDeviceSize indirectOffset =
@@ -12,7 +12,10 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -123,7 +126,11 @@ void UIRenderGraphPass::compile(RGPResourcesStorage &storage)
     const uint32_t imageCount = core::VulkanContext::getContext()->getSwapchain()->getImageCount();
     m_outputRenderTargets.resize(imageCount);
     m_passthroughDescriptorSets.resize(imageCount, VK_NULL_HANDLE);
-    m_transientVertexBuffersByFrame.resize(std::max<size_t>(2u, static_cast<size_t>(imageCount)));
+    const uint32_t frameCount = std::max(2u, imageCount);
+    if (frameCount != m_vertexRingFrameCount)
+        releaseVertexRing();
+    m_vertexRingFrameCount = frameCount;
+    m_retiredVertexRingsByFrame.resize(frameCount);
 
     auto device = core::VulkanContext::getContext()->getDevice();
     auto pool = core::VulkanContext::getContext()->getPersistentDescriptorPool();
@@ -162,7 +169,8 @@ void UIRenderGraphPass::freeResources()
     m_preparedBillboards.clear();
     m_preparedTexts.clear();
     m_preparedButtons.clear();
-    m_transientVertexBuffersByFrame.clear();
+    releaseVertexRing();
+    m_retiredVertexRingsByFrame.clear();
 }
 
 void UIRenderGraphPass::recordPassthrough(core::CommandBuffer::SharedPtr commandBuffer,
@@ -193,13 +201,16 @@ void UIRenderGraphPass::recordPassthrough(core::CommandBuffer::SharedPtr command
 void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
                                       const RenderGraphPassContext &renderContext)
 {
-    if (renderContext.currentFrame >= m_transientVertexBuffersByFrame.size())
-        m_transientVertexBuffersByFrame.resize(renderContext.currentFrame + 1u);
+    if (renderContext.currentFrame >= m_retiredVertexRingsByFrame.size())
+        m_retiredVertexRingsByFrame.resize(renderContext.currentFrame + 1u);
 
-    m_transientVertexBuffersByFrame[renderContext.currentFrame].clear();
+    // This slot's previous frame has finished, and with it any ring retired back then.
+    m_retiredVertexRingsByFrame[renderContext.currentFrame].clear();
     m_preparedBillboards.clear();
     m_preparedTexts.clear();
     m_preparedButtons.clear();
+    m_frameVertices.clear();
+    ++m_uiFrameIndex;
 
     const glm::mat4 viewProj = data.projection * data.view;
     const glm::vec3 baseRight = glm::vec3(data.view[0][0], data.view[1][0], data.view[2][0]);
@@ -249,45 +260,40 @@ void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
         if (!atlas || !atlas->isBuilt())
             continue;
 
-        std::vector<vertex::Vertex2D> verts;
-        const float scale = textObj->getScale() * 0.015f;
-        const glm::vec2 pivot = textObj->getPosition();
-        glm::vec2 pen = pivot;
+        TextMeshKey key{};
+        key.font = font;
+        key.atlas = atlas;
+        key.scale = textObj->getScale() * 0.015f;
+        key.position = textObj->getPosition();
+        key.rotation = textObj->getRotation();
+        key.aspectCorrection = aspectCorrection;
 
-        for (char c : textObj->getText())
-        {
-            const ui::Glyph *g = font->getGlyph(c);
-            if (!g)
-                continue;
-
-            const auto uvRect = atlas->getGlyphUV(c);
-            const float w = g->bitmapWidth * scale * aspectCorrection;
-            const float h = g->bitmapRows * scale;
-            const float xoff = g->bearing.x * scale * aspectCorrection;
-            const float yoff = (g->bearing.y - g->bitmapRows) * scale;
-
-            const float x0 = pen.x + xoff;
-            const float x1 = x0 + w;
-            const float y0 = pen.y + yoff;
-            const float y1 = y0 + h;
+        const auto &verts = getOrBuildTextMesh(textObj, textObj->getText(), key);
+        if (verts.empty())
+            continue;
 
-            const glm::vec2 p0 = rotatePointAroundPivot(glm::vec2(x0, y0), pivot, textObj->getRotation());
-            const glm::vec2 p1 = rotatePointAroundPivot(glm::vec2(x1, y0), pivot, textObj->getRotation());
-            const glm::vec2 p2 = rotatePointAroundPivot(glm::vec2(x0, y1), pivot, textObj->getRotation());
-            const glm::vec2 p3 = rotatePointAroundPivot(glm::vec2(x1, y1), pivot, textObj->getRotation());
+        const VkDescriptorSet descriptorSet = getTextureDescriptorSet(
+            atlas->getTexture()->vkImageView(), m_nearestSampler);
+        const uint32_t firstVertex = appendVertices(verts.data(), verts.size());
+        const uint32_t vertexCount = static_cast<uint32_t>(verts.size());
 
-            appendTexturedQuad(verts, p0, p1, p2, p3, uvRect);
-            pen.x += (g->advance >> 6) * scale * aspectCorrection;
+        // Runs sharing atlas and colour are contiguous in the ring: extend the previous draw.
+        if (!m_preparedTexts.empty())
+        {
+            auto &previous = m_preparedTexts.back();
+            if (previous.descriptorSet == descriptorSet &&
+                previous.pushConstants.color == textObj->getColor() &&
+                previous.firstVertex + previous.vertexCount == firstVertex)
+            {
+                previous.vertexCount += vertexCount;
+                continue;
+            }
         }
 
-        if (verts.empty())
-            continue;
-
         PreparedTextDraw prepared{};
-        prepared.descriptorSet = getTextureDescriptorSet(
-            atlas->getTexture()->vkImageView(), m_nearestSampler);
-        prepared.vertexBuffer = uploadVertices(verts, renderContext.currentFrame);
-        prepared.vertexCount = static_cast<uint32_t>(verts.size());
+        prepared.descriptorSet = descriptorSet;
+        prepared.firstVertex = firstVertex;
+        prepared.vertexCount = vertexCount;
         prepared.pushConstants.color = textObj->getColor();
         m_preparedTexts.push_back(std::move(prepared));
     }
@@ -312,7 +318,7 @@ void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
         const glm::vec2 p2 = rotatePointAroundPivot(glm::vec2(x0, y1), pivot, btn->getRotation());
         const glm::vec2 p3 = rotatePointAroundPivot(glm::vec2(x1, y1), pivot, btn->getRotation());
 
-        std::vector<vertex::Vertex2D> quadVerts = {
+        const vertex::Vertex2D quadVerts[] = {
             {{p0.x, p0.y, 0.f}, {0.f, 0.f}},
             {{p1.x, p1.y, 0.f}, {1.f, 0.f}},
             {{p2.x, p2.y, 0.f}, {0.f, 1.f}},
@@ -320,8 +326,8 @@ void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
             {{p3.x, p3.y, 0.f}, {1.f, 1.f}},
             {{p2.x, p2.y, 0.f}, {0.f, 1.f}}};
 
-        prepared.backgroundVertexBuffer = uploadVertices(quadVerts, renderContext.currentFrame);
-        prepared.backgroundVertexCount = static_cast<uint32_t>(quadVerts.size());
+        prepared.backgroundFirstVertex = appendVertices(quadVerts, std::size(quadVerts));
+        prepared.backgroundVertexCount = static_cast<uint32_t>(std::size(quadVerts));
         prepared.backgroundPushConstants.color = btn->isHovered() ? btn->getHoverColor() : btn->getBackgroundColor();
         prepared.backgroundPushConstants.borderColor = btn->getBorderColor();
         prepared.backgroundPushConstants.borderWidth = btn->getBorderWidth();
@@ -336,42 +342,21 @@ void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
                 ui::FontAtlas *atlas = getOrBuildAtlas(font);
                 if (atlas && atlas->isBuilt())
                 {
-                    const float scale = btn->getLabelScale() * 0.012f;
-                    glm::vec2 textSize = font->calculateTextSize(label, scale * aspectCorrection);
-                    glm::vec2 pen{pos.x + (size.x - textSize.x) * 0.5f,
-                                  pos.y + (size.y - textSize.y) * 0.5f};
-
-                    std::vector<vertex::Vertex2D> textVerts;
-                    for (char c : label)
-                    {
-                        const ui::Glyph *g = font->getGlyph(c);
-                        if (!g)
-                            continue;
-
-                        const auto uvRect = atlas->getGlyphUV(c);
-                        const float w = g->bitmapWidth * scale * aspectCorrection;
-                        const float h = g->bitmapRows * scale;
-                        const float xoff = g->bearing.x * scale * aspectCorrection;
-                        const float yoff = (g->bearing.y - g->bitmapRows) * scale;
-                        const float cx0 = pen.x + xoff;
-                        const float cx1 = cx0 + w;
-                        const float cy0 = pen.y + yoff;
-                        const float cy1 = cy0 + h;
-
-                        const glm::vec2 tp0 = rotatePointAroundPivot(glm::vec2(cx0, cy0), pivot, btn->getRotation());
-                        const glm::vec2 tp1 = rotatePointAroundPivot(glm::vec2(cx1, cy0), pivot, btn->getRotation());
-                        const glm::vec2 tp2 = rotatePointAroundPivot(glm::vec2(cx0, cy1), pivot, btn->getRotation());
-                        const glm::vec2 tp3 = rotatePointAroundPivot(glm::vec2(cx1, cy1), pivot, btn->getRotation());
-
-                        appendTexturedQuad(textVerts, tp0, tp1, tp2, tp3, uvRect);
-                        pen.x += (g->advance >> 6) * scale * aspectCorrection;
-                    }
-
+                    TextMeshKey key{};
+                    key.font = font;
+                    key.atlas = atlas;
+                    key.scale = btn->getLabelScale() * 0.012f;
+                    key.position = pos;
+                    key.size = size;
+                    key.rotation = btn->getRotation();
+                    key.aspectCorrection = aspectCorrection;
+
+                    const auto &textVerts = getOrBuildTextMesh(btn, label, key);
                     if (!textVerts.empty())
                     {
                         prepared.hasLabel = true;
                         prepared.labelDescriptorSet = getTextureDescriptorSet(atlas->getTexture()->vkImageView(), m_nearestSampler);
-                        prepared.labelVertexBuffer = uploadVertices(textVerts, renderContext.currentFrame);
+                        prepared.labelFirstVertex = appendVertices(textVerts.data(), textVerts.size());
                         prepared.labelVertexCount = static_cast<uint32_t>(textVerts.size());
                         prepared.labelPushConstants.color = btn->getLabelColor();
                     }
@@ -381,6 +366,119 @@ void UIRenderGraphPass::prepareRecord(const RenderGraphPassPerFrameData &data,
 
         m_preparedButtons.push_back(std::move(prepared));
     }
+
+    std::erase_if(m_textMeshCache, [this](const auto &entry)
+                  { return m_uiFrameIndex - entry.second.lastUsedFrame > TEXT_MESH_EVICTION_FRAMES; });
+
+    uploadFrameVertices(renderContext.currentFrame);
+}
+
+const std::vector<vertex::Vertex2D> &UIRenderGraphPass::getOrBuildTextMesh(const void *owner, const std::string &text, const TextMeshKey &key)
+{
+    auto &cached = m_textMeshCache[owner];
+    cached.lastUsedFrame = m_uiFrameIndex;
+
+    if (cached.key == key && cached.text == text)
+        return cached.vertices;
+
+    cached.text = text;
+    cached.key = key;
+    cached.vertices.clear();
+    buildTextMesh(cached.text, cached.key, cached.vertices);
+    return cached.vertices;
+}
+
+void UIRenderGraphPass::buildTextMesh(const std::string &text, const TextMeshKey &key, std::vector<vertex::Vertex2D> &vertices)
+{
+    const float scale = key.scale;
+    const float aspectCorrection = key.aspectCorrection;
+
+    glm::vec2 pen = key.position;
+    glm::vec2 pivot = key.position;
+    if (key.size != glm::vec2(0.0f))
+    {
+        const glm::vec2 textSize = key.font->calculateTextSize(text, scale * aspectCorrection);
+        pen = key.position + (key.size - textSize) * 0.5f;
+        pivot = key.position + key.size * 0.5f;
+    }
+
+    vertices.reserve(text.size() * 6u);
+
+    for (char c : text)
+    {
+        const ui::Glyph *g = key.font->getGlyph(c);
+        if (!g)
+            continue;
+
+        const auto uvRect = key.atlas->getGlyphUV(c);
+        const float w = g->bitmapWidth * scale * aspectCorrection;
+        const float h = g->bitmapRows * scale;
+        const float xoff = g->bearing.x * scale * aspectCorrection;
+        const float yoff = (g->bearing.y - g->bitmapRows) * scale;
+
+        const float x0 = pen.x + xoff;
+        const float x1 = x0 + w;
+        const float y0 = pen.y + yoff;
+        const float y1 = y0 + h;
+
+        const glm::vec2 p0 = rotatePointAroundPivot(glm::vec2(x0, y0), pivot, key.rotation);
+        const glm::vec2 p1 = rotatePointAroundPivot(glm::vec2(x1, y0), pivot, key.rotation);
+        const glm::vec2 p2 = rotatePointAroundPivot(glm::vec2(x0, y1), pivot, key.rotation);
+        const glm::vec2 p3 = rotatePointAroundPivot(glm::vec2(x1, y1), pivot, key.rotation);
+
+        appendTexturedQuad(vertices, p0, p1, p2, p3, uvRect);
+        pen.x += (g->advance >> 6) * scale * aspectCorrection;
+    }
+}
+
+uint32_t UIRenderGraphPass::appendVertices(const vertex::Vertex2D *vertices, size_t count)
+{
+    const uint32_t firstVertex = static_cast<uint32_t>(m_frameVertices.size());
+    m_frameVertices.insert(m_frameVertices.end(), vertices, vertices + count);
+    return firstVertex;
+}
+
+void UIRenderGraphPass::uploadFrameVertices(uint32_t currentFrame)
+{
+    const uint32_t vertexCount = static_cast<uint32_t>(m_frameVertices.size());
+    if (vertexCount == 0u)
+        return;
+
+    if (vertexCount > m_vertexRingCapacity)
+    {
+        // The other frames in flight may still read the old ring: retire it to this
+        // frame's slot, which is only reused once they have completed.
+        if (m_vertexRing)
+        {
+            m_vertexRing->unmap();
+            if (currentFrame >= m_retiredVertexRingsByFrame.size())
+                m_retiredVertexRingsByFrame.resize(currentFrame + 1u);
+            m_retiredVertexRingsByFrame[currentFrame].push_back(m_vertexRing);
+        }
+
+        m_vertexRingCapacity = std::max(INITIAL_VERTEX_RING_CAPACITY, std::bit_ceil(vertexCount));
+        m_vertexRing = core::Buffer::createShared(
+            static_cast<VkDeviceSize>(m_vertexRingCapacity) * m_vertexRingFrameCount * sizeof(vertex::Vertex2D),
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            core::memory::MemoryUsage::CPU_TO_GPU);
+        m_vertexRing->map(reinterpret_cast<void *&>(m_vertexRingMapped));
+    }
+
+    const uint32_t region = currentFrame % m_vertexRingFrameCount;
+    const size_t firstRingVertex = static_cast<size_t>(region) * m_vertexRingCapacity;
+    std::memcpy(m_vertexRingMapped + firstRingVertex, m_frameVertices.data(), vertexCount * sizeof(vertex::Vertex2D));
+    m_vertexRingFrameOffset = firstRingVertex * sizeof(vertex::Vertex2D);
+}
+
+void UIRenderGraphPass::releaseVertexRing()
+{
+    if (m_vertexRing && m_vertexRingMapped)
+        m_vertexRing->unmap();
+
+    m_vertexRing.reset();
+    m_vertexRingMapped = nullptr;
+    m_vertexRingCapacity = 0u;
+    m_vertexRingFrameOffset = 0u;
 }
 
 VkDescriptorSet UIRenderGraphPass::getTextureDescriptorSet(VkImageView view, VkSampler sampler)
@@ -444,20 +542,21 @@ void UIRenderGraphPass::recordUIText(core::CommandBuffer::SharedPtr commandBuffe
     auto pipeline = GraphicsPipelineManager::getOrCreate(key);
     vkCmdBindPipeline(commandBuffer->vk(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 
+    VkDescriptorSet boundSet = VK_NULL_HANDLE;
     for (const auto &textDraw : m_preparedTexts)
     {
-        VkDescriptorSet ds = textDraw.descriptorSet;
-        vkCmdBindDescriptorSets(commandBuffer->vk(), VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                m_textPipelineLayout, 0, 1, &ds, 0, nullptr);
+        if (textDraw.descriptorSet != boundSet)
+        {
+            boundSet = textDraw.descriptorSet;
+            vkCmdBindDescriptorSets(commandBuffer->vk(), VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                    m_textPipelineLayout, 0, 1, &boundSet, 0, nullptr);
+        }
 
         vkCmdPushConstants(commandBuffer->vk(), m_textPipelineLayout,
                            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
                            0, sizeof(UITextPC), &textDraw.pushConstants);
 
-        VkBuffer vkBuf = textDraw.vertexBuffer->vk();
-        VkDeviceSize offset = 0;
-        vkCmdBindVertexBuffers(commandBuffer->vk(), 0, 1, &vkBuf, &offset);
-        profiling::cmdDraw(commandBuffer, textDraw.vertexCount, 1, 0, 0);
+        profiling::cmdDraw(commandBuffer, textDraw.vertexCount, 1, textDraw.firstVertex, 0);
     }
 }
 
@@ -477,6 +576,11 @@ void UIRenderGraphPass::recordUIButtons(core::CommandBuffer::SharedPtr commandBu
 
     auto quadPipeline = GraphicsPipelineManager::getOrCreate(quadKey);
 
+    GraphicsPipelineKey textKey = quadKey;
+    textKey.shader = ShaderId::UIText;
+    textKey.pipelineLayout = m_textPipelineLayout;
+    auto textPipeline = GraphicsPipelineManager::getOrCreate(textKey);
+
     for (const auto &button : m_preparedButtons)
     {
         vkCmdBindPipeline(commandBuffer->vk(), VK_PIPELINE_BIND_POINT_GRAPHICS, quadPipeline);
@@ -485,18 +589,11 @@ void UIRenderGraphPass::recordUIButtons(core::CommandBuffer::SharedPtr commandBu
                            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
                            0, sizeof(UIQuadPC), &button.backgroundPushConstants);
 
-        VkBuffer vkBuf = button.backgroundVertexBuffer->vk();
-        VkDeviceSize offset = 0;
-        vkCmdBindVertexBuffers(commandBuffer->vk(), 0, 1, &vkBuf, &offset);
-        profiling::cmdDraw(commandBuffer, button.backgroundVertexCount, 1, 0, 0);
+        profiling::cmdDraw(commandBuffer, button.backgroundVertexCount, 1, button.backgroundFirstVertex, 0);
 
         if (!button.hasLabel)
             continue;
 
-        GraphicsPipelineKey textKey = quadKey;
-        textKey.shader = ShaderId::UIText;
-        textKey.pipelineLayout = m_textPipelineLayout;
-        auto textPipeline = GraphicsPipelineManager::getOrCreate(textKey);
         vkCmdBindPipeline(commandBuffer->vk(), VK_PIPELINE_BIND_POINT_GRAPHICS, textPipeline);
 
         VkDescriptorSet ds = button.labelDescriptorSet;
@@ -507,10 +604,7 @@ void UIRenderGraphPass::recordUIButtons(core::CommandBuffer::SharedPtr commandBu
                            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
                            0, sizeof(UITextPC), &button.labelPushConstants);
 
-        VkBuffer tvkBuf = button.labelVertexBuffer->vk();
-        VkDeviceSize toffset = 0;
-        vkCmdBindVertexBuffers(commandBuffer->vk(), 0, 1, &tvkBuf, &toffset);
-        profiling::cmdDraw(commandBuffer, button.labelVertexCount, 1, 0, 0);
+        profiling::cmdDraw(commandBuffer, button.labelVertexCount, 1, button.labelFirstVertex, 0);
     }
 }
 
@@ -525,6 +619,13 @@ void UIRenderGraphPass::record(core::CommandBuffer::SharedPtr commandBuffer,
 
     recordPassthrough(commandBuffer, renderContext.currentImageIndex);
     recordBillboards(commandBuffer);
+
+    if (m_vertexRing && !m_frameVertices.empty())
+    {
+        VkBuffer vertexRing = m_vertexRing->vk();
+        vkCmdBindVertexBuffers(commandBuffer->vk(), 0, 1, &vertexRing, &m_vertexRingFrameOffset);
+    }
+
     recordUIText(commandBuffer);
     recordUIButtons(commandBuffer);
 }
@@ -609,20 +710,5 @@ ui::FontAtlas *UIRenderGraphPass::getOrBuildAtlas(const ui::Font *font)
     return raw;
 }
 
-core::Buffer::SharedPtr UIRenderGraphPass::uploadVertices(const std::vector<vertex::Vertex2D> &verts, uint32_t currentFrame)
-{
-    const VkDeviceSize size = verts.size() * sizeof(vertex::Vertex2D);
-    auto buf = core::Buffer::createShared(size,
-                                          VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-                                          core::memory::MemoryUsage::CPU_TO_GPU);
-    buf->upload(verts.data(), size);
-
-    if (currentFrame >= m_transientVertexBuffersByFrame.size())
-        m_transientVertexBuffersByFrame.resize(currentFrame + 1u);
-
-    m_transientVertexBuffersByFrame[currentFrame].push_back(buf);
-    return buf;
-}
-
 ELIX_CUSTOM_NAMESPACE_END
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,318 @@
+#include "Engine/Render/LightClusterBuilder.hpp"
+
+#include "Engine/Threads/ThreadPoolManager.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ELIX_LIGHT_CLUSTER_SSE 1
+#include <emmintrin.h>
+#endif
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+namespace
+{
+    // RenderGraphLightData::parameters.w
+    constexpr float DIRECTIONAL_LIGHT_TYPE = 0.0f;
+    constexpr float SPOT_LIGHT_TYPE = 1.0f;
+
+    static_assert(LightClusterBuilder::TILES_PER_SLICE % 4u == 0u, "SIMD tile loop processes four tiles at a time");
+
+    // Point on the view ray through (ndcX, ndcY) at view-space depth `depth` (positive, looking down -Z).
+    glm::vec3 unprojectAtDepth(const glm::mat4 &inverseProjection, float ndcX, float ndcY, float depth)
+    {
+        glm::vec4 first = inverseProjection * glm::vec4(ndcX, ndcY, 0.0f, 1.0f);
+        glm::vec4 second = inverseProjection * glm::vec4(ndcX, ndcY, 0.5f, 1.0f);
+        first /= first.w;
+        second /= second.w;
+
+        const float deltaZ = second.z - first.z;
+        const float t = std::abs(deltaZ) > 1e-8f ? (-depth - first.z) / deltaZ : 0.0f;
+        return glm::vec3(first) + (glm::vec3(second) - glm::vec3(first)) * t;
+    }
+
+    // Conservative view-space bounding sphere of a point or spot light.
+    void computeLightSphere(const RenderGraphLightData &light, glm::vec3 &outCenter, float &outRadius)
+    {
+        const glm::vec3 position = glm::vec3(light.position);
+        const float range = std::max(light.parameters.z, 0.0001f);
+
+        outCenter = position;
+        outRadius = range;
+
+        if (light.parameters.w != SPOT_LIGHT_TYPE)
+            return;
+
+        const float cosOuter = glm::clamp(light.parameters.y, -1.0f, 1.0f);
+        const float directionLength = glm::length(glm::vec3(light.direction));
+        if (cosOuter <= 0.0f || directionLength <= 1e-6f)
+            return;
+
+        const glm::vec3 direction = glm::vec3(light.direction) / directionLength;
+
+        // Wide cones: sphere around the cap; narrow cones: circumsphere of apex and rim.
+        if (cosOuter < 0.70710678f)
+        {
+            const float sinOuter = std::sqrt(std::max(0.0f, 1.0f - cosOuter * cosOuter));
+            outCenter = position + direction * (range * cosOuter);
+            outRadius = range * sinOuter;
+        }
+        else
+        {
+            const float halfExtent = range / (2.0f * cosOuter);
+            outCenter = position + direction * halfExtent;
+            outRadius = halfExtent;
+        }
+    }
+}
+
+void LightClusterBuilder::build(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane)
+{
+    prepare(lights, projection, nearPlane, farPlane);
+
+    if (!m_localLights.empty())
+    {
+        ThreadPoolManager::instance().parallelFor(GRID_Z, [this](std::size_t begin, std::size_t end)
+                                                  {
+                                                      for (std::size_t slice = begin; slice < end; ++slice)
+                                                          binSlice(static_cast<uint32_t>(slice)); });
+    }
+
+    compact();
+}
+
+void LightClusterBuilder::buildReference(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane)
+{
+    prepare(lights, projection, nearPlane, farPlane);
+
+    for (uint32_t slice = 0u; slice < GRID_Z; ++slice)
+    {
+        const SliceBounds &bounds = m_sliceBounds[slice];
+
+        for (uint32_t tile = 0u; tile < TILES_PER_SLICE; ++tile)
+        {
+            const uint32_t cluster = slice * TILES_PER_SLICE + tile;
+
+            for (const LocalLight &light : m_localLights)
+            {
+                if (slice < light.firstSlice || slice > light.lastSlice || !sphereIntersectsTile(bounds, tile, light))
+                    continue;
+
+                uint32_t &count = m_clusterCounts[cluster];
+                if (count < MAX_LIGHTS_PER_CLUSTER)
+                    m_clusterLights[cluster * MAX_LIGHTS_PER_CLUSTER + count++] = light.lightIndex;
+                else
+                    ++m_sliceOverflow[slice];
+            }
+        }
+    }
+
+    compact();
+}
+
+uint32_t LightClusterBuilder::getSliceForDepth(float viewDepth) const
+{
+    const float slice = std::log(std::max(viewDepth, m_header.depthParams.x)) * m_header.depthParams.z - m_header.depthParams.w;
+    return static_cast<uint32_t>(glm::clamp(slice, 0.0f, static_cast<float>(GRID_Z - 1u)));
+}
+
+void LightClusterBuilder::prepare(const std::vector<RenderGraphLightData> &lights, const glm::mat4 &projection, float nearPlane, float farPlane)
+{
+    nearPlane = std::max(nearPlane, 0.01f);
+    farPlane = std::max(farPlane, nearPlane + 0.1f);
+
+    const float logDepthRange = std::log(farPlane / nearPlane);
+    m_header.depthParams = glm::vec4(nearPlane,
+                                     farPlane,
+                                     static_cast<float>(GRID_Z) / logDepthRange,
+                                     static_cast<float>(GRID_Z) * std::log(nearPlane) / logDepthRange);
+
+    updateClusterBounds(projection, nearPlane, farPlane);
+
+    m_localLights.clear();
+    m_directionalLights.clear();
+
+    for (uint32_t lightIndex = 0u; lightIndex < static_cast<uint32_t>(lights.size()); ++lightIndex)
+    {
+        const RenderGraphLightData &light = lights[lightIndex];
+
+        if (light.parameters.w == DIRECTIONAL_LIGHT_TYPE)
+        {
+            m_directionalLights.push_back(lightIndex);
+            continue;
+        }
+
+        LocalLight localLight{};
+        float radius = 0.0f;
+        computeLightSphere(light, localLight.center, radius);
+
+        const float depth = -localLight.center.z;
+        if (depth + radius < nearPlane || depth - radius > farPlane)
+            continue;
+
+        localLight.lightIndex = lightIndex;
+        localLight.radiusSquared = radius * radius;
+        localLight.firstSlice = getSliceForDepth(depth - radius);
+        localLight.lastSlice = getSliceForDepth(depth + radius);
+        m_localLights.push_back(localLight);
+    }
+
+    m_header.gridSize = glm::uvec4(GRID_X, GRID_Y, GRID_Z, static_cast<uint32_t>(m_directionalLights.size()));
+
+    m_clusterLights.resize(static_cast<std::size_t>(CLUSTER_COUNT) * MAX_LIGHTS_PER_CLUSTER);
+    m_clusterCounts.assign(CLUSTER_COUNT, 0u);
+    m_sliceOverflow.fill(0u);
+}
+
+void LightClusterBuilder::updateClusterBounds(const glm::mat4 &projection, float nearPlane, float farPlane)
+{
+    if (!m_sliceBounds.empty() && projection == m_boundsProjection && nearPlane == m_boundsNear && farPlane == m_boundsFar)
+        return;
+
+    m_boundsProjection = projection;
+    m_boundsNear = nearPlane;
+    m_boundsFar = farPlane;
+    m_sliceBounds.resize(GRID_Z);
+
+    const glm::mat4 inverseProjection = glm::inverse(projection);
+
+    for (uint32_t slice = 0u; slice < GRID_Z; ++slice)
+    {
+        const float sliceNear = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(slice) / static_cast<float>(GRID_Z));
+        const float sliceFar = nearPlane * std::pow(farPlane / nearPlane, static_cast<float>(slice + 1u) / static_cast<float>(GRID_Z));
+        SliceBounds &bounds = m_sliceBounds[slice];
+
+        for (uint32_t tileY = 0u; tileY < GRID_Y; ++tileY)
+        {
+            for (uint32_t tileX = 0u; tileX < GRID_X; ++tileX)
+            {
+                // Tiles are laid out in screen UV (v grows downwards), like vUV in the lighting pass.
+                const float ndcX0 = 2.0f * static_cast<float>(tileX) / static_cast<float>(GRID_X) - 1.0f;
+                const float ndcX1 = 2.0f * static_cast<float>(tileX + 1u) / static_cast<float>(GRID_X) - 1.0f;
+                const float ndcY0 = 1.0f - 2.0f * static_cast<float>(tileY) / static_cast<float>(GRID_Y);
+                const float ndcY1 = 1.0f - 2.0f * static_cast<float>(tileY + 1u) / static_cast<float>(GRID_Y);
+
+                glm::vec3 minCorner(std::numeric_limits<float>::max());
+                glm::vec3 maxCorner(-std::numeric_limits<float>::max());
+
+                for (const float depth : {sliceNear, sliceFar})
+                    for (const float ndcX : {ndcX0, ndcX1})
+                        for (const float ndcY : {ndcY0, ndcY1})
+                        {
+                            const glm::vec3 corner = unprojectAtDepth(inverseProjection, ndcX, ndcY, depth);
+                            minCorner = glm::min(minCorner, corner);
+                            maxCorner = glm::max(maxCorner, corner);
+                        }
+
+                const uint32_t tile = tileY * GRID_X + tileX;
+                bounds.minX[tile] = minCorner.x;
+                bounds.minY[tile] = minCorner.y;
+                bounds.minZ[tile] = minCorner.z;
+                bounds.maxX[tile] = maxCorner.x;
+                bounds.maxY[tile] = maxCorner.y;
+                bounds.maxZ[tile] = maxCorner.z;
+            }
+        }
+    }
+}
+
+void LightClusterBuilder::binSlice(uint32_t slice)
+{
+    const SliceBounds &bounds = m_sliceBounds[slice];
+    uint32_t *clusterCounts = m_clusterCounts.data() + static_cast<std::size_t>(slice) * TILES_PER_SLICE;
+    uint32_t *clusterLights = m_clusterLights.data() + static_cast<std::size_t>(slice) * TILES_PER_SLICE * MAX_LIGHTS_PER_CLUSTER;
+
+    auto appendLight = [&](uint32_t tile, uint32_t lightIndex)
+    {
+        uint32_t &count = clusterCounts[tile];
+        if (count < MAX_LIGHTS_PER_CLUSTER)
+            clusterLights[tile * MAX_LIGHTS_PER_CLUSTER + count++] = lightIndex;
+        else
+            ++m_sliceOverflow[slice];
+    };
+
+    for (const LocalLight &light : m_localLights)
+    {
+        if (slice < light.firstSlice || slice > light.lastSlice)
+            continue;
+
+#if defined(ELIX_LIGHT_CLUSTER_SSE)
+        const __m128 centerX = _mm_set1_ps(light.center.x);
+        const __m128 centerY = _mm_set1_ps(light.center.y);
+        const __m128 centerZ = _mm_set1_ps(light.center.z);
+        const __m128 radiusSquared = _mm_set1_ps(light.radiusSquared);
+        const __m128 zero = _mm_setzero_ps();
+
+        for (uint32_t tile = 0u; tile < TILES_PER_SLICE; tile += 4u)
+        {
+            // Per axis: distance from the sphere center to the box (0 inside).
+            const __m128 deltaX = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(&bounds.minX[tile]), centerX),
+                                                        _mm_sub_ps(centerX, _mm_load_ps(&bounds.maxX[tile]))),
+                                             zero);
+            const __m128 deltaY = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(&bounds.minY[tile]), centerY),
+                                                        _mm_sub_ps(centerY, _mm_load_ps(&bounds.maxY[tile]))),
+                                             zero);
+            const __m128 deltaZ = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(&bounds.minZ[tile]), centerZ),
+                                                        _mm_sub_ps(centerZ, _mm_load_ps(&bounds.maxZ[tile]))),
+                                             zero);
+
+            const __m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(deltaX, deltaX), _mm_mul_ps(deltaY, deltaY)),
+                                                      _mm_mul_ps(deltaZ, deltaZ));
+
+            int mask = _mm_movemask_ps(_mm_cmple_ps(distanceSquared, radiusSquared));
+            while (mask != 0)
+            {
+                const uint32_t lane = static_cast<uint32_t>(std::countr_zero(static_cast<unsigned>(mask)));
+                appendLight(tile + lane, light.lightIndex);
+                mask &= mask - 1;
+            }
+        }
+#else
+        for (uint32_t tile = 0u; tile < TILES_PER_SLICE; ++tile)
+            if (sphereIntersectsTile(bounds, tile, light))
+                appendLight(tile, light.lightIndex);
+#endif
+    }
+}
+
+void LightClusterBuilder::compact()
+{
+    m_data.assign(static_cast<std::size_t>(CLUSTER_COUNT) * 2u, 0u);
+    m_data.insert(m_data.end(), m_directionalLights.begin(), m_directionalLights.end());
+
+    uint32_t overflowCount = 0u;
+    for (const uint32_t sliceOverflow : m_sliceOverflow)
+        overflowCount += sliceOverflow;
+
+    const std::size_t maxDataSize = static_cast<std::size_t>(CLUSTER_COUNT) * 2u + MAX_LIGHT_INDICES;
+
+    for (uint32_t cluster = 0u; cluster < CLUSTER_COUNT; ++cluster)
+    {
+        const uint32_t available = static_cast<uint32_t>(maxDataSize - std::min(maxDataSize, m_data.size()));
+        const uint32_t count = std::min(m_clusterCounts[cluster], available);
+        overflowCount += m_clusterCounts[cluster] - count;
+
+        m_data[cluster * 2u] = static_cast<uint32_t>(m_data.size());
+        m_data[cluster * 2u + 1u] = count;
+
+        const uint32_t *clusterLights = m_clusterLights.data() + static_cast<std::size_t>(cluster) * MAX_LIGHTS_PER_CLUSTER;
+        m_data.insert(m_data.end(), clusterLights, clusterLights + count);
+    }
+
+    m_overflowCount = overflowCount;
+}
+
+bool LightClusterBuilder::sphereIntersectsTile(const SliceBounds &bounds, uint32_t tile, const LocalLight &light)
+{
+    const float deltaX = std::max(std::max(bounds.minX[tile] - light.center.x, light.center.x - bounds.maxX[tile]), 0.0f);
+    const float deltaY = std::max(std::max(bounds.minY[tile] - light.center.y, light.center.y - bounds.maxY[tile]), 0.0f);
+    const float deltaZ = std::max(std::max(bounds.minZ[tile] - light.center.z, light.center.z - bounds.maxZ[tile]), 0.0f);
+
+    return deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ <= light.radiusSquared;
+}
+
+ELIX_NESTED_NAMESPACE_END
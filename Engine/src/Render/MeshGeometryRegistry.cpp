@@ -1,16 +1,12 @@
 #include "Engine/Render/MeshGeometryRegistry.hpp"
 
-#include "Engine/Vertex.hpp"
+#include <algorithm>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
-void MeshGeometryRegistry::setUnifiedGeometryBuffer(UnifiedGeometryBuffer *unifiedGeometryBuffer,
-                                                    VkDeviceSize unifiedVertexBufferSize,
-                                                    uint32_t unifiedIndexBufferCount)
+void MeshGeometryRegistry::setGeometryPools(GeometryPoolManager *geometryPools)
 {
-    m_unifiedGeometryBuffer = unifiedGeometryBuffer;
-    m_unifiedVertexBufferSize = unifiedVertexBufferSize;
-    m_unifiedIndexBufferCount = unifiedIndexBufferCount;
+    m_geometryPools = geometryPools;
 }
 
 const MeshGeometryRegistry::Entry *MeshGeometryRegistry::find(MeshGeometryHash geometryHash) const
@@ -41,37 +37,37 @@ GPUMesh::SharedPtr MeshGeometryRegistry::getOrCreateSharedGeometryMesh(const CPU
     const MeshGeometryInfo &geometryInfo = mesh.getGeometryInfo();
 
     if (auto entry = find(geometryInfo.hash))
+    {
+        entry->retired = false;
         return entry->sharedMesh;
+    }
+
+    GPUMesh::SharedPtr sharedMesh{nullptr};
+    if (m_gpuUploadEnabled)
+        sharedMesh = GPUMesh::createFromMesh(mesh);
+    else if (!mesh.vertexData.empty() && !mesh.indices.empty())
+    {
+        sharedMesh = std::make_shared<GPUMesh>();
+        sharedMesh->indicesCount = static_cast<uint32_t>(mesh.indices.size());
+        sharedMesh->vertexStride = mesh.vertexStride;
+        sharedMesh->vertexLayoutHash = mesh.vertexLayoutHash;
+    }
 
-    auto sharedMesh = GPUMesh::createFromMesh(mesh);
     auto it = m_entries.emplace(geometryInfo.hash, Entry{}).first;
     it->second.geometryHash = geometryInfo.hash;
     it->second.sharedMesh = sharedMesh;
 
-    const uint64_t skinnedVertexLayoutHash = vertex::VertexTraits<vertex::VertexSkinned>::layout().hash;
-    if (sharedMesh &&
-        m_unifiedGeometryBuffer != nullptr &&
-        mesh.vertexLayoutHash != skinnedVertexLayoutHash &&
-        !mesh.vertexData.empty() &&
-        !mesh.indices.empty())
+    if (sharedMesh && m_geometryPools != nullptr)
     {
-        if (!m_unifiedGeometryBuffer->isInitialized())
-            m_unifiedGeometryBuffer->init(mesh.vertexStride, m_unifiedVertexBufferSize, m_unifiedIndexBufferCount);
-
-        if (m_unifiedGeometryBuffer->getVertexStride() == mesh.vertexStride)
+        int32_t outVertexOffset = GPUMesh::INVALID_VERTEX_OFFSET;
+        uint32_t outFirstIndex = 0u;
+        VkBuffer outVertexBuffer = VK_NULL_HANDLE;
+        if (m_geometryPools->registerMesh(mesh, outVertexOffset, outFirstIndex, it->second.unifiedAllocation, outVertexBuffer))
         {
-            int32_t outVertexOffset = GPUMesh::INVALID_VERTEX_OFFSET;
-            uint32_t outFirstIndex = 0u;
-            if (m_unifiedGeometryBuffer->registerMesh(mesh.vertexData.data(),
-                                                      static_cast<VkDeviceSize>(mesh.vertexData.size()),
-                                                      mesh.indices.data(),
-                                                      static_cast<uint32_t>(mesh.indices.size()),
-                                                      outVertexOffset, outFirstIndex))
-            {
-                sharedMesh->unifiedVertexOffset = outVertexOffset;
-                sharedMesh->unifiedFirstIndex = outFirstIndex;
-                sharedMesh->inUnifiedBuffer = true;
-            }
+            sharedMesh->unifiedVertexBuffer = outVertexBuffer;
+            sharedMesh->unifiedVertexOffset = outVertexOffset;
+            sharedMesh->unifiedFirstIndex = outFirstIndex;
+            sharedMesh->inUnifiedBuffer = true;
         }
     }
 
@@ -91,15 +87,138 @@ GPUMesh::SharedPtr MeshGeometryRegistry::createDrawMeshInstance(const CPUMesh &m
     instance->indexType = sharedGeometry->indexType;
     instance->vertexStride = sharedGeometry->vertexStride;
     instance->vertexLayoutHash = sharedGeometry->vertexLayoutHash;
+    instance->unifiedVertexBuffer = sharedGeometry->unifiedVertexBuffer;
     instance->unifiedVertexOffset = sharedGeometry->unifiedVertexOffset;
     instance->unifiedFirstIndex = sharedGeometry->unifiedFirstIndex;
     instance->inUnifiedBuffer = sharedGeometry->inUnifiedBuffer;
 
+    if (auto entry = find(mesh.getGeometryInfo().hash))
+    {
+        entry->instances.push_back(instance);
+        entry->unusedFrames = 0u;
+    }
+
     return instance;
 }
 
+void MeshGeometryRegistry::retireGeometry(MeshGeometryHash geometryHash)
+{
+    if (auto entry = find(geometryHash))
+        entry->retired = true;
+}
+
+void MeshGeometryRegistry::collectUnusedGeometry()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        auto &entry = it->second;
+
+        std::erase_if(entry.instances, [](const std::weak_ptr<GPUMesh> &instance)
+                      { return instance.expired(); });
+
+        const bool inUse = !entry.instances.empty() || entry.sharedMesh.use_count() > 1;
+        entry.unusedFrames = inUse ? 0u : entry.unusedFrames + 1u;
+
+        if (entry.unusedFrames < (entry.retired ? RETIRED_GEOMETRY_EVICTION_FRAMES : UNUSED_GEOMETRY_EVICTION_FRAMES))
+        {
+            ++it;
+            continue;
+        }
+
+        releaseEntry(entry);
+        it = m_entries.erase(it);
+    }
+}
+
+void MeshGeometryRegistry::compactUnifiedGeometry(uint32_t maxRelocations)
+{
+    if (!m_unifiedGeometryCompactionEnabled || maxRelocations == 0u || m_geometryPools == nullptr)
+        return;
+
+    // Index space is shared by all pools, so its fragmentation makes every pool a candidate.
+    bool indicesFragmented = false;
+    std::vector<uint64_t> fragmentedPools;
+    for (const auto &poolStatistics : m_geometryPools->getStatistics())
+    {
+        const auto &statistics = poolStatistics.statistics;
+        indicesFragmented = indicesFragmented || statistics.indices.fragmentation() >= UNIFIED_COMPACTION_FRAGMENTATION_THRESHOLD;
+        if (statistics.vertices.fragmentation() >= UNIFIED_COMPACTION_FRAGMENTATION_THRESHOLD)
+            fragmentedPools.push_back(poolStatistics.vertexLayoutHash);
+    }
+
+    if (!indicesFragmented && fragmentedPools.empty())
+        return;
+
+    // Highest ranges first: they are the ones that keep free space split up.
+    std::vector<Entry *> candidates;
+    candidates.reserve(m_entries.size());
+    for (auto &[_, entry] : m_entries)
+    {
+        if (!entry.sharedMesh || !entry.sharedMesh->inUnifiedBuffer || !entry.unifiedAllocation.isValid())
+            continue;
+
+        if (indicesFragmented ||
+            std::find(fragmentedPools.begin(), fragmentedPools.end(), entry.unifiedAllocation.vertexLayoutHash) != fragmentedPools.end())
+            candidates.push_back(&entry);
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [indicesFragmented](const Entry *left, const Entry *right)
+              {
+                  if (indicesFragmented)
+                      return left->sharedMesh->unifiedFirstIndex > right->sharedMesh->unifiedFirstIndex;
+                  return left->sharedMesh->unifiedVertexOffset > right->sharedMesh->unifiedVertexOffset; });
+
+    std::vector<Entry *> relocatedEntries;
+    for (Entry *entry : candidates)
+    {
+        if (relocatedEntries.size() >= maxRelocations)
+            break;
+
+        int32_t vertexOffset = entry->sharedMesh->unifiedVertexOffset;
+        uint32_t firstIndex = entry->sharedMesh->unifiedFirstIndex;
+        if (!m_geometryPools->relocateMesh(entry->unifiedAllocation, vertexOffset, firstIndex))
+            continue;
+
+        patchUnifiedOffsets(*entry, vertexOffset, firstIndex);
+        relocatedEntries.push_back(entry);
+    }
+
+    uint64_t completionValue = 0u;
+    if (!relocatedEntries.empty() && m_geometryPools->submitRelocations(completionValue))
+        for (Entry *entry : relocatedEntries)
+            entry->unifiedAllocation.allocation.uploadCompletionValue = completionValue;
+}
+
+void MeshGeometryRegistry::releaseEntry(Entry &entry)
+{
+    if (m_geometryPools != nullptr && entry.unifiedAllocation.isValid())
+        m_geometryPools->releaseMesh(entry.unifiedAllocation);
+
+    entry.unifiedAllocation = {};
+    if (entry.sharedMesh)
+        entry.sharedMesh->inUnifiedBuffer = false;
+}
+
+void MeshGeometryRegistry::patchUnifiedOffsets(Entry &entry, int32_t vertexOffset, uint32_t firstIndex)
+{
+    entry.sharedMesh->unifiedVertexOffset = vertexOffset;
+    entry.sharedMesh->unifiedFirstIndex = firstIndex;
+
+    for (const auto &weakInstance : entry.instances)
+    {
+        if (auto instance = weakInstance.lock())
+        {
+            instance->unifiedVertexOffset = vertexOffset;
+            instance->unifiedFirstIndex = firstIndex;
+        }
+    }
+}
+
 void MeshGeometryRegistry::clear()
 {
+    for (auto &[_, entry] : m_entries)
+        releaseEntry(entry);
+
     m_entries.clear();
 }
 
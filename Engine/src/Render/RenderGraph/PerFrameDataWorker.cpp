@@ -21,6 +21,7 @@
 #include "Engine/Scene.hpp"
 #include "Engine/Shaders/ShaderFamily.hpp"
 #include "Engine/Utilities/BufferUtilities.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -42,6 +43,8 @@ void PerFrameDataWorker::fillCameraData(Camera *camera)
 
 void PerFrameDataWorker::buildLightData(Scene *scene, Camera *camera)
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildLightData");
+
     resetPerFrameData();
     m_lightSpaceMatrixUBO = RenderGraphLightSpaceMatrixUBO{};
     m_lightData.clear();
@@ -69,8 +72,11 @@ void PerFrameDataWorker::buildLightData(Scene *scene, Camera *camera)
         lightData.colorStrength = glm::vec4(lightComponent->color, lightComponent->strength);
         lightData.shadowInfo = glm::vec4(0.0f);
 
-        if (auto directionalLight = dynamic_cast<DirectionalLight *>(lightComponent.get()))
+        const BaseLight::Type lightType = lightComponent->getType();
+
+        if (lightType == BaseLight::Type::Directional)
         {
+            auto *directionalLight = static_cast<DirectionalLight *>(lightComponent.get());
             m_data.hasDirectionalLight = true;
 
             const glm::vec3 dirWorld = glm::normalize(directionalLight->direction);
@@ -111,8 +117,9 @@ void PerFrameDataWorker::buildLightData(Scene *scene, Camera *camera)
                 directionalShadowAssigned = true;
             }
         }
-        else if (auto pointLight = dynamic_cast<PointLight *>(lightComponent.get()))
+        else if (lightType == BaseLight::Type::Point)
         {
+            auto *pointLight = static_cast<PointLight *>(lightComponent.get());
             const glm::vec3 posWorld = lightComponent->position;
             const glm::vec3 posView = glm::vec3(view * glm::vec4(posWorld, 1.0f));
 
@@ -130,8 +137,9 @@ void PerFrameDataWorker::buildLightData(Scene *scene, Camera *camera)
                 m_data.activeRTShadowLayerCount = std::max(m_data.activeRTShadowLayerCount, static_cast<uint32_t>(i + 1u));
             }
         }
-        else if (auto spotLight = dynamic_cast<SpotLight *>(lightComponent.get()))
+        else if (lightType == BaseLight::Type::Spot)
         {
+            auto *spotLight = static_cast<SpotLight *>(lightComponent.get());
             const glm::vec3 posView = glm::vec3(view * glm::vec4(lightComponent->position, 1.0f));
             const glm::vec3 dirView = glm::normalize(view3 * glm::normalize(spotLight->direction));
 
@@ -157,7 +165,6 @@ bool PerFrameDataWorker::fillDirectionalLight(Camera *camera, DirectionalLight *
 {
     const glm::mat4 view = camera ? camera->getViewMatrix() : glm::mat4(1.0f);
     const glm::mat3 view3 = glm::mat3(view);
-    const auto swapChain = core::VulkanContext::getContext()->getSwapchain();
     glm::vec3 dirWorld = glm::normalize(directionalLight->direction);
     glm::vec3 dirView = glm::normalize(view3 * dirWorld);
 
@@ -172,8 +179,15 @@ bool PerFrameDataWorker::fillDirectionalLight(Camera *camera, DirectionalLight *
         const float shadowMaxDistance = std::max(RenderQualitySettings::getInstance().shadowMaxDistance, cameraNear + 1.0f);
         const float cameraFar = std::min(sceneCameraFar, shadowMaxDistance);
         const float cameraFov = camera ? camera->getFOV() : 60.0f;
-        const float cameraAspect = camera ? std::max(camera->getAspect(), 0.001f)
-                                          : static_cast<float>(swapChain->getExtent().width) / std::max(1.0f, static_cast<float>(swapChain->getExtent().height));
+        float cameraAspect = 1.0f;
+        if (camera)
+            cameraAspect = std::max(camera->getAspect(), 0.001f);
+        else
+        {
+            // Headless callers always pass a camera, so the swapchain is only queried here.
+            const auto swapChain = core::VulkanContext::getContext()->getSwapchain();
+            cameraAspect = static_cast<float>(swapChain->getExtent().width) / std::max(1.0f, static_cast<float>(swapChain->getExtent().height));
+        }
 
         glm::mat4 invView = glm::inverse(view);
         glm::vec3 camPos = glm::vec3(invView[3]);
@@ -328,6 +342,8 @@ bool PerFrameDataWorker::fillSpotLight(Camera *camera, SpotLight *spotLight)
 
 void PerFrameDataWorker::pruneRemovedEntities(Scene *scene)
 {
+    VX_PROFILE_SCOPE("PerFrameData::pruneRemovedEntities");
+
     if (!scene)
         return;
 
@@ -360,6 +376,8 @@ void PerFrameDataWorker::pruneRemovedEntities(Scene *scene)
 
 void PerFrameDataWorker::syncSceneDrawItems(Scene *scene, const glm::vec3 &cameraPos)
 {
+    VX_PROFILE_SCOPE("PerFrameData::syncSceneDrawItems");
+
     if (!scene)
         return;
 
@@ -437,8 +455,17 @@ void PerFrameDataWorker::syncSceneDrawItems(Scene *scene, const glm::vec3 &camer
             meshes = &skeletalMeshComponent->getMeshes();
         else if (terrainComponent)
         {
-            terrainComponent->ensureChunkMeshesBuilt();
+            const glm::mat4 terrainTransform = entity->hasComponent<Transform3DComponent>()
+                                                   ? entity->getComponent<Transform3DComponent>()->getMatrix()
+                                                   : glm::mat4(1.0f);
+            terrainComponent->updateLod(glm::vec3(glm::inverse(terrainTransform) * glm::vec4(cameraPos, 1.0f)));
             meshes = &terrainComponent->getChunkMeshes();
+
+            if (m_dependencies.meshGeometryRegistry != nullptr)
+            {
+                for (const MeshGeometryHash geometryHash : terrainComponent->takeRetiredGeometry())
+                    m_dependencies.meshGeometryRegistry->retireGeometry(geometryHash);
+            }
         }
 
         if (!meshes || meshes->empty())
@@ -493,6 +520,8 @@ void PerFrameDataWorker::syncSceneDrawItems(Scene *scene, const glm::vec3 &camer
 
 void PerFrameDataWorker::buildFrameBones()
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildFrameBones");
+
     m_frameBones.clear();
     m_frameBones.reserve(1024);
 
@@ -512,6 +541,8 @@ void PerFrameDataWorker::buildDrawReferences(const glm::mat4 &view,
                                              const glm::mat4 &projection,
                                              bool enableFrustumCulling)
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildDrawReferences");
+
     const std::array<glm::vec4, 6> frustumPlanes = enableFrustumCulling
                                                        ? GpuCullingSystem::extractFrustumPlanes(projection * view)
                                                        : std::array<glm::vec4, 6>{};
@@ -586,6 +617,8 @@ void PerFrameDataWorker::buildDrawReferences(const glm::mat4 &view,
 
 void PerFrameDataWorker::sortDrawReferences(const glm::vec3 &cameraPosition)
 {
+    VX_PROFILE_SCOPE("PerFrameData::sortDrawReferences");
+
     std::sort(m_drawReferences.begin(), m_drawReferences.end(),
               [cameraPosition](const MeshDrawReference &left, const MeshDrawReference &right)
               {
@@ -607,6 +640,10 @@ void PerFrameDataWorker::sortDrawReferences(const glm::vec3 &cameraPosition)
                   if (left.skinned != right.skinned)
                       return left.skinned < right.skinned;
 
+                  // Group by unified geometry pool first so passes rebind the VB once per layout.
+                  if (left.mesh->unifiedVertexBuffer != right.mesh->unifiedVertexBuffer)
+                      return left.mesh->unifiedVertexBuffer < right.mesh->unifiedVertexBuffer;
+
                   if (left.mesh->vertexBuffer.get() != right.mesh->vertexBuffer.get())
                       return left.mesh->vertexBuffer.get() < right.mesh->vertexBuffer.get();
 
@@ -627,6 +664,8 @@ void PerFrameDataWorker::sortDrawReferences(const glm::vec3 &cameraPosition)
 
 void PerFrameDataWorker::buildRayTracingInputs()
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildRayTracingInputs");
+
     m_data.rtReflectionShadingInstances.clear();
 
     if (m_dependencies.rayTracingScene == nullptr || m_dependencies.rayTracingGeometryCache == nullptr)
@@ -819,6 +858,8 @@ void PerFrameDataWorker::buildRayTracingInputs()
 
 void PerFrameDataWorker::buildRasterBatches()
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildRasterBatches");
+
     m_data.perObjectInstances.clear();
     m_data.perObjectInstances.reserve(m_drawReferences.size());
     m_data.drawBatches.clear();
@@ -903,6 +944,8 @@ void PerFrameDataWorker::buildRasterBatches()
 
 void PerFrameDataWorker::buildShadowBatches()
 {
+    VX_PROFILE_SCOPE("PerFrameData::buildShadowBatches");
+
     for (auto &batches : m_data.directionalShadowDrawBatches)
         batches.clear();
     for (auto &batches : m_data.spotShadowDrawBatches)
@@ -926,6 +969,9 @@ void PerFrameDataWorker::buildShadowBatches()
                   if (left->skinned != right->skinned)
                       return left->skinned < right->skinned;
 
+                  if (left->mesh->unifiedVertexBuffer != right->mesh->unifiedVertexBuffer)
+                      return left->mesh->unifiedVertexBuffer < right->mesh->unifiedVertexBuffer;
+
                   if (left->mesh->vertexBuffer.get() != right->mesh->vertexBuffer.get())
                       return left->mesh->vertexBuffer.get() < right->mesh->vertexBuffer.get();
 
@@ -10,6 +10,10 @@ RGPResourceHandler RGPResourcesBuilder::createTexture(const RGPTextureDescriptio
 {
     ++m_nextResourceId;
     m_textureDescriptions[RGPResourceHandler{.id = m_nextResourceId}] = description;
+
+    if (m_currentPass)
+        m_currentPass->createdTextures.push_back(RGPResourceHandler{.id = m_nextResourceId});
+
     return RGPResourceHandler{.id = m_nextResourceId};
 }
 
@@ -18,6 +22,10 @@ RGPResourceHandler RGPResourcesBuilder::createTexture(const RGPTextureDescriptio
     ++m_nextResourceId;
     handler.id = m_nextResourceId;
     m_textureDescriptions[handler] = description;
+
+    if (m_currentPass)
+        m_currentPass->createdTextures.push_back(handler);
+
     return handler;
 }
 
@@ -35,6 +43,11 @@ RGPTextureDescription *RGPResourcesBuilder::getTextureDescriptionMutable(const R
     return it == m_textureDescriptions.end() ? nullptr : &it->second;
 }
 
+void RGPResourcesBuilder::removeTexture(const RGPResourceHandler &handler)
+{
+    m_textureDescriptions.erase(handler);
+}
+
 const std::unordered_map<RGPResourceHandler, RGPTextureDescription> &RGPResourcesBuilder::getAllTextureDescriptions() const
 {
     return m_textureDescriptions;
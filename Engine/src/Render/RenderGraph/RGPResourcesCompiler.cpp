@@ -100,6 +100,52 @@ namespace
             throw std::runtime_error("chooseDstSync: unsupported initial layout");
         }
     }
+
+    static void addSwapChainTargets(const elix::engine::renderGraph::RGPResourceHandler &id,
+                                    const elix::engine::renderGraph::RGPTextureDescription &textureDescription,
+                                    elix::engine::renderGraph::RGPResourcesStorage &storage,
+                                    std::vector<VkImageMemoryBarrier2> &barriers)
+    {
+        const auto &vulkanContext = elix::core::VulkanContext::getContext();
+        const auto &device = vulkanContext->getDevice();
+        const auto &swapChain = vulkanContext->getSwapchain();
+
+        for (int imageIndex = 0; imageIndex < swapChain->getImages().size(); ++imageIndex)
+        {
+            const auto &image = swapChain->getImages().at(imageIndex);
+            auto wrapImage = elix::core::Image::createShared(image);
+
+            auto renderTarget = std::make_shared<elix::engine::RenderTarget>(device, swapChain->getExtent(), swapChain->getImageFormat(),
+                                                                             elix::engine::utilities::ImageUtilities::getAspectBasedOnFormat(textureDescription.getFormat()), wrapImage);
+
+            storage.addSwapChainTexture(id, std::move(renderTarget));
+
+            if (textureDescription.getFinalLayout() == VK_IMAGE_LAYOUT_UNDEFINED && textureDescription.getInitialLayout() == VK_IMAGE_LAYOUT_UNDEFINED)
+                continue;
+
+            VkImageSubresourceRange subresourceRange{};
+            subresourceRange.aspectMask = elix::engine::utilities::ImageUtilities::getAspectBasedOnFormat(textureDescription.getFormat());
+            subresourceRange.baseMipLevel = 0;
+            subresourceRange.levelCount = 1;
+            subresourceRange.baseArrayLayer = 0;
+            subresourceRange.layerCount = 1;
+
+            VkPipelineStageFlags2 srcStageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
+            VkAccessFlags2 srcAccessMask = 0;
+            VkPipelineStageFlags2 dstStageMask;
+            VkAccessFlags2 dstAccessMask;
+
+            const VkImageLayout bootstrapLayout = chooseBootstrapLayout(textureDescription.getInitialLayout(), textureDescription.getFinalLayout());
+
+            chooseDstSync(bootstrapLayout, dstStageMask, dstAccessMask);
+
+            auto barrier = elix::engine::utilities::ImageUtilities::insertImageMemoryBarrier(*wrapImage, srcAccessMask, dstAccessMask, VK_IMAGE_LAYOUT_UNDEFINED,
+                                                                                             bootstrapLayout, srcStageMask,
+                                                                                             dstStageMask, subresourceRange);
+
+            barriers.push_back(barrier);
+        }
+    }
 }
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -122,7 +168,12 @@ std::vector<VkImageMemoryBarrier2> RGPResourcesCompiler::compile(const std::vect
             continue;
 
         if (textureDescription->getIsSwapChainTarget())
+        {
+            // Only bootstrapped here when a pass writing the swapchain was added at runtime.
+            if (!storage.getSwapChainTexture(idHandler, 0))
+                addSwapChainTargets(idHandler, *textureDescription, storage, barriers);
             continue;
+        }
 
         auto *renderTarget = storage.getTexture(idHandler);
         if (!renderTarget)
@@ -197,44 +248,7 @@ std::vector<VkImageMemoryBarrier2> RGPResourcesCompiler::compile(RGPResourcesBui
     {
         if (textureDescription.getIsSwapChainTarget())
         {
-            const auto &swapChain = vulkanContext->getSwapchain();
-
-            for (int imageIndex = 0; imageIndex < swapChain->getImages().size(); ++imageIndex)
-            {
-                const auto &image = swapChain->getImages().at(imageIndex);
-                auto wrapImage = core::Image::createShared(image);
-
-                auto renderTarget = std::make_shared<RenderTarget>(device, swapChain->getExtent(), swapChain->getImageFormat(),
-                                                                   utilities::ImageUtilities::getAspectBasedOnFormat(textureDescription.getFormat()), wrapImage);
-
-                storage.addSwapChainTexture(id, std::move(renderTarget));
-
-                if (textureDescription.getFinalLayout() == VK_IMAGE_LAYOUT_UNDEFINED && textureDescription.getInitialLayout() == VK_IMAGE_LAYOUT_UNDEFINED)
-                    continue;
-
-                VkImageSubresourceRange subresourceRange{};
-                subresourceRange.aspectMask = utilities::ImageUtilities::getAspectBasedOnFormat(textureDescription.getFormat());
-                subresourceRange.baseMipLevel = 0;
-                subresourceRange.levelCount = 1;
-                subresourceRange.baseArrayLayer = 0;
-                subresourceRange.layerCount = 1;
-
-                VkPipelineStageFlags2 srcStageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
-                VkAccessFlags2 srcAccessMask = 0;
-                VkPipelineStageFlags2 dstStageMask;
-                VkAccessFlags2 dstAccessMask;
-
-                const VkImageLayout bootstrapLayout = chooseBootstrapLayout(textureDescription.getInitialLayout(), textureDescription.getFinalLayout());
-
-                chooseDstSync(bootstrapLayout, dstStageMask, dstAccessMask);
-
-                auto barrier = utilities::ImageUtilities::insertImageMemoryBarrier(*wrapImage, srcAccessMask, dstAccessMask, VK_IMAGE_LAYOUT_UNDEFINED,
-                                                                                   bootstrapLayout, srcStageMask,
-                                                                                   dstStageMask, subresourceRange);
-
-                barriers.push_back(barrier);
-            }
-
+            addSwapChainTargets(id, textureDescription, storage, barriers);
             continue;
         }
 
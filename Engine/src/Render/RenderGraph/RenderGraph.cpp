@@ -40,6 +40,7 @@
 #include "Engine/Shaders/ShaderCompiler.hpp"
 #include "Engine/Shaders/ShaderFamily.hpp"
 #include "Engine/Threads/ThreadPoolManager.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -303,7 +304,8 @@ RenderGraph::RenderGraph(bool presentToSwapchain) : m_presentToSwapchain(present
 {
     m_device = core::VulkanContext::getContext()->getDevice();
     m_swapchain = core::VulkanContext::getContext()->getSwapchain();
-    m_meshGeometryRegistry.setUnifiedGeometryBuffer(&m_staticUnifiedGeometry, UNIFIED_VERTEX_BUFFER_SIZE, UNIFIED_INDEX_BUFFER_COUNT);
+    m_geometryPools.init(UNIFIED_INDEX_BUFFER_COUNT);
+    m_meshGeometryRegistry.setGeometryPools(&m_geometryPools);
 
     m_commandBuffers.reserve(MAX_FRAMES_IN_FLIGHT);
     m_secondaryCommandPools.resize(MAX_FRAMES_IN_FLIGHT);
@@ -404,6 +406,8 @@ std::vector<VkImageView> RenderGraph::getImageViews(const std::vector<RGPResourc
 
 void RenderGraph::prepareFrameDataFromScene(Scene *scene, const glm::mat4 &view, const glm::mat4 &projection, bool enableFrustumCulling)
 {
+    VX_PROFILE_SCOPE("RenderGraph::prepareFrameDataFromScene");
+
     m_sceneMaterialResolver.beginFrame();
 
     auto perFrameWorker = PerFrameDataWorker::begin(
@@ -425,6 +429,9 @@ void RenderGraph::prepareFrameDataFromScene(Scene *scene, const glm::mat4 &view,
     perFrameWorker.pruneRemovedEntities(scene);
     perFrameWorker.syncSceneDrawItems(scene, cameraWorldPos);
 
+    m_meshGeometryRegistry.collectUnusedGeometry();
+    m_meshGeometryRegistry.compactUnifiedGeometry(MAX_UNIFIED_RELOCATIONS_PER_FRAME);
+
     utilities::AsyncGpuUpload::batchFlush(core::VulkanContext::getContext()->getGraphicsQueue());
 
     perFrameWorker.buildFrameBones();
@@ -709,8 +716,7 @@ RenderGraph::ProbeCaptureResult RenderGraph::captureSceneProbe(const glm::vec3 &
         VkBuffer boundVB = VK_NULL_HANDLE;
         VkBuffer boundIB = VK_NULL_HANDLE;
 
-        const bool hasUnified = m_perFrameData.unifiedStaticVertexBuffer != VK_NULL_HANDLE &&
-                                m_perFrameData.unifiedStaticIndexBuffer != VK_NULL_HANDLE;
+        const bool hasUnified = m_perFrameData.unifiedIndexBuffer != VK_NULL_HANDLE;
 
         for (const auto &batch : m_perFrameData.drawBatches)
         {
@@ -721,17 +727,17 @@ RenderGraph::ProbeCaptureResult RenderGraph::captureSceneProbe(const glm::vec3 &
 
             if (useUnified)
             {
-                if (m_perFrameData.unifiedStaticVertexBuffer != boundUnifiedVB)
+                if (batch.mesh->unifiedVertexBuffer != boundUnifiedVB)
                 {
                     const VkDeviceSize off = 0;
-                    vkCmdBindVertexBuffers(cmdBuf, 0, 1, &m_perFrameData.unifiedStaticVertexBuffer, &off);
-                    boundUnifiedVB = m_perFrameData.unifiedStaticVertexBuffer;
+                    vkCmdBindVertexBuffers(cmdBuf, 0, 1, &batch.mesh->unifiedVertexBuffer, &off);
+                    boundUnifiedVB = batch.mesh->unifiedVertexBuffer;
                     boundVB = VK_NULL_HANDLE;
                 }
-                if (m_perFrameData.unifiedStaticIndexBuffer != boundUnifiedIB)
+                if (m_perFrameData.unifiedIndexBuffer != boundUnifiedIB)
                 {
-                    vkCmdBindIndexBuffer(cmdBuf, m_perFrameData.unifiedStaticIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
-                    boundUnifiedIB = m_perFrameData.unifiedStaticIndexBuffer;
+                    vkCmdBindIndexBuffer(cmdBuf, m_perFrameData.unifiedIndexBuffer, 0, VK_INDEX_TYPE_UINT32);
+                    boundUnifiedIB = m_perFrameData.unifiedIndexBuffer;
                     boundIB = VK_NULL_HANDLE;
                 }
             }
@@ -743,12 +749,14 @@ RenderGraph::ProbeCaptureResult RenderGraph::captureSceneProbe(const glm::vec3 &
                     const VkDeviceSize off = 0;
                     vkCmdBindVertexBuffers(cmdBuf, 0, 1, &vb, &off);
                     boundVB = vb;
+                    boundUnifiedVB = VK_NULL_HANDLE;
                 }
                 const VkBuffer ib = batch.mesh->indexBuffer;
                 if (ib != boundIB)
                 {
                     vkCmdBindIndexBuffer(cmdBuf, ib, 0, batch.mesh->indexType);
                     boundIB = ib;
+                    boundUnifiedIB = VK_NULL_HANDLE;
                 }
             }
 
@@ -807,6 +815,8 @@ RenderGraph::ProbeCaptureResult RenderGraph::captureSceneProbe(const glm::vec3 &
 
 void RenderGraph::prepareFrame(Camera::SharedPtr camera, Scene *scene, float deltaTime)
 {
+    VX_PROFILE_SCOPE("RenderGraph::prepareFrame");
+
     if (const VkResult waitResult = vkWaitForFences(m_device, 1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
         waitResult != VK_SUCCESS)
     {
@@ -815,14 +825,16 @@ void RenderGraph::prepareFrame(Camera::SharedPtr camera, Scene *scene, float del
         return;
     }
 
+    // Fence of this frame slot is signalled, so ranges released RELEASE_FRAME_LATENCY frames ago are idle.
+    m_geometryPools.advanceFrame();
+
     m_perFrameData.swapChainViewport = m_swapchain->getViewport();
     m_perFrameData.swapChainScissor = m_swapchain->getScissor();
     m_perFrameData.cameraDescriptorSet = m_cameraDescriptorSets[m_currentFrame];
     m_perFrameData.previewCameraDescriptorSet = m_previewCameraDescriptorSets[m_currentFrame];
     m_perFrameData.deltaTime = deltaTime;
     m_perFrameData.elapsedTime += deltaTime;
-    m_perFrameData.unifiedStaticVertexBuffer = m_staticUnifiedGeometry.getVertexBuffer();
-    m_perFrameData.unifiedStaticIndexBuffer = m_staticUnifiedGeometry.getIndexBuffer();
+    m_perFrameData.unifiedIndexBuffer = m_geometryPools.getIndexBuffer();
 
     CameraUBO cameraUBO{};
 
@@ -879,6 +891,21 @@ void RenderGraph::prepareFrame(Camera::SharedPtr camera, Scene *scene, float del
     if (!lights.empty())
         std::memcpy(ssboData->lights, lights.data(), lights.size() * sizeof(RenderGraphLightData));
     m_lightSSBOs[m_currentFrame]->unmap();
+
+    // Clustered light assignment: the lighting pass only loops over the lights of the pixel's cluster.
+    m_lightClusterBuilder.build(lights,
+                                camera ? camera->getProjectionMatrix() : glm::mat4(1.0f),
+                                camera ? camera->getNear() : 0.1f,
+                                camera ? camera->getFar() : 1000.0f);
+    {
+        const auto &clusterData = m_lightClusterBuilder.getData();
+        uint8_t *clusterMapped = nullptr;
+        m_lightClusterSSBOs[m_currentFrame]->map(reinterpret_cast<void *&>(clusterMapped));
+        std::memcpy(clusterMapped, &m_lightClusterBuilder.getHeader(), sizeof(LightClusterBuilder::GpuHeader));
+        std::memcpy(clusterMapped + sizeof(LightClusterBuilder::GpuHeader), clusterData.data(), clusterData.size() * sizeof(uint32_t));
+        m_lightClusterSSBOs[m_currentFrame]->unmap();
+    }
+
     const auto &lightSpaceMatrixUBO = perFrameWorker.getLightSpaceMatrixUBO();
     std::memcpy(m_lightMapped[m_currentFrame], &lightSpaceMatrixUBO, sizeof(RenderGraphLightSpaceMatrixUBO));
 
@@ -1388,6 +1415,8 @@ void RenderGraph::end()
 
 void RenderGraph::draw()
 {
+    VX_PROFILE_SCOPE("RenderGraph::draw");
+
     m_renderGraphProfiling->measureFrameCpuTime(
         m_currentFrame,
         [&]()
@@ -1418,17 +1447,26 @@ void RenderGraph::setup()
             continue;
         }
 
-        const std::string &debugName = passData->renderGraphPass->getDebugName();
-        VX_ENGINE_INFO_STREAM("[RenderGraph] Setup pass " << passData->id << ": "
-                                                         << (debugName.empty() ? "<unnamed>" : debugName) << '\n');
-
-        m_renderGraphPassesBuilder.setCurrentPass(&passData->passInfo);
-        passData->renderGraphPass->setup(m_renderGraphPassesBuilder);
+        setupPass(*passData);
     }
 
+    m_isSetup = true;
+    m_pendingSetupPassIds.clear();
+
     compile();
 }
 
+void RenderGraph::setupPass(RenderGraphPassData &data)
+{
+    const std::string &debugName = data.renderGraphPass->getDebugName();
+    VX_ENGINE_INFO_STREAM("[RenderGraph] Setup pass " << data.id << ": "
+                                                     << (debugName.empty() ? "<unnamed>" : debugName) << '\n');
+
+    m_renderGraphPassesBuilder.setCurrentPass(&data.passInfo);
+    data.renderGraphPass->setup(m_renderGraphPassesBuilder);
+    m_renderGraphPassesBuilder.setCurrentPass(nullptr);
+}
+
 void RenderGraph::sortRenderGraphPasses()
 {
     auto producerConsumer = [](const RenderGraphPassData &a, const RenderGraphPassData &b)
@@ -1785,9 +1823,27 @@ void RenderGraph::compile()
 
     m_renderGraphPassesStorage.cleanup();
 
-    const auto aliasRoots = buildAliasedTextureRoots();
-    auto barriers = m_renderGraphPassesCompiler.compile(m_renderGraphPassesBuilder, m_renderGraphPassesStorage, &aliasRoots);
+    m_textureAliasRoots = buildAliasedTextureRoots();
+    auto barriers = m_renderGraphPassesCompiler.compile(m_renderGraphPassesBuilder, m_renderGraphPassesStorage, &m_textureAliasRoots);
+
+    submitBootstrapBarriers(barriers);
 
+    for (const auto &[id, pass] : m_renderGraphPasses)
+        if (pass.enabled)
+            pass.renderGraphPass->compile(m_renderGraphPassesStorage);
+
+    invalidateAllExecutionCaches();
+
+    if (m_presentToSwapchain && !m_hasWindowResizeCallback)
+    {
+        m_hasWindowResizeCallback = true;
+        core::VulkanContext::getContext()->getSwapchain()->getWindow().addResizeCallback([this](platform::Window *, int, int)
+                                                                                         { m_swapchainResizeRequested.store(true, std::memory_order_relaxed); });
+    }
+}
+
+void RenderGraph::submitBootstrapBarriers(const std::vector<VkImageMemoryBarrier2> &barriers)
+{
     auto commandBuffer = core::CommandBuffer::create(*core::VulkanContext::getContext()->getGraphicsCommandPool());
     commandBuffer.begin();
 
@@ -1804,19 +1860,6 @@ void RenderGraph::compile()
         std::lock_guard<std::mutex> queueLock(core::helpers::queueHostSyncMutex());
         vkQueueWaitIdle(core::VulkanContext::getContext()->getGraphicsQueue());
     }
-
-    for (const auto &[id, pass] : m_renderGraphPasses)
-        if (pass.enabled)
-            pass.renderGraphPass->compile(m_renderGraphPassesStorage);
-
-    invalidateAllExecutionCaches();
-
-    if (m_presentToSwapchain && !m_hasWindowResizeCallback)
-    {
-        m_hasWindowResizeCallback = true;
-        core::VulkanContext::getContext()->getSwapchain()->getWindow().addResizeCallback([this](platform::Window *, int, int)
-                                                                                         { m_swapchainResizeRequested.store(true, std::memory_order_relaxed); });
-    }
 }
 
 void RenderGraph::createPreviewCameraDescriptorSets()
@@ -1844,6 +1887,7 @@ void RenderGraph::refreshCameraDescriptorSet(uint32_t frameIndex)
         frameIndex >= m_cameraUniformObjects.size() ||
         frameIndex >= m_lightSpaceMatrixUniformObjects.size() ||
         frameIndex >= m_lightSSBOs.size() ||
+        frameIndex >= m_lightClusterSSBOs.size() ||
         frameIndex >= m_cameraDescriptorSets.size())
         return;
 
@@ -1856,7 +1900,8 @@ void RenderGraph::refreshCameraDescriptorSet(uint32_t frameIndex)
     auto builder = DescriptorSetBuilder::begin()
                        .addBuffer(m_cameraUniformObjects[frameIndex], sizeof(CameraUBO), 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
                        .addBuffer(m_lightSpaceMatrixUniformObjects[frameIndex], sizeof(RenderGraphLightSpaceMatrixUBO), 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
-                       .addBuffer(m_lightSSBOs[frameIndex], VK_WHOLE_SIZE, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+                       .addBuffer(m_lightSSBOs[frameIndex], VK_WHOLE_SIZE, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+                       .addBuffer(m_lightClusterSSBOs[frameIndex], VK_WHOLE_SIZE, 4, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 
     auto context = core::VulkanContext::getContext();
     if (context && context->hasAccelerationStructureSupport())
@@ -1919,6 +1964,7 @@ void RenderGraph::createCameraDescriptorSets()
     m_lightSpaceMatrixUniformObjects.reserve(MAX_FRAMES_IN_FLIGHT);
     m_cameraUniformObjects.reserve(MAX_FRAMES_IN_FLIGHT);
     m_lightSSBOs.reserve(MAX_FRAMES_IN_FLIGHT);
+    m_lightClusterSSBOs.reserve(MAX_FRAMES_IN_FLIGHT);
 
     static constexpr uint8_t INIT_LIGHTS_COUNT = 2;
     static constexpr VkDeviceSize INITIAL_SIZE = sizeof(RenderGraphLightData) * (INIT_LIGHTS_COUNT * sizeof(RenderGraphLightData));
@@ -1934,6 +1980,9 @@ void RenderGraph::createCameraDescriptorSets()
         auto ssboBuffer = m_lightSSBOs.emplace_back(core::Buffer::createShared(INITIAL_SIZE, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
                                                                                core::memory::MemoryUsage::CPU_TO_GPU));
 
+        m_lightClusterSSBOs.emplace_back(core::Buffer::createShared(LightClusterBuilder::GPU_BUFFER_SIZE, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+                                                                    core::memory::MemoryUsage::CPU_TO_GPU));
+
         cameraBuffer->map(m_cameraMapped[i]);
         lightBuffer->map(m_lightMapped[i]);
         refreshCameraDescriptorSet(static_cast<uint32_t>(i));
@@ -2101,6 +2150,171 @@ void RenderGraph::enablePassData(RenderGraphPassData &data)
     invalidateAllExecutionCaches();
 }
 
+void RenderGraph::removePassData(std::type_index type)
+{
+    auto it = m_renderGraphPasses.find(type);
+    if (it == m_renderGraphPasses.end())
+        return;
+
+    auto &data = it->second;
+
+    {
+        std::lock_guard<std::mutex> queueLock(core::helpers::queueHostSyncMutex());
+        vkQueueWaitIdle(core::VulkanContext::getContext()->getGraphicsQueue());
+    }
+
+    if (data.enabled)
+        data.renderGraphPass->freeResources();
+    data.renderGraphPass->cleanup();
+
+    // Only release what the pass created: it may also write into other passes' textures.
+    std::unordered_set<RGPResourceHandler> releasedTextures;
+    for (const auto &handler : data.passInfo.createdTextures)
+    {
+        const auto *desc = m_renderGraphPassesBuilder.getTextureDescription(handler);
+        if (!desc)
+            continue;
+
+        if (desc->getIsSwapChainTarget())
+            m_renderGraphPassesStorage.removeSwapChainTexture(handler);
+        else
+            m_renderGraphPassesStorage.removeTexture(handler);
+
+        m_renderGraphPassesBuilder.removeTexture(handler);
+        releasedTextures.insert(handler);
+    }
+
+    // Passes still reading the released textures hold stale bindings.
+    for (auto &[otherType, other] : m_renderGraphPasses)
+    {
+        if (otherType == type)
+            continue;
+
+        for (const auto &read : other.passInfo.reads)
+        {
+            if (releasedTextures.contains(read.resourceId))
+            {
+                other.renderGraphPass->requestRecompilation();
+                break;
+            }
+        }
+    }
+
+    IRenderGraphPass *removedPass = data.renderGraphPass.get();
+    std::erase_if(m_connections, [removedPass](const RGPConnection &connection)
+                  { return connection.fromOwner == removedPass || connection.toOwner == removedPass; });
+
+    for (auto &[_, group] : m_passGroups)
+        std::erase(group.passes, type);
+
+    std::erase(m_pendingSetupPassIds, data.id);
+
+    m_renderGraphPasses.erase(it);
+    m_topologyChanged = true;
+
+    sortRenderGraphPasses();
+    invalidateAllExecutionCaches();
+}
+
+void RenderGraph::applyTopologyChanges()
+{
+    if (!m_isSetup || (m_pendingSetupPassIds.empty() && !m_topologyChanged))
+        return;
+
+    vkDeviceWaitIdle(m_device);
+
+    std::vector<RenderGraphPassData *> addedPasses;
+    std::vector<RGPResourceHandler> addedTextures;
+    std::sort(m_pendingSetupPassIds.begin(), m_pendingSetupPassIds.end());
+    for (const uint32_t passId : m_pendingSetupPassIds)
+    {
+        auto *passData = findRenderGraphPassById(passId);
+        if (!passData)
+            continue;
+
+        setupPass(*passData);
+        addedPasses.push_back(passData);
+        addedTextures.insert(addedTextures.end(), passData->passInfo.createdTextures.begin(), passData->passInfo.createdTextures.end());
+    }
+
+    m_pendingSetupPassIds.clear();
+    m_topologyChanged = false;
+
+    sortRenderGraphPasses();
+
+    if (m_renderGraphProfiling)
+        m_renderGraphProfiling->setRenderGraphPassCount(static_cast<uint32_t>(m_renderGraphPasses.size()));
+
+    // Surviving textures keep their memory, so every group of them sharing memory must
+    // still be lifetime-disjoint: each old alias root has to map to a single new root.
+    // Splitting memory that could now be shared is harmless, and new textures get
+    // dedicated memory.
+    const auto aliasRoots = buildAliasedTextureRoots();
+    const std::unordered_set<RGPResourceHandler> addedTextureSet(addedTextures.begin(), addedTextures.end());
+    const auto rootOf = [](const std::unordered_map<RGPResourceHandler, RGPResourceHandler> &roots, const RGPResourceHandler &handler)
+    {
+        const auto rootIt = roots.find(handler);
+        return rootIt == roots.end() ? handler : rootIt->second;
+    };
+
+    bool aliasingChanged = false;
+    std::unordered_map<RGPResourceHandler, RGPResourceHandler> oldToNewRoot;
+    for (const auto &[handler, description] : m_renderGraphPassesBuilder.getAllTextureDescriptions())
+    {
+        if (addedTextureSet.contains(handler) || description.getIsSwapChainTarget())
+            continue;
+
+        const RGPResourceHandler oldRoot = rootOf(m_textureAliasRoots, handler);
+        const RGPResourceHandler newRoot = rootOf(aliasRoots, handler);
+
+        const auto rootIt = oldToNewRoot.emplace(oldRoot, newRoot).first;
+        if (rootIt->second != newRoot)
+        {
+            aliasingChanged = true;
+            break;
+        }
+    }
+
+    if (aliasingChanged)
+    {
+        VX_ENGINE_INFO_STREAM("Render graph topology change requires new texture aliasing, recompiling all passes\n");
+        compile();
+        for (auto &[_, pass] : m_renderGraphPasses)
+            pass.renderGraphPass->recompilationIsDone();
+        return;
+    }
+
+    for (const auto &handler : addedTextures)
+        m_textureAliasRoots[handler] = handler;
+    std::erase_if(m_textureAliasRoots, [this](const auto &entry)
+                  { return !m_renderGraphPassesBuilder.getTextureDescription(entry.first); });
+
+    auto barriers = m_renderGraphPassesCompiler.compile(addedTextures, m_renderGraphPassesBuilder, m_renderGraphPassesStorage);
+    if (!barriers.empty())
+        submitBootstrapBarriers(barriers);
+
+    std::ostringstream stream;
+    stream << "Render graph topology change, compiling passes:";
+
+    for (auto &[_, pass] : m_renderGraphPasses)
+    {
+        const bool added = std::find(addedPasses.begin(), addedPasses.end(), &pass) != addedPasses.end();
+        if (!pass.enabled || (!added && !pass.renderGraphPass->needsRecompilation()))
+            continue;
+
+        if (!added)
+            pass.renderGraphPass->freeResources();
+
+        pass.renderGraphPass->compile(m_renderGraphPassesStorage);
+        pass.renderGraphPass->recompilationIsDone();
+        stream << ' ' << '[' << pass.renderGraphPass->getDebugName() << ']';
+    }
+
+    VX_ENGINE_INFO_STREAM(stream.str() << '\n');
+
+    invalidateAllExecutionCaches();
+}
+
 void RenderGraph::registerGroup(PassGroup group)
 {
     m_passGroups[group.name] = std::move(group);
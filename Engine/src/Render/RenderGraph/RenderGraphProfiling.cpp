@@ -111,6 +111,21 @@ void RenderGraphProfiling::destroyTimestampQueryPool()
     m_isGpuTimingAvailable = false;
 }
 
+void RenderGraphProfiling::setRenderGraphPassCount(uint32_t renderGraphPassSize)
+{
+    if (renderGraphPassSize <= m_renderGraphPassesSize)
+        return;
+
+    m_renderGraphPassesSize = renderGraphPassSize;
+
+    if (m_timestampQueryPool != VK_NULL_HANDLE)
+    {
+        for (auto &framePassProfilingData : m_passExecutionProfilingDataByFrame)
+            framePassProfilingData.clear();
+        initTimestampQueryPool();
+    }
+}
+
 void RenderGraphProfiling::resolveFrameProfilingData(uint32_t frameIndex)
 {
     const auto &passExecutionProfilingData = m_passExecutionProfilingDataByFrame[frameIndex];
@@ -6,11 +6,47 @@
 #include "Engine/Utilities/BufferUtilities.hpp"
 #include "Engine/Utilities/AsyncGpuUpload.hpp"
 
+#include <algorithm>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+UnifiedGeometryBuffer::IndexStorage::SharedPtr UnifiedGeometryBuffer::IndexStorage::create(uint32_t maxIndices)
+{
+    if (maxIndices == 0)
+        return nullptr;
+
+    constexpr VkBufferUsageFlags indexUsage =
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    auto storage = std::make_shared<IndexStorage>();
+    storage->buffer = core::Buffer::createShared(static_cast<VkDeviceSize>(maxIndices) * sizeof(uint32_t), indexUsage, core::memory::MemoryUsage::GPU_ONLY);
+    if (!storage->buffer)
+    {
+        VX_ENGINE_ERROR_STREAM("UnifiedGeometryBuffer::IndexStorage – failed to allocate GPU index buffer");
+        return nullptr;
+    }
+
+    storage->allocator.init(maxIndices);
+    return storage;
+}
+
 void UnifiedGeometryBuffer::init(uint32_t vertexStride, VkDeviceSize maxVertexBytes, uint32_t maxIndices)
 {
-    if (vertexStride == 0 || maxVertexBytes == 0 || maxIndices == 0)
+    if (maxIndices == 0)
+    {
+        VX_ENGINE_ERROR_STREAM("UnifiedGeometryBuffer::init – invalid parameters");
+        return;
+    }
+
+    init(vertexStride, maxVertexBytes, IndexStorage::create(maxIndices));
+}
+
+void UnifiedGeometryBuffer::init(uint32_t vertexStride, VkDeviceSize maxVertexBytes, IndexStorage::SharedPtr indexStorage)
+{
+    if (vertexStride == 0 || maxVertexBytes == 0 || !indexStorage)
     {
         VX_ENGINE_ERROR_STREAM("UnifiedGeometryBuffer::init – invalid parameters");
         return;
@@ -18,36 +54,37 @@ void UnifiedGeometryBuffer::init(uint32_t vertexStride, VkDeviceSize maxVertexBy
 
     m_vertexStride = vertexStride;
     m_maxVertexBytes = maxVertexBytes;
-    m_maxIndices = maxIndices;
-    m_vertexBytesUsed = 0;
-    m_indicesUsed = 0;
 
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_vertexAllocator.init(maxVertexBytes / vertexStride);
+        m_pendingReleases.clear();
+    }
+
+    // TRANSFER_SRC: compaction copies live ranges within the same buffer.
     constexpr VkBufferUsageFlags vertexUsage =
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
         VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
         VK_BUFFER_USAGE_STORAGE_BUFFER_BIT; // for future compute culling
 
-    constexpr VkBufferUsageFlags indexUsage =
-        VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
-        VK_BUFFER_USAGE_TRANSFER_DST_BIT |
-        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-
     m_vertexBuffer = core::Buffer::createShared(maxVertexBytes, vertexUsage, core::memory::MemoryUsage::GPU_ONLY);
-    m_indexBuffer = core::Buffer::createShared(static_cast<VkDeviceSize>(maxIndices) * sizeof(uint32_t), indexUsage, core::memory::MemoryUsage::GPU_ONLY);
+    m_indexStorage = std::move(indexStorage);
 
-    if (!m_vertexBuffer || !m_indexBuffer)
+    if (!m_vertexBuffer)
     {
         VX_ENGINE_ERROR_STREAM("UnifiedGeometryBuffer::init – failed to allocate GPU buffers");
         m_vertexBuffer = nullptr;
-        m_indexBuffer = nullptr;
+        m_indexStorage = nullptr;
     }
 }
 
 bool UnifiedGeometryBuffer::registerMesh(const uint8_t *vertexData, VkDeviceSize vertexBytes,
                                          const uint32_t *indexData, uint32_t indexCount,
-                                         int32_t &outVertexOffset, uint32_t &outFirstIndex)
+                                         int32_t &outVertexOffset, uint32_t &outFirstIndex,
+                                         MeshAllocation &outAllocation)
 {
-    if (!m_vertexBuffer || !m_indexBuffer)
+    if (!isInitialized())
         return false;
     if (!vertexData || vertexBytes == 0 || !indexData || indexCount == 0)
         return false;
@@ -58,60 +95,242 @@ bool UnifiedGeometryBuffer::registerMesh(const uint8_t *vertexData, VkDeviceSize
 
     std::unique_lock<std::mutex> lock(m_mutex);
 
-    if (m_vertexBytesUsed + vertexBytes > m_maxVertexBytes)
+    const auto vertexAllocation = m_vertexAllocator.allocate(vertexBytes / m_vertexStride);
+    if (!vertexAllocation.isValid())
     {
-        VX_ENGINE_WARNING_STREAM("UnifiedGeometryBuffer: vertex buffer full ("
-                                 << m_vertexBytesUsed << "/" << m_maxVertexBytes << " bytes used)");
+        const auto statistics = m_vertexAllocator.getStatistics();
+        VX_ENGINE_WARNING_STREAM("UnifiedGeometryBuffer: no vertex range for " << vertexBytes / m_vertexStride << " vertices ("
+                                 << statistics.usedSize << "/" << statistics.capacity << " used, largest free range "
+                                 << statistics.largestFreeRange << ")");
         return false;
     }
-    if (m_indicesUsed + indexCount > m_maxIndices)
+
+    std::unique_lock<std::mutex> indexLock(m_indexStorage->mutex);
+
+    const auto indexAllocation = m_indexStorage->allocator.allocate(indexCount);
+    if (!indexAllocation.isValid())
     {
-        VX_ENGINE_WARNING_STREAM("UnifiedGeometryBuffer: index buffer full ("
-                                 << m_indicesUsed << "/" << m_maxIndices << " indices used)");
+        m_vertexAllocator.free(vertexAllocation.id);
+
+        const auto statistics = m_indexStorage->allocator.getStatistics();
+        VX_ENGINE_WARNING_STREAM("UnifiedGeometryBuffer: no index range for " << indexCount << " indices ("
+                                 << statistics.usedSize << "/" << statistics.capacity << " used, largest free range "
+                                 << statistics.largestFreeRange << ")");
         return false;
     }
 
-    const VkDeviceSize vertexDstOffset = m_vertexBytesUsed;
-    const uint32_t firstIndex = m_indicesUsed;
-    const int32_t vertexOffset = static_cast<int32_t>(m_vertexBytesUsed / m_vertexStride);
+    const VkDeviceSize vertexDstOffset = vertexAllocation.offset * m_vertexStride;
+    const uint32_t firstIndex = static_cast<uint32_t>(indexAllocation.offset);
+    const int32_t vertexOffset = static_cast<int32_t>(vertexAllocation.offset);
 
-    m_vertexBytesUsed += vertexBytes;
-    m_indicesUsed += indexCount;
+    const uint64_t uploadFrame = m_frameCounter;
 
+    indexLock.unlock();
     lock.unlock();
 
-    // Upload vertex data via staging buffer
+    // Upload vertex and index data via staging buffers. One submission, so a single
+    // timeline value tells when the mesh is resident (see relocateMesh()).
+    auto stagingVB = core::Buffer::createShared(vertexBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, core::memory::MemoryUsage::CPU_TO_GPU);
+    stagingVB->upload(vertexData, vertexBytes);
+
+    auto stagingIB = core::Buffer::createShared(indexBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, core::memory::MemoryUsage::CPU_TO_GPU);
+    stagingIB->upload(indexData, indexBytes);
+
+    auto cmd = core::CommandBuffer::createShared(*core::VulkanContext::getContext()->getGraphicsCommandPool());
+    cmd->begin();
+    utilities::BufferUtilities::copyBufferRegion(*stagingVB, *m_vertexBuffer, *cmd,
+                                                 vertexBytes, 0, vertexDstOffset);
+    utilities::BufferUtilities::copyBufferRegion(*stagingIB, *m_indexStorage->buffer, *cmd,
+                                                 indexBytes, 0,
+                                                 static_cast<VkDeviceSize>(firstIndex) * sizeof(uint32_t));
+    cmd->end();
+
+    uint64_t uploadCompletionValue = 0u;
+    utilities::AsyncGpuUpload::submit(cmd, core::VulkanContext::getContext()->getGraphicsQueue(), {stagingVB, stagingIB},
+                                      &uploadCompletionValue);
+
+    outVertexOffset = vertexOffset;
+    outFirstIndex = firstIndex;
+    outAllocation.vertexAllocation = vertexAllocation.id;
+    outAllocation.indexAllocation = indexAllocation.id;
+    outAllocation.uploadCompletionValue = uploadCompletionValue;
+    outAllocation.uploadFrame = uploadFrame;
+    return true;
+}
+
+void UnifiedGeometryBuffer::releaseMesh(const MeshAllocation &allocation)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pendingReleases.push_back(PendingRelease{.allocation = allocation, .releaseFrame = m_frameCounter + RELEASE_FRAME_LATENCY});
+}
+
+void UnifiedGeometryBuffer::advanceFrame()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_frameCounter;
+
+    auto expiredIt = std::partition(m_pendingReleases.begin(), m_pendingReleases.end(),
+                                    [this](const PendingRelease &pendingRelease)
+                                    { return pendingRelease.releaseFrame > m_frameCounter; });
+
+    if (expiredIt != m_pendingReleases.end())
     {
-        auto stagingVB = core::Buffer::createShared(vertexBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, core::memory::MemoryUsage::CPU_TO_GPU);
-        stagingVB->upload(vertexData, vertexBytes);
+        std::lock_guard<std::mutex> indexLock(m_indexStorage->mutex);
+        for (auto it = expiredIt; it != m_pendingReleases.end(); ++it)
+        {
+            m_vertexAllocator.free(it->allocation.vertexAllocation);
+            m_indexStorage->allocator.free(it->allocation.indexAllocation);
+        }
+    }
 
-        auto cmd = core::CommandBuffer::createShared(*core::VulkanContext::getContext()->getGraphicsCommandPool());
-        cmd->begin();
-        utilities::BufferUtilities::copyBufferRegion(*stagingVB, *m_vertexBuffer, *cmd,
-                                                     vertexBytes, 0, vertexDstOffset);
-        cmd->end();
+    m_pendingReleases.erase(expiredIt, m_pendingReleases.end());
+}
 
-        utilities::AsyncGpuUpload::submit(cmd, core::VulkanContext::getContext()->getGraphicsQueue(), {stagingVB});
+bool UnifiedGeometryBuffer::relocateMesh(MeshAllocation &allocation, core::CommandBuffer::SharedPtr &commandBuffer,
+                                         int32_t &outVertexOffset, uint32_t &outFirstIndex)
+{
+    if (!isInitialized() || !allocation.isValid())
+        return false;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // Leave meshes alone until their upload finished, so compaction never chains onto work still in flight.
+    if (!isUploadComplete(allocation))
+        return false;
+
+    std::unique_lock<std::mutex> indexLock(m_indexStorage->mutex);
+
+    const auto oldVertexAllocation = m_vertexAllocator.getAllocation(allocation.vertexAllocation);
+    const auto oldIndexAllocation = m_indexStorage->allocator.getAllocation(allocation.indexAllocation);
+    if (!oldVertexAllocation.isValid() || !oldIndexAllocation.isValid())
+        return false;
+
+    // The old ranges stay allocated until released, so new ranges never overlap them
+    // and the copy source is intact for frames still in flight.
+    const auto newVertexAllocation = m_vertexAllocator.allocateLowest(oldVertexAllocation.size, oldVertexAllocation.offset);
+    const auto newIndexAllocation = m_indexStorage->allocator.allocateLowest(oldIndexAllocation.size, oldIndexAllocation.offset);
+    if (!newVertexAllocation.isValid() && !newIndexAllocation.isValid())
+        return false;
+
+    MeshAllocation retired{};
+
+    if (newVertexAllocation.isValid())
+    {
+        retired.vertexAllocation = oldVertexAllocation.id;
+        allocation.vertexAllocation = newVertexAllocation.id;
+    }
+
+    if (newIndexAllocation.isValid())
+    {
+        retired.indexAllocation = oldIndexAllocation.id;
+        allocation.indexAllocation = newIndexAllocation.id;
     }
 
-    // Upload index data via staging buffer
+    m_pendingReleases.push_back(PendingRelease{.allocation = retired, .releaseFrame = m_frameCounter + RELEASE_FRAME_LATENCY});
+    ++m_relocatedMeshes;
+
+    // The caller stamps uploadCompletionValue once the relocation batch is submitted.
+    allocation.uploadCompletionValue = 0u;
+    allocation.uploadFrame = m_frameCounter;
+
+    indexLock.unlock();
+    lock.unlock();
+
+    if (!commandBuffer)
+        commandBuffer = beginRelocationCommands();
+
+    if (newVertexAllocation.isValid())
+        utilities::BufferUtilities::copyBufferRegion(*m_vertexBuffer, *m_vertexBuffer, *commandBuffer,
+                                                     oldVertexAllocation.size * m_vertexStride,
+                                                     oldVertexAllocation.offset * m_vertexStride,
+                                                     newVertexAllocation.offset * m_vertexStride);
+
+    if (newIndexAllocation.isValid())
+        utilities::BufferUtilities::copyBufferRegion(*m_indexStorage->buffer, *m_indexStorage->buffer, *commandBuffer,
+                                                     oldIndexAllocation.size * sizeof(uint32_t),
+                                                     oldIndexAllocation.offset * sizeof(uint32_t),
+                                                     newIndexAllocation.offset * sizeof(uint32_t));
+
+    outVertexOffset = static_cast<int32_t>(newVertexAllocation.isValid() ? newVertexAllocation.offset : oldVertexAllocation.offset);
+    outFirstIndex = static_cast<uint32_t>(newIndexAllocation.isValid() ? newIndexAllocation.offset : oldIndexAllocation.offset);
+    return true;
+}
+
+uint32_t UnifiedGeometryBuffer::verticesUsed() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<uint32_t>(m_vertexAllocator.getStatistics().usedSize);
+}
+
+uint32_t UnifiedGeometryBuffer::indicesUsed() const
+{
+    if (!m_indexStorage)
+        return 0u;
+
+    std::lock_guard<std::mutex> lock(m_indexStorage->mutex);
+    return static_cast<uint32_t>(m_indexStorage->allocator.getStatistics().usedSize);
+}
+
+UnifiedGeometryBuffer::Statistics UnifiedGeometryBuffer::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Statistics statistics{};
+    statistics.vertices = m_vertexAllocator.getStatistics();
+    if (m_indexStorage)
     {
-        auto stagingIB = core::Buffer::createShared(indexBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, core::memory::MemoryUsage::CPU_TO_GPU);
-        stagingIB->upload(indexData, indexBytes);
+        std::lock_guard<std::mutex> indexLock(m_indexStorage->mutex);
+        statistics.indices = m_indexStorage->allocator.getStatistics();
+    }
+    statistics.pendingReleases = static_cast<uint32_t>(m_pendingReleases.size());
+    statistics.relocatedMeshes = m_relocatedMeshes;
+    return statistics;
+}
 
-        auto cmd = core::CommandBuffer::createShared(*core::VulkanContext::getContext()->getGraphicsCommandPool());
-        cmd->begin();
-        utilities::BufferUtilities::copyBufferRegion(*stagingIB, *m_indexBuffer, *cmd,
-                                                     indexBytes, 0,
-                                                     static_cast<VkDeviceSize>(firstIndex) * sizeof(uint32_t));
-        cmd->end();
+bool UnifiedGeometryBuffer::submitRelocations(core::CommandBuffer::SharedPtr commandBuffer, uint64_t &outCompletionValue)
+{
+    outCompletionValue = 0u;
+    if (!commandBuffer)
+        return false;
 
-        utilities::AsyncGpuUpload::submit(cmd, core::VulkanContext::getContext()->getGraphicsQueue(), {stagingIB});
+    commandBuffer->end();
+    if (!utilities::AsyncGpuUpload::submit(commandBuffer, core::VulkanContext::getContext()->getGraphicsQueue(), {}, &outCompletionValue))
+    {
+        VX_ENGINE_ERROR_STREAM("UnifiedGeometryBuffer – failed to submit relocation copies");
+        return false;
     }
 
-    outVertexOffset = vertexOffset;
-    outFirstIndex = firstIndex;
     return true;
 }
 
+bool UnifiedGeometryBuffer::isUploadComplete(const MeshAllocation &allocation) const
+{
+    if (allocation.uploadCompletionValue > 0u)
+        return utilities::AsyncGpuUpload::isComplete(allocation.uploadCompletionValue);
+
+    // No timeline value: the frames in flight have retired since the submission.
+    return m_frameCounter >= allocation.uploadFrame + RELEASE_FRAME_LATENCY;
+}
+
+core::CommandBuffer::SharedPtr UnifiedGeometryBuffer::beginRelocationCommands()
+{
+    auto commandBuffer = core::CommandBuffer::createShared(*core::VulkanContext::getContext()->getGraphicsCommandPool());
+    commandBuffer->begin();
+
+    // Earlier uploads and relocations on the queue write the ranges copied here, and
+    // submission order alone does not make those writes visible to the copy.
+    VkMemoryBarrier2 barrier{VK_STRUCTURE_TYPE_MEMORY_BARRIER_2};
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT;
+
+    VkDependencyInfo dependencyInfo{VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+    dependencyInfo.memoryBarrierCount = 1;
+    dependencyInfo.pMemoryBarriers = &barrier;
+    vkCmdPipelineBarrier2(commandBuffer->vk(), &dependencyInfo);
+
+    return commandBuffer;
+}
+
 ELIX_NESTED_NAMESPACE_END
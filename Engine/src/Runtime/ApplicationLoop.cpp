@@ -16,6 +16,8 @@
 #include "Engine/Render/RenderQualitySettings.hpp"
 #include "Engine/Runtime/EngineConfig.hpp"
 #include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Events/EventBus.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include "Engine/Diagnostics.hpp"
 #include "Core/Logger.hpp"
@@ -227,22 +229,51 @@ void ApplicationLoop::loop()
     float lastCacheSave = 0.0f;
     constexpr float kCacheSaveInterval = 30.0f;
 
-    while (m_window->isOpen())
-    {
-        const float currentFrame = static_cast<float>(glfwGetTime());
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
-
-        m_window->pollEvents();
-        scripting::beginFrame(deltaTime);
+    const auto &engineConfig = EngineConfig::instance();
+    m_fixedTimestep.configure(engineConfig.getPhysicsFixedRateHz(),
+                              static_cast<uint32_t>(engineConfig.getPhysicsMaxSubsteps()));
 
-        m_runtime->tick(deltaTime);
+    VX_PROFILE_THREAD_NAME("Main");
 
-        if (currentFrame - lastCacheSave >= kCacheSaveInterval)
+    while (m_window->isOpen())
+    {
         {
-            cache::GraphicsPipelineCache::saveCacheToFile(m_vulkanContext->getDevice(), m_graphicsPipelineCachePath);
-            lastCacheSave = currentFrame;
+            VX_PROFILE_SCOPE("Frame");
+
+            const float currentFrame = static_cast<float>(glfwGetTime());
+            deltaTime = currentFrame - lastFrame;
+            lastFrame = currentFrame;
+
+            m_window->pollEvents();
+            scripting::beginFrame(deltaTime);
+
+            const uint32_t fixedSteps = m_fixedTimestep.advance(deltaTime);
+            for (uint32_t step = 0; step < fixedSteps; ++step)
+            {
+                VX_PROFILE_SCOPE("FixedTick");
+                m_runtime->fixedTick(m_fixedTimestep.getFixedDelta());
+            }
+            m_runtime->setFixedStepAlpha(m_fixedTimestep.getAlpha());
+
+            // Events queued by physics, parallel scripts and worker jobs are delivered here, on the main thread.
+            {
+                VX_PROFILE_SCOPE("EventBus::flushAll");
+                EventBus::flushAll();
+            }
+
+            {
+                VX_PROFILE_SCOPE("Runtime::tick");
+                m_runtime->tick(deltaTime);
+            }
+
+            if (currentFrame - lastCacheSave >= kCacheSaveInterval)
+            {
+                cache::GraphicsPipelineCache::saveCacheToFile(m_vulkanContext->getDevice(), m_graphicsPipelineCachePath);
+                lastCacheSave = currentFrame;
+            }
         }
+
+        VX_PROFILE_FRAME_END();
     }
 }
 
@@ -198,6 +198,11 @@ bool EngineConfig::save() const
     json["ssr_strength"] = m_ssrStrength;
     json["ssr_steps"] = m_ssrSteps;
     json["ssr_roughness_cutoff"] = m_ssrRoughnessCutoff;
+    json["physics_fixed_rate_hz"] = m_physicsFixedRateHz;
+    json["physics_max_substeps"] = m_physicsMaxSubsteps;
+    json["physics_async_simulation"] = m_asyncPhysicsEnabled;
+    json["parallel_script_update"] = m_parallelScriptUpdateEnabled;
+    json["worker_thread_count"] = m_workerThreadCount;
 
     nlohmann::json pluginStates = nlohmann::json::object();
     for (const auto &[stem, enabled] : m_pluginEnabledStates)
@@ -434,6 +439,56 @@ void EngineConfig::setSSRRoughnessCutoff(float cutoff)
     m_ssrRoughnessCutoff = std::clamp(cutoff, 0.05f, 0.8f);
 }
 
+float EngineConfig::getPhysicsFixedRateHz() const
+{
+    return m_physicsFixedRateHz;
+}
+
+void EngineConfig::setPhysicsFixedRateHz(float rateHz)
+{
+    m_physicsFixedRateHz = std::clamp(rateHz, 10.0f, 480.0f);
+}
+
+int EngineConfig::getPhysicsMaxSubsteps() const
+{
+    return m_physicsMaxSubsteps;
+}
+
+void EngineConfig::setPhysicsMaxSubsteps(int substeps)
+{
+    m_physicsMaxSubsteps = std::clamp(substeps, 1, 16);
+}
+
+bool EngineConfig::getAsyncPhysicsEnabled() const
+{
+    return m_asyncPhysicsEnabled;
+}
+
+void EngineConfig::setAsyncPhysicsEnabled(bool enabled)
+{
+    m_asyncPhysicsEnabled = enabled;
+}
+
+bool EngineConfig::getParallelScriptUpdateEnabled() const
+{
+    return m_parallelScriptUpdateEnabled;
+}
+
+void EngineConfig::setParallelScriptUpdateEnabled(bool enabled)
+{
+    m_parallelScriptUpdateEnabled = enabled;
+}
+
+int EngineConfig::getWorkerThreadCount() const
+{
+    return m_workerThreadCount;
+}
+
+void EngineConfig::setWorkerThreadCount(int count)
+{
+    m_workerThreadCount = std::clamp(count, 0, 256);
+}
+
 std::optional<EngineConfig::IdeInfo> EngineConfig::findPreferredVSCodeIde() const
 {
     if (isVSCodeIdeId(m_preferredIdeId))
@@ -539,6 +594,11 @@ void EngineConfig::applyDefaults()
     m_ssrStrength = 1.0f;
     m_ssrSteps = 48;
     m_ssrRoughnessCutoff = 0.4f;
+    m_physicsFixedRateHz = 60.0f;
+    m_physicsMaxSubsteps = 4;
+    m_asyncPhysicsEnabled = false;
+    m_parallelScriptUpdateEnabled = true;
+    m_workerThreadCount = 0;
     m_pluginEnabledStates.clear();
 }
 
@@ -623,6 +683,21 @@ bool EngineConfig::loadFromDisk()
     if (json.contains("ssr_roughness_cutoff") && json["ssr_roughness_cutoff"].is_number())
         setSSRRoughnessCutoff(json["ssr_roughness_cutoff"].get<float>());
 
+    if (json.contains("physics_fixed_rate_hz") && json["physics_fixed_rate_hz"].is_number())
+        setPhysicsFixedRateHz(json["physics_fixed_rate_hz"].get<float>());
+
+    if (json.contains("physics_max_substeps") && json["physics_max_substeps"].is_number_integer())
+        setPhysicsMaxSubsteps(json["physics_max_substeps"].get<int>());
+
+    if (json.contains("physics_async_simulation") && json["physics_async_simulation"].is_boolean())
+        setAsyncPhysicsEnabled(json["physics_async_simulation"].get<bool>());
+
+    if (json.contains("parallel_script_update") && json["parallel_script_update"].is_boolean())
+        setParallelScriptUpdateEnabled(json["parallel_script_update"].get<bool>());
+
+    if (json.contains("worker_thread_count") && json["worker_thread_count"].is_number_integer())
+        setWorkerThreadCount(json["worker_thread_count"].get<int>());
+
     if (json.contains("plugin_enabled_states") && json["plugin_enabled_states"].is_object())
     {
         for (const auto &[key, value] : json["plugin_enabled_states"].items())
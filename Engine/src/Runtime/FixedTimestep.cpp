@@ -0,0 +1,40 @@
+#include "Engine/Runtime/FixedTimestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void FixedTimestep::configure(float rateHz, uint32_t maxSubsteps)
+{
+    m_fixedDelta = 1.0f / std::max(rateHz, 1.0f);
+    m_maxSubsteps = std::max(maxSubsteps, 1u);
+    m_accumulator = std::min(m_accumulator, m_fixedDelta);
+}
+
+uint32_t FixedTimestep::advance(float frameDelta)
+{
+    if (!std::isfinite(frameDelta) || frameDelta < 0.0f)
+        frameDelta = 0.0f;
+
+    m_accumulator += std::min(frameDelta, MAX_FRAME_DELTA);
+
+    uint32_t steps = static_cast<uint32_t>(m_accumulator / m_fixedDelta);
+    if (steps > m_maxSubsteps)
+    {
+        // Spiral-of-death guard: run the cap and forget the rest instead of carrying it forward.
+        m_droppedSteps += steps - m_maxSubsteps;
+        steps = m_maxSubsteps;
+        m_accumulator = std::fmod(m_accumulator, m_fixedDelta);
+        return steps;
+    }
+
+    m_accumulator -= static_cast<float>(steps) * m_fixedDelta;
+    m_accumulator = std::clamp(m_accumulator, 0.0f, m_fixedDelta);
+    if (m_accumulator >= m_fixedDelta)
+        m_accumulator = 0.0f;
+
+    return steps;
+}
+
+ELIX_NESTED_NAMESPACE_END
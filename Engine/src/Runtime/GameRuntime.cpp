@@ -8,18 +8,24 @@
 #include "Engine/Components/ReflectionProbeComponent.hpp"
 #include "Engine/Components/ScriptComponent.hpp"
 #include "Engine/Components/Transform3DComponent.hpp"
+#include "Engine/Diagnostics.hpp"
 #include "Engine/PluginSystem/PluginLoader.hpp"
 #include "Engine/PluginSystem/PluginManager.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 #include "Engine/Render/RenderQualitySettings.hpp"
+#include "Engine/Runtime/EngineConfig.hpp"
 #include "Engine/Scripting/ScriptsRegister.hpp"
 #include "Engine/SceneManager.hpp"
 #include "Engine/Scripting/VelixAPI.hpp"
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>
 #include <limits>
+#include <string_view>
 #include <system_error>
 
 #if defined(_WIN32)
@@ -36,12 +42,6 @@
 
 namespace
 {
-    template <typename TValue>
-    void hashCombine(size_t &seed, const TValue &value)
-    {
-        seed ^= std::hash<TValue>{}(value) + 0x9e3779b97f4a7c15ULL + (seed << 6u) + (seed >> 2u);
-    }
-
     std::filesystem::path normalizeAbsolutePath(const std::filesystem::path &path)
     {
         std::error_code errorCode;
@@ -207,34 +207,6 @@ namespace
                    ? settings.getAntiAliasingMode()
                    : elix::engine::RenderQualitySettings::AntiAliasingMode::NONE;
     }
-
-    size_t renderGraphTopologyHash(const elix::engine::Scene *scene)
-    {
-        const auto &settings = elix::engine::RenderQualitySettings::getInstance();
-        const auto context = elix::core::VulkanContext::getContext();
-        const bool supportsRayQuery = context && context->hasRayQuerySupport();
-        const bool supportsRayPipeline = context && context->hasRayTracingPipelineSupport();
-        const bool supportsAnyRT = supportsRayQuery || supportsRayPipeline;
-        const VkSampleCountFlagBits effectiveMsaaSamples = context
-            ? context->getEffectiveMsaaSampleCount(settings.getRequestedMsaaSampleCount())
-            : VK_SAMPLE_COUNT_1_BIT;
-
-        size_t seed = 0u;
-        hashCombine(seed, settings.enablePostProcessing);
-        hashCombine(seed, settings.enableRayTracing && settings.enableRTShadows && supportsAnyRT);
-        hashCombine(seed, settings.enableRayTracing && settings.enableRTReflections && supportsAnyRT);
-        hashCombine(seed, settings.enableRayTracing && settings.enableRTAO && supportsRayQuery);
-        hashCombine(seed, static_cast<uint32_t>(effectiveMsaaSamples));
-        hashCombine(seed, static_cast<uint32_t>(renderGraphAntiAliasingMode(settings)));
-        hashCombine(seed, renderGraphUsesSSR(settings));
-        hashCombine(seed, renderGraphUsesVolumetricFog(settings, scene));
-        hashCombine(seed, static_cast<uint32_t>(settings.volumetricFogQuality));
-        hashCombine(seed, settings.overrideVolumetricFogSceneSetting);
-        hashCombine(seed, settings.volumetricFogOverrideEnabled);
-        hashCombine(seed, renderGraphUsesParticles(scene));
-        hashCombine(seed, renderGraphUsesUI(scene));
-        return seed;
-    }
 } // namespace
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -315,7 +287,23 @@ bool GameRuntime::init()
     scripting::setActiveScene(m_scene.get());
 
     initRenderGraph();
-    m_renderGraphTopologyHash = renderGraphTopologyHash(m_scene.get());
+
+    for (const auto &argument : m_args)
+    {
+        const std::string lowerArgument = toLowerCopy(argument);
+        if (lowerArgument == "--render-graph-hitch-benchmark")
+            m_hitchBenchmark = std::make_unique<RenderGraphHitchBenchmark>();
+
+        // --cpu-trace=<frames>: capture that many frames and write a Chrome trace next to the logs.
+        constexpr std::string_view cpuTracePrefix = "--cpu-trace=";
+        if (lowerArgument.rfind(cpuTracePrefix, 0) == 0)
+        {
+            const int frameCount = std::atoi(lowerArgument.c_str() + cpuTracePrefix.size());
+            const auto tracePath = diagnostics::ensureLogsDirectory() / "cpu_trace.json";
+            if (frameCount > 0)
+                profiling::CpuProfiler::requestCapture(static_cast<uint32_t>(frameCount), tracePath.string());
+        }
+    }
 
     forEachScriptComponent([](ScriptComponent *scriptComponent)
                            {
@@ -328,6 +316,21 @@ bool GameRuntime::init()
     return true;
 }
 
+void GameRuntime::fixedTick(float fixedDelta)
+{
+    if (!m_initialized || !m_scene)
+        return;
+
+    m_scene->setAsyncPhysicsEnabled(EngineConfig::instance().getAsyncPhysicsEnabled());
+    m_scene->fixedUpdate(fixedDelta);
+}
+
+void GameRuntime::setFixedStepAlpha(float alpha)
+{
+    if (m_scene)
+        m_scene->setPhysicsInterpolationAlpha(alpha);
+}
+
 void GameRuntime::tick(float deltaTime)
 {
     if (!m_initialized || !m_scene || !m_renderGraph)
@@ -337,20 +340,26 @@ void GameRuntime::tick(float deltaTime)
 
     if (SceneManager::instance().hasPendingRequests())
     {
-        forEachScriptComponent([](ScriptComponent *scriptComponent)
-                               {
-                                   if (scriptComponent)
-                                       scriptComponent->onDetach(); });
-
-        SceneManager::instance().processRequests(m_scene, [this](std::shared_ptr<Scene> /*newScene*/)
-                                                 { bindSceneToPasses(); });
-
-        forEachScriptComponent([](ScriptComponent *scriptComponent)
-                               {
-                                   if (scriptComponent)
-                                       scriptComponent->onAttach(); });
+        SceneManager::instance().processRequests(
+            m_scene,
+            [this](std::shared_ptr<Scene> /*newScene*/)
+            {
+                bindSceneToPasses();
+                forEachScriptComponent([](ScriptComponent *scriptComponent)
+                                       {
+                                           if (scriptComponent)
+                                               scriptComponent->onAttach(); });
+            },
+            [this](std::shared_ptr<Scene> /*oldScene*/)
+            {
+                forEachScriptComponent([](ScriptComponent *scriptComponent)
+                                       {
+                                           if (scriptComponent)
+                                               scriptComponent->onDetach(); });
+            });
     }
 
+    m_scene->setParallelScriptUpdateEnabled(EngineConfig::instance().getParallelScriptUpdateEnabled());
     m_scene->update(deltaTime);
 
     refreshActiveCamera();
@@ -360,11 +369,22 @@ void GameRuntime::tick(float deltaTime)
     if (m_shadowRenderGraphPass)
         m_shadowRenderGraphPass->syncQualitySettings();
 
-    const size_t currentTopologyHash = renderGraphTopologyHash(m_scene.get());
-    if (currentTopologyHash != m_renderGraphTopologyHash)
+    if (m_hitchBenchmark)
+        m_hitchBenchmark->update(deltaTime);
+
+    const RenderGraphFeatures currentFeatures = captureRenderGraphFeatures(m_scene.get());
+    if (!(currentFeatures == m_renderGraphFeatures))
     {
-        initRenderGraph();
-        m_renderGraphTopologyHash = currentTopologyHash;
+        const RenderGraphStage firstStage = firstChangedStage(m_renderGraphFeatures, currentFeatures);
+        m_renderGraphFeatures = currentFeatures;
+
+        const auto rebuildStart = std::chrono::steady_clock::now();
+        rebuildRenderGraph(firstStage);
+        const double rebuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - rebuildStart).count();
+
+        VX_ENGINE_INFO_STREAM("Render graph rebuilt from stage " << static_cast<uint32_t>(firstStage) << " in " << rebuildMs << " ms\n");
+        if (m_hitchBenchmark)
+            m_hitchBenchmark->recordRebuild(rebuildMs);
     }
 
     syncNearestReflectionProbe(m_lightingRenderGraphPass, m_scene.get(), m_renderCamera);
@@ -373,6 +393,54 @@ void GameRuntime::tick(float deltaTime)
     m_renderGraph->draw();
 }
 
+GameRuntime::RenderGraphFeatures GameRuntime::captureRenderGraphFeatures(const Scene *scene)
+{
+    const auto &settings = RenderQualitySettings::getInstance();
+    const auto context = core::VulkanContext::getContext();
+    const bool supportsRayQuery = context && context->hasRayQuerySupport();
+    const bool supportsRayPipeline = context && context->hasRayTracingPipelineSupport();
+    const bool supportsAnyRT = supportsRayQuery || supportsRayPipeline;
+
+    RenderGraphFeatures features{};
+    features.msaaSamples = static_cast<uint32_t>(context
+                                                     ? context->getEffectiveMsaaSampleCount(settings.getRequestedMsaaSampleCount())
+                                                     : VK_SAMPLE_COUNT_1_BIT);
+    features.rtShadows = settings.enableRayTracing && settings.enableRTShadows && supportsAnyRT;
+    features.rtao = settings.enableRayTracing && settings.enableRTAO && supportsRayQuery;
+    features.ssr = renderGraphUsesSSR(settings);
+    features.rtReflections = settings.enableRayTracing && settings.enableRTReflections && supportsAnyRT;
+    features.volumetricFog = renderGraphUsesVolumetricFog(settings, scene);
+    features.volumetricFogQuality = settings.volumetricFogQuality;
+    features.particles = renderGraphUsesParticles(scene);
+    features.postProcessing = settings.enablePostProcessing;
+    features.antiAliasing = renderGraphAntiAliasingMode(settings);
+    features.ui = renderGraphUsesUI(scene);
+    return features;
+}
+
+GameRuntime::RenderGraphStage GameRuntime::firstChangedStage(const RenderGraphFeatures &previous, const RenderGraphFeatures &current)
+{
+    if (previous.msaaSamples != current.msaaSamples)
+        return RenderGraphStage::Core;
+    if (previous.rtShadows != current.rtShadows || previous.rtao != current.rtao)
+        return RenderGraphStage::Lighting;
+    if (previous.ssr != current.ssr)
+        return RenderGraphStage::ScreenSpaceReflections;
+    if (previous.rtReflections != current.rtReflections)
+        return RenderGraphStage::RayTracedReflections;
+    if (previous.volumetricFog != current.volumetricFog || previous.volumetricFogQuality != current.volumetricFogQuality)
+        return RenderGraphStage::VolumetricFog;
+    if (previous.particles != current.particles)
+        return RenderGraphStage::Particles;
+    if (previous.postProcessing != current.postProcessing)
+        return RenderGraphStage::PostProcess;
+    if (previous.antiAliasing != current.antiAliasing)
+        return RenderGraphStage::AntiAliasing;
+    if (previous.ui != current.ui)
+        return RenderGraphStage::UI;
+    return RenderGraphStage::None;
+}
+
 void GameRuntime::initRenderGraph()
 {
     if (m_renderGraph)
@@ -408,97 +476,186 @@ void GameRuntime::initRenderGraph()
     m_uiRenderGraphPass = nullptr;
     m_presentRenderGraphPass = nullptr;
 
+    m_renderGraphFeatures = captureRenderGraphFeatures(m_scene.get());
+    addRenderGraphPasses(RenderGraphStage::Core);
+
+    bindSceneToPasses();
+
+    m_renderGraph->setup();
+    m_renderGraph->createRenderGraphResources();
+    m_lastExtent = {0u, 0u};
+    syncViewportExtent();
+}
+
+void GameRuntime::rebuildRenderGraph(RenderGraphStage firstStage)
+{
+    if (!m_renderGraph || firstStage == RenderGraphStage::None)
+        return;
+
+    removeRenderGraphPasses(firstStage);
+    addRenderGraphPasses(firstStage);
+    bindSceneToPasses();
+
+    // Size the new passes before they are set up; kept passes already have the extent.
+    if (m_lastExtent.width > 0u && m_lastExtent.height > 0u)
+        applyViewportExtent(m_lastExtent, firstStage);
+
+    m_renderGraph->applyTopologyChanges();
+}
+
+void GameRuntime::removeRenderGraphPasses(RenderGraphStage firstStage)
+{
+    const auto remove = [this]<typename TPass>(TPass *&pass)
+    {
+        if (!pass)
+            return;
+
+        m_renderGraph->removePass<TPass>();
+        pass = nullptr;
+    };
+
+    // Downstream first, so no pass outlives the textures it reads for longer than needed.
+    if (firstStage <= RenderGraphStage::UI)
+    {
+        remove(m_presentRenderGraphPass);
+        remove(m_uiRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::AntiAliasing)
+    {
+        remove(m_taaRenderGraphPass);
+        remove(m_smaaRenderGraphPass);
+        remove(m_fxaaRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::PostProcess)
+    {
+        remove(m_bloomCompositeRenderGraphPass);
+        remove(m_tonemapRenderGraphPass);
+        remove(m_bloomRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::Particles)
+        remove(m_particleRenderGraphPass);
+    if (firstStage <= RenderGraphStage::VolumetricFog)
+    {
+        remove(m_volumetricFogCompositeRenderGraphPass);
+        remove(m_volumetricFogTemporalRenderGraphPass);
+        remove(m_volumetricFogLightingRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::RayTracedReflections)
+    {
+        remove(m_rtReflectionDenoiseRenderGraphPass);
+        remove(m_rtReflectionsRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::ScreenSpaceReflections)
+        remove(m_ssrRenderGraphPass);
+    if (firstStage <= RenderGraphStage::Lighting)
+    {
+        remove(m_skyLightRenderGraphPass);
+        remove(m_contactShadowRenderGraphPass);
+        remove(m_lightingRenderGraphPass);
+        remove(m_decalRenderGraphPass);
+        remove(m_rtaoDenoiseRenderGraphPass);
+        remove(m_rtaoRenderGraphPass);
+        remove(m_rtShadowDenoiseRenderGraphPass);
+        remove(m_rtShadowsRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::Core)
+    {
+        remove(m_ssaoRenderGraphPass);
+        remove(m_shadowRenderGraphPass);
+        remove(m_gBufferRenderGraphPass);
+        remove(m_depthPrepassRenderGraphPass);
+    }
+}
+
+void GameRuntime::addRenderGraphPasses(RenderGraphStage firstStage)
+{
     const auto &settings = RenderQualitySettings::getInstance();
-    const auto context = core::VulkanContext::getContext();
-    const bool supportsRayQuery = context && context->hasRayQuerySupport();
-    const bool supportsRayPipeline = context && context->hasRayTracingPipelineSupport();
-    const bool supportsAnyRT = supportsRayQuery || supportsRayPipeline;
-    const bool useRTShadows = settings.enableRayTracing && settings.enableRTShadows && supportsAnyRT;
-    const bool useRTAO = settings.enableRayTracing && settings.enableRTAO && supportsRayQuery;
-    const bool useRTReflections = settings.enableRayTracing && settings.enableRTReflections && supportsAnyRT;
-    const bool useSSR = renderGraphUsesSSR(settings);
-    const bool useVolumetricFog = renderGraphUsesVolumetricFog(settings, m_scene.get());
-    const bool useParticles = renderGraphUsesParticles(m_scene.get());
-    const bool useUI = renderGraphUsesUI(m_scene.get());
-    const auto aaMode = renderGraphAntiAliasingMode(settings);
+    const auto &features = m_renderGraphFeatures;
 
-    m_gBufferRenderGraphPass = m_renderGraph->addPass<renderGraph::GBufferRenderGraphPass>(false);
-    m_shadowRenderGraphPass = m_renderGraph->addPass<renderGraph::ShadowRenderGraphPass>();
+    if (firstStage <= RenderGraphStage::Core)
+    {
+        m_gBufferRenderGraphPass = m_renderGraph->addPass<renderGraph::GBufferRenderGraphPass>(false);
+        m_shadowRenderGraphPass = m_renderGraph->addPass<renderGraph::ShadowRenderGraphPass>();
 
-    m_ssaoRenderGraphPass = m_renderGraph->addPass<renderGraph::SSAORenderGraphPass>(
-        m_gBufferRenderGraphPass->getDepthTextureHandler(),
-        m_gBufferRenderGraphPass->getNormalTextureHandlers());
+        m_ssaoRenderGraphPass = m_renderGraph->addPass<renderGraph::SSAORenderGraphPass>(
+            m_gBufferRenderGraphPass->getDepthTextureHandler(),
+            m_gBufferRenderGraphPass->getNormalTextureHandlers());
+    }
 
-    if (useRTShadows)
+    if (firstStage <= RenderGraphStage::Lighting)
     {
-        m_rtShadowsRenderGraphPass = m_renderGraph->addPass<renderGraph::RTShadowsRenderGraphPass>(
-            m_gBufferRenderGraphPass->getNormalTextureHandlers(),
-            m_gBufferRenderGraphPass->getDepthTextureHandler());
-        m_rtShadowDenoiseRenderGraphPass = m_renderGraph->addPass<renderGraph::RTShadowDenoiseRenderGraphPass>(
-            m_rtShadowsRenderGraphPass->getOutput(),
+        if (features.rtShadows)
+        {
+            m_rtShadowsRenderGraphPass = m_renderGraph->addPass<renderGraph::RTShadowsRenderGraphPass>(
+                m_gBufferRenderGraphPass->getNormalTextureHandlers(),
+                m_gBufferRenderGraphPass->getDepthTextureHandler());
+            m_rtShadowDenoiseRenderGraphPass = m_renderGraph->addPass<renderGraph::RTShadowDenoiseRenderGraphPass>(
+                m_rtShadowsRenderGraphPass->getOutput(),
+                m_gBufferRenderGraphPass->getNormalTextureHandlers(),
+                m_gBufferRenderGraphPass->getDepthTextureHandler());
+        }
+
+        if (features.rtao)
+        {
+            m_rtaoRenderGraphPass = m_renderGraph->addPass<renderGraph::RTAORenderGraphPass>(
+                m_gBufferRenderGraphPass->getDepthTextureHandler(),
+                m_gBufferRenderGraphPass->getNormalTextureHandlers(),
+                m_ssaoRenderGraphPass->getAOHandlers());
+
+            m_rtaoDenoiseRenderGraphPass = m_renderGraph->addPass<renderGraph::RTAODenoiseRenderGraphPass>(
+                m_rtaoRenderGraphPass->getAOHandlers(),
+                m_gBufferRenderGraphPass->getNormalTextureHandlers(),
+                m_gBufferRenderGraphPass->getDepthTextureHandler());
+        }
+
+        m_decalRenderGraphPass = m_renderGraph->addPass<renderGraph::DecalRenderGraphPass>(
+            m_gBufferRenderGraphPass->getAlbedoTextureHandlers(),
             m_gBufferRenderGraphPass->getNormalTextureHandlers(),
+            m_gBufferRenderGraphPass->getMaterialTextureHandlers(),
+            m_gBufferRenderGraphPass->getEmissiveTextureHandlers(),
             m_gBufferRenderGraphPass->getDepthTextureHandler());
-    }
 
-    if (useRTAO)
-    {
-        m_rtaoRenderGraphPass = m_renderGraph->addPass<renderGraph::RTAORenderGraphPass>(
+        auto *rtShadowHandlers = m_rtShadowDenoiseRenderGraphPass ? &m_rtShadowDenoiseRenderGraphPass->getOutput() : nullptr;
+        auto *aoHandlers = m_rtaoDenoiseRenderGraphPass ? &m_rtaoDenoiseRenderGraphPass->getOutput()
+                         : (m_rtaoRenderGraphPass        ? &m_rtaoRenderGraphPass->getAOHandlers()
+                         :                                  &m_ssaoRenderGraphPass->getAOHandlers());
+
+        m_lightingRenderGraphPass = m_renderGraph->addPass<renderGraph::LightingRenderGraphPass>(
+            m_shadowRenderGraphPass->getDirectionalShadowHandler(),
             m_gBufferRenderGraphPass->getDepthTextureHandler(),
+            m_shadowRenderGraphPass->getCubeShadowHandler(),
+            m_shadowRenderGraphPass->getSpotShadowHandler(),
+            m_gBufferRenderGraphPass->getAlbedoTextureHandlers(),
             m_gBufferRenderGraphPass->getNormalTextureHandlers(),
-            m_ssaoRenderGraphPass->getAOHandlers());
+            m_gBufferRenderGraphPass->getMaterialTextureHandlers(),
+            m_gBufferRenderGraphPass->getEmissiveTextureHandlers(),
+            rtShadowHandlers,
+            aoHandlers);
 
-        m_rtaoDenoiseRenderGraphPass = m_renderGraph->addPass<renderGraph::RTAODenoiseRenderGraphPass>(
-            m_rtaoRenderGraphPass->getAOHandlers(),
+        m_contactShadowRenderGraphPass = m_renderGraph->addPass<renderGraph::ContactShadowRenderGraphPass>(
+            m_lightingRenderGraphPass->getOutput(),
             m_gBufferRenderGraphPass->getNormalTextureHandlers(),
             m_gBufferRenderGraphPass->getDepthTextureHandler());
-    }
 
-    m_decalRenderGraphPass = m_renderGraph->addPass<renderGraph::DecalRenderGraphPass>(
-        m_gBufferRenderGraphPass->getAlbedoTextureHandlers(),
-        m_gBufferRenderGraphPass->getNormalTextureHandlers(),
-        m_gBufferRenderGraphPass->getMaterialTextureHandlers(),
-        m_gBufferRenderGraphPass->getEmissiveTextureHandlers(),
-        m_gBufferRenderGraphPass->getDepthTextureHandler());
-    m_decalRenderGraphPass->setScene(m_scene.get());
-
-    auto *rtShadowHandlers = m_rtShadowDenoiseRenderGraphPass ? &m_rtShadowDenoiseRenderGraphPass->getOutput() : nullptr;
-    auto *aoHandlers = m_rtaoDenoiseRenderGraphPass ? &m_rtaoDenoiseRenderGraphPass->getOutput()
-                     : (m_rtaoRenderGraphPass        ? &m_rtaoRenderGraphPass->getAOHandlers()
-                     :                                  &m_ssaoRenderGraphPass->getAOHandlers());
-
-    m_lightingRenderGraphPass = m_renderGraph->addPass<renderGraph::LightingRenderGraphPass>(
-        m_shadowRenderGraphPass->getDirectionalShadowHandler(),
-        m_gBufferRenderGraphPass->getDepthTextureHandler(),
-        m_shadowRenderGraphPass->getCubeShadowHandler(),
-        m_shadowRenderGraphPass->getSpotShadowHandler(),
-        m_gBufferRenderGraphPass->getAlbedoTextureHandlers(),
-        m_gBufferRenderGraphPass->getNormalTextureHandlers(),
-        m_gBufferRenderGraphPass->getMaterialTextureHandlers(),
-        m_gBufferRenderGraphPass->getEmissiveTextureHandlers(),
-        rtShadowHandlers,
-        aoHandlers);
-
-    m_contactShadowRenderGraphPass = m_renderGraph->addPass<renderGraph::ContactShadowRenderGraphPass>(
-        m_lightingRenderGraphPass->getOutput(),
-        m_gBufferRenderGraphPass->getNormalTextureHandlers(),
-        m_gBufferRenderGraphPass->getDepthTextureHandler());
-
-    m_skyLightRenderGraphPass = m_renderGraph->addPass<renderGraph::SkyLightRenderGraphPass>(
-        m_contactShadowRenderGraphPass->getOutput(),
-        m_gBufferRenderGraphPass->getDepthTextureHandler());
+        m_skyLightRenderGraphPass = m_renderGraph->addPass<renderGraph::SkyLightRenderGraphPass>(
+            m_contactShadowRenderGraphPass->getOutput(),
+            m_gBufferRenderGraphPass->getDepthTextureHandler());
+    }
 
     auto *sceneColorInput = &m_skyLightRenderGraphPass->getOutput();
-    if (useSSR)
+
+    if (firstStage <= RenderGraphStage::ScreenSpaceReflections && features.ssr)
     {
         m_ssrRenderGraphPass = m_renderGraph->addPass<renderGraph::SSRRenderGraphPass>(
             *sceneColorInput,
             m_gBufferRenderGraphPass->getNormalTextureHandlers(),
             m_gBufferRenderGraphPass->getDepthTextureHandler(),
             m_gBufferRenderGraphPass->getMaterialTextureHandlers());
-        sceneColorInput = &m_ssrRenderGraphPass->getOutput();
     }
+    if (m_ssrRenderGraphPass)
+        sceneColorInput = &m_ssrRenderGraphPass->getOutput();
 
-    if (useRTReflections)
+    if (firstStage <= RenderGraphStage::RayTracedReflections && features.rtReflections)
     {
         m_rtReflectionsRenderGraphPass = m_renderGraph->addPass<renderGraph::RTReflectionsRenderGraphPass>(
             *sceneColorInput,
@@ -510,10 +667,11 @@ void GameRuntime::initRenderGraph()
             m_rtReflectionsRenderGraphPass->getOutput(),
             m_gBufferRenderGraphPass->getNormalTextureHandlers(),
             m_gBufferRenderGraphPass->getDepthTextureHandler());
-        sceneColorInput = &m_rtReflectionDenoiseRenderGraphPass->getOutput();
     }
+    if (m_rtReflectionDenoiseRenderGraphPass)
+        sceneColorInput = &m_rtReflectionDenoiseRenderGraphPass->getOutput();
 
-    if (useVolumetricFog)
+    if (firstStage <= RenderGraphStage::VolumetricFog && features.volumetricFog)
     {
         m_volumetricFogLightingRenderGraphPass = m_renderGraph->addPass<renderGraph::VolumetricFogLightingRenderGraphPass>(
             m_gBufferRenderGraphPass->getDepthTextureHandler(),
@@ -533,63 +691,72 @@ void GameRuntime::initRenderGraph()
         m_volumetricFogCompositeRenderGraphPass = m_renderGraph->addPass<renderGraph::VolumetricFogCompositeRenderGraphPass>(
             *sceneColorInput,
             *fogInput);
-        sceneColorInput = &m_volumetricFogCompositeRenderGraphPass->getOutput();
     }
+    if (m_volumetricFogCompositeRenderGraphPass)
+        sceneColorInput = &m_volumetricFogCompositeRenderGraphPass->getOutput();
 
-    if (useParticles)
+    if (firstStage <= RenderGraphStage::Particles && features.particles)
     {
         m_particleRenderGraphPass = m_renderGraph->addPass<renderGraph::ParticleRenderGraphPass>(
             *sceneColorInput,
             &m_gBufferRenderGraphPass->getDepthTextureHandler());
-        sceneColorInput = &m_particleRenderGraphPass->getHandlers();
     }
+    if (m_particleRenderGraphPass)
+        sceneColorInput = &m_particleRenderGraphPass->getHandlers();
 
-    m_bloomRenderGraphPass = m_renderGraph->addPass<renderGraph::BloomRenderGraphPass>(
-        *sceneColorInput);
+    if (firstStage <= RenderGraphStage::PostProcess)
+    {
+        m_bloomRenderGraphPass = m_renderGraph->addPass<renderGraph::BloomRenderGraphPass>(
+            *sceneColorInput);
 
-    m_tonemapRenderGraphPass = m_renderGraph->addPass<renderGraph::TonemapRenderGraphPass>(
-        *sceneColorInput);
+        m_tonemapRenderGraphPass = m_renderGraph->addPass<renderGraph::TonemapRenderGraphPass>(
+            *sceneColorInput);
 
-    m_bloomCompositeRenderGraphPass = m_renderGraph->addPass<renderGraph::BloomCompositeRenderGraphPass>(
-        m_tonemapRenderGraphPass->getHandlers(),
-        m_bloomRenderGraphPass->getHandlers());
+        m_bloomCompositeRenderGraphPass = m_renderGraph->addPass<renderGraph::BloomCompositeRenderGraphPass>(
+            m_tonemapRenderGraphPass->getHandlers(),
+            m_bloomRenderGraphPass->getHandlers());
+    }
 
     auto *finalSceneInput = &m_bloomCompositeRenderGraphPass->getHandlers();
-    switch (aaMode)
+
+    if (firstStage <= RenderGraphStage::AntiAliasing)
     {
-    case RenderQualitySettings::AntiAliasingMode::FXAA:
-        m_fxaaRenderGraphPass = m_renderGraph->addPass<renderGraph::FXAARenderGraphPass>(*finalSceneInput);
+        switch (features.antiAliasing)
+        {
+        case RenderQualitySettings::AntiAliasingMode::FXAA:
+            m_fxaaRenderGraphPass = m_renderGraph->addPass<renderGraph::FXAARenderGraphPass>(*finalSceneInput);
+            break;
+        case RenderQualitySettings::AntiAliasingMode::SMAA:
+        case RenderQualitySettings::AntiAliasingMode::CMAA:
+            m_smaaRenderGraphPass = m_renderGraph->addPass<renderGraph::SMAAPassRenderGraphPass>(*finalSceneInput);
+            break;
+        case RenderQualitySettings::AntiAliasingMode::TAA:
+            m_taaRenderGraphPass = m_renderGraph->addPass<renderGraph::TAARenderGraphPass>(*finalSceneInput);
+            break;
+        case RenderQualitySettings::AntiAliasingMode::NONE:
+        default:
+            break;
+        }
+    }
+    if (m_fxaaRenderGraphPass)
         finalSceneInput = &m_fxaaRenderGraphPass->getHandlers();
-        break;
-    case RenderQualitySettings::AntiAliasingMode::SMAA:
-    case RenderQualitySettings::AntiAliasingMode::CMAA:
-        m_smaaRenderGraphPass = m_renderGraph->addPass<renderGraph::SMAAPassRenderGraphPass>(*finalSceneInput);
+    else if (m_smaaRenderGraphPass)
         finalSceneInput = &m_smaaRenderGraphPass->getHandlers();
-        break;
-    case RenderQualitySettings::AntiAliasingMode::TAA:
-        m_taaRenderGraphPass = m_renderGraph->addPass<renderGraph::TAARenderGraphPass>(*finalSceneInput);
+    else if (m_taaRenderGraphPass)
         finalSceneInput = &m_taaRenderGraphPass->getHandlers();
-        break;
-    case RenderQualitySettings::AntiAliasingMode::NONE:
-    default:
-        break;
-    }
-    if (useUI)
+
+    if (firstStage <= RenderGraphStage::UI)
     {
-        m_uiRenderGraphPass = m_renderGraph->addPass<renderGraph::UIRenderGraphPass>(
+        if (features.ui)
+        {
+            m_uiRenderGraphPass = m_renderGraph->addPass<renderGraph::UIRenderGraphPass>(
+                *finalSceneInput);
+            finalSceneInput = &m_uiRenderGraphPass->getHandlers();
+        }
+
+        m_presentRenderGraphPass = m_renderGraph->addPass<renderGraph::PresentRenderGraphPass>(
             *finalSceneInput);
-        finalSceneInput = &m_uiRenderGraphPass->getHandlers();
     }
-
-    m_presentRenderGraphPass = m_renderGraph->addPass<renderGraph::PresentRenderGraphPass>(
-        *finalSceneInput);
-
-    bindSceneToPasses();
-
-    m_renderGraph->setup();
-    m_renderGraph->createRenderGraphResources();
-    m_lastExtent = {0u, 0u};
-    syncViewportExtent();
 }
 
 void GameRuntime::shutdown()
@@ -822,74 +989,91 @@ void GameRuntime::bindSceneToPasses()
         m_particleRenderGraphPass->setScene(m_scene.get());
 }
 
-void GameRuntime::syncViewportExtent()
+VkExtent2D GameRuntime::computeViewportExtent() const
 {
     auto *swapchain = core::VulkanContext::getContext()->getSwapchain().get();
     if (!swapchain)
-        return;
+        return {0u, 0u};
 
     const VkExtent2D swapchainExtent = swapchain->getExtent();
     const float renderScale = std::clamp(RenderQualitySettings::getInstance().renderScale, 0.25f, 2.0f);
 
     const uint32_t scaledWidth = std::max(1u, static_cast<uint32_t>(std::lround(static_cast<double>(std::max(1u, swapchainExtent.width)) * renderScale)));
     const uint32_t scaledHeight = std::max(1u, static_cast<uint32_t>(std::lround(static_cast<double>(std::max(1u, swapchainExtent.height)) * renderScale)));
-    const VkExtent2D extent{scaledWidth, scaledHeight};
+    return {scaledWidth, scaledHeight};
+}
 
-    if (extent.width == m_lastExtent.width && extent.height == m_lastExtent.height)
+void GameRuntime::syncViewportExtent()
+{
+    const VkExtent2D extent = computeViewportExtent();
+    if (extent.width == 0u || extent.height == 0u)
         return;
 
-    if (m_gBufferRenderGraphPass)
-        m_gBufferRenderGraphPass->setExtent(extent);
-    if (m_rtShadowsRenderGraphPass)
-        m_rtShadowsRenderGraphPass->setExtent(extent);
-    if (m_rtShadowDenoiseRenderGraphPass)
-        m_rtShadowDenoiseRenderGraphPass->setExtent(extent);
-    if (m_ssaoRenderGraphPass)
-        m_ssaoRenderGraphPass->setExtent(extent);
-    if (m_rtaoRenderGraphPass)
-        m_rtaoRenderGraphPass->setExtent(extent);
-    if (m_rtaoDenoiseRenderGraphPass)
-        m_rtaoDenoiseRenderGraphPass->setExtent(extent);
-    if (m_lightingRenderGraphPass)
-        m_lightingRenderGraphPass->setExtent(extent);
-    if (m_contactShadowRenderGraphPass)
-        m_contactShadowRenderGraphPass->setExtent(extent);
-    if (m_ssrRenderGraphPass)
-        m_ssrRenderGraphPass->setExtent(extent);
-    if (m_volumetricFogLightingRenderGraphPass)
-        m_volumetricFogLightingRenderGraphPass->setExtent(extent);
-    if (m_volumetricFogTemporalRenderGraphPass)
-        m_volumetricFogTemporalRenderGraphPass->setExtent(extent);
-    if (m_volumetricFogCompositeRenderGraphPass)
-        m_volumetricFogCompositeRenderGraphPass->setExtent(extent);
-    if (m_rtReflectionsRenderGraphPass)
-        m_rtReflectionsRenderGraphPass->setExtent(extent);
-    if (m_rtReflectionDenoiseRenderGraphPass)
-        m_rtReflectionDenoiseRenderGraphPass->setExtent(extent);
-    if (m_skyLightRenderGraphPass)
-        m_skyLightRenderGraphPass->setExtent(extent);
-    if (m_particleRenderGraphPass)
-        m_particleRenderGraphPass->setExtent(extent);
-    if (m_bloomRenderGraphPass)
-        m_bloomRenderGraphPass->setExtent(extent);
-    if (m_tonemapRenderGraphPass)
-        m_tonemapRenderGraphPass->setExtent(extent);
-    if (m_bloomCompositeRenderGraphPass)
-        m_bloomCompositeRenderGraphPass->setExtent(extent);
-    if (m_fxaaRenderGraphPass)
-        m_fxaaRenderGraphPass->setExtent(extent);
-    if (m_smaaRenderGraphPass)
-        m_smaaRenderGraphPass->setExtent(extent);
-    if (m_taaRenderGraphPass)
-        m_taaRenderGraphPass->setExtent(extent);
-    if (m_uiRenderGraphPass)
-        m_uiRenderGraphPass->setExtent(extent);
-    if (m_presentRenderGraphPass)
-        m_presentRenderGraphPass->setExtent(extent);
+    if (extent.width == m_lastExtent.width && extent.height == m_lastExtent.height)
+        return;
 
+    applyViewportExtent(extent, RenderGraphStage::Core);
     m_lastExtent = extent;
 }
 
+void GameRuntime::applyViewportExtent(VkExtent2D extent, RenderGraphStage firstStage)
+{
+    // Only touches passes from firstStage on; setExtent may request a recompile, which kept passes don't need.
+    const auto apply = [&extent](auto *pass)
+    {
+        if (pass)
+            pass->setExtent(extent);
+    };
+
+    if (firstStage <= RenderGraphStage::Core)
+    {
+        apply(m_gBufferRenderGraphPass);
+        apply(m_ssaoRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::Lighting)
+    {
+        apply(m_rtShadowsRenderGraphPass);
+        apply(m_rtShadowDenoiseRenderGraphPass);
+        apply(m_rtaoRenderGraphPass);
+        apply(m_rtaoDenoiseRenderGraphPass);
+        apply(m_lightingRenderGraphPass);
+        apply(m_contactShadowRenderGraphPass);
+        apply(m_skyLightRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::ScreenSpaceReflections)
+        apply(m_ssrRenderGraphPass);
+    if (firstStage <= RenderGraphStage::RayTracedReflections)
+    {
+        apply(m_rtReflectionsRenderGraphPass);
+        apply(m_rtReflectionDenoiseRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::VolumetricFog)
+    {
+        apply(m_volumetricFogLightingRenderGraphPass);
+        apply(m_volumetricFogTemporalRenderGraphPass);
+        apply(m_volumetricFogCompositeRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::Particles)
+        apply(m_particleRenderGraphPass);
+    if (firstStage <= RenderGraphStage::PostProcess)
+    {
+        apply(m_bloomRenderGraphPass);
+        apply(m_tonemapRenderGraphPass);
+        apply(m_bloomCompositeRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::AntiAliasing)
+    {
+        apply(m_fxaaRenderGraphPass);
+        apply(m_smaaRenderGraphPass);
+        apply(m_taaRenderGraphPass);
+    }
+    if (firstStage <= RenderGraphStage::UI)
+    {
+        apply(m_uiRenderGraphPass);
+        apply(m_presentRenderGraphPass);
+    }
+}
+
 void GameRuntime::refreshActiveCamera()
 {
     m_renderCamera = nullptr;
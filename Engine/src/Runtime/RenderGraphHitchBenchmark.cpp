@@ -0,0 +1,130 @@
+#include "Engine/Runtime/RenderGraphHitchBenchmark.hpp"
+
+#include "Core/Logger.hpp"
+
+#include <algorithm>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+namespace
+{
+    RenderQualitySettings &settings()
+    {
+        return RenderQualitySettings::getInstance();
+    }
+
+    void forceVolumetricFog(bool enabled)
+    {
+        settings().overrideVolumetricFogSceneSetting = true;
+        settings().volumetricFogOverrideEnabled = enabled;
+    }
+} // namespace
+
+RenderGraphHitchBenchmark::RenderGraphHitchBenchmark()
+{
+    // Each step forces a state regardless of the current one; the settings from before the run are
+    // restored after the last step.
+    m_steps = {
+        {"SSR on", []() { settings().enableSSR = true; }},
+        {"SSR off", []() { settings().enableSSR = false; }},
+        {"Volumetric fog on", []() { forceVolumetricFog(true); }},
+        {"Volumetric fog off", []() { forceVolumetricFog(false); }},
+        {"AA -> TAA", []() { settings().setAntiAliasingMode(RenderQualitySettings::AntiAliasingMode::TAA); }},
+        {"AA -> SMAA", []() { settings().setAntiAliasingMode(RenderQualitySettings::AntiAliasingMode::SMAA); }},
+        {"AA -> FXAA", []() { settings().setAntiAliasingMode(RenderQualitySettings::AntiAliasingMode::FXAA); }},
+        {"Post processing off", []() { settings().enablePostProcessing = false; }},
+        {"Post processing on", []() { settings().enablePostProcessing = true; }},
+    };
+
+    m_warmupFrameTimesMs.reserve(WARMUP_FRAMES);
+    VX_ENGINE_INFO_STREAM("Render graph hitch benchmark: " << m_steps.size() << " toggles after " << WARMUP_FRAMES << " warmup frames\n");
+}
+
+void RenderGraphHitchBenchmark::update(float deltaTime)
+{
+    const double frameMs = static_cast<double>(deltaTime) * 1000.0;
+
+    if (m_warmupFrameTimesMs.size() < WARMUP_FRAMES)
+    {
+        m_warmupFrameTimesMs.push_back(frameMs);
+        if (m_warmupFrameTimesMs.size() == WARMUP_FRAMES)
+        {
+            auto middle = m_warmupFrameTimesMs.begin() + m_warmupFrameTimesMs.size() / 2u;
+            std::nth_element(m_warmupFrameTimesMs.begin(), middle, m_warmupFrameTimesMs.end());
+            m_baselineFrameMs = *middle;
+            saveSettings();
+            m_steps.front().apply();
+        }
+        return;
+    }
+
+    if (isFinished())
+    {
+        if (!m_reported)
+        {
+            report();
+            m_reported = true;
+        }
+        return;
+    }
+
+    // deltaTime of this frame covers the previous one, which is where the rebuild happened.
+    Step &step = m_steps[m_stepIndex];
+    step.worstFrameMs = std::max(step.worstFrameMs, frameMs);
+
+    if (++m_frameInStep < OBSERVATION_FRAMES)
+        return;
+
+    m_frameInStep = 0;
+    if (++m_stepIndex < m_steps.size())
+        m_steps[m_stepIndex].apply();
+    else
+        restoreSettings();
+}
+
+void RenderGraphHitchBenchmark::recordRebuild(double rebuildMs)
+{
+    if (m_warmupFrameTimesMs.size() < WARMUP_FRAMES || isFinished())
+        return;
+
+    m_steps[m_stepIndex].rebuildMs += rebuildMs;
+}
+
+void RenderGraphHitchBenchmark::saveSettings()
+{
+    const auto &current = settings();
+    m_savedSettings.enableSSR = current.enableSSR;
+    m_savedSettings.enablePostProcessing = current.enablePostProcessing;
+    m_savedSettings.overrideVolumetricFogSceneSetting = current.overrideVolumetricFogSceneSetting;
+    m_savedSettings.volumetricFogOverrideEnabled = current.volumetricFogOverrideEnabled;
+    m_savedSettings.antiAliasingMode = current.getAntiAliasingMode();
+}
+
+void RenderGraphHitchBenchmark::restoreSettings() const
+{
+    auto &current = settings();
+    current.enableSSR = m_savedSettings.enableSSR;
+    current.enablePostProcessing = m_savedSettings.enablePostProcessing;
+    current.overrideVolumetricFogSceneSetting = m_savedSettings.overrideVolumetricFogSceneSetting;
+    current.volumetricFogOverrideEnabled = m_savedSettings.volumetricFogOverrideEnabled;
+    current.setAntiAliasingMode(m_savedSettings.antiAliasingMode);
+}
+
+void RenderGraphHitchBenchmark::report() const
+{
+    VX_ENGINE_INFO_STREAM("Render graph hitch benchmark: baseline median frame " << m_baselineFrameMs << " ms\n");
+
+    double worstSpikeMs = 0.0;
+    for (const auto &step : m_steps)
+    {
+        const double spikeMs = std::max(0.0, step.worstFrameMs - m_baselineFrameMs);
+        worstSpikeMs = std::max(worstSpikeMs, spikeMs);
+
+        VX_ENGINE_INFO_STREAM("  " << step.name << ": rebuild " << step.rebuildMs << " ms, worst frame "
+                                   << step.worstFrameMs << " ms (+" << spikeMs << " ms)\n");
+    }
+
+    VX_ENGINE_INFO_STREAM("Render graph hitch benchmark: worst spike +" << worstSpikeMs << " ms\n");
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -29,12 +29,16 @@
 #include "Engine/Particles/Modules/RotationOverLifetimeModule.hpp"
 #include "Engine/Particles/Modules/TurbulenceModule.hpp"
 
+#include "Engine/Assets/AssetManager.hpp"
 #include "Engine/Assets/AssetsLoader.hpp"
+#include "Engine/PreparedSceneFile.hpp"
 #include "Engine/Render/SceneMaterialResolver.hpp"
 #include "Engine/Scripting/ScriptsRegister.hpp"
+#include "Engine/Threads/ThreadPoolManager.hpp"
 
 #include "Engine/Mesh.hpp"
 #include "Engine/Primitives.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include "nlohmann/json.hpp"
 #include <glm/common.hpp>
@@ -492,6 +496,34 @@ const std::vector<Entity::SharedPtr> &Scene::getEntities() const
     return m_entities;
 }
 
+uint64_t Scene::getHierarchyRevision() const
+{
+    // Both counters only grow, so their sum changes whenever either does.
+    return m_entityListRevision + Entity::getHierarchyRevision();
+}
+
+const std::vector<TerrainComponent *> &Scene::getTerrainComponents()
+{
+    if (!isInParallelScriptUpdate())
+        refreshTerrainComponents();
+
+    return m_terrainComponents;
+}
+
+void Scene::refreshTerrainComponents()
+{
+    const uint64_t revision = getHierarchyRevision() + Entity::getComponentRevision();
+    if (revision == m_terrainComponentsRevision)
+        return;
+
+    m_terrainComponents.clear();
+    for (const auto &entity : m_entities)
+        if (auto *terrainComponent = entity ? entity->getComponent<TerrainComponent>() : nullptr)
+            m_terrainComponents.push_back(terrainComponent);
+
+    m_terrainComponentsRevision = revision;
+}
+
 Scene::SharedPtr Scene::copy()
 {
     auto copiedScene = std::make_shared<Scene>();
@@ -538,6 +570,29 @@ bool Scene::doesEntityNameExist(const std::string &name) const
     return false;
 }
 
+Entity *Scene::findEntityByName(std::string_view name)
+{
+    if (!isInParallelScriptUpdate())
+        refreshEntityNameIndex();
+
+    const auto it = m_entityNameIndex.find(name);
+    return it != m_entityNameIndex.end() ? it->second : nullptr;
+}
+
+void Scene::refreshEntityNameIndex()
+{
+    const uint64_t revision = getHierarchyRevision();
+    if (revision == m_entityNameIndexRevision)
+        return;
+
+    m_entityNameIndex.clear();
+    for (const auto &entity : m_entities)
+        if (entity)
+            m_entityNameIndex.try_emplace(entity->getName(), entity.get());
+
+    m_entityNameIndexRevision = revision;
+}
+
 Entity::SharedPtr Scene::addEntity(Entity &en, const std::string &name)
 {
     auto generateUniqueName = [this](const std::string &baseName)
@@ -564,6 +619,7 @@ Entity::SharedPtr Scene::addEntity(Entity &en, const std::string &name)
         ++m_nextEntityId;
 
     m_entities.push_back(entity);
+    ++m_entityListRevision;
     return entity;
 }
 
@@ -595,6 +651,7 @@ Entity::SharedPtr Scene::addEntity(const std::string &name)
         ++m_nextEntityId;
 
     m_entities.push_back(entity);
+    ++m_entityListRevision;
     return entity;
 }
 
@@ -627,10 +684,52 @@ Entity::SharedPtr Scene::addEntityWithId(const std::string &name, uint32_t id)
     m_nextEntityId = std::max(m_nextEntityId, candidateNextId);
 
     m_entities.push_back(entity);
+    ++m_entityListRevision;
     return entity;
 }
 
+struct Scene::IncrementalLoad
+{
+    struct AnimatorState
+    {
+        Entity *entity;
+        int selectedAnim;
+        float speed;
+        bool looped;
+        bool paused;
+        bool ignoreRootBoneY;
+    };
+
+    std::shared_ptr<PreparedSceneFile> preparedFile;
+    LoadStatusCallback statusCallback;
+    size_t gameObjectCount{0u};
+    size_t nextGameObjectIndex{0u};
+
+    std::unordered_map<uint32_t, Entity *> entitiesById;
+    std::vector<std::pair<Entity *, uint32_t>> pendingParents;
+    std::vector<std::pair<Entity *, glm::vec3>> pendingLightDirections;
+    std::vector<AnimatorState> pendingAnimatorStates;
+    SceneMaterialResolver decalMaterialResolver;
+};
+
 bool Scene::loadSceneFromFile(const std::string &filePath, const LoadStatusCallback &statusCallback, bool additive)
+{
+    if (statusCallback)
+        statusCallback("Opening scene file...");
+
+    auto preparedFile = PreparedSceneFile::load(filePath, false);
+    if (!preparedFile)
+    {
+        if (statusCallback)
+            statusCallback("Failed to load scene file");
+        return false;
+    }
+
+    beginIncrementalLoad(std::move(preparedFile), additive, statusCallback);
+    return continueIncrementalLoad(std::numeric_limits<size_t>::max());
+}
+
+void Scene::beginIncrementalLoad(std::shared_ptr<PreparedSceneFile> preparedFile, bool additive, const LoadStatusCallback &statusCallback)
 {
     auto reportStatus = [&](const std::string &status)
     {
@@ -643,6 +742,7 @@ bool Scene::loadSceneFromFile(const std::string &filePath, const LoadStatusCallb
         reportStatus("Resetting scene state...");
 
         m_entities.clear();
+        ++m_entityListRevision;
         m_uiTexts.clear();
         m_uiButtons.clear();
         m_billboards.clear();
@@ -650,49 +750,16 @@ bool Scene::loadSceneFromFile(const std::string &filePath, const LoadStatusCallb
         m_environmentSettings = {};
     }
 
-    reportStatus("Opening scene file...");
-
-    std::ifstream file(filePath);
-
-    if (!file.is_open())
-    {
-        VX_ENGINE_ERROR_STREAM("Failed to open file: " << filePath << std::endl);
-        ;
-        reportStatus("Failed to open scene file");
-        return false;
-    }
-
-    nlohmann::json json;
-
-    reportStatus("Parsing scene data...");
-
-    try
-    {
-        file >> json;
-    }
-    catch (const nlohmann::json::parse_error &e)
-    {
-        VX_ENGINE_ERROR_STREAM("Failed to parse scene file " << e.what() << std::endl);
-        reportStatus("Failed to parse scene JSON");
-        return false;
-    }
+    const nlohmann::json &json = preparedFile->getJson();
 
     if (json.contains("name"))
     {
         m_name = json["name"];
     }
 
-    const std::filesystem::path sceneDirectory = std::filesystem::path(filePath).parent_path();
-    auto resolveScenePath = [&](const std::string &rawPath) -> std::string
+    auto resolveScenePath = [&](const std::string &rawPath)
     {
-        if (rawPath.empty())
-            return {};
-
-        std::filesystem::path path(rawPath);
-        if (path.is_relative())
-            path = sceneDirectory / path;
-
-        return path.lexically_normal().string();
+        return preparedFile->resolvePath(rawPath);
     };
 
     if (json.contains("environment") && json["environment"].is_object())
@@ -852,6 +919,73 @@ bool Scene::loadSceneFromFile(const std::string &filePath, const LoadStatusCallb
         }
     }
 
+    m_incrementalLoad = std::make_unique<IncrementalLoad>();
+    m_incrementalLoad->statusCallback = statusCallback;
+    m_incrementalLoad->decalMaterialResolver.beginFrame(std::numeric_limits<int>::max());
+
+    if (json.contains("game_objects") && json["game_objects"].is_array())
+        m_incrementalLoad->gameObjectCount = json["game_objects"].size();
+
+    if (m_incrementalLoad->gameObjectCount > 0)
+        reportStatus("Loading game objects (0/" + std::to_string(m_incrementalLoad->gameObjectCount) + ")...");
+
+    m_incrementalLoad->preparedFile = std::move(preparedFile);
+}
+
+bool Scene::continueIncrementalLoad(size_t maxGameObjects)
+{
+    if (!m_incrementalLoad)
+        return true;
+
+    auto &load = *m_incrementalLoad;
+    const size_t remainingCount = load.gameObjectCount - load.nextGameObjectIndex;
+    const size_t endIndex = load.nextGameObjectIndex + std::min(maxGameObjects, remainingCount);
+
+    while (load.nextGameObjectIndex < endIndex)
+    {
+        loadGameObject(load.preparedFile->getJson()["game_objects"][load.nextGameObjectIndex]);
+
+        ++load.nextGameObjectIndex;
+        if (load.statusCallback && ((load.nextGameObjectIndex == load.gameObjectCount) || ((load.nextGameObjectIndex % 8u) == 0u)))
+            load.statusCallback("Loading game objects (" + std::to_string(load.nextGameObjectIndex) + "/" + std::to_string(load.gameObjectCount) + ")...");
+    }
+
+    if (load.nextGameObjectIndex < load.gameObjectCount)
+        return false;
+
+    finishIncrementalLoad();
+    return true;
+}
+
+bool Scene::isIncrementalLoadInProgress() const
+{
+    return m_incrementalLoad != nullptr;
+}
+
+size_t Scene::getIncrementalLoadedGameObjectCount() const
+{
+    return m_incrementalLoad ? m_incrementalLoad->nextGameObjectIndex : 0u;
+}
+
+size_t Scene::getIncrementalLoadGameObjectCount() const
+{
+    return m_incrementalLoad ? m_incrementalLoad->gameObjectCount : 0u;
+}
+
+void Scene::loadGameObject(const nlohmann::json &objectJson)
+{
+    auto &load = *m_incrementalLoad;
+    auto &entitiesById = load.entitiesById;
+    auto &pendingParents = load.pendingParents;
+    auto &pendingLightDirections = load.pendingLightDirections;
+    auto &pendingAnimatorStates = load.pendingAnimatorStates;
+    auto &decalMaterialResolver = load.decalMaterialResolver;
+
+    auto resolveScenePath = [&](const std::string &rawPath)
+    {
+        return load.preparedFile->resolvePath(rawPath);
+    };
+
     // Restore material override paths on a mesh component (GPU material loading is deferred to editor layer)
     auto restoreMaterialOverrides = [&](auto *meshComp, const nlohmann::json &overridesJson)
     {
@@ -871,833 +1005,839 @@ bool Scene::loadSceneFromFile(const std::string &filePath, const LoadStatusCallb
         }
     };
 
-    if (json.contains("game_objects"))
+    auto collectResolvedAnimationAssetPaths = [&](const nlohmann::json &componentJson)
     {
-        const size_t gameObjectCount = json["game_objects"].size();
-        if (gameObjectCount > 0)
-            reportStatus("Loading game objects (0/" + std::to_string(gameObjectCount) + ")...");
+        std::vector<std::string> resolvedPaths;
 
-        std::unordered_map<uint32_t, Entity *> entitiesById;
-        std::vector<std::pair<Entity *, uint32_t>> pendingParents;
-        std::vector<std::pair<Entity *, glm::vec3>> pendingLightDirections;
+        if (!componentJson.contains("animation_asset_paths") || !componentJson["animation_asset_paths"].is_array())
+            return resolvedPaths;
 
-        struct AnimatorState
+        resolvedPaths.reserve(componentJson["animation_asset_paths"].size());
+        for (const auto &pathJson : componentJson["animation_asset_paths"])
         {
-            Entity *entity;
-            int selectedAnim;
-            float speed;
-            bool looped;
-            bool paused;
-            bool ignoreRootBoneY;
-        };
-        std::vector<AnimatorState> pendingAnimatorStates;
-        SceneMaterialResolver decalMaterialResolver;
-        decalMaterialResolver.beginFrame(std::numeric_limits<int>::max());
+            if (!pathJson.is_string())
+                continue;
+
+            const std::string resolvedPath = resolveScenePath(pathJson.get<std::string>());
+            if (!resolvedPath.empty())
+                resolvedPaths.push_back(resolvedPath);
+        }
+
+        return resolvedPaths;
+    };
+
+    auto ensureAnimatorAnimationsLoaded = [&](Entity *entity, const nlohmann::json &componentJson)
+    {
+        if (!entity)
+            return;
 
-        auto collectResolvedAnimationAssetPaths = [&](const nlohmann::json &componentJson)
+        auto *animatorComponent = entity->getComponent<AnimatorComponent>();
+        auto *skeletalMeshComponent = entity->getComponent<SkeletalMeshComponent>();
+        Skeleton *skeleton = skeletalMeshComponent ? &skeletalMeshComponent->getSkeleton() : nullptr;
+        const std::vector<std::string> externalAnimationAssetPaths = collectResolvedAnimationAssetPaths(componentJson);
+        const std::string treeAssetPath = resolveScenePath(componentJson.value("tree_asset_path", std::string{}));
+
+        if (!animatorComponent)
         {
-            std::vector<std::string> resolvedPaths;
+            animatorComponent = entity->addComponent<AnimatorComponent>();
+            if (!animatorComponent)
+                return;
 
-            if (!componentJson.contains("animation_asset_paths") || !componentJson["animation_asset_paths"].is_array())
-                return resolvedPaths;
+            if (skeleton)
+                animatorComponent->bindSkeleton(skeleton);
+        }
 
-            resolvedPaths.reserve(componentJson["animation_asset_paths"].size());
-            for (const auto &pathJson : componentJson["animation_asset_paths"])
+        if (!externalAnimationAssetPaths.empty())
+        {
+            std::vector<Animation> mergedAnimations = animatorComponent->getAnimations();
+            for (const auto &animationAssetPath : externalAnimationAssetPaths)
             {
-                if (!pathJson.is_string())
+                auto animationAsset = load.preparedFile->findAnimationAsset(animationAssetPath);
+                if (!animationAsset)
+                {
+                    if (auto loadedAsset = AssetsLoader::loadAnimationAsset(animationAssetPath))
+                        animationAsset = std::make_shared<AnimationAsset>(std::move(loadedAsset.value()));
+                }
+
+                if (!animationAsset)
+                {
+                    VX_ENGINE_WARNING_STREAM("Failed to load animation asset while restoring scene: " << animationAssetPath << '\n');
                     continue;
+                }
 
-                const std::string resolvedPath = resolveScenePath(pathJson.get<std::string>());
-                if (!resolvedPath.empty())
-                    resolvedPaths.push_back(resolvedPath);
+                mergedAnimations.insert(mergedAnimations.end(),
+                                        animationAsset->animations.begin(),
+                                        animationAsset->animations.end());
             }
 
-            return resolvedPaths;
-        };
+            animatorComponent->setAnimations(mergedAnimations, skeleton);
+        }
 
-        auto ensureAnimatorAnimationsLoaded = [&](Entity *entity, const nlohmann::json &componentJson)
-        {
-            if (!entity)
-                return;
+        animatorComponent->setExternalAnimationAssetPaths(externalAnimationAssetPaths);
 
-            auto *animatorComponent = entity->getComponent<AnimatorComponent>();
-            auto *skeletalMeshComponent = entity->getComponent<SkeletalMeshComponent>();
-            Skeleton *skeleton = skeletalMeshComponent ? &skeletalMeshComponent->getSkeleton() : nullptr;
-            const std::vector<std::string> externalAnimationAssetPaths = collectResolvedAnimationAssetPaths(componentJson);
-            const std::string treeAssetPath = resolveScenePath(componentJson.value("tree_asset_path", std::string{}));
+        if (!treeAssetPath.empty())
+            animatorComponent->loadTree(treeAssetPath);
+    };
 
-            if (!animatorComponent)
-            {
-                animatorComponent = entity->addComponent<AnimatorComponent>();
-                if (!animatorComponent)
-                    return;
 
-                if (skeleton)
-                    animatorComponent->bindSkeleton(skeleton);
-            }
+    const std::string &name = objectJson.value("name", "undefined");
 
-            if (!externalAnimationAssetPaths.empty())
-            {
-                std::vector<Animation> mergedAnimations = animatorComponent->getAnimations();
-                for (const auto &animationAssetPath : externalAnimationAssetPaths)
-                {
-                    auto animationAsset = AssetsLoader::loadAnimationAsset(animationAssetPath);
-                    if (!animationAsset.has_value())
-                    {
-                        VX_ENGINE_WARNING_STREAM("Failed to load animation asset while restoring scene: " << animationAssetPath << '\n');
-                        continue;
-                    }
+    auto gameObject = addEntity(name);
 
-                    mergedAnimations.insert(mergedAnimations.end(),
-                                            animationAsset->animations.begin(),
-                                            animationAsset->animations.end());
-                }
+    if (objectJson.contains("id"))
+    {
+        const uint32_t objectId = objectJson["id"];
+        gameObject->setId(objectId);
+        entitiesById[objectId] = gameObject.get();
 
-                animatorComponent->setAnimations(mergedAnimations, skeleton);
-            }
+        const uint32_t candidateNextId =
+            (objectId == std::numeric_limits<uint32_t>::max()) ? objectId : static_cast<uint32_t>(objectId + 1u);
+        m_nextEntityId = std::max(m_nextEntityId, candidateNextId);
+    }
+    else
+        entitiesById[gameObject->getId()] = gameObject.get();
 
-            animatorComponent->setExternalAnimationAssetPaths(externalAnimationAssetPaths);
+    gameObject->setEnabled(objectJson.value("enabled", true));
 
-            if (!treeAssetPath.empty())
-                animatorComponent->loadTree(treeAssetPath);
-        };
+    if (objectJson.contains("parent_id"))
+        pendingParents.emplace_back(gameObject.get(), objectJson["parent_id"]);
 
-        size_t gameObjectIndex = 0;
-        for (const auto &objectJson : json["game_objects"])
-        {
-            ++gameObjectIndex;
-            if ((gameObjectIndex == gameObjectCount) || ((gameObjectIndex % 8u) == 0u))
-                reportStatus("Loading game objects (" + std::to_string(gameObjectIndex) + "/" + std::to_string(gameObjectCount) + ")...");
+    auto transformation = gameObject->getComponent<Transform3DComponent>();
 
-            const std::string &name = objectJson.value("name", "undefined");
+    if (objectJson.contains("position"))
+    {
+        const auto &pos = objectJson["position"];
+        transformation->setPosition({pos[0], pos[1], pos[2]});
+    }
 
-            auto gameObject = addEntity(name);
+    if (objectJson.contains("scale"))
+    {
+        const auto &scale = objectJson["scale"];
+        transformation->setScale({scale[0], scale[1], scale[2]});
+    }
 
-            if (objectJson.contains("id"))
-            {
-                const uint32_t objectId = objectJson["id"];
-                gameObject->setId(objectId);
-                entitiesById[objectId] = gameObject.get();
+    if (objectJson.contains("rotation"))
+    {
+        const auto &rot = objectJson["rotation"];
+        transformation->setEulerDegrees({rot[0], rot[1], rot[2]});
+    }
+
+    if (objectJson.contains("tags") && objectJson["tags"].is_array())
+    {
+        for (const auto &tag : objectJson["tags"])
+        {
+            if (tag.is_string())
+                gameObject->addTag(tag.get<std::string>());
+        }
+    }
 
-                const uint32_t candidateNextId =
-                    (objectId == std::numeric_limits<uint32_t>::max()) ? objectId : static_cast<uint32_t>(objectId + 1u);
-                m_nextEntityId = std::max(m_nextEntityId, candidateNextId);
+    // Determine if the JSON has an explicit mesh component
+    bool hasMeshComponent = false;
+    if (objectJson.contains("components") && objectJson["components"].is_array())
+    {
+        for (const auto &c : objectJson["components"])
+        {
+            if (!c.contains("type"))
+                continue;
+            const std::string t = c["type"];
+            if (t == "static_mesh" || t == "skeletal_mesh")
+            {
+                hasMeshComponent = true;
+                break;
             }
-            else
-                entitiesById[gameObject->getId()] = gameObject.get();
+        }
+    }
+
+    // Backward compat: old scenes with has_legacy_mesh but no explicit mesh component
+    if (!hasMeshComponent && objectJson.value("has_legacy_mesh", false))
+    {
+        CPUMesh mesh = CPUMesh::build<vertex::Vertex3D>(cube::vertices, cube::indices);
+        mesh.name = "Cube";
+        gameObject->addComponent<StaticMeshComponent>(std::vector<CPUMesh>{mesh});
+    }
+
+    if (!objectJson.contains("components"))
+        return;
 
-            gameObject->setEnabled(objectJson.value("enabled", true));
+    for (const auto &componentJson : objectJson["components"])
+    {
+        if (!componentJson.contains("type"))
+            continue;
 
-            if (objectJson.contains("parent_id"))
-                pendingParents.emplace_back(gameObject.get(), objectJson["parent_id"]);
+        const std::string type = componentJson["type"];
 
-            auto transformation = gameObject->getComponent<Transform3DComponent>();
+        if (type == "static_mesh")
+        {
+            std::vector<CPUMesh> meshes;
+            std::string assetPath;
 
-            if (objectJson.contains("position"))
+            if (componentJson.value("is_primitive", false))
             {
-                const auto &pos = objectJson["position"];
-                transformation->setPosition({pos[0], pos[1], pos[2]});
+                const std::string primType = componentJson.value("primitive_type", "Cube");
+                if (primType == "Sphere")
+                {
+                    std::vector<vertex::Vertex3D> verts;
+                    std::vector<uint32_t> inds;
+                    circle::genereteVerticesAndIndices(verts, inds);
+                    auto mesh = CPUMesh::build<vertex::Vertex3D>(verts, inds);
+                    mesh.name = "Sphere";
+                    meshes.push_back(mesh);
+                }
+                else
+                {
+                    auto mesh = CPUMesh::build<vertex::Vertex3D>(cube::vertices, cube::indices);
+                    mesh.name = "Cube";
+                    meshes.push_back(mesh);
+                }
             }
-
-            if (objectJson.contains("scale"))
+            else
             {
-                const auto &scale = objectJson["scale"];
-                transformation->setScale({scale[0], scale[1], scale[2]});
+                assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
+                if (!assetPath.empty())
+                {
+                    // Streaming path: create the component with a path-only handle.
+                    // AssetManager will load the model data asynchronously.
+                    auto *sm = gameObject->addComponent<StaticMeshComponent>(assetPath);
+                    if (load.preparedFile->isModelPrefetched(assetPath))
+                        AssetManager::getInstance().requestLoad(sm->getModelHandle());
+                    restoreMaterialOverrides(sm, componentJson.value("material_overrides", nlohmann::json::array()));
+                }
             }
 
-            if (objectJson.contains("rotation"))
+            if (!meshes.empty())
             {
-                const auto &rot = objectJson["rotation"];
-                transformation->setEulerDegrees({rot[0], rot[1], rot[2]});
+                auto *sm = gameObject->addComponent<StaticMeshComponent>(meshes);
+                sm->setAssetPath(assetPath);
+                restoreMaterialOverrides(sm, componentJson.value("material_overrides", nlohmann::json::array()));
             }
+        }
+        else if (type == "terrain")
+        {
+            const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
+            auto *terrainComponent = gameObject->addComponent<TerrainComponent>();
+            terrainComponent->setTerrainAssetPath(assetPath);
+            terrainComponent->setQuadsPerChunk(std::clamp(componentJson.value("quads_per_chunk", 63u), 1u, 512u));
+            terrainComponent->setLodEnabled(componentJson.value("lod_enabled", true));
+
+            TerrainLodSettings lodSettings{};
+            lodSettings.distanceScale = componentJson.value("lod_distance_scale", lodSettings.distanceScale);
+            lodSettings.maxPatches = componentJson.value("lod_max_patches", lodSettings.maxPatches);
+            terrainComponent->setLodSettings(lodSettings);
+
+            if (componentJson.contains("material_override_path") && componentJson["material_override_path"].is_string())
+                terrainComponent->setMaterialOverridePath(resolveScenePath(componentJson["material_override_path"].get<std::string>()));
 
-            if (objectJson.contains("tags") && objectJson["tags"].is_array())
+            if (!assetPath.empty())
             {
-                for (const auto &tag : objectJson["tags"])
+                std::shared_ptr<TerrainAsset> terrainAsset = load.preparedFile->takeTerrainAsset(assetPath);
+                if (!terrainAsset)
                 {
-                    if (tag.is_string())
-                        gameObject->addTag(tag.get<std::string>());
+                    if (auto loadedAsset = AssetsLoader::loadTerrain(assetPath))
+                        terrainAsset = std::make_shared<TerrainAsset>(std::move(loadedAsset.value()));
                 }
+
+                if (terrainAsset)
+                    terrainComponent->setTerrainAsset(std::move(terrainAsset));
+                else
+                    VX_ENGINE_WARNING_STREAM("Failed to load terrain asset: " << assetPath << '\n');
+            }
+        }
+        else if (type == "skeletal_mesh")
+        {
+            const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
+            if (!assetPath.empty())
+            {
+                // Streaming path: handle resolved asynchronously; AnimatorComponent
+                // will be populated in PerFrameDataWorker once onModelLoaded() fires.
+                auto *skm = gameObject->addComponent<SkeletalMeshComponent>(assetPath);
+                if (load.preparedFile->isModelPrefetched(assetPath))
+                    AssetManager::getInstance().requestLoad(skm->getModelHandle());
+                restoreMaterialOverrides(skm, componentJson.value("material_overrides", nlohmann::json::array()));
+            }
+        }
+        else if (type == "animator")
+        {
+            ensureAnimatorAnimationsLoaded(gameObject.get(), componentJson);
+            pendingAnimatorStates.push_back({gameObject.get(),
+                                             componentJson.value("selected_animation", -1),
+                                             componentJson.value("speed", 1.0f),
+                                             componentJson.value("looped", true),
+                                             componentJson.value("paused", false),
+                                             componentJson.value("ignore_root_bone_y", false)});
+        }
+        else if (type == "ragdoll")
+        {
+            if (gameObject->getComponent<RigidBodyComponent>())
+            {
+                VX_ENGINE_WARNING_STREAM("Skipping ragdoll on entity '" << gameObject->getName()
+                                         << "' because RigidBodyComponent is already present.\n");
+                continue;
+            }
+
+            auto *ragdoll = gameObject->addComponent<RagdollComponent>(this);
+            if (!ragdoll)
+                continue;
+
+            ragdollProfileFromJson(componentJson.value("profile", nlohmann::json::object()), ragdoll->getProfile());
+            ragdoll->setDebugDrawBodies(componentJson.value("debug_draw_bodies", false));
+            ragdoll->setDebugDrawJoints(componentJson.value("debug_draw_joints", false));
+            ragdoll->buildFromProfile();
+        }
+        else if (type == "camera")
+        {
+            auto *cameraComponent = gameObject->addComponent<CameraComponent>();
+            if (!cameraComponent)
+                continue;
+
+            const auto camera = cameraComponent->getCamera();
+            if (!camera)
+                continue;
+
+            camera->setYaw(componentJson.value("yaw", camera->getYaw()));
+            camera->setPitch(componentJson.value("pitch", camera->getPitch()));
+            camera->setFOV(componentJson.value("fov", camera->getFOV()));
+            camera->setAspect(componentJson.value("aspect", camera->getAspect()));
+
+            bool hasExplicitOffset = false;
+            if (componentJson.contains("position_offset") &&
+                componentJson["position_offset"].is_array() &&
+                componentJson["position_offset"].size() == 3)
+            {
+                const auto &offset = componentJson["position_offset"];
+                cameraComponent->setPositionOffset({offset[0], offset[1], offset[2]});
+                hasExplicitOffset = true;
             }
 
-            // Determine if the JSON has an explicit mesh component
-            bool hasMeshComponent = false;
-            if (objectJson.contains("components") && objectJson["components"].is_array())
+            if (componentJson.contains("position") &&
+                componentJson["position"].is_array() &&
+                componentJson["position"].size() == 3)
             {
-                for (const auto &c : objectJson["components"])
+                const auto &position = componentJson["position"];
+                // Backward compatibility for old scenes where camera position
+                // lived in component data instead of entity transform.
+                if (!objectJson.contains("position"))
+                    transformation->setPosition({position[0], position[1], position[2]});
+                else if (!hasExplicitOffset)
                 {
-                    if (!c.contains("type"))
-                        continue;
-                    const std::string t = c["type"];
-                    if (t == "static_mesh" || t == "skeletal_mesh")
-                    {
-                        hasMeshComponent = true;
-                        break;
-                    }
+                    const glm::vec3 basePosition = transformation->getWorldPosition();
+                    cameraComponent->setPositionOffset(glm::vec3{position[0], position[1], position[2]} - basePosition);
                 }
             }
 
-            // Backward compat: old scenes with has_legacy_mesh but no explicit mesh component
-            if (!hasMeshComponent && objectJson.value("has_legacy_mesh", false))
+            cameraComponent->syncFromOwnerTransform();
+        }
+        else if (type == "light")
+        {
+            LightComponent::LightType lightType{LightComponent::LightType::NONE};
+            const std::string stringLightType = componentJson.value("light_type", std::string{});
+
+            if (stringLightType == "directional")
+                lightType = LightComponent::LightType::DIRECTIONAL;
+            else if (stringLightType == "spot")
+                lightType = LightComponent::LightType::SPOT;
+            else if (stringLightType == "point")
+                lightType = LightComponent::LightType::POINT;
+
+            if (lightType == LightComponent::LightType::NONE)
             {
-                CPUMesh mesh = CPUMesh::build<vertex::Vertex3D>(cube::vertices, cube::indices);
-                mesh.name = "Cube";
-                gameObject->addComponent<StaticMeshComponent>(std::vector<CPUMesh>{mesh});
+                VX_ENGINE_ERROR_STREAM("Light type is none\n");
+                continue;
             }
 
-            if (!objectJson.contains("components"))
-                continue;
+            LightComponent *lightComponent = gameObject->addComponent<LightComponent>(lightType);
+            auto light = lightComponent->getLight();
 
-            for (const auto &componentJson : objectJson["components"])
+            if (componentJson.contains("color"))
             {
-                if (!componentJson.contains("type"))
-                    continue;
-
-                const std::string type = componentJson["type"];
+                const auto &color = componentJson["color"];
+                light->color = {color[0], color[1], color[2]};
+            }
 
-                if (type == "static_mesh")
-                {
-                    std::vector<CPUMesh> meshes;
-                    std::string assetPath;
+            if (componentJson.contains("position"))
+            {
+                const auto &position = componentJson["position"];
+                if (!objectJson.contains("position"))
+                    transformation->setPosition({position[0], position[1], position[2]});
+            }
 
-                    if (componentJson.value("is_primitive", false))
-                    {
-                        const std::string primType = componentJson.value("primitive_type", "Cube");
-                        if (primType == "Sphere")
-                        {
-                            std::vector<vertex::Vertex3D> verts;
-                            std::vector<uint32_t> inds;
-                            circle::genereteVerticesAndIndices(verts, inds);
-                            auto mesh = CPUMesh::build<vertex::Vertex3D>(verts, inds);
-                            mesh.name = "Sphere";
-                            meshes.push_back(mesh);
-                        }
-                        else
-                        {
-                            auto mesh = CPUMesh::build<vertex::Vertex3D>(cube::vertices, cube::indices);
-                            mesh.name = "Cube";
-                            meshes.push_back(mesh);
-                        }
-                    }
-                    else
-                    {
-                        assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
-                        if (!assetPath.empty())
-                        {
-                            // Streaming path: create the component with a path-only handle.
-                            // AssetManager will load the model data asynchronously.
-                            auto *sm = gameObject->addComponent<StaticMeshComponent>(assetPath);
-                            restoreMaterialOverrides(sm, componentJson.value("material_overrides", nlohmann::json::array()));
-                        }
-                    }
+            if (componentJson.contains("strength"))
+                light->strength = componentJson["strength"];
 
-                    if (!meshes.empty())
-                    {
-                        auto *sm = gameObject->addComponent<StaticMeshComponent>(meshes);
-                        sm->setAssetPath(assetPath);
-                        restoreMaterialOverrides(sm, componentJson.value("material_overrides", nlohmann::json::array()));
-                    }
-                }
-                else if (type == "terrain")
-                {
-                    const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
-                    auto *terrainComponent = gameObject->addComponent<TerrainComponent>();
-                    terrainComponent->setTerrainAssetPath(assetPath);
-                    terrainComponent->setQuadsPerChunk(std::clamp(componentJson.value("quads_per_chunk", 63u), 1u, 512u));
+            light->castsShadows = componentJson.value("casts_shadows", light->castsShadows);
 
-                    if (componentJson.contains("material_override_path") && componentJson["material_override_path"].is_string())
-                        terrainComponent->setMaterialOverridePath(resolveScenePath(componentJson["material_override_path"].get<std::string>()));
+            if (componentJson.contains("direction"))
+            {
+                const auto &direction = componentJson["direction"];
+                pendingLightDirections.emplace_back(gameObject.get(), glm::vec3{direction[0], direction[1], direction[2]});
+            }
 
-                    if (!assetPath.empty())
-                    {
-                        auto terrainAsset = AssetsLoader::loadTerrain(assetPath);
-                        if (terrainAsset.has_value())
-                            terrainComponent->setTerrainAsset(std::make_shared<TerrainAsset>(std::move(terrainAsset.value())));
-                        else
-                            VX_ENGINE_WARNING_STREAM("Failed to load terrain asset: " << assetPath << '\n');
-                    }
-                }
-                else if (type == "skeletal_mesh")
+            if (lightType == LightComponent::LightType::DIRECTIONAL)
+            {
+                if (auto *dl = dynamic_cast<DirectionalLight *>(light.get()))
+                    dl->skyLightEnabled = componentJson.value("sky_light_enabled", true);
+            }
+            else if (lightType == LightComponent::LightType::POINT)
+            {
+                if (auto *pl = dynamic_cast<PointLight *>(light.get()))
                 {
-                    const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
-                    if (!assetPath.empty())
-                    {
-                        // Streaming path: handle resolved asynchronously; AnimatorComponent
-                        // will be populated in PerFrameDataWorker once onModelLoaded() fires.
-                        auto *skm = gameObject->addComponent<SkeletalMeshComponent>(assetPath);
-                        restoreMaterialOverrides(skm, componentJson.value("material_overrides", nlohmann::json::array()));
-                    }
+                    pl->radius = componentJson.value("radius", pl->radius);
+                    pl->falloff = componentJson.value("falloff", pl->falloff);
                 }
-                else if (type == "animator")
+            }
+            else if (lightType == LightComponent::LightType::SPOT)
+            {
+                if (auto *sl = dynamic_cast<SpotLight *>(light.get()))
                 {
-                    ensureAnimatorAnimationsLoaded(gameObject.get(), componentJson);
-                    pendingAnimatorStates.push_back({gameObject.get(),
-                                                     componentJson.value("selected_animation", -1),
-                                                     componentJson.value("speed", 1.0f),
-                                                     componentJson.value("looped", true),
-                                                     componentJson.value("paused", false),
-                                                     componentJson.value("ignore_root_bone_y", false)});
+                    sl->innerAngle = componentJson.value("inner_angle", sl->innerAngle);
+                    sl->outerAngle = componentJson.value("outer_angle", sl->outerAngle);
+                    sl->range = componentJson.value("range", sl->range);
                 }
-                else if (type == "ragdoll")
-                {
-                    if (gameObject->getComponent<RigidBodyComponent>())
-                    {
-                        VX_ENGINE_WARNING_STREAM("Skipping ragdoll on entity '" << gameObject->getName()
-                                                 << "' because RigidBodyComponent is already present.\n");
-                        continue;
-                    }
+            }
+        }
+        else if (type == "rigid_body")
+        {
+            if (gameObject->getComponent<RagdollComponent>())
+            {
+                VX_ENGINE_WARNING_STREAM("Skipping rigid body on entity '" << gameObject->getName()
+                                         << "' because RagdollComponent is already present.\n");
+                continue;
+            }
 
-                    auto *ragdoll = gameObject->addComponent<RagdollComponent>(this);
-                    if (!ragdoll)
-                        continue;
+            const glm::vec3 worldPos = transformation->getWorldPosition();
+            const glm::quat worldRot = transformation->getWorldRotation();
+            auto *dynActor = m_physicsScene.createDynamic(
+                physx::PxTransform(
+                    physx::PxVec3(worldPos.x, worldPos.y, worldPos.z),
+                    physx::PxQuat(worldRot.x, worldRot.y, worldRot.z, worldRot.w)));
 
-                    ragdollProfileFromJson(componentJson.value("profile", nlohmann::json::object()), ragdoll->getProfile());
-                    ragdoll->setDebugDrawBodies(componentJson.value("debug_draw_bodies", false));
-                    ragdoll->setDebugDrawJoints(componentJson.value("debug_draw_joints", false));
-                    ragdoll->buildFromProfile();
-                }
-                else if (type == "camera")
-                {
-                    auto *cameraComponent = gameObject->addComponent<CameraComponent>();
-                    if (!cameraComponent)
-                        continue;
-
-                    const auto camera = cameraComponent->getCamera();
-                    if (!camera)
-                        continue;
-
-                    camera->setYaw(componentJson.value("yaw", camera->getYaw()));
-                    camera->setPitch(componentJson.value("pitch", camera->getPitch()));
-                    camera->setFOV(componentJson.value("fov", camera->getFOV()));
-                    camera->setAspect(componentJson.value("aspect", camera->getAspect()));
-
-                    bool hasExplicitOffset = false;
-                    if (componentJson.contains("position_offset") &&
-                        componentJson["position_offset"].is_array() &&
-                        componentJson["position_offset"].size() == 3)
-                    {
-                        const auto &offset = componentJson["position_offset"];
-                        cameraComponent->setPositionOffset({offset[0], offset[1], offset[2]});
-                        hasExplicitOffset = true;
-                    }
+            if (dynActor)
+            {
+                auto *rb = gameObject->addComponent<RigidBodyComponent>(dynActor);
+                rb->setKinematic(componentJson.value("is_kinematic", false));
+                rb->setGravityEnable(componentJson.value("gravity_enabled", true));
+            }
+        }
+        else if (type == "collision")
+        {
+            std::string collisionType = componentJson.value("collision_type", "box");
+            std::transform(collisionType.begin(), collisionType.end(), collisionType.begin(), ::tolower);
 
-                    if (componentJson.contains("position") &&
-                        componentJson["position"].is_array() &&
-                        componentJson["position"].size() == 3)
-                    {
-                        const auto &position = componentJson["position"];
-                        // Backward compatibility for old scenes where camera position
-                        // lived in component data instead of entity transform.
-                        if (!objectJson.contains("position"))
-                            transformation->setPosition({position[0], position[1], position[2]});
-                        else if (!hasExplicitOffset)
-                        {
-                            const glm::vec3 basePosition = transformation->getWorldPosition();
-                            cameraComponent->setPositionOffset(glm::vec3{position[0], position[1], position[2]} - basePosition);
-                        }
-                    }
+            CollisionComponent::ShapeType shapeType = CollisionComponent::ShapeType::BOX;
+            glm::vec3 boxHalfExtents(0.5f);
+            float capsuleRadius = 0.5f;
+            float capsuleHalfHeight = 0.5f;
+            physx::PxShape *shape = nullptr;
 
-                    cameraComponent->syncFromOwnerTransform();
-                }
-                else if (type == "light")
+            if (collisionType == "capsule")
+            {
+                shapeType = CollisionComponent::ShapeType::CAPSULE;
+                capsuleRadius = std::max(componentJson.value("radius", 0.5f), 0.01f);
+                capsuleHalfHeight = std::max(componentJson.value("half_height", 0.5f), 0.0f);
+                shape = m_physicsScene.createShape(physx::PxCapsuleGeometry(capsuleRadius, capsuleHalfHeight));
+                if (shape)
+                    shape->setLocalPose(physx::PxTransform(physx::PxQuat(physx::PxHalfPi, physx::PxVec3(0.0f, 0.0f, 1.0f))));
+            }
+            else
+            {
+                if (componentJson.contains("half_extents") &&
+                    componentJson["half_extents"].is_array() &&
+                    componentJson["half_extents"].size() == 3)
                 {
-                    LightComponent::LightType lightType{LightComponent::LightType::NONE};
-                    const std::string stringLightType = componentJson.value("light_type", std::string{});
-
-                    if (stringLightType == "directional")
-                        lightType = LightComponent::LightType::DIRECTIONAL;
-                    else if (stringLightType == "spot")
-                        lightType = LightComponent::LightType::SPOT;
-                    else if (stringLightType == "point")
-                        lightType = LightComponent::LightType::POINT;
-
-                    if (lightType == LightComponent::LightType::NONE)
-                    {
-                        VX_ENGINE_ERROR_STREAM("Light type is none\n");
-                        continue;
-                    }
-
-                    LightComponent *lightComponent = gameObject->addComponent<LightComponent>(lightType);
-                    auto light = lightComponent->getLight();
+                    boxHalfExtents.x = componentJson["half_extents"][0];
+                    boxHalfExtents.y = componentJson["half_extents"][1];
+                    boxHalfExtents.z = componentJson["half_extents"][2];
+                }
+                boxHalfExtents = glm::max(boxHalfExtents, glm::vec3(0.01f));
+                shape = m_physicsScene.createShape(physx::PxBoxGeometry(boxHalfExtents.x, boxHalfExtents.y, boxHalfExtents.z));
+            }
 
-                    if (componentJson.contains("color"))
-                    {
-                        const auto &color = componentJson["color"];
-                        light->color = {color[0], color[1], color[2]};
-                    }
+            if (!shape)
+            {
+                VX_ENGINE_ERROR_STREAM("Failed to create collision shape while loading scene\n");
+                continue;
+            }
 
-                    if (componentJson.contains("position"))
-                    {
-                        const auto &position = componentJson["position"];
-                        if (!objectJson.contains("position"))
-                            transformation->setPosition({position[0], position[1], position[2]});
-                    }
+            if (auto *rb = gameObject->getComponent<RigidBodyComponent>())
+            {
+                rb->getRigidActor()->attachShape(*shape);
+                if (auto *dyn = rb->getRigidActor()->is<physx::PxRigidDynamic>())
+                    physx::PxRigidBodyExt::updateMassAndInertia(*dyn, 10.0f);
 
-                    if (componentJson.contains("strength"))
-                        light->strength = componentJson["strength"];
+                gameObject->addComponent<CollisionComponent>(shape, shapeType, boxHalfExtents, capsuleRadius, capsuleHalfHeight, nullptr);
+            }
+            else
+            {
+                const glm::vec3 worldPosition = transformation->getWorldPosition();
+                const glm::quat worldRotation = transformation->getWorldRotation();
+                auto *staticActor = m_physicsScene.createStatic(
+                    physx::PxTransform(
+                        physx::PxVec3(worldPosition.x, worldPosition.y, worldPosition.z),
+                        physx::PxQuat(worldRotation.x, worldRotation.y, worldRotation.z, worldRotation.w)));
 
-                    light->castsShadows = componentJson.value("casts_shadows", light->castsShadows);
+                staticActor->attachShape(*shape);
+                gameObject->addComponent<CollisionComponent>(shape, shapeType, boxHalfExtents, capsuleRadius, capsuleHalfHeight, staticActor);
+            }
+        }
+        else if (type == "character_movement")
+        {
+            const float capsuleRadius = std::max(componentJson.value("radius", 0.35f), 0.05f);
+            const float capsuleHeight = std::max(componentJson.value("height", 1.0f), 0.1f);
 
-                    if (componentJson.contains("direction"))
-                    {
-                        const auto &direction = componentJson["direction"];
-                        pendingLightDirections.emplace_back(gameObject.get(), glm::vec3{direction[0], direction[1], direction[2]});
-                    }
+            auto *characterMovement = gameObject->addComponent<CharacterMovementComponent>(this, capsuleRadius, capsuleHeight);
+            if (!characterMovement)
+                continue;
 
-                    if (lightType == LightComponent::LightType::DIRECTIONAL)
-                    {
-                        if (auto *dl = dynamic_cast<DirectionalLight *>(light.get()))
-                            dl->skyLightEnabled = componentJson.value("sky_light_enabled", true);
-                    }
-                    else if (lightType == LightComponent::LightType::POINT)
-                    {
-                        if (auto *pl = dynamic_cast<PointLight *>(light.get()))
-                        {
-                            pl->radius = componentJson.value("radius", pl->radius);
-                            pl->falloff = componentJson.value("falloff", pl->falloff);
-                        }
-                    }
-                    else if (lightType == LightComponent::LightType::SPOT)
-                    {
-                        if (auto *sl = dynamic_cast<SpotLight *>(light.get()))
-                        {
-                            sl->innerAngle = componentJson.value("inner_angle", sl->innerAngle);
-                            sl->outerAngle = componentJson.value("outer_angle", sl->outerAngle);
-                            sl->range = componentJson.value("range", sl->range);
-                        }
-                    }
-                }
-                else if (type == "rigid_body")
-                {
-                    if (gameObject->getComponent<RagdollComponent>())
-                    {
-                        VX_ENGINE_WARNING_STREAM("Skipping rigid body on entity '" << gameObject->getName()
-                                                 << "' because RagdollComponent is already present.\n");
-                        continue;
-                    }
+            characterMovement->setCapsuleCenterOffsetY(componentJson.value("center_offset_y", characterMovement->getCapsuleCenterOffsetY()));
+            characterMovement->setStepOffset(componentJson.value("step_offset", characterMovement->getStepOffset()));
+            characterMovement->setContactOffset(componentJson.value("contact_offset", characterMovement->getContactOffset()));
+            characterMovement->setSlopeLimitDegrees(componentJson.value("slope_limit_degrees", characterMovement->getSlopeLimitDegrees()));
+        }
+        else if (type == "audio")
+        {
+            auto *audio = gameObject->addComponent<AudioComponent>();
+            const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
+            if (!assetPath.empty())
+                audio->loadFromAsset(assetPath);
+
+            audio->setVolume(componentJson.value("volume", 1.0f));
+            audio->setPitch(componentJson.value("pitch", 1.0f));
+            audio->setLooping(componentJson.value("loop", false));
+            audio->setPlayOnStart(componentJson.value("play_on_start", false));
+            audio->setMuted(componentJson.value("muted", false));
+            audio->setSpatial(componentJson.value("spatial", false));
+            audio->setMinDistance(componentJson.value("min_distance", 1.0f));
+            audio->setMaxDistance(componentJson.value("max_distance", 500.0f));
+
+            const std::string audioTypeStr = componentJson.value("audio_type", "sound");
+            audio->setAudioType(audioTypeStr == "music" ? AudioComponent::AudioType::Music
+                                                        : AudioComponent::AudioType::Sound);
+        }
+        else if (type == "script")
+        {
+            const std::string scriptName = componentJson.value("name", std::string{});
+            if (!scriptName.empty())
+            {
+                Script *script = ScriptsRegister::createScriptFromActiveRegister(scriptName);
+                if (!script)
+                    VX_ENGINE_WARNING_STREAM("Script not found in registry: '" << scriptName
+                                             << "' — adding as broken component (plugin may not be loaded)\n");
 
-                    const glm::vec3 worldPos = transformation->getWorldPosition();
-                    const glm::quat worldRot = transformation->getWorldRotation();
-                    auto *dynActor = m_physicsScene.createDynamic(
-                        physx::PxTransform(
-                            physx::PxVec3(worldPos.x, worldPos.y, worldPos.z),
-                            physx::PxQuat(worldRot.x, worldRot.y, worldRot.z, worldRot.w)));
+                auto *scriptComponent = gameObject->addComponent<ScriptComponent>(scriptName, script);
 
-                    if (dynActor)
-                    {
-                        auto *rb = gameObject->addComponent<RigidBodyComponent>(dynActor);
-                        rb->setKinematic(componentJson.value("is_kinematic", false));
-                        rb->setGravityEnable(componentJson.value("gravity_enabled", true));
-                    }
-                }
-                else if (type == "collision")
+                if (scriptComponent &&
+                    componentJson.contains("variables") &&
+                    componentJson["variables"].is_object())
                 {
-                    std::string collisionType = componentJson.value("collision_type", "box");
-                    std::transform(collisionType.begin(), collisionType.end(), collisionType.begin(), ::tolower);
-
-                    CollisionComponent::ShapeType shapeType = CollisionComponent::ShapeType::BOX;
-                    glm::vec3 boxHalfExtents(0.5f);
-                    float capsuleRadius = 0.5f;
-                    float capsuleHalfHeight = 0.5f;
-                    physx::PxShape *shape = nullptr;
-
-                    if (collisionType == "capsule")
-                    {
-                        shapeType = CollisionComponent::ShapeType::CAPSULE;
-                        capsuleRadius = std::max(componentJson.value("radius", 0.5f), 0.01f);
-                        capsuleHalfHeight = std::max(componentJson.value("half_height", 0.5f), 0.0f);
-                        shape = m_physicsScene.createShape(physx::PxCapsuleGeometry(capsuleRadius, capsuleHalfHeight));
-                        if (shape)
-                            shape->setLocalPose(physx::PxTransform(physx::PxQuat(physx::PxHalfPi, physx::PxVec3(0.0f, 0.0f, 1.0f))));
-                    }
-                    else
+                    Script::ExposedVariablesMap serializedVariables;
+                    for (auto it = componentJson["variables"].begin(); it != componentJson["variables"].end(); ++it)
                     {
-                        if (componentJson.contains("half_extents") &&
-                            componentJson["half_extents"].is_array() &&
-                            componentJson["half_extents"].size() == 3)
-                        {
-                            boxHalfExtents.x = componentJson["half_extents"][0];
-                            boxHalfExtents.y = componentJson["half_extents"][1];
-                            boxHalfExtents.z = componentJson["half_extents"][2];
-                        }
-                        boxHalfExtents = glm::max(boxHalfExtents, glm::vec3(0.01f));
-                        shape = m_physicsScene.createShape(physx::PxBoxGeometry(boxHalfExtents.x, boxHalfExtents.y, boxHalfExtents.z));
-                    }
+                        Script::ExposedVariable variable;
+                        if (!scriptVariableFromJson(it.value(), variable))
+                            continue;
 
-                    if (!shape)
-                    {
-                        VX_ENGINE_ERROR_STREAM("Failed to create collision shape while loading scene\n");
-                        continue;
+                        serializedVariables[it.key()] = std::move(variable);
                     }
 
-                    if (auto *rb = gameObject->getComponent<RigidBodyComponent>())
-                    {
-                        rb->getRigidActor()->attachShape(*shape);
-                        if (auto *dyn = rb->getRigidActor()->is<physx::PxRigidDynamic>())
-                            physx::PxRigidBodyExt::updateMassAndInertia(*dyn, 10.0f);
-
-                        gameObject->addComponent<CollisionComponent>(shape, shapeType, boxHalfExtents, capsuleRadius, capsuleHalfHeight, nullptr);
-                    }
-                    else
-                    {
-                        const glm::vec3 worldPosition = transformation->getWorldPosition();
-                        const glm::quat worldRotation = transformation->getWorldRotation();
-                        auto *staticActor = m_physicsScene.createStatic(
-                            physx::PxTransform(
-                                physx::PxVec3(worldPosition.x, worldPosition.y, worldPosition.z),
-                                physx::PxQuat(worldRotation.x, worldRotation.y, worldRotation.z, worldRotation.w)));
-
-                        staticActor->attachShape(*shape);
-                        gameObject->addComponent<CollisionComponent>(shape, shapeType, boxHalfExtents, capsuleRadius, capsuleHalfHeight, staticActor);
-                    }
+                    scriptComponent->setSerializedVariables(serializedVariables);
                 }
-                else if (type == "character_movement")
-                {
-                    const float capsuleRadius = std::max(componentJson.value("radius", 0.35f), 0.05f);
-                    const float capsuleHeight = std::max(componentJson.value("height", 1.0f), 0.1f);
-
-                    auto *characterMovement = gameObject->addComponent<CharacterMovementComponent>(this, capsuleRadius, capsuleHeight);
-                    if (!characterMovement)
-                        continue;
+            }
+        }
+        else if (type == "particle_system")
+        {
+            auto ps = std::make_shared<ParticleSystem>();
 
-                    characterMovement->setCapsuleCenterOffsetY(componentJson.value("center_offset_y", characterMovement->getCapsuleCenterOffsetY()));
-                    characterMovement->setStepOffset(componentJson.value("step_offset", characterMovement->getStepOffset()));
-                    characterMovement->setContactOffset(componentJson.value("contact_offset", characterMovement->getContactOffset()));
-                    characterMovement->setSlopeLimitDegrees(componentJson.value("slope_limit_degrees", characterMovement->getSlopeLimitDegrees()));
-                }
-                else if (type == "audio")
-                {
-                    auto *audio = gameObject->addComponent<AudioComponent>();
-                    const std::string assetPath = resolveScenePath(componentJson.value("asset_path", std::string{}));
-                    if (!assetPath.empty())
-                        audio->loadFromAsset(assetPath);
-
-                    audio->setVolume(componentJson.value("volume", 1.0f));
-                    audio->setPitch(componentJson.value("pitch", 1.0f));
-                    audio->setLooping(componentJson.value("loop", false));
-                    audio->setPlayOnStart(componentJson.value("play_on_start", false));
-                    audio->setMuted(componentJson.value("muted", false));
-                    audio->setSpatial(componentJson.value("spatial", false));
-                    audio->setMinDistance(componentJson.value("min_distance", 1.0f));
-                    audio->setMaxDistance(componentJson.value("max_distance", 500.0f));
-
-                    const std::string audioTypeStr = componentJson.value("audio_type", "sound");
-                    audio->setAudioType(audioTypeStr == "music" ? AudioComponent::AudioType::Music
-                                                                : AudioComponent::AudioType::Sound);
-                }
-                else if (type == "script")
+            if (componentJson.contains("system") && componentJson["system"].is_object())
+            {
+                const auto &sysJson = componentJson["system"];
+                ps->name = sysJson.value("name", "Particle System");
+
+                if (sysJson.contains("emitters") && sysJson["emitters"].is_array())
                 {
-                    const std::string scriptName = componentJson.value("name", std::string{});
-                    if (!scriptName.empty())
+                    for (const auto &emJson : sysJson["emitters"])
                     {
-                        Script *script = ScriptsRegister::createScriptFromActiveRegister(scriptName);
-                        if (!script)
-                            VX_ENGINE_WARNING_STREAM("Script not found in registry: '" << scriptName
-                                                     << "' — adding as broken component (plugin may not be loaded)\n");
+                        auto *emitter = ps->addEmitter(emJson.value("name", "Emitter"));
+                        emitter->enabled = emJson.value("enabled", true);
 
-                        auto *scriptComponent = gameObject->addComponent<ScriptComponent>(scriptName, script);
+                        if (!emJson.contains("modules"))
+                            continue;
+                        const auto &mods = emJson["modules"];
 
-                        if (scriptComponent &&
-                            componentJson.contains("variables") &&
-                            componentJson["variables"].is_object())
+                        if (mods.contains("spawn"))
                         {
-                            Script::ExposedVariablesMap serializedVariables;
-                            for (auto it = componentJson["variables"].begin(); it != componentJson["variables"].end(); ++it)
+                            const auto &m = mods["spawn"];
+                            auto *spawn = emitter->addModule<SpawnModule>();
+                            spawn->setEnabled(m.value("enabled", true));
+                            spawn->spawnRate = m.value("spawn_rate", 100.0f);
+                            spawn->burstCount = m.value("burst_count", 0.0f);
+                            spawn->loop = m.value("loop", true);
+                            spawn->duration = m.value("duration", 5.0f);
+
+                            if (m.contains("shape") && m["shape"].is_object())
                             {
-                                Script::ExposedVariable variable;
-                                if (!scriptVariableFromJson(it.value(), variable))
-                                    continue;
+                                const auto &sh = m["shape"];
+                                const std::string shapeStr = sh.value("type", "point");
+
+                                if (shapeStr == "sphere")
+                                    spawn->shape.shape = EmitterShape::Sphere;
+                                else if (shapeStr == "box")
+                                    spawn->shape.shape = EmitterShape::Box;
+                                else if (shapeStr == "cone")
+                                    spawn->shape.shape = EmitterShape::Cone;
+                                else if (shapeStr == "cylinder")
+                                    spawn->shape.shape = EmitterShape::Cylinder;
+                                else
+                                    spawn->shape.shape = EmitterShape::Point;
 
-                                serializedVariables[it.key()] = std::move(variable);
+                                if (sh.contains("extents") && sh["extents"].is_array() && sh["extents"].size() == 3)
+                                    spawn->shape.extents = {sh["extents"][0], sh["extents"][1], sh["extents"][2]};
+
+                                spawn->shape.radius = sh.value("radius", 1.0f);
+                                spawn->shape.angle = sh.value("angle", 25.0f);
+                                spawn->shape.height = sh.value("height", 1.0f);
+                                spawn->shape.surfaceOnly = sh.value("surface_only", false);
                             }
 
-                            scriptComponent->setSerializedVariables(serializedVariables);
+                            spawn->subEmitterOnDeath = m.value("sub_emitter_on_death", std::string{});
+                            spawn->subEmitterBurstCount = m.value("sub_emitter_burst_count", 1);
                         }
-                    }
-                }
-                else if (type == "particle_system")
-                {
-                    auto ps = std::make_shared<ParticleSystem>();
-
-                    if (componentJson.contains("system") && componentJson["system"].is_object())
-                    {
-                        const auto &sysJson = componentJson["system"];
-                        ps->name = sysJson.value("name", "Particle System");
 
-                        if (sysJson.contains("emitters") && sysJson["emitters"].is_array())
+                        if (mods.contains("lifetime"))
                         {
-                            for (const auto &emJson : sysJson["emitters"])
-                            {
-                                auto *emitter = ps->addEmitter(emJson.value("name", "Emitter"));
-                                emitter->enabled = emJson.value("enabled", true);
-
-                                if (!emJson.contains("modules"))
-                                    continue;
-                                const auto &mods = emJson["modules"];
-
-                                if (mods.contains("spawn"))
-                                {
-                                    const auto &m = mods["spawn"];
-                                    auto *spawn = emitter->addModule<SpawnModule>();
-                                    spawn->setEnabled(m.value("enabled", true));
-                                    spawn->spawnRate = m.value("spawn_rate", 100.0f);
-                                    spawn->burstCount = m.value("burst_count", 0.0f);
-                                    spawn->loop = m.value("loop", true);
-                                    spawn->duration = m.value("duration", 5.0f);
-
-                                    if (m.contains("shape") && m["shape"].is_object())
-                                    {
-                                        const auto &sh = m["shape"];
-                                        const std::string shapeStr = sh.value("type", "point");
-
-                                        if (shapeStr == "sphere")
-                                            spawn->shape.shape = EmitterShape::Sphere;
-                                        else if (shapeStr == "box")
-                                            spawn->shape.shape = EmitterShape::Box;
-                                        else if (shapeStr == "cone")
-                                            spawn->shape.shape = EmitterShape::Cone;
-                                        else if (shapeStr == "cylinder")
-                                            spawn->shape.shape = EmitterShape::Cylinder;
-                                        else
-                                            spawn->shape.shape = EmitterShape::Point;
-
-                                        if (sh.contains("extents") && sh["extents"].is_array() && sh["extents"].size() == 3)
-                                            spawn->shape.extents = {sh["extents"][0], sh["extents"][1], sh["extents"][2]};
-
-                                        spawn->shape.radius = sh.value("radius", 1.0f);
-                                        spawn->shape.angle = sh.value("angle", 25.0f);
-                                        spawn->shape.height = sh.value("height", 1.0f);
-                                        spawn->shape.surfaceOnly = sh.value("surface_only", false);
-                                    }
-
-                                    spawn->subEmitterOnDeath = m.value("sub_emitter_on_death", std::string{});
-                                    spawn->subEmitterBurstCount = m.value("sub_emitter_burst_count", 1);
-                                }
-
-                                if (mods.contains("lifetime"))
-                                {
-                                    const auto &m = mods["lifetime"];
-                                    auto *mod = emitter->addModule<LifetimeModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    mod->minLifetime = m.value("min", 1.0f);
-                                    mod->maxLifetime = m.value("max", 2.0f);
-                                }
-
-                                if (mods.contains("initial_velocity"))
-                                {
-                                    const auto &m = mods["initial_velocity"];
-                                    auto *mod = emitter->addModule<InitialVelocityModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    if (m.contains("base") && m["base"].is_array() && m["base"].size() == 3)
-                                        mod->baseVelocity = {m["base"][0], m["base"][1], m["base"][2]};
-                                    if (m.contains("randomness") && m["randomness"].is_array() && m["randomness"].size() == 3)
-                                        mod->randomness = {m["randomness"][0], m["randomness"][1], m["randomness"][2]};
-                                }
-
-                                if (mods.contains("size_over_lifetime"))
-                                {
-                                    const auto &m = mods["size_over_lifetime"];
-                                    auto *mod = emitter->addModule<SizeOverLifetimeModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    if (m.contains("base_size") && m["base_size"].is_array() && m["base_size"].size() == 2)
-                                        mod->baseSize = {m["base_size"][0], m["base_size"][1]};
-                                    if (m.contains("curve") && m["curve"].is_array())
-                                    {
-                                        mod->curve.clear();
-                                        for (const auto &pt : m["curve"])
-                                            mod->curve.push_back({pt.value("t", 0.0f), pt.value("v", 1.0f)});
-                                    }
-                                }
+                            const auto &m = mods["lifetime"];
+                            auto *mod = emitter->addModule<LifetimeModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            mod->minLifetime = m.value("min", 1.0f);
+                            mod->maxLifetime = m.value("max", 2.0f);
+                        }
 
-                                if (mods.contains("color_over_lifetime"))
-                                {
-                                    const auto &m = mods["color_over_lifetime"];
-                                    auto *mod = emitter->addModule<ColorOverLifetimeModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    if (m.contains("gradient") && m["gradient"].is_array())
-                                    {
-                                        mod->gradient.clear();
-                                        for (const auto &pt : m["gradient"])
-                                        {
-                                            GradientPoint gp;
-                                            gp.time = pt.value("t", 0.0f);
-                                            if (pt.contains("color") && pt["color"].is_array() && pt["color"].size() == 4)
-                                                gp.color = {pt["color"][0], pt["color"][1], pt["color"][2], pt["color"][3]};
-                                            mod->gradient.push_back(gp);
-                                        }
-                                    }
-                                }
+                        if (mods.contains("initial_velocity"))
+                        {
+                            const auto &m = mods["initial_velocity"];
+                            auto *mod = emitter->addModule<InitialVelocityModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            if (m.contains("base") && m["base"].is_array() && m["base"].size() == 3)
+                                mod->baseVelocity = {m["base"][0], m["base"][1], m["base"][2]};
+                            if (m.contains("randomness") && m["randomness"].is_array() && m["randomness"].size() == 3)
+                                mod->randomness = {m["randomness"][0], m["randomness"][1], m["randomness"][2]};
+                        }
 
-                                if (mods.contains("force"))
-                                {
-                                    const auto &m = mods["force"];
-                                    auto *mod = emitter->addModule<ForceModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    if (m.contains("force") && m["force"].is_array() && m["force"].size() == 3)
-                                        mod->force = {m["force"][0], m["force"][1], m["force"][2]};
-                                    mod->drag = m.value("drag", 0.0f);
-                                }
+                        if (mods.contains("size_over_lifetime"))
+                        {
+                            const auto &m = mods["size_over_lifetime"];
+                            auto *mod = emitter->addModule<SizeOverLifetimeModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            if (m.contains("base_size") && m["base_size"].is_array() && m["base_size"].size() == 2)
+                                mod->baseSize = {m["base_size"][0], m["base_size"][1]};
+                            if (m.contains("curve") && m["curve"].is_array())
+                            {
+                                mod->curve.clear();
+                                for (const auto &pt : m["curve"])
+                                    mod->curve.push_back({pt.value("t", 0.0f), pt.value("v", 1.0f)});
+                            }
+                        }
 
-                                if (mods.contains("renderer"))
+                        if (mods.contains("color_over_lifetime"))
+                        {
+                            const auto &m = mods["color_over_lifetime"];
+                            auto *mod = emitter->addModule<ColorOverLifetimeModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            if (m.contains("gradient") && m["gradient"].is_array())
+                            {
+                                mod->gradient.clear();
+                                for (const auto &pt : m["gradient"])
                                 {
-                                    const auto &m = mods["renderer"];
-                                    auto *mod = emitter->addModule<RendererModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    mod->texturePath = resolveScenePath(m.value("texture_path", std::string{}));
-
-                                    const std::string blendStr = m.value("blend_mode", "alpha_blend");
-                                    if (blendStr == "additive")
-                                        mod->blendMode = ParticleBlendMode::Additive;
-                                    else if (blendStr == "premultiplied")
-                                        mod->blendMode = ParticleBlendMode::Premultiplied;
-                                    else
-                                        mod->blendMode = ParticleBlendMode::AlphaBlend;
-
-                                    const std::string faceStr = m.value("facing_mode", "camera_facing");
-                                    if (faceStr == "velocity_aligned")
-                                        mod->facingMode = ParticleFacingMode::VelocityAligned;
-                                    else if (faceStr == "world_up")
-                                        mod->facingMode = ParticleFacingMode::WorldUp;
-                                    else
-                                        mod->facingMode = ParticleFacingMode::CameraFacing;
-
-                                    mod->castShadows = m.value("cast_shadows", false);
-                                    mod->softParticles = m.value("soft_particles", false);
-                                    mod->softParticleRange = m.value("soft_particle_range", 1.0f);
+                                    GradientPoint gp;
+                                    gp.time = pt.value("t", 0.0f);
+                                    if (pt.contains("color") && pt["color"].is_array() && pt["color"].size() == 4)
+                                        gp.color = {pt["color"][0], pt["color"][1], pt["color"][2], pt["color"][3]};
+                                    mod->gradient.push_back(gp);
                                 }
+                            }
+                        }
 
-                                if (mods.contains("velocity_over_lifetime"))
-                                {
-                                    const auto &m = mods["velocity_over_lifetime"];
-                                    auto *mod = emitter->addModule<VelocityOverLifetimeModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    if (m.contains("speed_curve") && m["speed_curve"].is_array())
-                                    {
-                                        mod->speedCurve.clear();
-                                        for (const auto &pt : m["speed_curve"])
-                                            mod->speedCurve.push_back({pt.value("t", 0.0f), pt.value("v", 1.0f)});
-                                    }
-                                }
+                        if (mods.contains("force"))
+                        {
+                            const auto &m = mods["force"];
+                            auto *mod = emitter->addModule<ForceModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            if (m.contains("force") && m["force"].is_array() && m["force"].size() == 3)
+                                mod->force = {m["force"][0], m["force"][1], m["force"][2]};
+                            mod->drag = m.value("drag", 0.0f);
+                        }
 
-                                if (mods.contains("rotation_over_lifetime"))
-                                {
-                                    const auto &m = mods["rotation_over_lifetime"];
-                                    auto *mod = emitter->addModule<RotationOverLifetimeModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    mod->angularVelocityMin = m.value("angular_velocity_min", -1.0f);
-                                    mod->angularVelocityMax = m.value("angular_velocity_max", 1.0f);
-                                }
+                        if (mods.contains("renderer"))
+                        {
+                            const auto &m = mods["renderer"];
+                            auto *mod = emitter->addModule<RendererModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            mod->texturePath = resolveScenePath(m.value("texture_path", std::string{}));
+
+                            const std::string blendStr = m.value("blend_mode", "alpha_blend");
+                            if (blendStr == "additive")
+                                mod->blendMode = ParticleBlendMode::Additive;
+                            else if (blendStr == "premultiplied")
+                                mod->blendMode = ParticleBlendMode::Premultiplied;
+                            else
+                                mod->blendMode = ParticleBlendMode::AlphaBlend;
+
+                            const std::string faceStr = m.value("facing_mode", "camera_facing");
+                            if (faceStr == "velocity_aligned")
+                                mod->facingMode = ParticleFacingMode::VelocityAligned;
+                            else if (faceStr == "world_up")
+                                mod->facingMode = ParticleFacingMode::WorldUp;
+                            else
+                                mod->facingMode = ParticleFacingMode::CameraFacing;
+
+                            mod->castShadows = m.value("cast_shadows", false);
+                            mod->softParticles = m.value("soft_particles", false);
+                            mod->softParticleRange = m.value("soft_particle_range", 1.0f);
+                        }
 
-                                if (mods.contains("turbulence"))
-                                {
-                                    const auto &m = mods["turbulence"];
-                                    auto *mod = emitter->addModule<TurbulenceModule>();
-                                    mod->setEnabled(m.value("enabled", true));
-                                    mod->strength = m.value("strength", 1.0f);
-                                    mod->frequency = m.value("frequency", 1.0f);
-                                    mod->scrollSpeed = m.value("scroll_speed", 0.5f);
-                                }
+                        if (mods.contains("velocity_over_lifetime"))
+                        {
+                            const auto &m = mods["velocity_over_lifetime"];
+                            auto *mod = emitter->addModule<VelocityOverLifetimeModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            if (m.contains("speed_curve") && m["speed_curve"].is_array())
+                            {
+                                mod->speedCurve.clear();
+                                for (const auto &pt : m["speed_curve"])
+                                    mod->speedCurve.push_back({pt.value("t", 0.0f), pt.value("v", 1.0f)});
                             }
                         }
-                    }
-
-                    auto *psComp = gameObject->addComponent<ParticleSystemComponent>();
-                    psComp->playOnStart = componentJson.value("play_on_start", true);
-                    if (componentJson.contains("vfx_asset_path"))
-                        psComp->vfxAssetPath = resolveScenePath(componentJson.value("vfx_asset_path", std::string{}));
-                    psComp->setParticleSystem(ps);
-                }
-                else if (type == "decal")
-                {
-                    auto *decal = gameObject->addComponent<DecalComponent>();
-                    if (!decal)
-                        continue;
-
-                    if (componentJson.contains("size") &&
-                        componentJson["size"].is_array() &&
-                        componentJson["size"].size() == 3)
-                    {
-                        const auto &size = componentJson["size"];
-                        decal->size = glm::max(glm::abs(glm::vec3{size[0], size[1], size[2]}), glm::vec3(0.01f));
-                    }
 
-                    decal->opacity = std::clamp(componentJson.value("opacity", decal->opacity), 0.0f, 1.0f);
-                    decal->sortOrder = componentJson.value("sort_order", decal->sortOrder);
-                    decal->materialPath = resolveScenePath(componentJson.value("material_path", std::string{}));
+                        if (mods.contains("rotation_over_lifetime"))
+                        {
+                            const auto &m = mods["rotation_over_lifetime"];
+                            auto *mod = emitter->addModule<RotationOverLifetimeModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            mod->angularVelocityMin = m.value("angular_velocity_min", -1.0f);
+                            mod->angularVelocityMax = m.value("angular_velocity_max", 1.0f);
+                        }
 
-                    if (!decal->materialPath.empty())
-                    {
-                        decal->material = decalMaterialResolver.resolveMaterialOverrideFromPath(decal->materialPath);
-                        if (!decal->material)
-                            VX_ENGINE_WARNING_STREAM("Failed to load decal material: " << decal->materialPath << '\n');
+                        if (mods.contains("turbulence"))
+                        {
+                            const auto &m = mods["turbulence"];
+                            auto *mod = emitter->addModule<TurbulenceModule>();
+                            mod->setEnabled(m.value("enabled", true));
+                            mod->strength = m.value("strength", 1.0f);
+                            mod->frequency = m.value("frequency", 1.0f);
+                            mod->scrollSpeed = m.value("scroll_speed", 0.5f);
+                        }
                     }
                 }
-                else if (type == "reflection_probe")
-                {
-                    auto *probe = gameObject->addComponent<ReflectionProbeComponent>();
-                    probe->radius = componentJson.value("radius", 5.0f);
-                    probe->intensity = componentJson.value("intensity", 1.0f);
-                    const std::string hdrPath = resolveScenePath(componentJson.value("hdr_path", std::string{}));
-                    if (!hdrPath.empty())
-                        probe->setHDRPath(hdrPath, core::VulkanContext::getContext()->getPersistentDescriptorPool());
-                }
             }
-        }
-
-        reportStatus("Resolving entity hierarchy...");
 
-        for (const auto &[child, parentId] : pendingParents)
+            auto *psComp = gameObject->addComponent<ParticleSystemComponent>();
+            psComp->playOnStart = componentJson.value("play_on_start", true);
+            if (componentJson.contains("vfx_asset_path"))
+                psComp->vfxAssetPath = resolveScenePath(componentJson.value("vfx_asset_path", std::string{}));
+            psComp->setParticleSystem(ps);
+        }
+        else if (type == "decal")
         {
-            auto it = entitiesById.find(parentId);
-            if (it == entitiesById.end())
-            {
-                VX_ENGINE_WARNING_STREAM("Parent entity with id " << parentId << " was not found while loading scene.\n");
+            auto *decal = gameObject->addComponent<DecalComponent>();
+            if (!decal)
                 continue;
-            }
 
-            if (!child->setParent(it->second))
-                VX_ENGINE_WARNING_STREAM("Failed to set parent for entity '" << child->getName() << "' while loading scene.\n");
-        }
+            if (componentJson.contains("size") &&
+                componentJson["size"].is_array() &&
+                componentJson["size"].size() == 3)
+            {
+                const auto &size = componentJson["size"];
+                decal->size = glm::max(glm::abs(glm::vec3{size[0], size[1], size[2]}), glm::vec3(0.01f));
+            }
 
-        reportStatus("Finalizing light transforms...");
+            decal->opacity = std::clamp(componentJson.value("opacity", decal->opacity), 0.0f, 1.0f);
+            decal->sortOrder = componentJson.value("sort_order", decal->sortOrder);
+            decal->materialPath = resolveScenePath(componentJson.value("material_path", std::string{}));
 
-        for (const auto &[entity, direction] : pendingLightDirections)
+            if (!decal->materialPath.empty())
+            {
+                decal->material = decalMaterialResolver.resolveMaterialOverrideFromPath(decal->materialPath);
+                if (!decal->material)
+                    VX_ENGINE_WARNING_STREAM("Failed to load decal material: " << decal->materialPath << '\n');
+            }
+        }
+        else if (type == "reflection_probe")
         {
-            if (!entity)
-                continue;
+            auto *probe = gameObject->addComponent<ReflectionProbeComponent>();
+            probe->radius = componentJson.value("radius", 5.0f);
+            probe->intensity = componentJson.value("intensity", 1.0f);
+            const std::string hdrPath = resolveScenePath(componentJson.value("hdr_path", std::string{}));
+            if (!hdrPath.empty())
+                probe->setHDRPath(hdrPath, core::VulkanContext::getContext()->getPersistentDescriptorPool());
+        }
+    }
+}
 
-            if (auto *transform = entity->getComponent<Transform3DComponent>())
-                transform->setWorldRotation(worldRotationFromForward(direction));
+void Scene::finishIncrementalLoad()
+{
+    auto &load = *m_incrementalLoad;
+    auto &entitiesById = load.entitiesById;
+    auto &pendingParents = load.pendingParents;
+    auto &pendingLightDirections = load.pendingLightDirections;
+    auto &pendingAnimatorStates = load.pendingAnimatorStates;
 
-            if (auto *lightComponent = entity->getComponent<LightComponent>())
-                lightComponent->syncFromOwnerTransform();
-        }
+    auto reportStatus = [&](const std::string &status)
+    {
+        if (load.statusCallback)
+            load.statusCallback(status);
+    };
 
-        reportStatus("Finalizing animator states...");
+    reportStatus("Resolving entity hierarchy...");
 
-        for (const auto &state : pendingAnimatorStates)
+    for (const auto &[child, parentId] : pendingParents)
+    {
+        auto it = entitiesById.find(parentId);
+        if (it == entitiesById.end())
         {
-            if (!state.entity)
-                continue;
-            auto *anim = state.entity->getComponent<AnimatorComponent>();
-            if (!anim)
-                continue;
-            anim->setAnimationSpeed(state.speed);
-            anim->setAnimationLooped(state.looped);
-            anim->setAnimationPaused(state.paused);
-            anim->setIgnoreRootBoneY(state.ignoreRootBoneY);
-            if (state.selectedAnim >= 0)
-                anim->setSelectedAnimationIndex(state.selectedAnim);
+            VX_ENGINE_WARNING_STREAM("Parent entity with id " << parentId << " was not found while loading scene.\n");
+            continue;
         }
+
+        if (!child->setParent(it->second))
+            VX_ENGINE_WARNING_STREAM("Failed to set parent for entity '" << child->getName() << "' while loading scene.\n");
     }
 
-    reportStatus("Finalizing scene...");
+    reportStatus("Finalizing light transforms...");
 
-    file.close();
+    for (const auto &[entity, direction] : pendingLightDirections)
+    {
+        if (!entity)
+            continue;
 
-    reportStatus("Scene loaded");
+        if (auto *transform = entity->getComponent<Transform3DComponent>())
+            transform->setWorldRotation(worldRotationFromForward(direction));
 
-    return true;
+        if (auto *lightComponent = entity->getComponent<LightComponent>())
+            lightComponent->syncFromOwnerTransform();
+    }
+
+    reportStatus("Finalizing animator states...");
+
+    for (const auto &state : pendingAnimatorStates)
+    {
+        if (!state.entity)
+            continue;
+        auto *anim = state.entity->getComponent<AnimatorComponent>();
+        if (!anim)
+            continue;
+        anim->setAnimationSpeed(state.speed);
+        anim->setAnimationLooped(state.looped);
+        anim->setAnimationPaused(state.paused);
+        anim->setIgnoreRootBoneY(state.ignoreRootBoneY);
+        if (state.selectedAnim >= 0)
+            anim->setSelectedAnimationIndex(state.selectedAnim);
+    }
+
+    reportStatus("Finalizing scene...");
+
+    const LoadStatusCallback statusCallback = std::move(load.statusCallback);
+    m_incrementalLoad.reset();
+
+    if (statusCallback)
+        statusCallback("Scene loaded");
 }
 
 bool Scene::loadEntitiesFromFile(const std::string &filePath, const LoadStatusCallback &statusCallback)
@@ -1719,6 +1859,9 @@ std::vector<Entity::SharedPtr> Scene::extractEntitiesWithTag(const std::string &
         else
             ++it;
     }
+
+    if (!extracted.empty())
+        ++m_entityListRevision;
     return extracted;
 }
 
@@ -1735,6 +1878,8 @@ void Scene::injectEntities(std::vector<Entity::SharedPtr> entities)
 
         m_entities.push_back(std::move(entity));
     }
+
+    ++m_entityListRevision;
 }
 
 std::vector<std::shared_ptr<BaseLight>> Scene::getLights()
@@ -1885,6 +2030,9 @@ void Scene::saveSceneToFile(const std::string &filePath)
             j["type"] = "terrain";
             j["asset_path"] = toRelativePath(terrainComponent->getTerrainAssetPath());
             j["quads_per_chunk"] = terrainComponent->getQuadsPerChunk();
+            j["lod_enabled"] = terrainComponent->isLodEnabled();
+            j["lod_distance_scale"] = terrainComponent->getLodSettings().distanceScale;
+            j["lod_max_patches"] = terrainComponent->getLodSettings().maxPatches;
 
             if (!terrainComponent->getMaterialOverridePath().empty())
                 j["material_override_path"] = toRelativePath(terrainComponent->getMaterialOverridePath());
@@ -2460,6 +2608,9 @@ bool Scene::serializeEntityHierarchy(uint32_t rootEntityId, std::string &outPayl
             componentJson["type"] = "terrain";
             componentJson["asset_path"] = normalizeSerializedPath(terrainComponent->getTerrainAssetPath());
             componentJson["quads_per_chunk"] = terrainComponent->getQuadsPerChunk();
+            componentJson["lod_enabled"] = terrainComponent->isLodEnabled();
+            componentJson["lod_distance_scale"] = terrainComponent->getLodSettings().distanceScale;
+            componentJson["lod_max_patches"] = terrainComponent->getLodSettings().maxPatches;
 
             if (!terrainComponent->getMaterialOverridePath().empty())
                 componentJson["material_override_path"] = normalizeSerializedPath(terrainComponent->getMaterialOverridePath());
@@ -3205,6 +3356,12 @@ Entity *Scene::restoreEntityHierarchy(const std::string &payload, uint32_t *outR
                 auto *terrainComponent = entity->addComponent<TerrainComponent>();
                 terrainComponent->setTerrainAssetPath(assetPath);
                 terrainComponent->setQuadsPerChunk(std::clamp(componentJson.value("quads_per_chunk", 63u), 1u, 512u));
+                terrainComponent->setLodEnabled(componentJson.value("lod_enabled", true));
+
+                TerrainLodSettings lodSettings{};
+                lodSettings.distanceScale = componentJson.value("lod_distance_scale", lodSettings.distanceScale);
+                lodSettings.maxPatches = componentJson.value("lod_max_patches", lodSettings.maxPatches);
+                terrainComponent->setLodSettings(lodSettings);
 
                 if (componentJson.contains("material_override_path") && componentJson["material_override_path"].is_string())
                     terrainComponent->setMaterialOverridePath(resolveSerializedPath(componentJson["material_override_path"].get<std::string>()));
@@ -4032,12 +4189,15 @@ bool Scene::destroyEntity(Entity *entity)
         std::remove_if(m_entities.begin(), m_entities.end(), [&entitiesToDestroy](const std::shared_ptr<Entity> &en)
                        { return entitiesToDestroy.contains(en.get()); }),
         m_entities.end());
+    ++m_entityListRevision;
 
     return true;
 }
 
 void Scene::update(float deltaTime)
 {
+    VX_PROFILE_SCOPE("Scene::update");
+
     // Scripts can spawn/destroy entities during update.
     // Iterate by index and copy shared_ptr to avoid iterator/reference invalidation.
     for (size_t index = 0; index < m_entities.size(); ++index)
@@ -4047,19 +4207,16 @@ void Scene::update(float deltaTime)
             entity->update(deltaTime);
     }
 
-    m_physicsScene.update(deltaTime);
+    runParallelScriptUpdates(deltaTime);
+    m_commandBuffer.apply(*this);
 
-    for (size_t index = 0; index < m_entities.size(); ++index)
+    // Physics is stepped in fixedUpdate(); here only bodies that moved are placed between the last two steps.
+    for (const auto &movingBody : m_movingRigidBodies)
     {
-        auto entity = m_entities[index];
-        if (!entity)
+        if (movingBody.lifetime.expired())
             continue;
 
-        if (!entity->isEnabled())
-            continue;
-
-        if (auto *rigidBodyComponent = entity->getComponent<RigidBodyComponent>())
-            rigidBodyComponent->syncFromPhysics();
+        movingBody.component->interpolateTransform(m_physicsInterpolationAlpha);
     }
 
     for (size_t index = 0; index < m_entities.size(); ++index)
@@ -4072,12 +4229,269 @@ void Scene::update(float deltaTime)
 
 void Scene::fixedUpdate(float fixedDelta)
 {
+    VX_PROFILE_SCOPE("Scene::fixedUpdate");
+
+    finishPhysicsStep();
+
     for (size_t index = 0; index < m_entities.size(); ++index)
     {
         auto entity = m_entities[index];
         if (entity && entity->isEnabled())
             entity->fixedUpdate(fixedDelta);
     }
+
+    if (m_asyncPhysicsEnabled)
+    {
+        m_physicsScene.beginStep(fixedDelta);
+        return;
+    }
+
+    m_physicsScene.update(fixedDelta);
+    capturePhysicsStates();
+}
+
+void Scene::finishPhysicsStep()
+{
+    if (m_physicsScene.finishStep())
+        capturePhysicsStates();
+}
+
+void Scene::capturePhysicsStates()
+{
+    VX_PROFILE_SCOPE("Scene::capturePhysicsStates");
+
+    // Only actors that moved in this step are visited; sleeping bodies cost nothing.
+    uint32_t activeActorCount = 0u;
+    physx::PxActor **activeActors = m_physicsScene.getActiveActors(activeActorCount);
+
+    ++m_physicsStepIndex;
+    m_nextMovingRigidBodies.clear();
+    m_nextMovingRigidBodies.reserve(activeActorCount + m_movingRigidBodies.size());
+
+    for (uint32_t actorIndex = 0; actorIndex < activeActorCount; ++actorIndex)
+    {
+        physx::PxActor *actor = activeActors[actorIndex];
+        auto *entity = static_cast<Entity *>(actor->userData);
+        if (!entity || !entity->isEnabled())
+            continue;
+
+        // userData is the owning entity; ragdoll and controller actors share it but aren't the body's actor.
+        auto *rigidBodyComponent = entity->getComponent<RigidBodyComponent>();
+        if (!rigidBodyComponent || rigidBodyComponent->getRigidActor() != actor || !rigidBodyComponent->isInterpolated())
+            continue;
+
+        rigidBodyComponent->capturePhysicsState(m_physicsStepIndex);
+        m_nextMovingRigidBodies.push_back({rigidBodyComponent, rigidBodyComponent->getLifetimeToken(), false});
+    }
+
+    for (const auto &movingBody : m_movingRigidBodies)
+    {
+        if (movingBody.settling || movingBody.lifetime.expired())
+            continue;
+
+        if (movingBody.component->getLastCapturedStep() == m_physicsStepIndex)
+            continue;
+
+        movingBody.component->settlePhysicsState();
+        m_nextMovingRigidBodies.push_back({movingBody.component, movingBody.lifetime, true});
+    }
+
+    std::swap(m_movingRigidBodies, m_nextMovingRigidBodies);
+}
+
+void Scene::setAsyncPhysicsEnabled(bool enabled)
+{
+    if (m_asyncPhysicsEnabled == enabled)
+        return;
+
+    if (!enabled)
+        finishPhysicsStep();
+
+    m_asyncPhysicsEnabled = enabled;
+}
+
+bool Scene::isAsyncPhysicsEnabled() const
+{
+    return m_asyncPhysicsEnabled;
+}
+
+void Scene::setPhysicsInterpolationAlpha(float alpha)
+{
+    m_physicsInterpolationAlpha = std::clamp(alpha, 0.0f, 1.0f);
+}
+
+namespace
+{
+    thread_local bool t_inParallelScriptUpdate{false};
+    thread_local const Entity *t_parallelScriptJobOwner{nullptr};
+
+    struct ParallelScriptUpdateScope
+    {
+        ParallelScriptUpdateScope()
+        {
+            t_inParallelScriptUpdate = true;
+        }
+
+        ~ParallelScriptUpdateScope()
+        {
+            t_inParallelScriptUpdate = false;
+            t_parallelScriptJobOwner = nullptr;
+        }
+    };
+} // namespace
+
+// Owner access is only compared with declared access: two owners never touch each other's components.
+bool Scene::conflictsWithParallelScriptBatch(const ParallelScriptBatch &batch) const
+{
+    return batch.access.conflictsWith(m_entityParallelAccess) ||
+           batch.access.conflictsWith(m_entityOwnerAccess) ||
+           m_entityParallelAccess.conflictsWith(batch.ownerAccess);
+}
+
+void Scene::buildParallelScriptBatches()
+{
+    for (size_t index = 0; index < m_parallelScriptBatchCount; ++index)
+    {
+        auto &batch = m_parallelScriptBatches[index];
+        batch.access.clear();
+        batch.ownerAccess.clear();
+        batch.scripts.clear();
+        batch.jobOffsets.clear();
+    }
+    m_parallelScriptBatchCount = 0u;
+
+    for (const auto &entity : m_entities)
+    {
+        if (!entity || !entity->isEnabled())
+            continue;
+
+        const auto *scriptComponents = entity->findMultiComponentsByType(std::type_index(typeid(ScriptComponent)));
+        if (!scriptComponents)
+            continue;
+
+        m_entityParallelScripts.clear();
+        m_entityParallelAccess.clear();
+
+        for (const auto &component : *scriptComponents)
+        {
+            auto *scriptComponent = static_cast<ScriptComponent *>(component.get());
+            if (!scriptComponent->hasParallelUpdate())
+                continue;
+
+            m_entityParallelScripts.push_back(scriptComponent);
+            m_entityParallelAccess.merge(scriptComponent->getParallelUpdateAccess());
+        }
+
+        if (m_entityParallelScripts.empty())
+            continue;
+
+        // The job writes anything on its own entity. Its transform is listed as a read: other jobs read
+        // transforms from the snapshot, so only declared transform writes must keep away from it.
+        m_entityOwnerAccess.clear();
+        for (const auto &[type, _] : entity->getSingleComponents())
+        {
+            if (type == std::type_index(typeid(Transform3DComponent)))
+                m_entityOwnerAccess.reads(type);
+            else
+                m_entityOwnerAccess.writes(type);
+        }
+        for (const auto &[type, _] : entity->getMultiComponents())
+            m_entityOwnerAccess.writes(type);
+
+        // First batch this entity's job does not conflict with.
+        size_t batchIndex = 0u;
+        while (batchIndex < m_parallelScriptBatchCount &&
+               conflictsWithParallelScriptBatch(m_parallelScriptBatches[batchIndex]))
+            ++batchIndex;
+
+        if (batchIndex == m_parallelScriptBatchCount)
+        {
+            if (m_parallelScriptBatchCount == m_parallelScriptBatches.size())
+                m_parallelScriptBatches.emplace_back();
+            ++m_parallelScriptBatchCount;
+        }
+
+        auto &batch = m_parallelScriptBatches[batchIndex];
+        if (batch.jobOffsets.empty())
+            batch.jobOffsets.push_back(0u);
+
+        batch.access.merge(m_entityParallelAccess);
+        batch.ownerAccess.merge(m_entityOwnerAccess);
+        batch.scripts.insert(batch.scripts.end(), m_entityParallelScripts.begin(), m_entityParallelScripts.end());
+        batch.jobOffsets.push_back(batch.scripts.size());
+    }
+}
+
+void Scene::runParallelScriptUpdates(float deltaTime)
+{
+    VX_PROFILE_SCOPE("Scene::parallelScriptUpdates");
+
+    buildParallelScriptBatches();
+    if (m_parallelScriptBatchCount == 0u)
+        return;
+
+    // Scripts look up names and terrain concurrently and never rebuild these themselves.
+    refreshTerrainComponents();
+    refreshEntityNameIndex();
+
+    // Jobs read other entities' transforms from here while owners move their own.
+    for (const auto &entity : m_entities)
+        if (auto *transform = entity ? entity->getComponent<Transform3DComponent>() : nullptr)
+            transform->captureParallelReadSnapshot();
+
+    // Batches run one after another; entity jobs inside a batch run concurrently.
+    for (size_t batchIndex = 0; batchIndex < m_parallelScriptBatchCount; ++batchIndex)
+    {
+        const auto &batch = m_parallelScriptBatches[batchIndex];
+        const size_t jobCount = batch.jobOffsets.size() - 1u;
+
+        const auto runJobs = [&batch, deltaTime](size_t begin, size_t end)
+        {
+            ParallelScriptUpdateScope scope;
+
+            for (size_t job = begin; job < end; ++job)
+            {
+                t_parallelScriptJobOwner = batch.scripts[batch.jobOffsets[job]]->getOwner<Entity>();
+                for (size_t script = batch.jobOffsets[job]; script < batch.jobOffsets[job + 1u]; ++script)
+                    batch.scripts[script]->parallelUpdate(deltaTime);
+            }
+        };
+
+        if (m_parallelScriptUpdateEnabled)
+            ThreadPoolManager::instance().parallelFor(jobCount, runJobs);
+        else
+            runJobs(0u, jobCount);
+    }
+}
+
+SceneCommandBuffer &Scene::getCommandBuffer()
+{
+    return m_commandBuffer;
+}
+
+void Scene::setParallelScriptUpdateEnabled(bool enabled)
+{
+    m_parallelScriptUpdateEnabled = enabled;
+}
+
+bool Scene::isParallelScriptUpdateEnabled() const
+{
+    return m_parallelScriptUpdateEnabled;
+}
+
+bool Scene::isInParallelScriptUpdate()
+{
+    return t_inParallelScriptUpdate;
+}
+
+const Entity *Scene::getParallelScriptJobOwner()
+{
+    return t_parallelScriptJobOwner;
+}
+
+size_t Scene::getParallelScriptBatchCount() const
+{
+    return m_parallelScriptBatchCount;
 }
 
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include "Engine/SceneCommandBuffer.hpp"
+#include "Engine/Scene.hpp"
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void SceneCommandBuffer::enqueue(Command command)
+{
+    if (!command)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_commands.push_back(std::move(command));
+}
+
+void SceneCommandBuffer::spawnEntity(const std::string &name, std::function<void(Entity &)> onSpawned)
+{
+    enqueue([name, onSpawned = std::move(onSpawned)](Scene &scene)
+            {
+                auto entity = scene.addEntity(name);
+                if (entity && onSpawned)
+                    onSpawned(*entity); });
+}
+
+void SceneCommandBuffer::destroyEntity(const Entity *entity)
+{
+    if (!entity)
+        return;
+
+    const uint32_t entityId = entity->getId();
+    enqueue([entityId](Scene &scene)
+            { scene.destroyEntity(scene.getEntityById(entityId)); });
+}
+
+void SceneCommandBuffer::enqueueForEntity(const Entity *entity, std::function<void(Entity &)> command)
+{
+    const uint32_t entityId = entity->getId();
+    enqueue([entityId, command = std::move(command)](Scene &scene)
+            {
+                if (auto *target = scene.getEntityById(entityId))
+                    command(*target); });
+}
+
+void SceneCommandBuffer::apply(Scene &scene)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_applying.swap(m_commands);
+    }
+
+    for (auto &command : m_applying)
+        command(scene);
+
+    m_applying.clear();
+}
+
+bool SceneCommandBuffer::isEmpty() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_commands.empty();
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -1,13 +1,44 @@
 #include "Engine/SceneManager.hpp"
 
 #include "Engine/Entity.hpp"
+#include "Engine/PreparedSceneFile.hpp"
 #include "Engine/Scene.hpp"
 #include "Engine/Scripting/VelixAPI.hpp"
 
 #include "Core/Logger.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+float SceneManager::LoadProgress::getFraction() const
+{
+    switch (stage)
+    {
+    case LoadStage::None:
+        return 1.0f;
+    case LoadStage::Reading:
+        return 0.0f;
+    case LoadStage::Streaming:
+        return prefetchedModelCount == 0u
+                   ? 0.1f
+                   : 0.1f + 0.3f * static_cast<float>(streamedModelCount) / static_cast<float>(prefetchedModelCount);
+    case LoadStage::Activating:
+        return gameObjectCount == 0u
+                   ? 0.4f
+                   : 0.4f + 0.6f * static_cast<float>(builtGameObjectCount) / static_cast<float>(gameObjectCount);
+    }
+
+    return 0.0f;
+}
+
+SceneManager::ActiveLoad::~ActiveLoad()
+{
+    if (readThread.joinable())
+        readThread.join();
+}
+
 SceneManager &SceneManager::instance()
 {
     static SceneManager s_instance;
@@ -43,72 +74,188 @@ void SceneManager::clearDontDestroyOnLoad(Entity *entity)
 
 bool SceneManager::hasPendingRequests() const
 {
-    return !m_pendingRequests.empty();
+    return !m_pendingRequests.empty() || m_activeLoad != nullptr;
 }
 
-void SceneManager::processRequests(std::shared_ptr<Scene> &activeScene,
-                                   const SceneChangedCallback &onSceneChanged)
+bool SceneManager::isLoading() const
 {
-    if (m_pendingRequests.empty())
-        return;
+    return m_activeLoad != nullptr;
+}
 
-    auto requests = std::move(m_pendingRequests);
-    m_pendingRequests.clear();
+SceneManager::LoadProgress SceneManager::getLoadProgress() const
+{
+    LoadProgress progress{};
+    if (!m_activeLoad)
+        return progress;
 
-    for (const auto &request : requests)
+    progress.stage = m_activeLoad->stage;
+    progress.filePath = m_activeLoad->request.payload;
+
+    if (const auto &preparedFile = m_activeLoad->preparedFile)
     {
-        switch (request.type)
-        {
-        case Request::Type::LoadScene:
-        {
-            if (!activeScene)
-                break;
+        progress.prefetchedModelCount = preparedFile->getPrefetchedModelCount();
+        progress.streamedModelCount = progress.prefetchedModelCount - preparedFile->getPendingModelCount();
+    }
+
+    if (m_activeLoad->stage == LoadStage::Activating && m_activeLoad->scene)
+    {
+        progress.builtGameObjectCount = m_activeLoad->scene->getIncrementalLoadedGameObjectCount();
+        progress.gameObjectCount = m_activeLoad->scene->getIncrementalLoadGameObjectCount();
+    }
 
-            // Preserve DontDestroyOnLoad entities before the new scene is created.
-            auto preserved = activeScene->extractEntitiesWithTag(k_dontDestroyTag);
+    return progress;
+}
 
-            auto newScene = std::make_shared<Scene>();
-            if (!newScene->loadSceneFromFile(request.payload))
-            {
-                VX_ENGINE_ERROR_STREAM("SceneManager: failed to load scene: " << request.payload << '\n');
-                // Roll back: re-inject preserved entities into the original scene.
-                activeScene->injectEntities(std::move(preserved));
-                break;
-            }
+void SceneManager::setActivationBudgetMs(float milliseconds)
+{
+    m_activationBudgetMs = std::max(0.0f, milliseconds);
+}
 
-            // Re-inject preserved entities into the new scene.
-            newScene->injectEntities(std::move(preserved));
+float SceneManager::getActivationBudgetMs() const
+{
+    return m_activationBudgetMs;
+}
 
-            activeScene = newScene;
-            scripting::setActiveScene(activeScene.get());
+void SceneManager::beginLoad(const Request &request)
+{
+    m_activeLoad = std::make_unique<ActiveLoad>();
+    m_activeLoad->request = request;
+    m_activeLoad->readJob = std::make_shared<ReadJob>();
 
-            if (onSceneChanged)
-                onSceneChanged(activeScene);
+    m_activeLoad->readThread = std::thread([readJob = m_activeLoad->readJob, filePath = request.payload]()
+                                           {
+                                               readJob->preparedFile = PreparedSceneFile::load(filePath, true);
+                                               readJob->finished.store(true, std::memory_order_release); });
+}
 
-            VX_ENGINE_INFO_STREAM("SceneManager: loaded scene: " << request.payload << '\n');
-            break;
+bool SceneManager::advanceLoad(std::shared_ptr<Scene> &activeScene,
+                               const SceneChangedCallback &onSceneChanged,
+                               const SceneChangedCallback &onSceneChanging)
+{
+    auto &load = *m_activeLoad;
+    const bool additive = load.request.type == Request::Type::LoadAdditive;
+
+    if (load.stage == LoadStage::Reading)
+    {
+        if (!load.readJob->finished.load(std::memory_order_acquire))
+            return false;
+
+        load.readThread.join();
+        load.preparedFile = std::move(load.readJob->preparedFile);
+        load.readJob.reset();
+
+        if (!load.preparedFile)
+        {
+            VX_ENGINE_ERROR_STREAM("SceneManager: failed to load " << (additive ? "additive scene: " : "scene: ")
+                                                                    << load.request.payload << '\n');
+            return true;
         }
 
-        case Request::Type::LoadAdditive:
+        load.stage = LoadStage::Streaming;
+    }
+
+    if (load.stage == LoadStage::Streaming)
+    {
+        // Building before the models arrive would make mesh components queue their own duplicate loads.
+        if (load.preparedFile->getPendingModelCount() > 0u)
+            return false;
+
+        if (!activeScene)
+            return true;
+
+        load.scene = additive ? activeScene : std::make_shared<Scene>();
+        load.scene->beginIncrementalLoad(load.preparedFile, additive);
+        load.stage = LoadStage::Activating;
+    }
+
+    // The active scene was replaced under an additive load; its remaining entities have nowhere to go.
+    if (additive && load.scene != activeScene)
+    {
+        VX_ENGINE_WARNING_STREAM("SceneManager: active scene changed, dropping additive load: " << load.request.payload << '\n');
+        return true;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                             std::chrono::duration<float, std::milli>(m_activationBudgetMs));
+
+    bool activated = false;
+    do
+    {
+        activated = load.scene->continueIncrementalLoad(k_activationBatchSize);
+    } while (!activated && Clock::now() < deadline);
+
+    if (!activated)
+        return false;
+
+    if (onSceneChanging)
+        onSceneChanging(activeScene);
+
+    if (additive)
+    {
+        if (onSceneChanged)
+            onSceneChanged(activeScene);
+
+        VX_ENGINE_INFO_STREAM("SceneManager: loaded additive scene: " << load.request.payload << '\n');
+        return true;
+    }
+
+    // DontDestroyOnLoad entities stay in the old scene until the new one is ready to take over.
+    auto preserved = activeScene->extractEntitiesWithTag(k_dontDestroyTag);
+    load.scene->injectEntities(std::move(preserved));
+
+    activeScene = load.scene;
+    scripting::setActiveScene(activeScene.get());
+
+    if (onSceneChanged)
+        onSceneChanged(activeScene);
+
+    VX_ENGINE_INFO_STREAM("SceneManager: loaded scene: " << load.request.payload << '\n');
+    return true;
+}
+
+void SceneManager::processRequests(std::shared_ptr<Scene> &activeScene,
+                                   const SceneChangedCallback &onSceneChanged,
+                                   const SceneChangedCallback &onSceneChanging)
+{
+    while (true)
+    {
+        if (m_activeLoad)
         {
-            if (!activeScene)
-                break;
+            if (!advanceLoad(activeScene, onSceneChanged, onSceneChanging))
+                return;
 
-            if (!activeScene->loadEntitiesFromFile(request.payload))
-                VX_ENGINE_ERROR_STREAM("SceneManager: failed to load additive scene: " << request.payload << '\n');
-            else
-                VX_ENGINE_INFO_STREAM("SceneManager: loaded additive scene: " << request.payload << '\n');
-            break;
+            m_activeLoad.reset();
+            continue;
         }
 
+        if (m_pendingRequests.empty())
+            return;
+
+        const Request request = std::move(m_pendingRequests.front());
+        m_pendingRequests.pop_front();
+
+        if (!activeScene)
+            continue;
+
+        switch (request.type)
+        {
+        case Request::Type::LoadScene:
+        case Request::Type::LoadAdditive:
+            beginLoad(request);
+            break;
+
         case Request::Type::UnloadGroup:
         {
-            if (!activeScene)
-                break;
+            if (onSceneChanging)
+                onSceneChanging(activeScene);
 
             const auto removed = activeScene->extractEntitiesWithTag(request.payload);
             VX_ENGINE_INFO_STREAM("SceneManager: unloaded " << removed.size()
                                   << " entities with tag '" << request.payload << "'\n");
+
+            if (onSceneChanged)
+                onSceneChanged(activeScene);
             break;
         }
         }
@@ -21,12 +21,16 @@
 #include "Engine/Components/SkeletalMeshComponent.hpp"
 #include "Engine/Components/SpriteMeshComponent.hpp"
 #include "Engine/Components/StaticMeshComponent.hpp"
+#include "Engine/Components/TerrainComponent.hpp"
 #include "Engine/Components/Transform2DComponent.hpp"
 #include "Engine/Components/Transform3DComponent.hpp"
 
 #include <glm/gtc/quaternion.hpp>
 
+#include <array>
 #include <string_view>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
@@ -42,73 +46,52 @@ namespace
         return scene ? scene : g_activeScene;
     }
 
-    bool componentNameMatches(std::string_view componentName, std::initializer_list<std::string_view> aliases)
+    struct ComponentTypeInfo
     {
-        for (const auto alias : aliases)
-            if (componentName == alias)
-                return true;
-
-        return false;
-    }
+        std::type_index type;
+        bool multiComponent;
+        std::array<std::string_view, 4> aliases;
+    };
 
+    // Storage follows Entity::addComponent, so the flag comes from the same trait.
     template <typename T>
-    void appendSingleComponent(Entity *entity, std::vector<ECS *> &result)
+    ComponentTypeInfo makeComponentTypeInfo(std::array<std::string_view, 4> aliases)
     {
-        if (!entity)
-            return;
-
-        if (auto *component = entity->getComponent<T>())
-            result.push_back(component);
+        return {typeid(T), IsMultiComponent<T>::value, aliases};
     }
 
-    template <typename T>
-    void appendMultiComponents(Entity *entity, std::vector<ECS *> &result)
+    // Index + 1 is the ComponentTypeId handed out by resolveComponentType().
+    const std::array<ComponentTypeInfo, 14> &componentTypeTable()
     {
-        if (!entity)
-            return;
-
-        const auto components = entity->getComponents<T>();
-        for (auto *component : components)
-            result.push_back(component);
+        static const std::array<ComponentTypeInfo, 14> table{{
+            makeComponentTypeInfo<Transform3DComponent>({"Transform3DComponent", "Transform3D", "transform3d", "transform"}),
+            makeComponentTypeInfo<Transform2DComponent>({"Transform2DComponent", "Transform2D", "transform2d"}),
+            makeComponentTypeInfo<CameraComponent>({"CameraComponent", "Camera", "camera"}),
+            makeComponentTypeInfo<StaticMeshComponent>({"StaticMeshComponent", "StaticMesh", "static_mesh"}),
+            makeComponentTypeInfo<SkeletalMeshComponent>({"SkeletalMeshComponent", "SkeletalMesh", "skeletal_mesh"}),
+            makeComponentTypeInfo<AnimatorComponent>({"AnimatorComponent", "Animator", "animator"}),
+            makeComponentTypeInfo<LightComponent>({"LightComponent", "Light", "light"}),
+            makeComponentTypeInfo<RigidBodyComponent>({"RigidBodyComponent", "RigidBody", "rigidbody"}),
+            makeComponentTypeInfo<CollisionComponent>({"CollisionComponent", "Collision", "collision"}),
+            makeComponentTypeInfo<CharacterMovementComponent>({"CharacterMovementComponent", "CharacterMovement", "character_movement"}),
+            makeComponentTypeInfo<SpriteMeshComponent>({"SpriteMeshComponent", "SpriteMesh", "sprite_mesh"}),
+            makeComponentTypeInfo<AudioComponent>({"AudioComponent", "Audio", "audio"}),
+            makeComponentTypeInfo<ScriptComponent>({"ScriptComponent", "Script", "script"}),
+            makeComponentTypeInfo<ParticleSystemComponent>({"ParticleSystemComponent", "ParticleSystem", "particle_system"}),
+        }};
+
+        return table;
     }
 
-    std::vector<ECS *> collectComponentsByName(Entity *entity, std::string_view componentTypeName)
+    const ComponentTypeInfo *findComponentTypeInfo(ComponentTypeId componentType)
     {
-        std::vector<ECS *> result;
-        if (!entity || componentTypeName.empty())
-            return result;
-
-        if (componentNameMatches(componentTypeName, {"Transform3DComponent", "Transform3D", "transform3d", "transform"}))
-            appendSingleComponent<Transform3DComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"Transform2DComponent", "Transform2D", "transform2d"}))
-            appendSingleComponent<Transform2DComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"CameraComponent", "Camera", "camera"}))
-            appendSingleComponent<CameraComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"StaticMeshComponent", "StaticMesh", "static_mesh"}))
-            appendSingleComponent<StaticMeshComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"SkeletalMeshComponent", "SkeletalMesh", "skeletal_mesh"}))
-            appendSingleComponent<SkeletalMeshComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"AnimatorComponent", "Animator", "animator"}))
-            appendSingleComponent<AnimatorComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"LightComponent", "Light", "light"}))
-            appendSingleComponent<LightComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"RigidBodyComponent", "RigidBody", "rigidbody"}))
-            appendSingleComponent<RigidBodyComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"CollisionComponent", "Collision", "collision"}))
-            appendSingleComponent<CollisionComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"CharacterMovementComponent", "CharacterMovement", "character_movement"}))
-            appendSingleComponent<CharacterMovementComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"SpriteMeshComponent", "SpriteMesh", "sprite_mesh"}))
-            appendSingleComponent<SpriteMeshComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"AudioComponent", "Audio", "audio"}))
-            appendMultiComponents<AudioComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"ScriptComponent", "Script", "script"}))
-            appendMultiComponents<ScriptComponent>(entity, result);
-        else if (componentNameMatches(componentTypeName, {"ParticleSystemComponent", "ParticleSystem", "particle_system"}))
-            appendMultiComponents<ParticleSystemComponent>(entity, result);
+        const auto &table = componentTypeTable();
+        if (componentType == INVALID_COMPONENT_TYPE || componentType > table.size())
+            return nullptr;
 
-        return result;
+        return &table[componentType - 1u];
     }
+
 } // namespace
 
 void setActiveScene(Scene *scene)
@@ -146,6 +129,14 @@ Entity *spawnEntity(const char *name, Scene *scene)
         return nullptr;
 
     const std::string entityName = name ? name : "Entity";
+
+    // Parallel scripts cannot mutate the entity list; the spawn is applied at the end of the scene update.
+    if (Scene::isInParallelScriptUpdate())
+    {
+        targetScene->getCommandBuffer().spawnEntity(entityName);
+        return nullptr;
+    }
+
     auto entity = targetScene->addEntity(entityName);
 
     return entity ? entity.get() : nullptr;
@@ -158,9 +149,21 @@ bool destroyEntity(Entity *entity, Scene *scene)
     if (!targetScene || !entity)
         return false;
 
+    if (Scene::isInParallelScriptUpdate())
+    {
+        targetScene->getCommandBuffer().destroyEntity(entity);
+        return true;
+    }
+
     return targetScene->destroyEntity(entity);
 }
 
+SceneCommandBuffer *getCommandBuffer(Scene *scene)
+{
+    auto *targetScene = resolveScene(scene);
+    return targetScene ? &targetScene->getCommandBuffer() : nullptr;
+}
+
 Entity *findEntityById(uint32_t id, Scene *scene)
 {
     auto *targetScene = resolveScene(scene);
@@ -178,13 +181,7 @@ Entity *findEntityByName(const char *name, Scene *scene)
     if (!targetScene || !name)
         return nullptr;
 
-    for (const auto &entity : targetScene->getEntities())
-    {
-        if (entity && entity->getName() == name)
-            return entity.get();
-    }
-
-    return nullptr;
+    return targetScene->findEntityByName(name);
 }
 
 uint64_t getEntitiesCount(Scene *scene)
@@ -219,38 +216,85 @@ std::string getEntityName(const Entity *entity)
     return entity->getName();
 }
 
-ECS *getEntitySingleComponent(Entity *entity, const char *componentTypeName)
+ComponentTypeId resolveComponentType(const char *componentTypeName)
 {
     if (!componentTypeName)
-        return nullptr;
+        return INVALID_COMPONENT_TYPE;
+
+    static const auto aliasToType = []
+    {
+        std::unordered_map<std::string_view, ComponentTypeId> result;
+        const auto &table = componentTypeTable();
+
+        for (size_t index = 0; index < table.size(); ++index)
+            for (const auto alias : table[index].aliases)
+                if (!alias.empty())
+                    result.emplace(alias, static_cast<ComponentTypeId>(index + 1u));
+
+        return result;
+    }();
 
-    const auto components = collectComponentsByName(entity, componentTypeName);
-    return components.empty() ? nullptr : components.front();
+    auto it = aliasToType.find(componentTypeName);
+    return it != aliasToType.end() ? it->second : INVALID_COMPONENT_TYPE;
 }
 
-uint64_t getEntityComponentsCount(Entity *entity, const char *componentTypeName)
+ECS *getEntitySingleComponent(Entity *entity, ComponentTypeId componentType)
 {
-    if (!componentTypeName)
+    return getEntityComponentByIndex(entity, componentType, 0u);
+}
+
+uint64_t getEntityComponentsCount(Entity *entity, ComponentTypeId componentType)
+{
+    const auto *info = findComponentTypeInfo(componentType);
+    if (!entity || !info)
         return 0;
 
-    return static_cast<uint64_t>(collectComponentsByName(entity, componentTypeName).size());
+    if (!info->multiComponent)
+        return entity->findComponentByType(info->type) ? 1u : 0u;
+
+    const auto *components = entity->findMultiComponentsByType(info->type);
+    return components ? static_cast<uint64_t>(components->size()) : 0u;
 }
 
-ECS *getEntityComponentByIndex(Entity *entity, const char *componentTypeName, uint64_t index)
+ECS *getEntityComponentByIndex(Entity *entity, ComponentTypeId componentType, uint64_t index)
 {
-    if (!componentTypeName)
+    const auto *info = findComponentTypeInfo(componentType);
+    if (!entity || !info)
         return nullptr;
 
-    const auto components = collectComponentsByName(entity, componentTypeName);
-    if (index >= components.size())
+    if (!info->multiComponent)
+        return index == 0u ? entity->findComponentByType(info->type) : nullptr;
+
+    const auto *components = entity->findMultiComponentsByType(info->type);
+    if (!components || index >= components->size())
         return nullptr;
 
-    return components[index];
+    return (*components)[index].get();
+}
+
+bool entityHasComponent(Entity *entity, ComponentTypeId componentType)
+{
+    return getEntitySingleComponent(entity, componentType) != nullptr;
+}
+
+ECS *getEntitySingleComponent(Entity *entity, const char *componentTypeName)
+{
+    return getEntitySingleComponent(entity, resolveComponentType(componentTypeName));
+}
+
+uint64_t getEntityComponentsCount(Entity *entity, const char *componentTypeName)
+{
+    return getEntityComponentsCount(entity, resolveComponentType(componentTypeName));
+}
+
+ECS *getEntityComponentByIndex(Entity *entity, const char *componentTypeName, uint64_t index)
+{
+    return getEntityComponentByIndex(entity, resolveComponentType(componentTypeName), index);
 }
 
 bool entityHasComponent(Entity *entity, const char *componentTypeName)
 {
-    return getEntitySingleComponent(entity, componentTypeName) != nullptr;
+    return getEntitySingleComponent(entity, resolveComponentType(componentTypeName)) != nullptr;
 }
 
 void loadScene(const char *filePath)
@@ -271,6 +315,16 @@ void unloadGroup(const char *tag)
         SceneManager::instance().requestUnloadGroup(tag);
 }
 
+bool isSceneLoading()
+{
+    return SceneManager::instance().isLoading();
+}
+
+float getSceneLoadProgress()
+{
+    return SceneManager::instance().getLoadProgress().getFraction();
+}
+
 void setDontDestroyOnLoad(Entity *entity)
 {
     SceneManager::instance().setDontDestroyOnLoad(entity);
@@ -306,6 +360,75 @@ bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDista
     return targetScene->getPhysicsScene().raycast(origin, direction, maxDistance, outHit);
 }
 
+void raycastBatch(const PhysicsRaycastBatch &batch, PhysicsQueryResults &results, Scene *scene)
+{
+    auto *targetScene = resolveScene(scene);
+    if (!targetScene)
+    {
+        results.resize(batch.size());
+        return;
+    }
+
+    targetScene->getPhysicsScene().raycastBatch(batch, results);
+}
+
+const TerrainQuery *findTerrainQuery(float worldX, float worldZ, Scene *scene)
+{
+    auto *targetScene = resolveScene(scene);
+    if (!targetScene)
+        return nullptr;
+
+    for (auto *terrainComponent : targetScene->getTerrainComponents())
+        if (terrainComponent->getQuery().contains(worldX, worldZ))
+            return &terrainComponent->getQuery();
+
+    return nullptr;
+}
+
+bool sampleTerrainHeight(float worldX, float worldZ, float &outHeight, glm::vec3 *outNormal, Scene *scene)
+{
+    const TerrainQuery *terrainQuery = findTerrainQuery(worldX, worldZ, scene);
+    if (!terrainQuery)
+        return false;
+
+    if (!outNormal)
+        return terrainQuery->sampleHeight(worldX, worldZ, outHeight);
+
+    TerrainSurfaceSample sample;
+    if (!terrainQuery->sampleSurface(worldX, worldZ, sample))
+        return false;
+
+    outHeight = sample.position.y;
+    *outNormal = sample.normal;
+    return true;
+}
+
+bool raycastTerrain(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance,
+                    TerrainRayHit *outHit, Scene *scene)
+{
+    auto *targetScene = resolveScene(scene);
+    if (!targetScene)
+        return false;
+
+    TerrainRayHit closestHit;
+    bool hasHit = false;
+    for (auto *terrainComponent : targetScene->getTerrainComponents())
+    {
+        TerrainRayHit hit;
+        const float searchDistance = hasHit ? closestHit.distance : maxDistance;
+        if (terrainComponent->getQuery().raycast(origin, direction, searchDistance, hit))
+        {
+            closestHit = hit;
+            hasHit = true;
+        }
+    }
+
+    if (hasHit && outHit)
+        *outHit = closestHit;
+
+    return hasHit;
+}
+
 void addImpulse(Entity *entity, const glm::vec3 &impulse)
 {
     if (!entity)
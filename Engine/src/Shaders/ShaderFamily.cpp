@@ -43,10 +43,18 @@ void EngineShaderFamilies::initEngineShaderFamilies()
                                             VK_SHADER_STAGE_CLOSEST_HIT_BIT_KHR;
         lightSSBOLayoutBinding.pImmutableSamplers = nullptr;
 
+        VkDescriptorSetLayoutBinding lightClusterLayoutBinding{};
+        lightClusterLayoutBinding.binding = 4;
+        lightClusterLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        lightClusterLayoutBinding.descriptorCount = 1;
+        lightClusterLayoutBinding.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+        lightClusterLayoutBinding.pImmutableSamplers = nullptr;
+
         std::vector<VkDescriptorSetLayoutBinding> cameraBindings{
             uboLayoutBinding,
             lightSpaceBinding,
-            lightSSBOLayoutBinding};
+            lightSSBOLayoutBinding,
+            lightClusterLayoutBinding};
 
         if (hasAccelerationStructureSupport)
         {
@@ -63,7 +71,7 @@ void EngineShaderFamilies::initEngineShaderFamilies()
             cameraBindings.push_back(accelerationStructureBinding);
         }
 
-        // All bindings default to 0 (fully bound); TLAS (binding 3) is partially bound
+        // All bindings default to 0 (fully bound); TLAS (binding 3, pushed last) is partially bound
         // so it can be legally unset when no TLAS is available (e.g. empty scene, first frame).
         std::vector<VkDescriptorBindingFlags> cameraBindingFlags(cameraBindings.size(), 0u);
         if (hasAccelerationStructureSupport)
@@ -11,6 +11,8 @@
 #include <iomanip>
 #include <limits>
 
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
 namespace
 {
     float sanitizeFinite(float value, float fallback)
@@ -27,54 +29,122 @@ namespace
     {
         return static_cast<uint16_t>(std::clamp<int64_t>(value, 0, std::numeric_limits<uint16_t>::max()));
     }
-} // namespace
 
-ELIX_NESTED_NAMESPACE_BEGIN(engine)
+    bool prepareOutputPath(const std::string &filePath, std::filesystem::path &outPath)
+    {
+        if (filePath.empty())
+            return false;
 
-bool saveTerrainAssetToFile(const TerrainAsset &terrainAsset, const std::string &filePath)
-{
-    if (filePath.empty())
-        return false;
+        std::error_code errorCode;
+        outPath = std::filesystem::path(filePath).lexically_normal();
+        if (!outPath.parent_path().empty())
+            std::filesystem::create_directories(outPath.parent_path(), errorCode);
 
-    std::error_code errorCode;
-    const std::filesystem::path outputPath = std::filesystem::path(filePath).lexically_normal();
-    if (!outputPath.parent_path().empty())
-        std::filesystem::create_directories(outputPath.parent_path(), errorCode);
+        if (errorCode)
+        {
+            VX_ENGINE_ERROR_STREAM("Failed to create terrain asset directory: " << outPath.parent_path() << '\n');
+            return false;
+        }
 
-    if (errorCode)
-    {
-        VX_ENGINE_ERROR_STREAM("Failed to create terrain asset directory: " << outputPath.parent_path() << '\n');
-        return false;
+        return true;
     }
 
-    TerrainAsset sanitized = terrainAsset;
-    sanitized.version = TerrainAsset::CURRENT_VERSION;
-    sanitized.width = sanitizeDimension(sanitized.width);
-    sanitized.height = sanitizeDimension(sanitized.height);
-    sanitized.worldSizeX = std::max(1.0f, sanitizeFinite(sanitized.worldSizeX, 100.0f));
-    sanitized.worldSizeZ = std::max(1.0f, sanitizeFinite(sanitized.worldSizeZ, 100.0f));
-    sanitized.heightScale = std::max(0.01f, sanitizeFinite(sanitized.heightScale, 25.0f));
-    sanitized.weightmapChannels = std::clamp(sanitized.weightmapChannels, 1u, 4u);
+    nlohmann::json layersToJson(const std::vector<TerrainLayerInfo> &layers)
+    {
+        nlohmann::json layersJson = nlohmann::json::array();
+        for (const auto &layer : layers)
+        {
+            layersJson.push_back({
+                {"name", layer.name},
+                {"material_path", layer.materialPath},
+                {"albedo_texture", layer.albedoTexture},
+                {"normal_texture", layer.normalTexture},
+                {"orm_texture", layer.ormTexture},
+                {"uv_scale", std::max(0.001f, sanitizeFinite(layer.uvScale, 1.0f))},
+                {"blend_hardness", std::clamp(sanitizeFinite(layer.blendHardness, 0.5f), 0.0f, 1.0f)},
+            });
+        }
 
-    const size_t expectedHeightSamples = static_cast<size_t>(sanitized.width) * static_cast<size_t>(sanitized.height);
-    if (sanitized.heightSamples.size() != expectedHeightSamples)
-        sanitized.heightSamples.assign(expectedHeightSamples, 0u);
+        return layersJson;
+    }
 
-    const bool validWeightmapResolution = sanitized.weightmapWidth > 0u && sanitized.weightmapHeight > 0u;
-    if (!validWeightmapResolution)
+    std::vector<TerrainLayerInfo> layersFromJson(const nlohmann::json &json)
     {
-        sanitized.weightmapWidth = 0u;
-        sanitized.weightmapHeight = 0u;
-        sanitized.weightmapData.clear();
+        std::vector<TerrainLayerInfo> layers;
+        if (!json.contains("layers") || !json["layers"].is_array())
+            return layers;
+
+        for (const auto &layerJson : json["layers"])
+        {
+            if (!layerJson.is_object())
+                continue;
+
+            TerrainLayerInfo layer{};
+            layer.name = layerJson.value("name", std::string{"Layer"});
+            layer.materialPath = layerJson.value("material_path", std::string{});
+            layer.albedoTexture = layerJson.value("albedo_texture", std::string{});
+            layer.normalTexture = layerJson.value("normal_texture", std::string{});
+            layer.ormTexture = layerJson.value("orm_texture", std::string{});
+            layer.uvScale = std::max(0.001f, sanitizeFinite(layerJson.value("uv_scale", 1.0f), 1.0f));
+            layer.blendHardness = std::clamp(sanitizeFinite(layerJson.value("blend_hardness", 0.5f), 0.5f), 0.0f, 1.0f);
+            layers.push_back(std::move(layer));
+        }
+
+        return layers;
     }
-    else
+
+    TerrainAsset sanitizeForSave(const TerrainAsset &terrainAsset)
     {
-        const size_t expectedWeightmapSize = static_cast<size_t>(sanitized.weightmapWidth) *
-                                             static_cast<size_t>(sanitized.weightmapHeight) *
-                                             static_cast<size_t>(sanitized.weightmapChannels);
-        if (sanitized.weightmapData.size() != expectedWeightmapSize)
-            sanitized.weightmapData.assign(expectedWeightmapSize, 255u);
+        TerrainAsset sanitized = terrainAsset;
+        sanitized.version = TerrainAsset::CURRENT_VERSION;
+        sanitized.width = sanitizeDimension(sanitized.width);
+        sanitized.height = sanitizeDimension(sanitized.height);
+        sanitized.worldSizeX = std::max(1.0f, sanitizeFinite(sanitized.worldSizeX, 100.0f));
+        sanitized.worldSizeZ = std::max(1.0f, sanitizeFinite(sanitized.worldSizeZ, 100.0f));
+        sanitized.heightScale = std::max(0.01f, sanitizeFinite(sanitized.heightScale, 25.0f));
+        sanitized.weightmapChannels = std::clamp(sanitized.weightmapChannels, 1u, 4u);
+
+        const size_t expectedHeightSamples = static_cast<size_t>(sanitized.width) * static_cast<size_t>(sanitized.height);
+        if (sanitized.heightSamples.size() != expectedHeightSamples)
+            sanitized.heightSamples.assign(expectedHeightSamples, 0u);
+
+        const bool validWeightmapResolution = sanitized.weightmapWidth > 0u && sanitized.weightmapHeight > 0u;
+        if (!validWeightmapResolution)
+        {
+            sanitized.weightmapWidth = 0u;
+            sanitized.weightmapHeight = 0u;
+            sanitized.weightmapData.clear();
+        }
+        else
+        {
+            const size_t expectedWeightmapSize = static_cast<size_t>(sanitized.weightmapWidth) *
+                                                 static_cast<size_t>(sanitized.weightmapHeight) *
+                                                 static_cast<size_t>(sanitized.weightmapChannels);
+            if (sanitized.weightmapData.size() != expectedWeightmapSize)
+                sanitized.weightmapData.assign(expectedWeightmapSize, 255u);
+        }
+
+        return sanitized;
     }
+} // namespace
+
+bool saveTerrainAssetToFile(const TerrainAsset &terrainAsset, const std::string &filePath, uint32_t tileSize)
+{
+    std::filesystem::path outputPath;
+    if (!prepareOutputPath(filePath, outputPath))
+        return false;
+
+    return TerrainTileFile::write(sanitizeForSave(terrainAsset), outputPath.string(), tileSize);
+}
+
+bool saveTerrainAssetToJsonFile(const TerrainAsset &terrainAsset, const std::string &filePath)
+{
+    std::filesystem::path outputPath;
+    if (!prepareOutputPath(filePath, outputPath))
+        return false;
+
+    const TerrainAsset sanitized = sanitizeForSave(terrainAsset);
+    const bool validWeightmapResolution = sanitized.weightmapWidth > 0u && sanitized.weightmapHeight > 0u;
 
     nlohmann::json json;
     json["version"] = sanitized.version;
@@ -89,20 +159,7 @@ bool saveTerrainAssetToFile(const TerrainAsset &terrainAsset, const std::string
         {"height_scale", sanitized.heightScale},
         {"samples_u16", sanitized.heightSamples}};
 
-    nlohmann::json layersJson = nlohmann::json::array();
-    for (const auto &layer : sanitized.layers)
-    {
-        layersJson.push_back({
-            {"name", layer.name},
-            {"material_path", layer.materialPath},
-            {"albedo_texture", layer.albedoTexture},
-            {"normal_texture", layer.normalTexture},
-            {"orm_texture", layer.ormTexture},
-            {"uv_scale", std::max(0.001f, sanitizeFinite(layer.uvScale, 1.0f))},
-            {"blend_hardness", std::clamp(sanitizeFinite(layer.blendHardness, 0.5f), 0.0f, 1.0f)},
-        });
-    }
-    json["layers"] = std::move(layersJson);
+    json["layers"] = layersToJson(sanitized.layers);
 
     if (validWeightmapResolution)
     {
@@ -129,6 +186,15 @@ std::optional<TerrainAsset> loadTerrainAssetFromFile(const std::string &filePath
     if (filePath.empty())
         return std::nullopt;
 
+    if (TerrainTileFile::isTerrainTileFile(filePath))
+    {
+        TerrainTileFile tileFile;
+        if (!tileFile.open(filePath))
+            return std::nullopt;
+
+        return tileFile.loadAll();
+    }
+
     std::ifstream file(filePath);
     if (!file.is_open())
     {
@@ -187,25 +253,7 @@ std::optional<TerrainAsset> loadTerrainAssetFromFile(const std::string &filePath
     if (terrainAsset.heightSamples.size() != expectedHeightSamples)
         terrainAsset.heightSamples.assign(expectedHeightSamples, 0u);
 
-    terrainAsset.layers.clear();
-    if (json.contains("layers") && json["layers"].is_array())
-    {
-        for (const auto &layerJson : json["layers"])
-        {
-            if (!layerJson.is_object())
-                continue;
-
-            TerrainLayerInfo layer{};
-            layer.name = layerJson.value("name", std::string{"Layer"});
-            layer.materialPath = layerJson.value("material_path", std::string{});
-            layer.albedoTexture = layerJson.value("albedo_texture", std::string{});
-            layer.normalTexture = layerJson.value("normal_texture", std::string{});
-            layer.ormTexture = layerJson.value("orm_texture", std::string{});
-            layer.uvScale = std::max(0.001f, sanitizeFinite(layerJson.value("uv_scale", 1.0f), 1.0f));
-            layer.blendHardness = std::clamp(sanitizeFinite(layerJson.value("blend_hardness", 0.5f), 0.5f), 0.0f, 1.0f);
-            terrainAsset.layers.push_back(std::move(layer));
-        }
-    }
+    terrainAsset.layers = layersFromJson(json);
 
     if (json.contains("weightmap") && json["weightmap"].is_object())
     {
@@ -243,4 +291,25 @@ std::optional<TerrainAsset> loadTerrainAssetFromFile(const std::string &filePath
     return terrainAsset;
 }
 
+std::string serializeTerrainMetadata(const TerrainAsset &terrainAsset)
+{
+    nlohmann::json json;
+    json["name"] = terrainAsset.name;
+    json["source_heightmap_path"] = terrainAsset.sourceHeightmapPath;
+    json["layers"] = layersToJson(terrainAsset.layers);
+    return json.dump();
+}
+
+bool deserializeTerrainMetadata(const std::string &metadata, TerrainAsset &outTerrainAsset)
+{
+    const nlohmann::json json = nlohmann::json::parse(metadata, nullptr, false);
+    if (!json.is_object())
+        return false;
+
+    outTerrainAsset.name = json.value("name", std::string{"Terrain"});
+    outTerrainAsset.sourceHeightmapPath = json.value("source_heightmap_path", std::string{});
+    outTerrainAsset.layers = layersFromJson(json);
+    return true;
+}
+
 ELIX_NESTED_NAMESPACE_END
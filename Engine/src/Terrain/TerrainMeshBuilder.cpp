@@ -1,43 +1,173 @@
 #include "Engine/Terrain/TerrainMeshBuilder.hpp"
 
+#include "Engine/Threads/ThreadPoolManager.hpp"
 #include "Engine/Vertex.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
-#include <limits>
+#include <map>
+#include <mutex>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
 namespace
 {
-    float safeHeight(const TerrainAsset &terrainAsset, int32_t x, int32_t y)
+    struct TerrainGridMetrics
     {
-        if (!terrainAsset.isValid())
-            return 0.0f;
-
-        const int32_t maxX = static_cast<int32_t>(terrainAsset.width) - 1;
-        const int32_t maxY = static_cast<int32_t>(terrainAsset.height) - 1;
-        x = std::clamp(x, 0, maxX);
-        y = std::clamp(y, 0, maxY);
-        return terrainAsset.sampleWorldHeight(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+        uint32_t quadsX{1};
+        uint32_t quadsY{1};
+        float worldMinX{0.0f};
+        float worldMinZ{0.0f};
+        float gridStepX{1.0f};
+        float gridStepZ{1.0f};
+    };
+
+    TerrainGridMetrics computeGridMetrics(const TerrainAsset &terrainAsset)
+    {
+        TerrainGridMetrics metrics{};
+        metrics.quadsX = terrainAsset.width - 1u;
+        metrics.quadsY = terrainAsset.height - 1u;
+        metrics.worldMinX = -terrainAsset.worldSizeX * 0.5f;
+        metrics.worldMinZ = -terrainAsset.worldSizeZ * 0.5f;
+        metrics.gridStepX = terrainAsset.worldSizeX / static_cast<float>(metrics.quadsX);
+        metrics.gridStepZ = terrainAsset.worldSizeZ / static_cast<float>(metrics.quadsY);
+        return metrics;
     }
 
-    glm::vec3 computeNormal(const TerrainAsset &terrainAsset, int32_t x, int32_t y, float gridStepX, float gridStepZ)
+    TerrainMeshSource gatherSource(const TerrainAsset &terrainAsset,
+                                   uint32_t x,
+                                   uint32_t y,
+                                   uint32_t quadsX,
+                                   uint32_t quadsY,
+                                   uint32_t step)
     {
-        const float hL = safeHeight(terrainAsset, x - 1, y);
-        const float hR = safeHeight(terrainAsset, x + 1, y);
-        const float hD = safeHeight(terrainAsset, x, y - 1);
-        const float hU = safeHeight(terrainAsset, x, y + 1);
+        const TerrainGridMetrics metrics = computeGridMetrics(terrainAsset);
+
+        TerrainMeshSource source{};
+        source.x = x;
+        source.y = y;
+        source.quadsX = quadsX;
+        source.quadsY = quadsY;
+        source.step = step;
+        source.terrainQuadsX = metrics.quadsX;
+        source.terrainQuadsY = metrics.quadsY;
+        source.worldMinX = metrics.worldMinX;
+        source.worldMinZ = metrics.worldMinZ;
+        source.gridStepX = metrics.gridStepX;
+        source.gridStepZ = metrics.gridStepZ;
+        if (!terrainAsset.layers.empty())
+            source.baseLayer = terrainAsset.layers.front();
 
-        const float dx = hR - hL;
-        const float dz = hU - hD;
+        const uint32_t pointsX = quadsX + 3u;
+        const uint32_t pointsY = quadsY + 3u;
+        source.heights.resize(static_cast<size_t>(pointsX) * pointsY);
 
-        glm::vec3 normal(-dx / std::max(gridStepX * 2.0f, 0.0001f), 1.0f, -dz / std::max(gridStepZ * 2.0f, 0.0001f));
-        const float length = glm::length(normal);
-        if (length <= std::numeric_limits<float>::epsilon())
-            return {0.0f, 1.0f, 0.0f};
+        // Clamped sample column per grid point, shared by every row.
+        std::vector<uint32_t> sampleColumns(pointsX);
+        for (uint32_t pointX = 0; pointX < pointsX; ++pointX)
+        {
+            const int64_t sampleX = static_cast<int64_t>(x) + (static_cast<int64_t>(pointX) - 1) * step;
+            sampleColumns[pointX] = static_cast<uint32_t>(std::clamp<int64_t>(sampleX, 0, metrics.quadsX));
+        }
 
-        return normal / length;
+        const float heightScale = terrainAsset.heightScale / 65535.0f;
+        for (uint32_t pointY = 0; pointY < pointsY; ++pointY)
+        {
+            const int64_t sampleY = static_cast<int64_t>(y) + (static_cast<int64_t>(pointY) - 1) * step;
+            const uint16_t *sampleRow = terrainAsset.heightSamples.data() +
+                                        static_cast<size_t>(std::clamp<int64_t>(sampleY, 0, metrics.quadsY)) * terrainAsset.width;
+            float *heightRow = source.heights.data() + static_cast<size_t>(pointY) * pointsX;
+
+            for (uint32_t pointX = 0; pointX < pointsX; ++pointX)
+                heightRow[pointX] = static_cast<float>(sampleRow[sampleColumns[pointX]]) * heightScale;
+        }
+
+        return source;
+    }
+
+    std::vector<uint32_t> buildPatchIndexPattern(uint32_t patchQuads, uint32_t stitchMask)
+    {
+        const uint32_t vertsPerRow = patchQuads + 1u;
+        const uint32_t blockCount = patchQuads / 2u;
+
+        std::vector<uint32_t> indices;
+        indices.reserve(static_cast<size_t>(patchQuads) * patchQuads * 6u);
+
+        for (uint32_t blockY = 0; blockY < blockCount; ++blockY)
+        {
+            for (uint32_t blockX = 0; blockX < blockCount; ++blockX)
+            {
+                const uint32_t x = blockX * 2u;
+                const uint32_t y = blockY * 2u;
+                const auto vertexAt = [vertsPerRow, x, y](uint32_t offsetX, uint32_t offsetY)
+                { return (y + offsetY) * vertsPerRow + x + offsetX; };
+
+                const uint32_t center = vertexAt(1u, 1u);
+                // Block ring, counter-clockwise in (x, z): -Z side, +X side, +Z side, -X side.
+                const std::array<uint32_t, 9> ring{
+                    vertexAt(0u, 0u), vertexAt(1u, 0u), vertexAt(2u, 0u),
+                    vertexAt(2u, 1u), vertexAt(2u, 2u), vertexAt(1u, 2u),
+                    vertexAt(0u, 2u), vertexAt(0u, 1u), vertexAt(0u, 0u)};
+
+                const std::array<bool, 4> stitchedSides{
+                    blockY == 0u && (stitchMask & TERRAIN_STITCH_NEG_Z) != 0u,
+                    blockX == blockCount - 1u && (stitchMask & TERRAIN_STITCH_POS_X) != 0u,
+                    blockY == blockCount - 1u && (stitchMask & TERRAIN_STITCH_POS_Z) != 0u,
+                    blockX == 0u && (stitchMask & TERRAIN_STITCH_NEG_X) != 0u};
+
+                // Same winding as the full-resolution chunks (clockwise in x, z).
+                const auto emit = [&indices, center](uint32_t from, uint32_t to)
+                {
+                    indices.push_back(center);
+                    indices.push_back(to);
+                    indices.push_back(from);
+                };
+
+                for (uint32_t side = 0; side < 4u; ++side)
+                {
+                    const uint32_t first = side * 2u;
+                    if (stitchedSides[side])
+                    {
+                        emit(ring[first], ring[first + 2u]);
+                        continue;
+                    }
+
+                    emit(ring[first], ring[first + 1u]);
+                    emit(ring[first + 1u], ring[first + 2u]);
+                }
+            }
+        }
+
+        return indices;
+    }
+
+    std::vector<uint32_t> buildGridIndexPattern(uint32_t quadsX, uint32_t quadsY)
+    {
+        const uint32_t vertsX = quadsX + 1u;
+        std::vector<uint32_t> indices(static_cast<size_t>(quadsX) * quadsY * 6u);
+
+        uint32_t *output = indices.data();
+        for (uint32_t localY = 0; localY < quadsY; ++localY)
+        {
+            for (uint32_t localX = 0; localX < quadsX; ++localX)
+            {
+                const uint32_t topLeft = localY * vertsX + localX;
+                const uint32_t topRight = topLeft + 1u;
+                const uint32_t bottomLeft = topLeft + vertsX;
+                const uint32_t bottomRight = bottomLeft + 1u;
+
+                *output++ = topLeft;
+                *output++ = bottomLeft;
+                *output++ = topRight;
+
+                *output++ = topRight;
+                *output++ = bottomLeft;
+                *output++ = bottomRight;
+            }
+        }
+
+        return indices;
     }
 } // namespace
 
@@ -45,110 +175,162 @@ std::vector<CPUMesh> TerrainMeshBuilder::buildChunkMeshes(const TerrainAsset &te
                                                           const TerrainMeshBuildSettings &settings)
 {
     std::vector<CPUMesh> meshes;
-    if (!terrainAsset.isValid())
+    const TerrainChunkLayout layout = computeChunkLayout(terrainAsset, settings.quadsPerChunk);
+    if (layout.getChunkCount() == 0u)
         return meshes;
 
+    meshes.resize(layout.getChunkCount());
+    ThreadPoolManager::instance().parallelFor(meshes.size(), [&](size_t begin, size_t end)
+                                              {
+        for (size_t chunkIndex = begin; chunkIndex < end; ++chunkIndex)
+        {
+            const uint32_t chunkX = static_cast<uint32_t>(chunkIndex % layout.chunkCountX);
+            const uint32_t chunkY = static_cast<uint32_t>(chunkIndex / layout.chunkCountX);
+            meshes[chunkIndex] = buildMesh(gatherChunkSource(terrainAsset, layout, chunkX, chunkY));
+            meshes[chunkIndex].getGeometryInfo();
+        } });
+
+    return meshes;
+}
+
+TerrainChunkLayout TerrainMeshBuilder::computeChunkLayout(const TerrainAsset &terrainAsset, uint32_t quadsPerChunk)
+{
+    TerrainChunkLayout layout{};
+    if (!terrainAsset.isValid())
+        return layout;
+
     const uint32_t quadsX = terrainAsset.width - 1u;
     const uint32_t quadsY = terrainAsset.height - 1u;
-    if (quadsX == 0u || quadsY == 0u)
-        return meshes;
 
-    const uint32_t quadsPerChunk = std::clamp(settings.quadsPerChunk, 1u, std::max(quadsX, quadsY));
-    const uint32_t chunkCountX = (quadsX + quadsPerChunk - 1u) / quadsPerChunk;
-    const uint32_t chunkCountY = (quadsY + quadsPerChunk - 1u) / quadsPerChunk;
-    meshes.reserve(static_cast<size_t>(chunkCountX) * static_cast<size_t>(chunkCountY));
+    layout.quadsPerChunk = std::clamp(quadsPerChunk, 1u, std::max(quadsX, quadsY));
+    layout.chunkCountX = (quadsX + layout.quadsPerChunk - 1u) / layout.quadsPerChunk;
+    layout.chunkCountY = (quadsY + layout.quadsPerChunk - 1u) / layout.quadsPerChunk;
+    return layout;
+}
+
+CPUMesh TerrainMeshBuilder::buildPatchMesh(const TerrainAsset &terrainAsset,
+                                           const TerrainQuadtree &quadtree,
+                                           const TerrainLodSelection &selection)
+{
+    return buildMesh(gatherPatchSource(terrainAsset, quadtree, selection));
+}
+
+TerrainMeshSource TerrainMeshBuilder::gatherChunkSource(const TerrainAsset &terrainAsset,
+                                                        const TerrainChunkLayout &layout,
+                                                        uint32_t chunkX,
+                                                        uint32_t chunkY)
+{
+    const uint32_t startX = chunkX * layout.quadsPerChunk;
+    const uint32_t startY = chunkY * layout.quadsPerChunk;
+    const uint32_t quadsX = std::min(layout.quadsPerChunk, terrainAsset.width - 1u - startX);
+    const uint32_t quadsY = std::min(layout.quadsPerChunk, terrainAsset.height - 1u - startY);
+
+    TerrainMeshSource source = gatherSource(terrainAsset, startX, startY, quadsX, quadsY, 1u);
+    source.name = "TerrainChunk_" + std::to_string(chunkX) + "_" + std::to_string(chunkY);
+    source.indices = &getGridIndices(quadsX, quadsY);
+    return source;
+}
+
+TerrainMeshSource TerrainMeshBuilder::gatherPatchSource(const TerrainAsset &terrainAsset,
+                                                        const TerrainQuadtree &quadtree,
+                                                        const TerrainLodSelection &selection)
+{
+    const auto &node = quadtree.getNode(selection.nodeIndex);
+    const uint32_t patchQuads = quadtree.getPatchQuads();
 
-    const float worldMinX = -terrainAsset.worldSizeX * 0.5f;
-    const float worldMinZ = -terrainAsset.worldSizeZ * 0.5f;
-    const float gridStepX = terrainAsset.worldSizeX / static_cast<float>(quadsX);
-    const float gridStepZ = terrainAsset.worldSizeZ / static_cast<float>(quadsY);
+    // Patches overhanging a non power-of-two terrain clamp to its edge; those triangles collapse.
+    TerrainMeshSource source = gatherSource(terrainAsset, node.x, node.y, patchQuads, patchQuads, 1u << node.level);
+    source.name = "TerrainPatch_L" + std::to_string(node.level) + "_" + std::to_string(node.x) + "_" + std::to_string(node.y);
+    source.indices = &getPatchIndices(patchQuads, selection.stitchMask);
+    return source;
+}
 
-    for (uint32_t chunkY = 0; chunkY < chunkCountY; ++chunkY)
+CPUMesh TerrainMeshBuilder::buildMesh(const TerrainMeshSource &source)
+{
+    const uint32_t vertsX = source.quadsX + 1u;
+    const uint32_t vertsY = source.quadsY + 1u;
+    const size_t pointsX = static_cast<size_t>(source.quadsX) + 3u;
+    const glm::vec3 tangent(1.0f, 0.0f, 0.0f);
+
+    // Central differences over one grid point, i.e. `step` heightmap samples (wider for coarse patches).
+    const float span = 2.0f * static_cast<float>(source.step);
+    const float normalScaleX = 1.0f / std::max(source.gridStepX * span, 0.0001f);
+    const float normalScaleZ = 1.0f / std::max(source.gridStepZ * span, 0.0001f);
+
+    std::vector<vertex::Vertex3D> vertices(static_cast<size_t>(vertsX) * vertsY);
+
+    for (uint32_t localY = 0; localY < vertsY; ++localY)
     {
-        for (uint32_t chunkX = 0; chunkX < chunkCountX; ++chunkX)
+        const uint32_t sampleY = std::min(source.y + localY * source.step, source.terrainQuadsY);
+        const float *heightRow = source.heights.data() + (static_cast<size_t>(localY) + 1u) * pointsX + 1u;
+
+        for (uint32_t localX = 0; localX < vertsX; ++localX)
         {
-            const uint32_t startX = chunkX * quadsPerChunk;
-            const uint32_t startY = chunkY * quadsPerChunk;
-            const uint32_t endX = std::min(startX + quadsPerChunk, quadsX);
-            const uint32_t endY = std::min(startY + quadsPerChunk, quadsY);
+            const uint32_t sampleX = std::min(source.x + localX * source.step, source.terrainQuadsX);
 
-            const uint32_t vertsX = (endX - startX) + 1u;
-            const uint32_t vertsY = (endY - startY) + 1u;
-            const uint32_t localQuadCountX = vertsX - 1u;
-            const uint32_t localQuadCountY = vertsY - 1u;
+            const float *height = heightRow + localX;
 
-            std::vector<vertex::Vertex3D> vertices;
-            vertices.resize(static_cast<size_t>(vertsX) * static_cast<size_t>(vertsY));
+            const glm::vec3 position(source.worldMinX + static_cast<float>(sampleX) * source.gridStepX,
+                                     *height,
+                                     source.worldMinZ + static_cast<float>(sampleY) * source.gridStepZ);
+            const glm::vec2 uv(static_cast<float>(sampleX) / static_cast<float>(source.terrainQuadsX),
+                               static_cast<float>(sampleY) / static_cast<float>(source.terrainQuadsY));
 
-            for (uint32_t localY = 0; localY < vertsY; ++localY)
-            {
-                for (uint32_t localX = 0; localX < vertsX; ++localX)
-                {
-                    const uint32_t sampleX = startX + localX;
-                    const uint32_t sampleY = startY + localY;
+            glm::vec3 normal(-(height[1] - height[-1]) * normalScaleX,
+                             1.0f,
+                             -(height[pointsX] - height[-static_cast<ptrdiff_t>(pointsX)]) * normalScaleZ);
+            normal = glm::normalize(normal);
+            const glm::vec3 bitangent = glm::normalize(glm::cross(normal, tangent));
 
-                    const float worldX = worldMinX + static_cast<float>(sampleX) * gridStepX;
-                    const float worldY = terrainAsset.sampleWorldHeight(sampleX, sampleY);
-                    const float worldZ = worldMinZ + static_cast<float>(sampleY) * gridStepZ;
+            vertices[static_cast<size_t>(localY) * vertsX + localX] = vertex::Vertex3D(position, uv, normal, tangent, bitangent);
+        }
+    }
 
-                    const float u = static_cast<float>(sampleX) / static_cast<float>(quadsX);
-                    const float v = static_cast<float>(sampleY) / static_cast<float>(quadsY);
+    CPUMesh mesh = CPUMesh::build(vertices, source.indices ? *source.indices : getGridIndices(source.quadsX, source.quadsY));
+    mesh.name = source.name;
 
-                    const glm::vec3 normal = computeNormal(
-                        terrainAsset,
-                        static_cast<int32_t>(sampleX),
-                        static_cast<int32_t>(sampleY),
-                        gridStepX,
-                        gridStepZ);
+    if (source.baseLayer.has_value())
+    {
+        const TerrainLayerInfo &baseLayer = source.baseLayer.value();
+        mesh.material.name = baseLayer.name;
+        mesh.material.albedoTexture = baseLayer.albedoTexture;
+        mesh.material.normalTexture = baseLayer.normalTexture;
+        mesh.material.ormTexture = baseLayer.ormTexture;
+        mesh.material.uvScale = glm::vec2(baseLayer.uvScale);
+    }
 
-                    const glm::vec3 tangent = glm::normalize(glm::vec3(1.0f, 0.0f, 0.0f));
-                    const glm::vec3 bitangent = glm::normalize(glm::cross(normal, tangent));
+    return mesh;
+}
 
-                    const size_t vertexIndex = static_cast<size_t>(localY) * static_cast<size_t>(vertsX) + static_cast<size_t>(localX);
-                    vertices[vertexIndex] = vertex::Vertex3D({worldX, worldY, worldZ}, {u, v}, normal, tangent, bitangent);
-                }
-            }
+const std::vector<uint32_t> &TerrainMeshBuilder::getPatchIndices(uint32_t patchQuads, uint32_t stitchMask)
+{
+    static std::mutex cacheMutex;
+    static std::map<uint64_t, std::vector<uint32_t>> patterns;
 
-            std::vector<uint32_t> indices;
-            indices.reserve(static_cast<size_t>(localQuadCountX) * static_cast<size_t>(localQuadCountY) * 6u);
+    const uint64_t key = (static_cast<uint64_t>(patchQuads) << 4u) | (stitchMask & 0xFu);
 
-            for (uint32_t localY = 0; localY < localQuadCountY; ++localY)
-            {
-                for (uint32_t localX = 0; localX < localQuadCountX; ++localX)
-                {
-                    const uint32_t topLeft = localY * vertsX + localX;
-                    const uint32_t topRight = topLeft + 1u;
-                    const uint32_t bottomLeft = topLeft + vertsX;
-                    const uint32_t bottomRight = bottomLeft + 1u;
-
-                    indices.push_back(topLeft);
-                    indices.push_back(bottomLeft);
-                    indices.push_back(topRight);
-
-                    indices.push_back(topRight);
-                    indices.push_back(bottomLeft);
-                    indices.push_back(bottomRight);
-                }
-            }
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto patternIt = patterns.find(key);
+    if (patternIt == patterns.end())
+        patternIt = patterns.emplace(key, buildPatchIndexPattern(patchQuads, stitchMask & 0xFu)).first;
 
-            CPUMesh mesh = CPUMesh::build(vertices, indices);
-            mesh.name = "TerrainChunk_" + std::to_string(chunkX) + "_" + std::to_string(chunkY);
+    // std::map nodes are stable, so the reference outlives the lock.
+    return patternIt->second;
+}
 
-            if (!terrainAsset.layers.empty())
-            {
-                const TerrainLayerInfo &baseLayer = terrainAsset.layers.front();
-                mesh.material.name = baseLayer.name;
-                mesh.material.albedoTexture = baseLayer.albedoTexture;
-                mesh.material.normalTexture = baseLayer.normalTexture;
-                mesh.material.ormTexture = baseLayer.ormTexture;
-                mesh.material.uvScale = glm::vec2(baseLayer.uvScale);
-            }
+const std::vector<uint32_t> &TerrainMeshBuilder::getGridIndices(uint32_t quadsX, uint32_t quadsY)
+{
+    static std::mutex cacheMutex;
+    static std::map<uint64_t, std::vector<uint32_t>> patterns;
 
-            meshes.push_back(std::move(mesh));
-        }
-    }
+    const uint64_t key = (static_cast<uint64_t>(quadsX) << 32u) | quadsY;
 
-    return meshes;
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto patternIt = patterns.find(key);
+    if (patternIt == patterns.end())
+        patternIt = patterns.emplace(key, buildGridIndexPattern(quadsX, quadsY)).first;
+
+    return patternIt->second;
 }
 
 ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,278 @@
+#include "Engine/Terrain/TerrainQuadtree.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+void TerrainQuadtree::clear()
+{
+    m_nodes.clear();
+    m_leafLevels.clear();
+    m_levelCount = 0u;
+}
+
+void TerrainQuadtree::build(const TerrainAsset &terrainAsset, uint32_t patchQuads)
+{
+    clear();
+
+    if (!terrainAsset.isValid() || patchQuads < 2u || (patchQuads & (patchQuads - 1u)) != 0u)
+        return;
+
+    m_patchQuads = patchQuads;
+    m_quadsX = terrainAsset.width - 1u;
+    m_quadsY = terrainAsset.height - 1u;
+    m_leafCountX = (m_quadsX + patchQuads - 1u) / patchQuads;
+    m_leafCountY = (m_quadsY + patchQuads - 1u) / patchQuads;
+    m_worldMinX = -terrainAsset.worldSizeX * 0.5f;
+    m_worldMinZ = -terrainAsset.worldSizeZ * 0.5f;
+    m_gridStepX = terrainAsset.worldSizeX / static_cast<float>(m_quadsX);
+    m_gridStepZ = terrainAsset.worldSizeZ / static_cast<float>(m_quadsY);
+
+    uint32_t rootSize = patchQuads;
+    m_levelCount = 1u;
+    while (rootSize < std::max(m_quadsX, m_quadsY))
+    {
+        rootSize <<= 1u;
+        ++m_levelCount;
+    }
+
+    m_nodes.reserve(static_cast<size_t>(m_leafCountX) * m_leafCountY * 4u / 3u + m_levelCount);
+    buildNode(terrainAsset, 0u, 0u, m_levelCount - 1u);
+}
+
+int32_t TerrainQuadtree::buildNode(const TerrainAsset &terrainAsset, uint32_t x, uint32_t y, uint32_t level)
+{
+    if (x >= m_quadsX || y >= m_quadsY)
+        return INVALID_NODE;
+
+    const int32_t nodeIndex = static_cast<int32_t>(m_nodes.size());
+    const uint32_t size = m_patchQuads << level;
+
+    m_nodes.push_back({});
+    m_nodes[nodeIndex].x = x;
+    m_nodes[nodeIndex].y = y;
+    m_nodes[nodeIndex].size = size;
+    m_nodes[nodeIndex].level = level;
+
+    if (level == 0u)
+    {
+        computeLeafBounds(terrainAsset, m_nodes[nodeIndex]);
+        return nodeIndex;
+    }
+
+    float minHeight = std::numeric_limits<float>::max();
+    float maxHeight = std::numeric_limits<float>::lowest();
+
+    const uint32_t half = size >> 1u;
+    const std::array<int32_t, 4> children{
+        buildNode(terrainAsset, x, y, level - 1u),
+        buildNode(terrainAsset, x + half, y, level - 1u),
+        buildNode(terrainAsset, x, y + half, level - 1u),
+        buildNode(terrainAsset, x + half, y + half, level - 1u)};
+
+    for (const int32_t child : children)
+    {
+        if (child == INVALID_NODE)
+            continue;
+
+        minHeight = std::min(minHeight, m_nodes[child].minHeight);
+        maxHeight = std::max(maxHeight, m_nodes[child].maxHeight);
+    }
+
+    // Children may have reallocated the node array.
+    m_nodes[nodeIndex].children = children;
+    m_nodes[nodeIndex].minHeight = minHeight;
+    m_nodes[nodeIndex].maxHeight = maxHeight;
+    return nodeIndex;
+}
+
+void TerrainQuadtree::computeLeafBounds(const TerrainAsset &terrainAsset, Node &node) const
+{
+    float minHeight = std::numeric_limits<float>::max();
+    float maxHeight = std::numeric_limits<float>::lowest();
+
+    const uint32_t endX = std::min(node.x + node.size, m_quadsX);
+    const uint32_t endY = std::min(node.y + node.size, m_quadsY);
+    for (uint32_t sampleY = node.y; sampleY <= endY; ++sampleY)
+    {
+        for (uint32_t sampleX = node.x; sampleX <= endX; ++sampleX)
+        {
+            const float height = terrainAsset.sampleWorldHeight(sampleX, sampleY);
+            minHeight = std::min(minHeight, height);
+            maxHeight = std::max(maxHeight, height);
+        }
+    }
+
+    node.minHeight = minHeight;
+    node.maxHeight = maxHeight;
+}
+
+void TerrainQuadtree::refreshHeightBounds(const TerrainAsset &terrainAsset, const TerrainRegion &region)
+{
+    if (m_nodes.empty() || region.isEmpty() || !terrainAsset.isValid())
+        return;
+
+    refreshNode(terrainAsset, 0u, region);
+}
+
+void TerrainQuadtree::refreshNode(const TerrainAsset &terrainAsset, uint32_t nodeIndex, const TerrainRegion &region)
+{
+    Node &node = m_nodes[nodeIndex];
+    const TerrainRegion nodeSamples{node.x,
+                                    node.y,
+                                    std::min(node.x + node.size, m_quadsX) - node.x + 1u,
+                                    std::min(node.y + node.size, m_quadsY) - node.y + 1u};
+    if (!nodeSamples.intersects(region))
+        return;
+
+    if (node.isLeaf())
+    {
+        computeLeafBounds(terrainAsset, node);
+        return;
+    }
+
+    float minHeight = std::numeric_limits<float>::max();
+    float maxHeight = std::numeric_limits<float>::lowest();
+    for (const int32_t child : node.children)
+    {
+        if (child == INVALID_NODE)
+            continue;
+
+        refreshNode(terrainAsset, static_cast<uint32_t>(child), region);
+        minHeight = std::min(minHeight, m_nodes[child].minHeight);
+        maxHeight = std::max(maxHeight, m_nodes[child].maxHeight);
+    }
+
+    node.minHeight = minHeight;
+    node.maxHeight = maxHeight;
+}
+
+TerrainRegion TerrainQuadtree::getNodeFootprint(uint32_t nodeIndex) const
+{
+    const Node &node = m_nodes[nodeIndex];
+    const uint32_t ring = 1u << node.level;
+    const uint32_t minX = node.x > ring ? node.x - ring : 0u;
+    const uint32_t minY = node.y > ring ? node.y - ring : 0u;
+    return {minX, minY, node.x + node.size + ring + 1u - minX, node.y + node.size + ring + 1u - minY};
+}
+
+float TerrainQuadtree::distanceToNode(const Node &node, const glm::vec3 &localCameraPosition) const
+{
+    const float minX = m_worldMinX + static_cast<float>(node.x) * m_gridStepX;
+    const float maxX = m_worldMinX + static_cast<float>(std::min(node.x + node.size, m_quadsX)) * m_gridStepX;
+    const float minZ = m_worldMinZ + static_cast<float>(node.y) * m_gridStepZ;
+    const float maxZ = m_worldMinZ + static_cast<float>(std::min(node.y + node.size, m_quadsY)) * m_gridStepZ;
+
+    const float dx = std::max({minX - localCameraPosition.x, 0.0f, localCameraPosition.x - maxX});
+    const float dy = std::max({node.minHeight - localCameraPosition.y, 0.0f, localCameraPosition.y - node.maxHeight});
+    const float dz = std::max({minZ - localCameraPosition.z, 0.0f, localCameraPosition.z - maxZ});
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+void TerrainQuadtree::select(const glm::vec3 &localCameraPosition,
+                             const TerrainLodSettings &settings,
+                             std::vector<TerrainLodSelection> &outSelection) const
+{
+    outSelection.clear();
+    if (m_nodes.empty())
+        return;
+
+    const float leafWorldSize = static_cast<float>(m_patchQuads) * std::max(m_gridStepX, m_gridStepZ);
+    const float baseRange = leafWorldSize * std::max(settings.distanceScale, 0.5f);
+    const size_t maxPatches = std::max<size_t>(settings.maxPatches, 1u);
+
+    // Breadth-first, so when the budget runs out the remaining detail is dropped evenly
+    // level by level instead of starving one side of the terrain.
+    std::vector<uint32_t> queue;
+    queue.reserve(maxPatches * 2u);
+    queue.push_back(0u);
+
+    for (size_t head = 0; head < queue.size(); ++head)
+    {
+        const uint32_t nodeIndex = queue[head];
+        const Node &node = m_nodes[nodeIndex];
+
+        bool split = !node.isLeaf() &&
+                     distanceToNode(node, localCameraPosition) < baseRange * static_cast<float>(1u << (node.level - 1u));
+
+        if (split)
+        {
+            const size_t childCount = static_cast<size_t>(std::count_if(node.children.begin(), node.children.end(),
+                                                                        [](int32_t child)
+                                                                        { return child != INVALID_NODE; }));
+            const size_t pending = queue.size() - head - 1u;
+            split = outSelection.size() + pending + childCount <= maxPatches;
+        }
+
+        if (!split)
+        {
+            outSelection.push_back({nodeIndex, 0u});
+            continue;
+        }
+
+        for (const int32_t child : node.children)
+        {
+            if (child != INVALID_NODE)
+                queue.push_back(static_cast<uint32_t>(child));
+        }
+    }
+
+    std::sort(outSelection.begin(), outSelection.end(), [](const TerrainLodSelection &left, const TerrainLodSelection &right)
+              { return left.nodeIndex < right.nodeIndex; });
+
+    computeStitchMasks(outSelection);
+}
+
+void TerrainQuadtree::computeStitchMasks(std::vector<TerrainLodSelection> &selection) const
+{
+    m_leafLevels.assign(static_cast<size_t>(m_leafCountX) * m_leafCountY, -1);
+
+    const auto leafRange = [this](const Node &node, uint32_t &outX0, uint32_t &outY0, uint32_t &outX1, uint32_t &outY1)
+    {
+        outX0 = node.x / m_patchQuads;
+        outY0 = node.y / m_patchQuads;
+        outX1 = std::min(outX0 + (node.size / m_patchQuads), m_leafCountX);
+        outY1 = std::min(outY0 + (node.size / m_patchQuads), m_leafCountY);
+    };
+
+    for (const auto &selected : selection)
+    {
+        const Node &node = m_nodes[selected.nodeIndex];
+        uint32_t x0, y0, x1, y1;
+        leafRange(node, x0, y0, x1, y1);
+
+        for (uint32_t leafY = y0; leafY < y1; ++leafY)
+            std::fill_n(m_leafLevels.begin() + static_cast<ptrdiff_t>(leafY) * m_leafCountX + x0, x1 - x0, static_cast<int32_t>(node.level));
+    }
+
+    const auto levelAt = [this](uint32_t leafX, uint32_t leafY)
+    {
+        return m_leafLevels[static_cast<size_t>(leafY) * m_leafCountX + leafX];
+    };
+
+    // Quadtree alignment means a coarser neighbour spans the whole shared edge, so one cell is enough.
+    // Distance-based ranges keep neighbours within one level of each other.
+    for (auto &selected : selection)
+    {
+        const Node &node = m_nodes[selected.nodeIndex];
+        const int32_t level = static_cast<int32_t>(node.level);
+        uint32_t x0, y0, x1, y1;
+        leafRange(node, x0, y0, x1, y1);
+
+        uint32_t stitchMask = 0u;
+        if (x0 > 0u && levelAt(x0 - 1u, y0) > level)
+            stitchMask |= TERRAIN_STITCH_NEG_X;
+        if (x1 < m_leafCountX && levelAt(x1, y0) > level)
+            stitchMask |= TERRAIN_STITCH_POS_X;
+        if (y0 > 0u && levelAt(x0, y0 - 1u) > level)
+            stitchMask |= TERRAIN_STITCH_NEG_Z;
+        if (y1 < m_leafCountY && levelAt(x0, y1) > level)
+            stitchMask |= TERRAIN_STITCH_POS_Z;
+
+        selected.stitchMask = stitchMask;
+    }
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,572 @@
+#include "Engine/Terrain/TerrainQuery.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ELIX_TERRAIN_QUERY_SSE 1
+#include <emmintrin.h>
+#endif
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+namespace
+{
+    // Catmull-Rom weights and their derivatives for the samples at -1, 0, +1, +2.
+    void catmullRomWeights(float t, std::array<float, 4> &outWeights, std::array<float, 4> &outDerivatives)
+    {
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+
+        outWeights = {-0.5f * t3 + t2 - 0.5f * t,
+                      1.5f * t3 - 2.5f * t2 + 1.0f,
+                      -1.5f * t3 + 2.0f * t2 + 0.5f * t,
+                      0.5f * t3 - 0.5f * t2};
+
+        outDerivatives = {-1.5f * t2 + 2.0f * t - 0.5f,
+                          4.5f * t2 - 5.0f * t,
+                          -4.5f * t2 + 4.0f * t + 0.5f,
+                          1.5f * t2 - t};
+    }
+
+    // Clips [inOutEnter, inOutExit] to the slab [minValue, maxValue] along one axis.
+    bool clipSlab(float origin, float direction, float minValue, float maxValue, float &inOutEnter, float &inOutExit)
+    {
+        if (std::abs(direction) < 1e-12f)
+            return origin >= minValue && origin <= maxValue;
+
+        const float inverse = 1.0f / direction;
+        float enter = (minValue - origin) * inverse;
+        float exit = (maxValue - origin) * inverse;
+        if (enter > exit)
+            std::swap(enter, exit);
+
+        inOutEnter = std::max(inOutEnter, enter);
+        inOutExit = std::min(inOutExit, exit);
+        return inOutEnter <= inOutExit;
+    }
+} // namespace
+
+TerrainQuery::TerrainQuery(std::shared_ptr<const TerrainAsset> terrainAsset, const glm::mat4 &localToWorld)
+{
+    setTransform(localToWorld);
+    setTerrainAsset(std::move(terrainAsset));
+}
+
+void TerrainQuery::setTerrainAsset(std::shared_ptr<const TerrainAsset> terrainAsset)
+{
+    m_terrainAsset = std::move(terrainAsset);
+    rebuild();
+}
+
+void TerrainQuery::setTransform(const glm::mat4 &localToWorld)
+{
+    m_localToWorld = localToWorld;
+    m_worldToLocal = glm::inverse(localToWorld);
+    m_normalMatrix = glm::transpose(glm::inverse(glm::mat3(localToWorld)));
+}
+
+void TerrainQuery::rebuild()
+{
+    m_levels.clear();
+    m_levelSizes.clear();
+
+    if (!m_terrainAsset || !m_terrainAsset->isValid())
+        return;
+
+    const TerrainAsset &terrainAsset = *m_terrainAsset;
+    m_quadsX = terrainAsset.width - 1u;
+    m_quadsZ = terrainAsset.height - 1u;
+    m_worldMinX = -terrainAsset.worldSizeX * 0.5f;
+    m_worldMinZ = -terrainAsset.worldSizeZ * 0.5f;
+    m_gridStepX = terrainAsset.worldSizeX / static_cast<float>(m_quadsX);
+    m_gridStepZ = terrainAsset.worldSizeZ / static_cast<float>(m_quadsZ);
+    m_heightScale = terrainAsset.heightScale / 65535.0f;
+
+    glm::uvec2 size(m_quadsX, m_quadsZ);
+    for (;;)
+    {
+        m_levelSizes.push_back(size);
+        m_levels.emplace_back(static_cast<size_t>(size.x) * size.y);
+        if (size.x == 1u && size.y == 1u)
+            break;
+
+        size = glm::uvec2((size.x + 1u) / 2u, (size.y + 1u) / 2u);
+    }
+
+    refreshLevels(0u, 0u, m_quadsX - 1u, m_quadsZ - 1u);
+}
+
+void TerrainQuery::refreshRegion(const TerrainRegion &region)
+{
+    if (m_levels.empty() || region.isEmpty() || !m_terrainAsset || !m_terrainAsset->isValid())
+        return;
+
+    // A sample is a corner of up to four cells.
+    const uint32_t minCellX = region.x > 0u ? region.x - 1u : 0u;
+    const uint32_t minCellZ = region.y > 0u ? region.y - 1u : 0u;
+    if (minCellX >= m_quadsX || minCellZ >= m_quadsZ)
+        return;
+
+    refreshLevels(minCellX,
+                  minCellZ,
+                  std::min(region.x + region.width - 1u, m_quadsX - 1u),
+                  std::min(region.y + region.height - 1u, m_quadsZ - 1u));
+}
+
+void TerrainQuery::refreshLevels(uint32_t minCellX, uint32_t minCellZ, uint32_t maxCellX, uint32_t maxCellZ)
+{
+    const TerrainAsset &terrainAsset = *m_terrainAsset;
+    const uint32_t rowStride = terrainAsset.width;
+
+    auto &cells = m_levels.front();
+    for (uint32_t cellZ = minCellZ; cellZ <= maxCellZ; ++cellZ)
+    {
+        const uint16_t *row = terrainAsset.heightSamples.data() + static_cast<size_t>(cellZ) * rowStride;
+        const uint16_t *nextRow = row + rowStride;
+
+        for (uint32_t cellX = minCellX; cellX <= maxCellX; ++cellX)
+        {
+            const uint16_t h00 = row[cellX];
+            const uint16_t h10 = row[cellX + 1u];
+            const uint16_t h01 = nextRow[cellX];
+            const uint16_t h11 = nextRow[cellX + 1u];
+
+            cells[static_cast<size_t>(cellZ) * m_quadsX + cellX] = {std::min({h00, h10, h01, h11}), std::max({h00, h10, h01, h11})};
+        }
+    }
+
+    for (size_t level = 1; level < m_levels.size(); ++level)
+    {
+        minCellX >>= 1u;
+        minCellZ >>= 1u;
+        maxCellX >>= 1u;
+        maxCellZ >>= 1u;
+
+        const auto &children = m_levels[level - 1u];
+        const glm::uvec2 childSize = m_levelSizes[level - 1u];
+        auto &nodes = m_levels[level];
+        const glm::uvec2 size = m_levelSizes[level];
+
+        for (uint32_t nodeZ = minCellZ; nodeZ <= maxCellZ; ++nodeZ)
+        {
+            for (uint32_t nodeX = minCellX; nodeX <= maxCellX; ++nodeX)
+            {
+                HeightRange range{UINT16_MAX, 0u};
+                for (uint32_t childZ = nodeZ * 2u; childZ < std::min(nodeZ * 2u + 2u, childSize.y); ++childZ)
+                {
+                    for (uint32_t childX = nodeX * 2u; childX < std::min(nodeX * 2u + 2u, childSize.x); ++childX)
+                    {
+                        const HeightRange &child = children[static_cast<size_t>(childZ) * childSize.x + childX];
+                        range.minValue = std::min(range.minValue, child.minValue);
+                        range.maxValue = std::max(range.maxValue, child.maxValue);
+                    }
+                }
+
+                nodes[static_cast<size_t>(nodeZ) * size.x + nodeX] = range;
+            }
+        }
+    }
+}
+
+glm::vec2 TerrainQuery::worldToGrid(float worldX, float worldZ) const
+{
+    const glm::vec4 local = m_worldToLocal * glm::vec4(worldX, 0.0f, worldZ, 1.0f);
+    return {(local.x - m_worldMinX) / m_gridStepX, (local.z - m_worldMinZ) / m_gridStepZ};
+}
+
+glm::vec3 TerrainQuery::gridToWorldPoint(float gridX, float localHeight, float gridZ) const
+{
+    return glm::vec3(m_localToWorld * glm::vec4(m_worldMinX + gridX * m_gridStepX, localHeight, m_worldMinZ + gridZ * m_gridStepZ, 1.0f));
+}
+
+glm::vec3 TerrainQuery::gridGradientToWorldNormal(const glm::vec2 &gradient) const
+{
+    const glm::vec3 localNormal(-gradient.x / m_gridStepX, 1.0f, -gradient.y / m_gridStepZ);
+    return glm::normalize(m_normalMatrix * localNormal);
+}
+
+float TerrainQuery::sampleAt(int32_t x, int32_t z) const
+{
+    x = std::clamp(x, 0, static_cast<int32_t>(m_quadsX));
+    z = std::clamp(z, 0, static_cast<int32_t>(m_quadsZ));
+    return static_cast<float>(m_terrainAsset->heightSamples[static_cast<size_t>(z) * m_terrainAsset->width + static_cast<size_t>(x)]);
+}
+
+bool TerrainQuery::contains(float worldX, float worldZ) const
+{
+    if (m_levels.empty())
+        return false;
+
+    const glm::vec2 grid = worldToGrid(worldX, worldZ);
+    return grid.x >= 0.0f && grid.y >= 0.0f && grid.x <= static_cast<float>(m_quadsX) && grid.y <= static_cast<float>(m_quadsZ);
+}
+
+bool TerrainQuery::sampleGrid(float gridX, float gridZ, TerrainFilter filter, float &outHeight, glm::vec2 &outGradient) const
+{
+    if (m_levels.empty() ||
+        !(gridX >= 0.0f && gridZ >= 0.0f && gridX <= static_cast<float>(m_quadsX) && gridZ <= static_cast<float>(m_quadsZ)))
+        return false;
+
+    const int32_t cellX = std::min(static_cast<int32_t>(gridX), static_cast<int32_t>(m_quadsX) - 1);
+    const int32_t cellZ = std::min(static_cast<int32_t>(gridZ), static_cast<int32_t>(m_quadsZ) - 1);
+    const float fractionX = gridX - static_cast<float>(cellX);
+    const float fractionZ = gridZ - static_cast<float>(cellZ);
+
+    if (filter == TerrainFilter::Bicubic)
+    {
+        std::array<float, 4> weightsX, derivativesX, weightsZ, derivativesZ;
+        catmullRomWeights(fractionX, weightsX, derivativesX);
+        catmullRomWeights(fractionZ, weightsZ, derivativesZ);
+
+        float height = 0.0f;
+        float gradientX = 0.0f;
+        float gradientZ = 0.0f;
+        for (int32_t row = 0; row < 4; ++row)
+        {
+            float rowHeight = 0.0f;
+            float rowDerivative = 0.0f;
+            for (int32_t column = 0; column < 4; ++column)
+            {
+                const float sample = sampleAt(cellX + column - 1, cellZ + row - 1);
+                rowHeight += weightsX[column] * sample;
+                rowDerivative += derivativesX[column] * sample;
+            }
+
+            height += weightsZ[row] * rowHeight;
+            gradientX += weightsZ[row] * rowDerivative;
+            gradientZ += derivativesZ[row] * rowHeight;
+        }
+
+        outHeight = height * m_heightScale;
+        outGradient = glm::vec2(gradientX, gradientZ) * m_heightScale;
+        return true;
+    }
+
+    const float h00 = sampleAt(cellX, cellZ);
+    const float h10 = sampleAt(cellX + 1, cellZ);
+    const float h01 = sampleAt(cellX, cellZ + 1);
+    const float h11 = sampleAt(cellX + 1, cellZ + 1);
+
+    const float bottom = h00 + (h10 - h00) * fractionX;
+    const float top = h01 + (h11 - h01) * fractionX;
+
+    outHeight = (bottom + (top - bottom) * fractionZ) * m_heightScale;
+    outGradient = glm::vec2((h10 - h00) + ((h11 - h01) - (h10 - h00)) * fractionZ,
+                            top - bottom) *
+                  m_heightScale;
+    return true;
+}
+
+bool TerrainQuery::sampleHeight(float worldX, float worldZ, float &outHeight, TerrainFilter filter) const
+{
+    const glm::vec2 grid = worldToGrid(worldX, worldZ);
+
+    float localHeight = 0.0f;
+    glm::vec2 gradient{0.0f};
+    if (!sampleGrid(grid.x, grid.y, filter, localHeight, gradient))
+        return false;
+
+    outHeight = gridToWorldPoint(grid.x, localHeight, grid.y).y;
+    return true;
+}
+
+bool TerrainQuery::sampleSurface(float worldX, float worldZ, TerrainSurfaceSample &outSample, TerrainFilter filter) const
+{
+    const glm::vec2 grid = worldToGrid(worldX, worldZ);
+
+    float localHeight = 0.0f;
+    glm::vec2 gradient{0.0f};
+    if (!sampleGrid(grid.x, grid.y, filter, localHeight, gradient))
+        return false;
+
+    outSample.position = gridToWorldPoint(grid.x, localHeight, grid.y);
+    outSample.normal = gridGradientToWorldNormal(gradient);
+    return true;
+}
+
+void TerrainQuery::sampleHeights(const glm::vec3 *worldPositions, size_t count, float *outHeights, float outsideHeight) const
+{
+    if (m_levels.empty())
+    {
+        std::fill_n(outHeights, count, outsideHeight);
+        return;
+    }
+
+    // World (x, z) -> grid coordinates and (grid x, grid z, raw height) -> world y, folded into one affine map each.
+    const glm::vec4 gridFromX = m_worldToLocal[0];
+    const glm::vec4 gridFromZ = m_worldToLocal[2];
+    const glm::vec4 gridOffset = m_worldToLocal[3];
+
+    const float gridXFromX = gridFromX.x / m_gridStepX;
+    const float gridXFromZ = gridFromZ.x / m_gridStepX;
+    const float gridXOffset = (gridOffset.x - m_worldMinX) / m_gridStepX;
+    const float gridZFromX = gridFromX.z / m_gridStepZ;
+    const float gridZFromZ = gridFromZ.z / m_gridStepZ;
+    const float gridZOffset = (gridOffset.z - m_worldMinZ) / m_gridStepZ;
+
+    const float heightFromGridX = m_localToWorld[0].y * m_gridStepX;
+    const float heightFromGridZ = m_localToWorld[2].y * m_gridStepZ;
+    const float heightFromRaw = m_localToWorld[1].y * m_heightScale;
+    const float heightOffset = m_localToWorld[0].y * m_worldMinX + m_localToWorld[2].y * m_worldMinZ + m_localToWorld[3].y;
+
+    const float maxGridX = static_cast<float>(m_quadsX);
+    const float maxGridZ = static_cast<float>(m_quadsZ);
+    const int32_t maxCellX = static_cast<int32_t>(m_quadsX) - 1;
+    const int32_t maxCellZ = static_cast<int32_t>(m_quadsZ) - 1;
+    const uint16_t *samples = m_terrainAsset->heightSamples.data();
+    const size_t rowStride = m_terrainAsset->width;
+
+    size_t index = 0;
+
+#if defined(ELIX_TERRAIN_QUERY_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 maxGridXVector = _mm_set1_ps(maxGridX);
+    const __m128 maxGridZVector = _mm_set1_ps(maxGridZ);
+    const __m128i maxCellXVector = _mm_set1_epi32(maxCellX);
+    const __m128i maxCellZVector = _mm_set1_epi32(maxCellZ);
+
+    alignas(16) int32_t cellX[4];
+    alignas(16) int32_t cellZ[4];
+    alignas(16) float h00[4], h10[4], h01[4], h11[4];
+
+    for (; index + 4u <= count; index += 4u)
+    {
+        const glm::vec3 *points = worldPositions + index;
+        const __m128 worldX = _mm_setr_ps(points[0].x, points[1].x, points[2].x, points[3].x);
+        const __m128 worldZ = _mm_setr_ps(points[0].z, points[1].z, points[2].z, points[3].z);
+
+        const __m128 gridX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(worldX, _mm_set1_ps(gridXFromX)), _mm_mul_ps(worldZ, _mm_set1_ps(gridXFromZ))),
+                                        _mm_set1_ps(gridXOffset));
+        const __m128 gridZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(worldX, _mm_set1_ps(gridZFromX)), _mm_mul_ps(worldZ, _mm_set1_ps(gridZFromZ))),
+                                        _mm_set1_ps(gridZOffset));
+
+        const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(gridX, zero), _mm_cmple_ps(gridX, maxGridXVector)),
+                                         _mm_and_ps(_mm_cmpge_ps(gridZ, zero), _mm_cmple_ps(gridZ, maxGridZVector)));
+
+        // Clamped so outside lanes still read valid samples; they are replaced below.
+        const __m128 clampedX = _mm_min_ps(_mm_max_ps(gridX, zero), maxGridXVector);
+        const __m128 clampedZ = _mm_min_ps(_mm_max_ps(gridZ, zero), maxGridZVector);
+
+        // SSE2 has no integer min; select through a compare instead.
+        __m128i cellXVector = _mm_cvttps_epi32(clampedX);
+        __m128i cellZVector = _mm_cvttps_epi32(clampedZ);
+        const __m128i overX = _mm_cmpgt_epi32(cellXVector, maxCellXVector);
+        const __m128i overZ = _mm_cmpgt_epi32(cellZVector, maxCellZVector);
+        cellXVector = _mm_or_si128(_mm_and_si128(overX, maxCellXVector), _mm_andnot_si128(overX, cellXVector));
+        cellZVector = _mm_or_si128(_mm_and_si128(overZ, maxCellZVector), _mm_andnot_si128(overZ, cellZVector));
+
+        const __m128 fractionX = _mm_sub_ps(clampedX, _mm_cvtepi32_ps(cellXVector));
+        const __m128 fractionZ = _mm_sub_ps(clampedZ, _mm_cvtepi32_ps(cellZVector));
+
+        _mm_store_si128(reinterpret_cast<__m128i *>(cellX), cellXVector);
+        _mm_store_si128(reinterpret_cast<__m128i *>(cellZ), cellZVector);
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            const uint16_t *corner = samples + static_cast<size_t>(cellZ[lane]) * rowStride + static_cast<size_t>(cellX[lane]);
+            h00[lane] = static_cast<float>(corner[0]);
+            h10[lane] = static_cast<float>(corner[1]);
+            h01[lane] = static_cast<float>(corner[rowStride]);
+            h11[lane] = static_cast<float>(corner[rowStride + 1u]);
+        }
+
+        const __m128 bottom = _mm_add_ps(_mm_load_ps(h00), _mm_mul_ps(_mm_sub_ps(_mm_load_ps(h10), _mm_load_ps(h00)), fractionX));
+        const __m128 top = _mm_add_ps(_mm_load_ps(h01), _mm_mul_ps(_mm_sub_ps(_mm_load_ps(h11), _mm_load_ps(h01)), fractionX));
+        const __m128 raw = _mm_add_ps(bottom, _mm_mul_ps(_mm_sub_ps(top, bottom), fractionZ));
+
+        const __m128 height = _mm_add_ps(_mm_add_ps(_mm_mul_ps(gridX, _mm_set1_ps(heightFromGridX)), _mm_mul_ps(gridZ, _mm_set1_ps(heightFromGridZ))),
+                                         _mm_add_ps(_mm_mul_ps(raw, _mm_set1_ps(heightFromRaw)), _mm_set1_ps(heightOffset)));
+
+        _mm_storeu_ps(outHeights + index, _mm_or_ps(_mm_and_ps(inside, height), _mm_andnot_ps(inside, _mm_set1_ps(outsideHeight))));
+    }
+#endif
+
+    for (; index < count; ++index)
+    {
+        const float worldX = worldPositions[index].x;
+        const float worldZ = worldPositions[index].z;
+        const float gridX = worldX * gridXFromX + worldZ * gridXFromZ + gridXOffset;
+        const float gridZ = worldX * gridZFromX + worldZ * gridZFromZ + gridZOffset;
+
+        if (!(gridX >= 0.0f && gridZ >= 0.0f && gridX <= maxGridX && gridZ <= maxGridZ))
+        {
+            outHeights[index] = outsideHeight;
+            continue;
+        }
+
+        const int32_t cellX = std::min(static_cast<int32_t>(gridX), maxCellX);
+        const int32_t cellZ = std::min(static_cast<int32_t>(gridZ), maxCellZ);
+        const float fractionX = gridX - static_cast<float>(cellX);
+        const float fractionZ = gridZ - static_cast<float>(cellZ);
+
+        const uint16_t *corner = samples + static_cast<size_t>(cellZ) * rowStride + static_cast<size_t>(cellX);
+        const float bottom = static_cast<float>(corner[0]) + (static_cast<float>(corner[1]) - static_cast<float>(corner[0])) * fractionX;
+        const float top = static_cast<float>(corner[rowStride]) + (static_cast<float>(corner[rowStride + 1u]) - static_cast<float>(corner[rowStride])) * fractionX;
+        const float raw = bottom + (top - bottom) * fractionZ;
+
+        outHeights[index] = gridX * heightFromGridX + gridZ * heightFromGridZ + (raw * heightFromRaw + heightOffset);
+    }
+}
+
+bool TerrainQuery::raycast(const glm::vec3 &origin, const glm::vec3 &direction, float maxDistance, TerrainRayHit &outHit) const
+{
+    const float directionLength = glm::length(direction);
+    if (m_levels.empty() || directionLength <= 1e-12f || maxDistance <= 0.0f)
+        return false;
+
+    // Affine maps keep the ray parameter, so t found in grid space is valid in world space.
+    const glm::vec3 localOrigin = glm::vec3(m_worldToLocal * glm::vec4(origin, 1.0f));
+    const glm::vec3 localDirection = glm::mat3(m_worldToLocal) * direction;
+    const glm::vec3 gridOrigin((localOrigin.x - m_worldMinX) / m_gridStepX, localOrigin.y, (localOrigin.z - m_worldMinZ) / m_gridStepZ);
+    const glm::vec3 gridDirection(localDirection.x / m_gridStepX, localDirection.y, localDirection.z / m_gridStepZ);
+
+    struct StackEntry
+    {
+        uint32_t level;
+        uint32_t x;
+        uint32_t z;
+        float enter;
+        float exit;
+    };
+
+    const auto clipNode = [&](uint32_t level, uint32_t x, uint32_t z, float limit, float &outEnter, float &outExit)
+    {
+        const HeightRange &range = m_levels[level][static_cast<size_t>(z) * m_levelSizes[level].x + x];
+        const float minX = static_cast<float>(x << level);
+        const float minZ = static_cast<float>(z << level);
+        const float maxX = static_cast<float>(std::min((x + 1u) << level, m_quadsX));
+        const float maxZ = static_cast<float>(std::min((z + 1u) << level, m_quadsZ));
+
+        outEnter = 0.0f;
+        outExit = limit;
+        return clipSlab(gridOrigin.x, gridDirection.x, minX, maxX, outEnter, outExit) &&
+               clipSlab(gridOrigin.z, gridDirection.z, minZ, maxZ, outEnter, outExit) &&
+               clipSlab(gridOrigin.y, gridDirection.y,
+                        static_cast<float>(range.minValue) * m_heightScale,
+                        static_cast<float>(range.maxValue) * m_heightScale,
+                        outEnter, outExit);
+    };
+
+    float bestT = maxDistance / directionLength;
+    bool hit = false;
+    glm::vec2 hitGradient{0.0f};
+
+    // Near-first depth-first descent: at most three siblings wait per level.
+    std::array<StackEntry, 4u * 32u> stack;
+    size_t stackSize = 0u;
+
+    const uint32_t rootLevel = static_cast<uint32_t>(m_levels.size() - 1u);
+    float rootEnter = 0.0f;
+    float rootExit = 0.0f;
+    if (!clipNode(rootLevel, 0u, 0u, bestT, rootEnter, rootExit))
+        return false;
+
+    stack[stackSize++] = {rootLevel, 0u, 0u, rootEnter, rootExit};
+
+    while (stackSize > 0u)
+    {
+        const StackEntry entry = stack[--stackSize];
+        if (entry.enter >= bestT)
+            continue;
+
+        if (entry.level == 0u)
+        {
+            // Bilinear patch h = a + b*u + c*v + d*u*v in cell coordinates, intersected exactly:
+            // ray height minus patch height is quadratic in t. Parametrized from the cell entry for precision.
+            const float h00 = sampleAt(static_cast<int32_t>(entry.x), static_cast<int32_t>(entry.z)) * m_heightScale;
+            const float h10 = sampleAt(static_cast<int32_t>(entry.x) + 1, static_cast<int32_t>(entry.z)) * m_heightScale;
+            const float h01 = sampleAt(static_cast<int32_t>(entry.x), static_cast<int32_t>(entry.z) + 1) * m_heightScale;
+            const float h11 = sampleAt(static_cast<int32_t>(entry.x) + 1, static_cast<int32_t>(entry.z) + 1) * m_heightScale;
+
+            const float b = h10 - h00;
+            const float c = h01 - h00;
+            const float d = h00 - h10 - h01 + h11;
+
+            const float u0 = gridOrigin.x + gridDirection.x * entry.enter - static_cast<float>(entry.x);
+            const float v0 = gridOrigin.z + gridDirection.z * entry.enter - static_cast<float>(entry.z);
+            const float y0 = gridOrigin.y + gridDirection.y * entry.enter;
+            const float du = gridDirection.x;
+            const float dv = gridDirection.z;
+
+            const float quadratic = -d * du * dv;
+            const float linear = gridDirection.y - (b * du + c * dv + d * (u0 * dv + v0 * du));
+            const float constant = y0 - (h00 + b * u0 + c * v0 + d * u0 * v0);
+            const float length = std::min(entry.exit, bestT) - entry.enter;
+
+            std::array<float, 2> roots{-1.0f, -1.0f};
+            if (std::abs(quadratic) <= 1e-9f * (std::abs(linear) + std::abs(constant) + 1.0f))
+            {
+                if (linear != 0.0f)
+                    roots[0] = -constant / linear;
+            }
+            else
+            {
+                const float discriminant = linear * linear - 4.0f * quadratic * constant;
+                if (discriminant >= 0.0f)
+                {
+                    const float q = -0.5f * (linear + std::copysign(std::sqrt(discriminant), linear));
+                    roots[0] = q / quadratic;
+                    roots[1] = q != 0.0f ? constant / q : roots[0];
+                    if (roots[0] > roots[1])
+                        std::swap(roots[0], roots[1]);
+                }
+            }
+
+            const float tolerance = 1e-5f * std::max(1.0f, length);
+            for (const float root : roots)
+            {
+                // Only crossings from above count.
+                if (root < -tolerance || root > length + tolerance || 2.0f * quadratic * root + linear > 0.0f)
+                    continue;
+
+                const float s = std::clamp(root, 0.0f, length);
+                const float u = std::clamp(u0 + du * s, 0.0f, 1.0f);
+                const float v = std::clamp(v0 + dv * s, 0.0f, 1.0f);
+
+                bestT = entry.enter + s;
+                hitGradient = glm::vec2(b + d * v, c + d * u);
+                hit = true;
+                break;
+            }
+
+            continue;
+        }
+
+        // Children sorted far to near, so the nearest is popped first.
+        std::array<StackEntry, 4> children;
+        size_t childCount = 0u;
+        const uint32_t childLevel = entry.level - 1u;
+        const glm::uvec2 childSize = m_levelSizes[childLevel];
+
+        for (uint32_t childZ = entry.z * 2u; childZ < std::min(entry.z * 2u + 2u, childSize.y); ++childZ)
+        {
+            for (uint32_t childX = entry.x * 2u; childX < std::min(entry.x * 2u + 2u, childSize.x); ++childX)
+            {
+                float enter = 0.0f;
+                float exit = 0.0f;
+                if (clipNode(childLevel, childX, childZ, bestT, enter, exit))
+                    children[childCount++] = {childLevel, childX, childZ, enter, exit};
+            }
+        }
+
+        for (size_t sorted = 1; sorted < childCount; ++sorted)
+        {
+            for (size_t child = sorted; child > 0u && children[child - 1u].enter < children[child].enter; --child)
+                std::swap(children[child - 1u], children[child]);
+        }
+
+        for (size_t child = 0; child < childCount; ++child)
+            stack[stackSize++] = children[child];
+    }
+
+    if (!hit)
+        return false;
+
+    outHit.position = origin + direction * bestT;
+    outHit.normal = gridGradientToWorldNormal(hitGradient);
+    outHit.distance = bestT * directionLength;
+    return true;
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -0,0 +1,618 @@
+#include "Engine/Terrain/TerrainTileFile.hpp"
+
+#include "Core/Logger.hpp"
+#include "Engine/Assets/Compressor.hpp"
+#include "Engine/Terrain/TerrainAssetIO.hpp"
+#include "Engine/Threads/ThreadPoolManager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+ELIX_NESTED_NAMESPACE_BEGIN(engine)
+
+namespace
+{
+    constexpr char TERRAIN_FILE_MAGIC[8] = {'V', 'X', 'T', 'E', 'R', 'R', 'N', '\0'};
+
+    // All fields are little-endian, which covers every platform the engine targets.
+    struct FileHeader
+    {
+        char magic[8]{};
+        uint32_t formatVersion{0};
+        uint32_t headerSize{0};
+
+        uint32_t width{0};
+        uint32_t height{0};
+        float worldSizeX{0.0f};
+        float worldSizeZ{0.0f};
+        float heightScale{0.0f};
+        uint32_t tileSize{0};
+
+        uint32_t heightTilesX{0};
+        uint32_t heightTilesY{0};
+        uint32_t weightmapWidth{0};
+        uint32_t weightmapHeight{0};
+        uint32_t weightmapChannels{0};
+        uint32_t weightTilesX{0};
+        uint32_t weightTilesY{0};
+        uint32_t reserved{0};
+
+        uint64_t metadataOffset{0};
+        uint64_t metadataSize{0};
+        uint64_t heightTableOffset{0};
+        uint64_t weightTableOffset{0};
+    };
+
+    static_assert(sizeof(FileHeader) == 104u, "FileHeader is part of the on-disk format");
+
+    uint32_t tileCount(uint32_t samples, uint32_t tileSize)
+    {
+        return samples == 0u ? 0u : (samples + tileSize - 1u) / tileSize;
+    }
+
+    TerrainTileRect tileRect(uint32_t tileX, uint32_t tileY, uint32_t tileSize, uint32_t width, uint32_t height)
+    {
+        TerrainTileRect rect{};
+        rect.x = tileX * tileSize;
+        rect.y = tileY * tileSize;
+        rect.width = rect.x < width ? std::min(tileSize, width - rect.x) : 0u;
+        rect.height = rect.y < height ? std::min(tileSize, height - rect.y) : 0u;
+        return rect;
+    }
+
+    // Residual against the left neighbour (or the one above for the first column). Low and high
+    // bytes are stored as separate planes: smooth terrain leaves the high plane almost all zeros.
+    std::vector<uint8_t> encodeHeightTile(const TerrainAsset &terrainAsset, const TerrainTileRect &rect,
+                                          uint16_t &outMin, uint16_t &outMax)
+    {
+        const size_t sampleCount = static_cast<size_t>(rect.width) * rect.height;
+        std::vector<uint8_t> raw(sampleCount * 2u);
+        uint8_t *lowPlane = raw.data();
+        uint8_t *highPlane = raw.data() + sampleCount;
+
+        outMin = UINT16_MAX;
+        outMax = 0u;
+
+        size_t index = 0u;
+        for (uint32_t y = 0; y < rect.height; ++y)
+        {
+            const uint16_t *row = terrainAsset.heightSamples.data() + static_cast<size_t>(rect.y + y) * terrainAsset.width + rect.x;
+            const uint16_t *rowAbove = y > 0u ? row - terrainAsset.width : nullptr;
+
+            for (uint32_t x = 0; x < rect.width; ++x, ++index)
+            {
+                const uint16_t sample = row[x];
+                const uint16_t prediction = x > 0u ? row[x - 1u] : (rowAbove ? rowAbove[0] : 0u);
+                const uint16_t residual = static_cast<uint16_t>(sample - prediction);
+
+                lowPlane[index] = static_cast<uint8_t>(residual & 0xFFu);
+                highPlane[index] = static_cast<uint8_t>(residual >> 8u);
+
+                outMin = std::min(outMin, sample);
+                outMax = std::max(outMax, sample);
+            }
+        }
+
+        return raw;
+    }
+
+    void decodeHeightResiduals(const std::vector<uint8_t> &raw, const TerrainTileRect &rect, uint16_t *output, size_t outputStride)
+    {
+        const size_t sampleCount = static_cast<size_t>(rect.width) * rect.height;
+        const uint8_t *lowPlane = raw.data();
+        const uint8_t *highPlane = raw.data() + sampleCount;
+
+        size_t index = 0u;
+        for (uint32_t y = 0; y < rect.height; ++y)
+        {
+            uint16_t *row = output + static_cast<size_t>(y) * outputStride;
+            const uint16_t *rowAbove = y > 0u ? row - outputStride : nullptr;
+
+            for (uint32_t x = 0; x < rect.width; ++x, ++index)
+            {
+                const uint16_t residual = static_cast<uint16_t>(lowPlane[index] | (highPlane[index] << 8u));
+                const uint16_t prediction = x > 0u ? row[x - 1u] : (rowAbove ? rowAbove[0] : 0u);
+                row[x] = static_cast<uint16_t>(prediction + residual);
+            }
+        }
+    }
+
+    // Same predictor per channel; weight channels stay interleaved.
+    std::vector<uint8_t> encodeWeightTile(const TerrainAsset &terrainAsset, const TerrainTileRect &rect)
+    {
+        const uint32_t channels = terrainAsset.weightmapChannels;
+        const size_t rowStride = static_cast<size_t>(terrainAsset.weightmapWidth) * channels;
+        std::vector<uint8_t> raw(static_cast<size_t>(rect.width) * rect.height * channels);
+
+        size_t index = 0u;
+        for (uint32_t y = 0; y < rect.height; ++y)
+        {
+            const uint8_t *row = terrainAsset.weightmapData.data() + static_cast<size_t>(rect.y + y) * rowStride + static_cast<size_t>(rect.x) * channels;
+            const uint8_t *rowAbove = y > 0u ? row - rowStride : nullptr;
+
+            for (uint32_t x = 0; x < rect.width; ++x)
+            {
+                for (uint32_t channel = 0; channel < channels; ++channel, ++index)
+                {
+                    const uint8_t value = row[x * channels + channel];
+                    const uint8_t prediction = x > 0u ? row[(x - 1u) * channels + channel] : (rowAbove ? rowAbove[channel] : 0u);
+                    raw[index] = static_cast<uint8_t>(value - prediction);
+                }
+            }
+        }
+
+        return raw;
+    }
+
+    void decodeWeightResiduals(const std::vector<uint8_t> &raw, const TerrainTileRect &rect, uint32_t channels, uint8_t *output, size_t outputRowStride)
+    {
+        size_t index = 0u;
+        for (uint32_t y = 0; y < rect.height; ++y)
+        {
+            uint8_t *row = output + static_cast<size_t>(y) * outputRowStride;
+            const uint8_t *rowAbove = y > 0u ? row - outputRowStride : nullptr;
+
+            for (uint32_t x = 0; x < rect.width; ++x)
+            {
+                for (uint32_t channel = 0; channel < channels; ++channel, ++index)
+                {
+                    const uint8_t prediction = x > 0u ? row[(x - 1u) * channels + channel] : (rowAbove ? rowAbove[channel] : 0u);
+                    row[x * channels + channel] = static_cast<uint8_t>(prediction + raw[index]);
+                }
+            }
+        }
+    }
+
+    struct EncodedTile
+    {
+        std::vector<uint8_t> payload;
+        uint32_t rawSize{0};
+        uint16_t minValue{0};
+        uint16_t maxValue{0};
+        Compressor::Algorithm compression{Compressor::Algorithm::None};
+    };
+
+    void compressTile(std::vector<uint8_t> raw, EncodedTile &outTile)
+    {
+        outTile.rawSize = static_cast<uint32_t>(raw.size());
+
+        std::vector<uint8_t> compressed;
+        if (Compressor::compress(raw, compressed, Compressor::Algorithm::LZ4) && compressed.size() < raw.size())
+        {
+            outTile.payload = std::move(compressed);
+            outTile.compression = Compressor::Algorithm::LZ4;
+            return;
+        }
+
+        // LZ4 unavailable in this build, or the tile is incompressible.
+        outTile.payload = std::move(raw);
+        outTile.compression = Compressor::Algorithm::None;
+    }
+} // namespace
+
+bool TerrainTileFile::isTerrainTileFile(const std::string &filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    char magic[sizeof(TERRAIN_FILE_MAGIC)]{};
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, TERRAIN_FILE_MAGIC, sizeof(magic)) == 0;
+}
+
+bool TerrainTileFile::write(const TerrainAsset &terrainAsset, const std::string &filePath, uint32_t tileSize)
+{
+    if (!terrainAsset.isValid())
+        return false;
+
+    tileSize = std::clamp(tileSize, 16u, 1024u);
+
+    const bool hasWeightmap = terrainAsset.weightmapWidth > 0u && terrainAsset.weightmapHeight > 0u &&
+                              terrainAsset.weightmapData.size() == static_cast<size_t>(terrainAsset.weightmapWidth) *
+                                                                       terrainAsset.weightmapHeight * terrainAsset.weightmapChannels;
+
+    FileHeader header{};
+    std::memcpy(header.magic, TERRAIN_FILE_MAGIC, sizeof(header.magic));
+    header.formatVersion = FORMAT_VERSION;
+    header.headerSize = sizeof(FileHeader);
+    header.width = terrainAsset.width;
+    header.height = terrainAsset.height;
+    header.worldSizeX = terrainAsset.worldSizeX;
+    header.worldSizeZ = terrainAsset.worldSizeZ;
+    header.heightScale = terrainAsset.heightScale;
+    header.tileSize = tileSize;
+    header.heightTilesX = tileCount(terrainAsset.width, tileSize);
+    header.heightTilesY = tileCount(terrainAsset.height, tileSize);
+
+    if (hasWeightmap)
+    {
+        header.weightmapWidth = terrainAsset.weightmapWidth;
+        header.weightmapHeight = terrainAsset.weightmapHeight;
+        header.weightmapChannels = terrainAsset.weightmapChannels;
+        header.weightTilesX = tileCount(terrainAsset.weightmapWidth, tileSize);
+        header.weightTilesY = tileCount(terrainAsset.weightmapHeight, tileSize);
+    }
+
+    const size_t heightTileCount = static_cast<size_t>(header.heightTilesX) * header.heightTilesY;
+    const size_t weightTileCount = static_cast<size_t>(header.weightTilesX) * header.weightTilesY;
+
+    std::vector<EncodedTile> encodedTiles(heightTileCount + weightTileCount);
+    ThreadPoolManager::instance().parallelFor(encodedTiles.size(), [&](size_t begin, size_t end)
+                                              {
+        for (size_t index = begin; index < end; ++index)
+        {
+            auto &encodedTile = encodedTiles[index];
+            if (index < heightTileCount)
+            {
+                const auto rect = tileRect(static_cast<uint32_t>(index % header.heightTilesX), static_cast<uint32_t>(index / header.heightTilesX),
+                                           tileSize, header.width, header.height);
+                compressTile(encodeHeightTile(terrainAsset, rect, encodedTile.minValue, encodedTile.maxValue), encodedTile);
+            }
+            else
+            {
+                const size_t weightIndex = index - heightTileCount;
+                const auto rect = tileRect(static_cast<uint32_t>(weightIndex % header.weightTilesX), static_cast<uint32_t>(weightIndex / header.weightTilesX),
+                                           tileSize, header.weightmapWidth, header.weightmapHeight);
+                compressTile(encodeWeightTile(terrainAsset, rect), encodedTile);
+            }
+        } });
+
+    const std::string metadata = serializeTerrainMetadata(terrainAsset);
+
+    header.metadataOffset = sizeof(FileHeader);
+    header.metadataSize = metadata.size();
+    header.heightTableOffset = header.metadataOffset + header.metadataSize;
+    header.weightTableOffset = header.heightTableOffset + heightTileCount * sizeof(TileEntry);
+
+    std::vector<TileEntry> tileTable(encodedTiles.size());
+    uint64_t payloadOffset = header.weightTableOffset + weightTileCount * sizeof(TileEntry);
+    for (size_t index = 0; index < encodedTiles.size(); ++index)
+    {
+        const auto &encodedTile = encodedTiles[index];
+        auto &entry = tileTable[index];
+        entry.offset = payloadOffset;
+        entry.compressedSize = static_cast<uint32_t>(encodedTile.payload.size());
+        entry.rawSize = encodedTile.rawSize;
+        entry.minValue = encodedTile.minValue;
+        entry.maxValue = encodedTile.maxValue;
+        entry.compression = static_cast<uint8_t>(encodedTile.compression);
+        payloadOffset += entry.compressedSize;
+    }
+
+    // Written next to the target and renamed over it, so converting a file in place never leaves it half-written.
+    const std::filesystem::path outputPath(filePath);
+    const std::filesystem::path temporaryPath = outputPath.string() + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            VX_ENGINE_ERROR_STREAM("Failed to open terrain file for writing: " << temporaryPath << '\n');
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+        file.write(reinterpret_cast<const char *>(tileTable.data()), static_cast<std::streamsize>(tileTable.size() * sizeof(TileEntry)));
+        for (const auto &encodedTile : encodedTiles)
+            file.write(reinterpret_cast<const char *>(encodedTile.payload.data()), static_cast<std::streamsize>(encodedTile.payload.size()));
+
+        if (!file.good())
+        {
+            VX_ENGINE_ERROR_STREAM("Failed to write terrain file: " << temporaryPath << '\n');
+            return false;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(temporaryPath, outputPath, errorCode);
+    if (errorCode)
+    {
+        VX_ENGINE_ERROR_STREAM("Failed to replace terrain file " << outputPath << ": " << errorCode.message() << '\n');
+        std::filesystem::remove(temporaryPath, errorCode);
+        return false;
+    }
+
+    return true;
+}
+
+bool TerrainTileFile::open(const std::string &filePath)
+{
+    close();
+
+    const uint8_t *headerBytes = nullptr;
+    std::vector<uint8_t> headerScratch;
+
+    if (m_mappedFile.open(filePath))
+    {
+        m_fileSize = m_mappedFile.size();
+    }
+    else
+    {
+        m_stream.open(filePath, std::ios::binary | std::ios::ate);
+        if (!m_stream.is_open())
+        {
+            VX_ENGINE_ERROR_STREAM("Failed to open terrain file: " << filePath << '\n');
+            return false;
+        }
+
+        m_fileSize = static_cast<uint64_t>(m_stream.tellg());
+    }
+
+    m_isOpen = true;
+
+    auto readRange = [&](uint64_t offset, uint64_t size, std::vector<uint8_t> &scratch) -> const uint8_t *
+    {
+        TileEntry range{};
+        range.offset = offset;
+        range.compressedSize = static_cast<uint32_t>(size);
+        return size == range.compressedSize ? readPayload(range, scratch) : nullptr;
+    };
+
+    headerBytes = readRange(0u, sizeof(FileHeader), headerScratch);
+    FileHeader header{};
+    if (headerBytes)
+        std::memcpy(&header, headerBytes, sizeof(header));
+
+    if (!headerBytes || std::memcmp(header.magic, TERRAIN_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.formatVersion != FORMAT_VERSION || header.headerSize != sizeof(FileHeader) ||
+        header.width < 2u || header.height < 2u || header.tileSize == 0u ||
+        header.heightTilesX != tileCount(header.width, header.tileSize) ||
+        header.heightTilesY != tileCount(header.height, header.tileSize) ||
+        header.weightTilesX != tileCount(header.weightmapWidth, header.tileSize) ||
+        header.weightTilesY != tileCount(header.weightmapHeight, header.tileSize))
+    {
+        VX_ENGINE_ERROR_STREAM("Invalid terrain file header: " << filePath << '\n');
+        close();
+        return false;
+    }
+
+    m_tileSize = header.tileSize;
+    m_heightTilesX = header.heightTilesX;
+    m_heightTilesY = header.heightTilesY;
+    m_weightTilesX = header.weightTilesX;
+    m_weightTilesY = header.weightTilesY;
+
+    m_heightTiles.resize(static_cast<size_t>(m_heightTilesX) * m_heightTilesY);
+    m_weightTiles.resize(static_cast<size_t>(m_weightTilesX) * m_weightTilesY);
+
+    std::vector<uint8_t> scratch;
+    const uint8_t *metadataBytes = readRange(header.metadataOffset, header.metadataSize, scratch);
+    const std::string metadata = metadataBytes ? std::string(reinterpret_cast<const char *>(metadataBytes), header.metadataSize) : std::string{};
+
+    const uint8_t *heightTable = readRange(header.heightTableOffset, m_heightTiles.size() * sizeof(TileEntry), headerScratch);
+    if (heightTable)
+        std::memcpy(m_heightTiles.data(), heightTable, m_heightTiles.size() * sizeof(TileEntry));
+
+    const uint8_t *weightTable = m_weightTiles.empty() ? nullptr : readRange(header.weightTableOffset, m_weightTiles.size() * sizeof(TileEntry), headerScratch);
+    if (weightTable)
+        std::memcpy(m_weightTiles.data(), weightTable, m_weightTiles.size() * sizeof(TileEntry));
+
+    if (!metadataBytes || !heightTable || (!m_weightTiles.empty() && !weightTable))
+    {
+        VX_ENGINE_ERROR_STREAM("Truncated terrain file: " << filePath << '\n');
+        close();
+        return false;
+    }
+
+    m_description = TerrainAsset{};
+    deserializeTerrainMetadata(metadata, m_description);
+    m_description.width = header.width;
+    m_description.height = header.height;
+    m_description.worldSizeX = header.worldSizeX;
+    m_description.worldSizeZ = header.worldSizeZ;
+    m_description.heightScale = header.heightScale;
+    m_description.weightmapWidth = header.weightmapWidth;
+    m_description.weightmapHeight = header.weightmapHeight;
+    m_description.weightmapChannels = header.weightmapChannels == 0u ? 4u : header.weightmapChannels;
+
+    return true;
+}
+
+void TerrainTileFile::close()
+{
+    m_mappedFile.close();
+
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    if (m_stream.is_open())
+        m_stream.close();
+    m_stream.clear();
+
+    m_heightTiles.clear();
+    m_weightTiles.clear();
+    m_heightTilesX = m_heightTilesY = m_weightTilesX = m_weightTilesY = 0u;
+    m_fileSize = 0u;
+    m_isOpen = false;
+}
+
+TerrainTileRect TerrainTileFile::getHeightTileRect(uint32_t tileX, uint32_t tileY) const
+{
+    return tileRect(tileX, tileY, m_tileSize, m_description.width, m_description.height);
+}
+
+TerrainTileRect TerrainTileFile::getWeightTileRect(uint32_t tileX, uint32_t tileY) const
+{
+    return tileRect(tileX, tileY, m_tileSize, m_description.weightmapWidth, m_description.weightmapHeight);
+}
+
+bool TerrainTileFile::getHeightTileRange(uint32_t tileX, uint32_t tileY, uint16_t &outMin, uint16_t &outMax) const
+{
+    if (tileX >= m_heightTilesX || tileY >= m_heightTilesY)
+        return false;
+
+    const auto &entry = m_heightTiles[static_cast<size_t>(tileY) * m_heightTilesX + tileX];
+    outMin = entry.minValue;
+    outMax = entry.maxValue;
+    return true;
+}
+
+void TerrainTileFile::collectHeightTilesInRadius(float localX, float localZ, float radius, std::vector<TerrainTileCoord> &outTiles) const
+{
+    outTiles.clear();
+    if (!m_isOpen || radius < 0.0f)
+        return;
+
+    const float worldMinX = -m_description.worldSizeX * 0.5f;
+    const float worldMinZ = -m_description.worldSizeZ * 0.5f;
+    const float gridStepX = m_description.worldSizeX / static_cast<float>(m_description.width - 1u);
+    const float gridStepZ = m_description.worldSizeZ / static_cast<float>(m_description.height - 1u);
+    const float tileWorldX = gridStepX * static_cast<float>(m_tileSize);
+    const float tileWorldZ = gridStepZ * static_cast<float>(m_tileSize);
+
+    const auto toTileRange = [](float minValue, float maxValue, float origin, float tileExtent, uint32_t tileCount, uint32_t &outFirst, uint32_t &outLast)
+    {
+        const float first = std::floor((minValue - origin) / tileExtent);
+        const float last = std::floor((maxValue - origin) / tileExtent);
+        if (last < 0.0f || first >= static_cast<float>(tileCount))
+            return false;
+
+        outFirst = static_cast<uint32_t>(std::max(first, 0.0f));
+        outLast = static_cast<uint32_t>(std::min(last, static_cast<float>(tileCount - 1u)));
+        return true;
+    };
+
+    uint32_t firstX = 0u, lastX = 0u, firstY = 0u, lastY = 0u;
+    if (!toTileRange(localX - radius, localX + radius, worldMinX, tileWorldX, m_heightTilesX, firstX, lastX) ||
+        !toTileRange(localZ - radius, localZ + radius, worldMinZ, tileWorldZ, m_heightTilesY, firstY, lastY))
+        return;
+
+    const float radiusSquared = radius * radius;
+    for (uint32_t tileY = firstY; tileY <= lastY; ++tileY)
+    {
+        for (uint32_t tileX = firstX; tileX <= lastX; ++tileX)
+        {
+            // Distance from the point to the tile's XZ rectangle.
+            const float minX = worldMinX + static_cast<float>(tileX) * tileWorldX;
+            const float minZ = worldMinZ + static_cast<float>(tileY) * tileWorldZ;
+            const float dx = std::max({minX - localX, 0.0f, localX - (minX + tileWorldX)});
+            const float dz = std::max({minZ - localZ, 0.0f, localZ - (minZ + tileWorldZ)});
+            if (dx * dx + dz * dz <= radiusSquared)
+                outTiles.push_back({tileX, tileY});
+        }
+    }
+}
+
+const uint8_t *TerrainTileFile::readPayload(const TileEntry &entry, std::vector<uint8_t> &scratch) const
+{
+    if (!m_isOpen || entry.offset > m_fileSize || entry.compressedSize > m_fileSize - entry.offset)
+        return nullptr;
+
+    if (m_mappedFile.isOpen())
+        return m_mappedFile.data() + entry.offset;
+
+    scratch.resize(entry.compressedSize);
+
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    m_stream.clear();
+    m_stream.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!m_stream.read(reinterpret_cast<char *>(scratch.data()), static_cast<std::streamsize>(entry.compressedSize)))
+        return nullptr;
+
+    return scratch.data();
+}
+
+bool TerrainTileFile::decompressTile(const TileEntry &entry, std::vector<uint8_t> &outRaw) const
+{
+    std::vector<uint8_t> scratch;
+    const uint8_t *payload = readPayload(entry, scratch);
+    if (!payload)
+        return false;
+
+    const auto algorithm = static_cast<Compressor::Algorithm>(entry.compression);
+    return Compressor::decompress(payload, entry.compressedSize, entry.rawSize, outRaw, algorithm) &&
+           outRaw.size() == entry.rawSize;
+}
+
+bool TerrainTileFile::decodeHeightTile(uint32_t tileX, uint32_t tileY, std::vector<uint16_t> &outSamples) const
+{
+    if (tileX >= m_heightTilesX || tileY >= m_heightTilesY)
+        return false;
+
+    const auto rect = getHeightTileRect(tileX, tileY);
+    const size_t sampleCount = static_cast<size_t>(rect.width) * rect.height;
+
+    std::vector<uint8_t> raw;
+    if (!decompressTile(m_heightTiles[static_cast<size_t>(tileY) * m_heightTilesX + tileX], raw) || raw.size() != sampleCount * 2u)
+        return false;
+
+    outSamples.resize(sampleCount);
+    decodeHeightResiduals(raw, rect, outSamples.data(), rect.width);
+    return true;
+}
+
+bool TerrainTileFile::decodeWeightTile(uint32_t tileX, uint32_t tileY, std::vector<uint8_t> &outData) const
+{
+    if (tileX >= m_weightTilesX || tileY >= m_weightTilesY)
+        return false;
+
+    const auto rect = getWeightTileRect(tileX, tileY);
+    const uint32_t channels = m_description.weightmapChannels;
+    const size_t byteCount = static_cast<size_t>(rect.width) * rect.height * channels;
+
+    std::vector<uint8_t> raw;
+    if (!decompressTile(m_weightTiles[static_cast<size_t>(tileY) * m_weightTilesX + tileX], raw) || raw.size() != byteCount)
+        return false;
+
+    outData.resize(byteCount);
+    decodeWeightResiduals(raw, rect, channels, outData.data(), static_cast<size_t>(rect.width) * channels);
+    return true;
+}
+
+std::optional<TerrainAsset> TerrainTileFile::loadAll() const
+{
+    if (!m_isOpen)
+        return std::nullopt;
+
+    TerrainAsset terrainAsset = m_description;
+    terrainAsset.heightSamples.resize(static_cast<size_t>(terrainAsset.width) * terrainAsset.height);
+    if (!m_weightTiles.empty())
+        terrainAsset.weightmapData.resize(static_cast<size_t>(terrainAsset.weightmapWidth) * terrainAsset.weightmapHeight * terrainAsset.weightmapChannels);
+
+    const size_t heightTileCount = m_heightTiles.size();
+    std::atomic<bool> failed{false};
+
+    // Tiles decode straight into their place in the full arrays; they never overlap.
+    ThreadPoolManager::instance().parallelFor(heightTileCount + m_weightTiles.size(), [&](size_t begin, size_t end)
+                                              {
+        std::vector<uint8_t> raw;
+        for (size_t index = begin; index < end && !failed.load(std::memory_order_relaxed); ++index)
+        {
+            if (index < heightTileCount)
+            {
+                const auto rect = getHeightTileRect(static_cast<uint32_t>(index % m_heightTilesX), static_cast<uint32_t>(index / m_heightTilesX));
+                if (!decompressTile(m_heightTiles[index], raw) || raw.size() != static_cast<size_t>(rect.width) * rect.height * 2u)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+
+                uint16_t *destination = terrainAsset.heightSamples.data() + static_cast<size_t>(rect.y) * terrainAsset.width + rect.x;
+                decodeHeightResiduals(raw, rect, destination, terrainAsset.width);
+            }
+            else
+            {
+                const size_t weightIndex = index - heightTileCount;
+                const auto rect = getWeightTileRect(static_cast<uint32_t>(weightIndex % m_weightTilesX), static_cast<uint32_t>(weightIndex / m_weightTilesX));
+                const uint32_t channels = terrainAsset.weightmapChannels;
+                if (!decompressTile(m_weightTiles[weightIndex], raw) || raw.size() != static_cast<size_t>(rect.width) * rect.height * channels)
+                {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+
+                const size_t rowStride = static_cast<size_t>(terrainAsset.weightmapWidth) * channels;
+                uint8_t *destination = terrainAsset.weightmapData.data() + static_cast<size_t>(rect.y) * rowStride + static_cast<size_t>(rect.x) * channels;
+                decodeWeightResiduals(raw, rect, channels, destination, rowStride);
+            }
+        } });
+
+    if (failed.load())
+    {
+        VX_ENGINE_ERROR_STREAM("Failed to decode terrain tiles for '" << terrainAsset.name << "'\n");
+        return std::nullopt;
+    }
+
+    return terrainAsset;
+}
+
+ELIX_NESTED_NAMESPACE_END
@@ -1,10 +1,18 @@
 #include "Engine/Threads/ThreadPoolManager.hpp"
+#include "Engine/Runtime/EngineConfig.hpp"
+#include "Engine/Profiling/CpuProfiler.hpp"
 
 #include <algorithm>
 #include <stdexcept>
+#include <string>
 
 ELIX_NESTED_NAMESPACE_BEGIN(engine)
 
+namespace
+{
+    thread_local bool t_isPoolWorker = false;
+} // namespace
+
 ThreadPoolManager &ThreadPoolManager::instance()
 {
     static ThreadPoolManager manager;
@@ -14,12 +22,21 @@ ThreadPoolManager &ThreadPoolManager::instance()
 ThreadPoolManager::ThreadPoolManager()
 {
     const std::size_t hardwareThreads = std::max<std::size_t>(1u, std::thread::hardware_concurrency());
-    const std::size_t workerCount = hardwareThreads > 1u ? hardwareThreads - 1u : 0u;
+    const int configuredWorkers = EngineConfig::instance().getWorkerThreadCount();
+
+    // 0 means one worker per hardware thread besides the main thread.
+    const std::size_t workerCount = configuredWorkers > 0
+                                        ? static_cast<std::size_t>(configuredWorkers)
+                                        : (hardwareThreads > 1u ? hardwareThreads - 1u : 0u);
 
     m_workers.reserve(workerCount);
     for (std::size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
-        m_workers.emplace_back([this]()
-                               { workerLoop(); });
+        m_workers.emplace_back([this, workerIndex]()
+                               {
+                                   const std::string threadName = "Job Worker " + std::to_string(workerIndex);
+                                   VX_PROFILE_THREAD_NAME(threadName.c_str());
+                                   t_isPoolWorker = true;
+                                   workerLoop(); });
 }
 
 ThreadPoolManager::~ThreadPoolManager()
@@ -57,7 +74,7 @@ void ThreadPoolManager::parallelFor(std::size_t taskCount, const RangeTask &task
                                                                   : std::max<std::size_t>(1u, maxThreadCount);
     const std::size_t threadCount = std::max<std::size_t>(1u, std::min(taskCount, requestedThreadCount));
 
-    if (threadCount == 1u)
+    if (threadCount == 1u || t_isPoolWorker)
     {
         task(0u, taskCount);
         return;
@@ -75,7 +92,9 @@ void ThreadPoolManager::parallelFor(std::size_t taskCount, const RangeTask &task
             std::lock_guard<std::mutex> lock(m_queueMutex);
             m_tasks.emplace([batchState, task, begin, end]()
                             { executeOrCaptureTask(batchState, [task, begin, end]()
-                                                   { task(begin, end); }); });
+                                                   {
+                                                       VX_PROFILE_SCOPE("ParallelFor chunk");
+                                                       task(begin, end); }); });
         }
     }
 
@@ -84,7 +103,9 @@ void ThreadPoolManager::parallelFor(std::size_t taskCount, const RangeTask &task
     const std::size_t callerBegin = 0u;
     const std::size_t callerEnd = taskCount / threadCount;
     executeOrCaptureTask(batchState, [task, callerBegin, callerEnd]()
-                         { task(callerBegin, callerEnd); });
+                         {
+                             VX_PROFILE_SCOPE("ParallelFor chunk");
+                             task(callerBegin, callerEnd); });
 
     std::unique_lock<std::mutex> lock(batchState->mutex);
     batchState->cv.wait(lock, [&batchState]()
@@ -94,6 +115,25 @@ void ThreadPoolManager::parallelFor(std::size_t taskCount, const RangeTask &task
         std::rethrow_exception(batchState->firstException);
 }
 
+void ThreadPoolManager::submit(std::function<void()> task)
+{
+    if (!task)
+        return;
+
+    if (m_workers.empty())
+    {
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_tasks.emplace(std::move(task));
+    }
+
+    m_queueCv.notify_one();
+}
+
 void ThreadPoolManager::workerLoop()
 {
     for (;;)
@@ -112,6 +152,7 @@ void ThreadPoolManager::workerLoop()
             m_tasks.pop();
         }
 
+        VX_PROFILE_SCOPE("Job");
         task();
     }
 }
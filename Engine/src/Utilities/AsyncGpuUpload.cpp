@@ -105,8 +105,12 @@ bool AsyncGpuUpload::submitAndWait(core::CommandBuffer::SharedPtr commandBuffer,
 }
 
 bool AsyncGpuUpload::submit(core::CommandBuffer::SharedPtr commandBuffer, VkQueue queue,
-                            std::vector<core::Buffer::SharedPtr> stagingBuffers)
+                            std::vector<core::Buffer::SharedPtr> stagingBuffers,
+                            uint64_t *outCompletionValue)
 {
+    if (outCompletionValue)
+        *outCompletionValue = 0u;
+
     if (!commandBuffer || queue == VK_NULL_HANDLE)
         return false;
 
@@ -147,6 +151,9 @@ bool AsyncGpuUpload::submit(core::CommandBuffer::SharedPtr commandBuffer, VkQueu
             });
         }
 
+        if (outCompletionValue)
+            *outCompletionValue = completionValue;
+
         return true;
     }
 
@@ -386,6 +393,21 @@ void AsyncGpuUpload::collectFinished(VkDevice device)
     g_pendingUploads.resize(writeIndex);
 }
 
+bool AsyncGpuUpload::isComplete(uint64_t completionValue)
+{
+    std::lock_guard<std::mutex> lock(g_pendingUploadsMutex);
+
+    // After shutdown() nothing is in flight any more.
+    if (g_timelineSemaphore == VK_NULL_HANDLE)
+        return true;
+
+    uint64_t completedTimelineValue = 0u;
+    if (vkGetSemaphoreCounterValue(core::VulkanContext::getContext()->getDevice(), g_timelineSemaphore, &completedTimelineValue) != VK_SUCCESS)
+        return false;
+
+    return completedTimelineValue >= completionValue;
+}
+
 AsyncGpuUpload::TimelineWait AsyncGpuUpload::acquireReadyTimelineWait()
 {
     std::lock_guard<std::mutex> lock(g_pendingUploadsMutex);
@@ -0,0 +1,962 @@
+#include "Engine/Assets/Asset.hpp"
+#include "Engine/Assets/AssetsSerializer.hpp"
+#include "Engine/Assets/ElixBundle.hpp"
+#include "Engine/Camera.hpp"
+#include "Engine/Components/AnimatorComponent.hpp"
+#include "Engine/Components/LightComponent.hpp"
+#include "Engine/Components/ParticleSystemComponent.hpp"
+#include "Engine/Components/ScriptComponent.hpp"
+#include "Engine/Components/StaticMeshComponent.hpp"
+#include "Engine/Components/Transform3DComponent.hpp"
+#include "Engine/Mesh.hpp"
+#include "Engine/Particles/Modules/ForceModule.hpp"
+#include "Engine/Particles/Modules/InitialVelocityModule.hpp"
+#include "Engine/Particles/Modules/LifetimeModule.hpp"
+#include "Engine/Particles/Modules/SpawnModule.hpp"
+#include "Engine/Physics/PhysXCore.hpp"
+#include "Engine/Primitives.hpp"
+#include "Engine/Render/LightClusterBuilder.hpp"
+#include "Engine/Render/MeshGeometryRegistry.hpp"
+#include "Engine/Render/RenderGraph/PerFrameDataWorker.hpp"
+#include "Engine/Render/RenderQualitySettings.hpp"
+#include "Engine/Scene.hpp"
+#include "Engine/Scripting/Script.hpp"
+#include "Engine/Scripting/VelixAPI.hpp"
+#include "Engine/Skeleton.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace engine = elix::engine;
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float FRAME_DELTA_SECONDS = 1.0f / 60.0f;
+    constexpr float GRID_SPACING = 4.0f;
+    constexpr uint32_t SERIALIZED_MESH_COUNT = 64u;
+    constexpr uint32_t BUNDLE_MODEL_COUNT = 16u;
+
+    struct Options
+    {
+        uint32_t entityCount{10000u};
+        uint32_t hierarchyDepth{4u};
+        uint32_t animatorCount{256u};
+        uint32_t boneCount{32u};
+        uint32_t emitterCount{64u};
+        uint32_t lightCount{16u};
+        uint32_t clusterLightCount{1024u};
+        uint32_t scriptCount{1024u};
+        uint32_t frameCount{120u};
+        uint32_t warmupFrameCount{10u};
+        uint32_t ioIterationCount{20u};
+        uint32_t seed{1337u};
+        std::filesystem::path outputPath{"velix_bench.json"};
+        std::vector<std::string> benchmarks;
+    };
+
+    struct Timing
+    {
+        std::string name;
+        std::vector<double> samplesMs;
+    };
+
+    // Skeletons are referenced by pointer from the animators, so they live in a deque next to the scene.
+    struct SyntheticScene
+    {
+        std::deque<engine::Skeleton> skeletons;
+        std::shared_ptr<engine::Scene> scene;
+        std::vector<engine::AnimatorComponent *> animators;
+        std::vector<engine::ParticleSystemComponent *> emitters;
+        engine::Camera::SharedPtr camera;
+    };
+
+    const std::vector<std::string> &benchmarkNames()
+    {
+        static const std::vector<std::string> names{"scene", "animation", "particles", "frame_data", "light_clusters", "parallel_scripts", "serialization", "bundle"};
+        return names;
+    }
+
+    void printUsage(const char *executableName)
+    {
+        std::cout
+            << "Velix Bench\n"
+            << "Times CPU-side engine subsystems on a synthetic scene without a window or Vulkan device.\n\n"
+            << "Usage:\n"
+            << "  " << executableName << " [options]\n\n"
+            << "Options:\n"
+            << "  --entities <count>       Mesh entities in the scene. Default: 10000\n"
+            << "  --depth <count>          Hierarchy depth of each entity chain (1 = flat). Default: 4\n"
+            << "  --animators <count>      Entities with an animated skeleton. Default: 256\n"
+            << "  --bones <count>          Bones per skeleton. Default: 32\n"
+            << "  --emitters <count>       Entities with a particle emitter. Default: 64\n"
+            << "  --lights <count>         Lights; the first one is directional. Default: 16\n"
+            << "  --cluster-lights <count> Lights binned by the light_clusters benchmark. Default: 1024\n"
+            << "  --scripts <count>        Entities with a parallel script in parallel_scripts. Default: 1024\n"
+            << "  --frames <count>         Measured frames per benchmark. Default: 120\n"
+            << "  --warmup <count>         Frames run before measuring. Default: 10\n"
+            << "  --io-iterations <count>  Repetitions of the serialization and bundle benchmarks. Default: 20\n"
+            << "  --seed <value>           Seed for the scene layout. Default: 1337\n"
+            << "  --only <names>           Comma separated subset of: scene, animation, particles,\n"
+            << "                           frame_data, light_clusters, parallel_scripts, serialization,\n"
+            << "                           bundle.\n"
+            << "  --output <path>          JSON results file. Default: velix_bench.json\n"
+            << "  --help                   Show this help.\n\n"
+            << "Examples:\n"
+            << "  " << executableName << " --entities 50000 --output baseline.json\n"
+            << "  " << executableName << " --only frame_data,scene --frames 300\n";
+    }
+
+    bool parseCount(const std::string &argument, const std::string &value, uint32_t minimum, uint32_t &outValue)
+    {
+        char *endPointer = nullptr;
+        const unsigned long parsed = std::strtoul(value.c_str(), &endPointer, 10);
+        if (!endPointer || endPointer == value.c_str() || *endPointer != '\0' || parsed < minimum || parsed > UINT32_MAX)
+        {
+            std::cerr << "Invalid value for " << argument << ": " << value << '\n';
+            return false;
+        }
+
+        outValue = static_cast<uint32_t>(parsed);
+        return true;
+    }
+
+    bool parseBenchmarkList(const std::string &value, std::vector<std::string> &outBenchmarks)
+    {
+        std::stringstream stream(value);
+        std::string name;
+        while (std::getline(stream, name, ','))
+        {
+            if (name.empty())
+                continue;
+
+            const auto &names = benchmarkNames();
+            if (std::find(names.begin(), names.end(), name) == names.end())
+            {
+                std::cerr << "Unknown benchmark: " << name << '\n';
+                return false;
+            }
+
+            outBenchmarks.push_back(name);
+        }
+
+        return true;
+    }
+
+    bool parseArguments(int argc, char **argv, Options &outOptions)
+    {
+        for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+        {
+            const std::string argument = argv[argumentIndex];
+
+            if (argumentIndex + 1 >= argc)
+            {
+                std::cerr << (argument.rfind("--", 0) == 0 ? "Missing value for " : "Unknown option: ") << argument << '\n';
+                return false;
+            }
+
+            const std::string value = argv[++argumentIndex];
+            bool parsed = true;
+
+            if (argument == "--entities")
+                parsed = parseCount(argument, value, 1u, outOptions.entityCount);
+            else if (argument == "--depth")
+                parsed = parseCount(argument, value, 1u, outOptions.hierarchyDepth);
+            else if (argument == "--animators")
+                parsed = parseCount(argument, value, 0u, outOptions.animatorCount);
+            else if (argument == "--bones")
+                parsed = parseCount(argument, value, 1u, outOptions.boneCount);
+            else if (argument == "--emitters")
+                parsed = parseCount(argument, value, 0u, outOptions.emitterCount);
+            else if (argument == "--lights")
+                parsed = parseCount(argument, value, 0u, outOptions.lightCount);
+            else if (argument == "--cluster-lights")
+                parsed = parseCount(argument, value, 0u, outOptions.clusterLightCount);
+            else if (argument == "--scripts")
+                parsed = parseCount(argument, value, 1u, outOptions.scriptCount);
+            else if (argument == "--frames")
+                parsed = parseCount(argument, value, 1u, outOptions.frameCount);
+            else if (argument == "--warmup")
+                parsed = parseCount(argument, value, 0u, outOptions.warmupFrameCount);
+            else if (argument == "--io-iterations")
+                parsed = parseCount(argument, value, 1u, outOptions.ioIterationCount);
+            else if (argument == "--seed")
+                parsed = parseCount(argument, value, 0u, outOptions.seed);
+            else if (argument == "--only")
+                parsed = parseBenchmarkList(value, outOptions.benchmarks);
+            else if (argument == "--output")
+                outOptions.outputPath = value;
+            else
+            {
+                std::cerr << "Unknown option: " << argument << '\n';
+                return false;
+            }
+
+            if (!parsed)
+                return false;
+        }
+
+        // Animators and emitters are attached to mesh entities.
+        outOptions.animatorCount = std::min(outOptions.animatorCount, outOptions.entityCount);
+        outOptions.emitterCount = std::min(outOptions.emitterCount, outOptions.entityCount);
+
+        return true;
+    }
+
+    bool isBenchmarkEnabled(const Options &options, const std::string &name)
+    {
+        return options.benchmarks.empty() ||
+               std::find(options.benchmarks.begin(), options.benchmarks.end(), name) != options.benchmarks.end();
+    }
+
+    double elapsedMs(Clock::time_point startTime)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - startTime).count();
+    }
+
+    template <typename Function>
+    Timing measure(const std::string &name, uint32_t warmupCount, uint32_t iterationCount, Function &&function)
+    {
+        Timing timing{name, {}};
+        timing.samplesMs.reserve(iterationCount);
+
+        for (uint32_t iteration = 0; iteration < warmupCount; ++iteration)
+            function();
+
+        for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+        {
+            const auto startTime = Clock::now();
+            function();
+            timing.samplesMs.push_back(elapsedMs(startTime));
+        }
+
+        return timing;
+    }
+
+    double percentile(const std::vector<double> &sortedSamples, double fraction)
+    {
+        if (sortedSamples.empty())
+            return 0.0;
+
+        const double position = fraction * static_cast<double>(sortedSamples.size() - 1u);
+        const size_t lowerIndex = static_cast<size_t>(position);
+        const size_t upperIndex = std::min(lowerIndex + 1u, sortedSamples.size() - 1u);
+        const double weight = position - static_cast<double>(lowerIndex);
+        return sortedSamples[lowerIndex] + (sortedSamples[upperIndex] - sortedSamples[lowerIndex]) * weight;
+    }
+
+    nlohmann::json summarize(const Timing &timing)
+    {
+        std::vector<double> sortedSamples = timing.samplesMs;
+        std::sort(sortedSamples.begin(), sortedSamples.end());
+
+        double totalMs = 0.0;
+        for (const double sample : sortedSamples)
+            totalMs += sample;
+
+        const bool empty = sortedSamples.empty();
+        return nlohmann::json{
+            {"name", timing.name},
+            {"iterations", sortedSamples.size()},
+            {"mean_ms", empty ? 0.0 : totalMs / static_cast<double>(sortedSamples.size())},
+            {"median_ms", percentile(sortedSamples, 0.5)},
+            {"p95_ms", percentile(sortedSamples, 0.95)},
+            {"min_ms", empty ? 0.0 : sortedSamples.front()},
+            {"max_ms", empty ? 0.0 : sortedSamples.back()}};
+    }
+
+    engine::CPUMesh makeCubeMesh()
+    {
+        auto mesh = engine::CPUMesh::build<engine::vertex::Vertex3D>(engine::cube::vertices, engine::cube::indices);
+        mesh.name = "Cube";
+        return mesh;
+    }
+
+    engine::CPUMesh makeSphereMesh()
+    {
+        std::vector<engine::vertex::Vertex3D> vertices;
+        std::vector<uint32_t> indices;
+        engine::circle::genereteVerticesAndIndices(vertices, indices);
+
+        auto mesh = engine::CPUMesh::build<engine::vertex::Vertex3D>(vertices, indices);
+        mesh.name = "Sphere";
+        return mesh;
+    }
+
+    // Binary tree of bones; every other bone carries translation keys so both interpolation paths run.
+    void buildSkeleton(engine::Skeleton &skeleton, uint32_t boneCount)
+    {
+        for (uint32_t boneIndex = 0; boneIndex < boneCount; ++boneIndex)
+        {
+            const int boneId = static_cast<int>(skeleton.addBone(engine::Skeleton::BoneInfo("Bone_" + std::to_string(boneIndex),
+                                                                                            static_cast<int>(boneIndex),
+                                                                                            glm::mat4(1.0f),
+                                                                                            glm::mat4(1.0f))));
+            if (boneIndex == 0u)
+                continue;
+
+            const int parentId = static_cast<int>((boneIndex - 1u) / 2u);
+            skeleton.getBone(boneId)->parentId = parentId;
+            skeleton.getBone(parentId)->children.push_back(boneId);
+        }
+
+        skeleton.calculateBindPoseTransforms();
+    }
+
+    engine::Animation buildAnimation(uint32_t boneCount)
+    {
+        constexpr uint32_t keyFrameCount = 16u;
+        constexpr double ticksPerSecond = 30.0;
+
+        engine::Animation animation{};
+        animation.name = "Synthetic";
+        animation.ticksPerSecond = ticksPerSecond;
+        animation.duration = ticksPerSecond * 2.0;
+        animation.boneAnimations.reserve(boneCount);
+
+        for (uint32_t boneIndex = 0; boneIndex < boneCount; ++boneIndex)
+        {
+            engine::AnimationTrack track{};
+            track.objectName = "Bone_" + std::to_string(boneIndex);
+            track.keyFrames.reserve(keyFrameCount + 1u);
+
+            for (uint32_t keyIndex = 0; keyIndex <= keyFrameCount; ++keyIndex)
+            {
+                const float phase = static_cast<float>(keyIndex) / static_cast<float>(keyFrameCount);
+                const float angle = std::sin(phase * glm::two_pi<float>() + static_cast<float>(boneIndex)) * 0.5f;
+
+                engine::SQT keyFrame{};
+                keyFrame.rotation = glm::angleAxis(angle, glm::normalize(glm::vec3(1.0f, static_cast<float>(boneIndex % 3u), 0.5f)));
+                keyFrame.position = boneIndex % 2u == 0u ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(0.0f, 1.0f + angle * 0.1f, 0.0f);
+                keyFrame.timeStamp = static_cast<float>(phase * animation.duration);
+                track.keyFrames.push_back(keyFrame);
+            }
+
+            animation.boneAnimations.push_back(std::move(track));
+        }
+
+        return animation;
+    }
+
+    engine::ParticleSystem::SharedPtr buildParticleSystem()
+    {
+        auto particleSystem = std::make_shared<engine::ParticleSystem>();
+        particleSystem->name = "Synthetic";
+
+        auto *emitter = particleSystem->addEmitter("Sparks");
+        emitter->addModule<engine::SpawnModule>()->spawnRate = 200.0f;
+
+        auto *lifetime = emitter->addModule<engine::LifetimeModule>();
+        lifetime->minLifetime = 1.0f;
+        lifetime->maxLifetime = 2.0f;
+
+        auto *velocity = emitter->addModule<engine::InitialVelocityModule>();
+        velocity->baseVelocity = glm::vec3(0.0f, 4.0f, 0.0f);
+        velocity->randomness = glm::vec3(1.5f, 1.0f, 1.5f);
+
+        emitter->addModule<engine::ForceModule>();
+
+        return particleSystem;
+    }
+
+    // Entities form chains of hierarchyDepth links on a square grid; roots are spread around the camera
+    // so frustum culling rejects part of the scene.
+    void buildSyntheticScene(const Options &options, SyntheticScene &outScene)
+    {
+        std::mt19937 random(options.seed);
+        std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+
+        outScene.scene = std::make_shared<engine::Scene>();
+        auto &scene = *outScene.scene;
+
+        const std::vector<engine::CPUMesh> cubeMeshes{makeCubeMesh()};
+        const std::vector<engine::CPUMesh> sphereMeshes{makeSphereMesh()};
+        const engine::Animation animation = buildAnimation(options.boneCount);
+
+        const uint32_t rootCount = (options.entityCount + options.hierarchyDepth - 1u) / options.hierarchyDepth;
+        const uint32_t gridSide = std::max(1u, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(rootCount)))));
+        const float gridExtent = static_cast<float>(gridSide) * GRID_SPACING;
+
+        const uint32_t animatorStride = options.animatorCount > 0u ? std::max(1u, options.entityCount / options.animatorCount) : 0u;
+        const uint32_t emitterStride = options.emitterCount > 0u ? std::max(1u, options.entityCount / options.emitterCount) : 0u;
+
+        engine::Entity *chainParent = nullptr;
+        for (uint32_t entityIndex = 0; entityIndex < options.entityCount; ++entityIndex)
+        {
+            auto entity = scene.addEntity("Entity_" + std::to_string(entityIndex));
+            auto *transform = entity->getComponent<engine::Transform3DComponent>();
+
+            if (entityIndex % options.hierarchyDepth == 0u)
+            {
+                const uint32_t rootIndex = entityIndex / options.hierarchyDepth;
+                transform->setPosition(glm::vec3(static_cast<float>(rootIndex % gridSide) * GRID_SPACING - gridExtent * 0.5f,
+                                                 0.0f,
+                                                 static_cast<float>(rootIndex / gridSide) * GRID_SPACING - gridExtent * 0.5f));
+                chainParent = nullptr;
+            }
+            else
+            {
+                entity->setParent(chainParent);
+                transform->setPosition(glm::vec3(0.0f, 1.5f, 0.0f));
+                transform->setScale(glm::vec3(0.75f));
+            }
+
+            transform->setRotation(glm::angleAxis(unitDistribution(random) * glm::two_pi<float>(), glm::vec3(0.0f, 1.0f, 0.0f)));
+            chainParent = entity.get();
+
+            // One in eight meshes is the heavier sphere so sorting and batching see two geometries.
+            entity->addComponent<engine::StaticMeshComponent>(entityIndex % 8u == 7u ? sphereMeshes : cubeMeshes);
+
+            if (animatorStride > 0u && entityIndex % animatorStride == 0u && outScene.animators.size() < options.animatorCount)
+            {
+                auto &skeleton = outScene.skeletons.emplace_back();
+                buildSkeleton(skeleton, options.boneCount);
+
+                auto *animator = entity->addComponent<engine::AnimatorComponent>();
+                animator->setAnimations({animation}, &skeleton);
+                animator->playAnimationByIndex(0u);
+                animator->setCurrentTime(unitDistribution(random) * static_cast<float>(animation.duration));
+                outScene.animators.push_back(animator);
+            }
+
+            if (emitterStride > 0u && entityIndex % emitterStride == 0u && outScene.emitters.size() < options.emitterCount)
+            {
+                auto *emitter = entity->addComponent<engine::ParticleSystemComponent>();
+                emitter->setParticleSystem(buildParticleSystem());
+                outScene.emitters.push_back(emitter);
+            }
+        }
+
+        for (uint32_t lightIndex = 0; lightIndex < options.lightCount; ++lightIndex)
+        {
+            using LightType = engine::LightComponent::LightType;
+            const LightType lightType = lightIndex == 0u ? LightType::DIRECTIONAL : (lightIndex % 2u == 0u ? LightType::SPOT : LightType::POINT);
+
+            auto entity = scene.addEntity("Light_" + std::to_string(lightIndex));
+            entity->getComponent<engine::Transform3DComponent>()->setPosition(
+                glm::vec3((unitDistribution(random) - 0.5f) * gridExtent, 6.0f, (unitDistribution(random) - 0.5f) * gridExtent));
+
+            auto light = entity->addComponent<engine::LightComponent>(lightType)->getLight();
+            light->color = glm::vec3(unitDistribution(random), unitDistribution(random), unitDistribution(random));
+            light->strength = 1.0f + unitDistribution(random) * 4.0f;
+        }
+
+        outScene.camera = std::make_shared<engine::Camera>();
+        outScene.camera->setAspect(16.0f / 9.0f);
+        outScene.camera->setFar(std::max(500.0f, gridExtent));
+        outScene.camera->setPosition(glm::vec3(0.0f, 20.0f, gridExtent * 0.25f));
+        outScene.camera->setPitch(-20.0f);
+        outScene.camera->updateCameraVectors();
+    }
+
+    void runSceneBenchmarks(const Options &options, SyntheticScene &syntheticScene, std::vector<Timing> &outTimings)
+    {
+        auto &scene = *syntheticScene.scene;
+
+        if (isBenchmarkEnabled(options, "scene"))
+            outTimings.push_back(measure("scene_update", options.warmupFrameCount, options.frameCount, [&]()
+                                         { scene.update(FRAME_DELTA_SECONDS); }));
+
+        if (isBenchmarkEnabled(options, "animation") && !syntheticScene.animators.empty())
+            outTimings.push_back(measure("animation_sample", options.warmupFrameCount, options.frameCount, [&]()
+                                         {
+                                             for (auto *animator : syntheticScene.animators)
+                                                 animator->update(FRAME_DELTA_SECONDS); }));
+
+        if (isBenchmarkEnabled(options, "particles") && !syntheticScene.emitters.empty())
+            outTimings.push_back(measure("particle_update", options.warmupFrameCount, options.frameCount, [&]()
+                                         {
+                                             for (auto *emitter : syntheticScene.emitters)
+                                                 emitter->update(FRAME_DELTA_SECONDS); }));
+    }
+
+    // Runs the same PerFrameDataWorker steps as RenderGraph, with a geometry registry that skips uploads.
+    void runFrameDataBenchmark(const Options &options, SyntheticScene &syntheticScene, std::vector<Timing> &outTimings, nlohmann::json &outStatistics)
+    {
+        using engine::renderGraph::PerFrameDataWorker;
+
+        engine::MeshGeometryRegistry geometryRegistry;
+        geometryRegistry.setGpuUploadEnabled(false);
+
+        engine::RenderGraphPassPerFrameData frameData{};
+        frameData.swapChainViewport = VkViewport{0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f};
+
+        std::array<glm::vec4, 6> lastFrustumPlanes{};
+        bool lastFrustumCullingEnabled = false;
+
+        std::vector<Timing> stepTimings{{"frame_data_lights", {}},
+                                        {"frame_data_sync_draw_items", {}},
+                                        {"frame_data_draw_references", {}},
+                                        {"frame_data_sort", {}},
+                                        {"frame_data_raster_batches", {}},
+                                        {"frame_data_shadow_batches", {}},
+                                        {"frame_data_total", {}}};
+
+        engine::Scene *scene = syntheticScene.scene.get();
+        engine::Camera *camera = syntheticScene.camera.get();
+        const glm::mat4 view = camera->getViewMatrix();
+        const glm::mat4 projection = camera->getProjectionMatrix();
+        const glm::vec3 cameraWorldPos = glm::vec3(glm::inverse(view)[3]);
+
+        for (uint32_t frameIndex = 0; frameIndex < options.warmupFrameCount + options.frameCount; ++frameIndex)
+        {
+            const bool record = frameIndex >= options.warmupFrameCount;
+            size_t stepIndex = 0u;
+            auto step = [&](auto &&function)
+            {
+                const auto startTime = Clock::now();
+                function();
+                if (record)
+                    stepTimings[stepIndex].samplesMs.push_back(elapsedMs(startTime));
+                ++stepIndex;
+            };
+
+            const auto frameStartTime = Clock::now();
+
+            auto worker = PerFrameDataWorker::begin(
+                frameData,
+                PerFrameDataWorker::Dependencies{
+                    .meshGeometryRegistry = &geometryRegistry,
+                    .lastFrustumPlanes = &lastFrustumPlanes,
+                    .lastFrustumCullingEnabled = &lastFrustumCullingEnabled,
+                    .currentFrame = frameIndex % 2u});
+
+            step([&]()
+                 { worker.buildLightData(scene, camera); });
+            step([&]()
+                 {
+                     worker.pruneRemovedEntities(scene);
+                     worker.syncSceneDrawItems(scene, cameraWorldPos);
+                     geometryRegistry.collectUnusedGeometry(); });
+            step([&]()
+                 {
+                     worker.buildFrameBones();
+                     worker.buildDrawReferences(view, projection, true); });
+            step([&]()
+                 { worker.sortDrawReferences(cameraWorldPos); });
+            step([&]()
+                 { worker.buildRasterBatches(); });
+            step([&]()
+                 { worker.buildShadowBatches(); });
+
+            if (record)
+                stepTimings.back().samplesMs.push_back(elapsedMs(frameStartTime));
+        }
+
+        size_t directionalShadowBatchCount = 0u;
+        for (const auto &batches : frameData.directionalShadowDrawBatches)
+            directionalShadowBatchCount += batches.size();
+
+        outStatistics["draw_items"] = frameData.drawItems.size();
+        outStatistics["visible_instances"] = frameData.perObjectInstances.size();
+        outStatistics["draw_batches"] = frameData.drawBatches.size();
+        outStatistics["directional_shadow_batches"] = directionalShadowBatchCount;
+        outStatistics["unique_geometries"] = geometryRegistry.size();
+
+        outTimings.insert(outTimings.end(), stepTimings.begin(), stepTimings.end());
+    }
+
+    // View-space lights spread through the camera frustum: a few directional lights, the rest alternating
+    // point and spot, with ranges from small fill lights up to ones spanning many slices.
+    std::vector<engine::RenderGraphLightData> buildClusterLights(const Options &options, const engine::Camera &camera)
+    {
+        std::mt19937 random(options.seed);
+        std::uniform_real_distribution<float> unitDistribution(0.0f, 1.0f);
+
+        const float tanHalfFov = std::tan(glm::radians(camera.getFOV()) * 0.5f);
+        const float maxDepth = camera.getFar() * 0.5f;
+
+        std::vector<engine::RenderGraphLightData> lights(options.clusterLightCount);
+        for (uint32_t lightIndex = 0; lightIndex < options.clusterLightCount; ++lightIndex)
+        {
+            auto &light = lights[lightIndex];
+            const glm::vec3 direction = glm::normalize(glm::vec3(unitDistribution(random) - 0.5f, unitDistribution(random) - 0.5f, -1.0f));
+
+            if (lightIndex % 64u == 0u)
+            {
+                light.direction = glm::vec4(direction, 0.0f);
+                light.parameters.w = 0.0f;
+                continue;
+            }
+
+            const float depth = camera.getNear() + unitDistribution(random) * maxDepth;
+            light.position = glm::vec4((unitDistribution(random) * 2.0f - 1.0f) * depth * tanHalfFov * camera.getAspect(),
+                                       (unitDistribution(random) * 2.0f - 1.0f) * depth * tanHalfFov,
+                                       -depth,
+                                       1.0f);
+            light.parameters.z = 0.5f + unitDistribution(random) * unitDistribution(random) * 40.0f;
+
+            if (lightIndex % 2u == 0u)
+            {
+                light.direction = glm::vec4(direction, 0.0f);
+                light.parameters.y = std::cos(glm::radians(10.0f + unitDistribution(random) * 50.0f));
+                light.parameters.x = std::min(1.0f, light.parameters.y + 0.05f);
+                light.parameters.w = 1.0f;
+            }
+            else
+                light.parameters.w = 2.0f;
+        }
+
+        return lights;
+    }
+
+    // Times LightClusterBuilder::build() and checks every frame's output against buildReference(),
+    // since the lighting shaders trust the cluster lists and a mismatch shows up as missing lights.
+    bool runLightClusterBenchmark(const Options &options, const SyntheticScene &syntheticScene, std::vector<Timing> &outTimings, nlohmann::json &outStatistics)
+    {
+        const engine::Camera &camera = *syntheticScene.camera;
+        const std::vector<engine::RenderGraphLightData> lights = buildClusterLights(options, camera);
+        const glm::mat4 projection = camera.getProjectionMatrix();
+
+        engine::LightClusterBuilder builder;
+        engine::LightClusterBuilder referenceBuilder;
+        referenceBuilder.buildReference(lights, projection, camera.getNear(), camera.getFar());
+
+        bool matches = true;
+        outTimings.push_back(measure("light_cluster_build", options.warmupFrameCount, options.frameCount, [&]()
+                                     { builder.build(lights, projection, camera.getNear(), camera.getFar()); }));
+
+        if (std::memcmp(&builder.getHeader(), &referenceBuilder.getHeader(), sizeof(engine::LightClusterBuilder::GpuHeader)) != 0 ||
+            builder.getData() != referenceBuilder.getData() ||
+            builder.getOverflowCount() != referenceBuilder.getOverflowCount())
+        {
+            std::cerr << "[FAILED] light_clusters (build() differs from buildReference())\n";
+            matches = false;
+        }
+
+        outTimings.push_back(measure("light_cluster_build_reference", 1u, std::max(1u, options.frameCount / 10u), [&]()
+                                     { referenceBuilder.buildReference(lights, projection, camera.getNear(), camera.getFar()); }));
+
+        outStatistics["cluster_lights"] = lights.size();
+        outStatistics["cluster_light_indices"] = builder.getData().size() - engine::LightClusterBuilder::CLUSTER_COUNT * 2u;
+        outStatistics["cluster_overflow"] = builder.getOverflowCount();
+
+        return matches;
+    }
+
+    // Steers its owner towards another entity, reading that entity's transform while its own owner moves it.
+    class FollowTargetScript final : public engine::Script
+    {
+    public:
+        explicit FollowTargetScript(engine::Entity *target) : m_target(target)
+        {
+        }
+
+        bool declareParallelUpdate(engine::ScriptAccess &access) const override
+        {
+            access.reads<engine::Transform3DComponent>();
+            return true;
+        }
+
+        void onUpdate(float deltaTime) override
+        {
+            auto *transform = getOwnerEntity()->getComponent<engine::Transform3DComponent>();
+            const glm::vec3 targetPosition = m_target->getComponent<engine::Transform3DComponent>()->getWorldPosition();
+            transform->setPosition(transform->getPosition() + (targetPosition - transform->getWorldPosition()) * deltaTime);
+        }
+
+    private:
+        engine::Entity *m_target{nullptr};
+    };
+
+    // Scripts that only read other entities' transforms must share one batch; a second batch means the
+    // scheduler serialized them and the phase runs one script after another.
+    bool runParallelScriptBenchmark(const Options &options, std::vector<Timing> &outTimings, nlohmann::json &outStatistics)
+    {
+        engine::Scene scene;
+
+        std::vector<engine::Entity *> entities;
+        entities.reserve(options.scriptCount);
+        for (uint32_t entityIndex = 0; entityIndex < options.scriptCount; ++entityIndex)
+        {
+            auto entity = scene.addEntity("Follower_" + std::to_string(entityIndex));
+            entity->getComponent<engine::Transform3DComponent>()->setPosition(glm::vec3(static_cast<float>(entityIndex) * GRID_SPACING, 0.0f, 0.0f));
+            entities.push_back(entity.get());
+        }
+
+        for (uint32_t entityIndex = 0; entityIndex < options.scriptCount; ++entityIndex)
+        {
+            auto *target = entities[(entityIndex + 1u) % options.scriptCount];
+            entities[entityIndex]->addComponent<engine::ScriptComponent>(new FollowTargetScript(target))->onAttach();
+        }
+
+        outTimings.push_back(measure("parallel_script_update", options.warmupFrameCount, options.frameCount, [&]()
+                                     { scene.update(FRAME_DELTA_SECONDS); }));
+
+        outStatistics["parallel_scripts"] = options.scriptCount;
+        outStatistics["parallel_script_batches"] = scene.getParallelScriptBatchCount();
+
+        if (scene.getParallelScriptBatchCount() != 1u)
+        {
+            std::cerr << "[FAILED] parallel_scripts (" << options.scriptCount << " transform-reading scripts ran in "
+                      << scene.getParallelScriptBatchCount() << " batches, expected 1)\n";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool readFileBytes(const std::filesystem::path &path, std::vector<uint8_t> &outBytes)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        outBytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    engine::ModelAsset buildModelAsset(const Options &options)
+    {
+        std::vector<engine::CPUMesh> meshes;
+        meshes.reserve(SERIALIZED_MESH_COUNT);
+        for (uint32_t meshIndex = 0; meshIndex < SERIALIZED_MESH_COUNT; ++meshIndex)
+        {
+            meshes.push_back(meshIndex % 2u == 0u ? makeCubeMesh() : makeSphereMesh());
+            meshes.back().name += "_" + std::to_string(meshIndex);
+        }
+
+        engine::Skeleton skeleton;
+        buildSkeleton(skeleton, options.boneCount);
+
+        engine::ModelAsset modelAsset(meshes, skeleton, {buildAnimation(options.boneCount)});
+        modelAsset.assetPath = "bench_model.elixasset";
+        return modelAsset;
+    }
+
+    // Serialized files are written to a scratch directory that is removed afterwards.
+    bool runAssetBenchmarks(const Options &options, const std::filesystem::path &scratchDirectory, std::vector<Timing> &outTimings)
+    {
+        const engine::AssetsSerializer serializer{};
+        const engine::ModelAsset modelAsset = buildModelAsset(options);
+
+        engine::AnimationAsset animationAsset;
+        animationAsset.name = "Synthetic";
+        animationAsset.assetPath = "bench_animation.elixasset";
+        animationAsset.animations = modelAsset.animations;
+
+        const std::string modelPath = (scratchDirectory / modelAsset.assetPath).string();
+        const std::string animationPath = (scratchDirectory / animationAsset.assetPath).string();
+
+        bool succeeded = true;
+        const auto check = [&succeeded](bool result, const char *operation)
+        {
+            if (!result && succeeded)
+                std::cerr << "[FAILED] " << operation << '\n';
+            succeeded = succeeded && result;
+        };
+
+        if (isBenchmarkEnabled(options, "serialization"))
+        {
+            outTimings.push_back(measure("model_write", 1u, options.ioIterationCount, [&]()
+                                         { check(serializer.writeModel(modelAsset, modelPath), "model_write"); }));
+            outTimings.push_back(measure("model_read", 1u, options.ioIterationCount, [&]()
+                                         { check(serializer.readModel(modelPath).has_value(), "model_read"); }));
+            outTimings.push_back(measure("animation_write", 1u, options.ioIterationCount, [&]()
+                                         { check(serializer.writeAnimationAsset(animationAsset, animationPath), "animation_write"); }));
+            outTimings.push_back(measure("animation_read", 1u, options.ioIterationCount, [&]()
+                                         { check(serializer.readAnimationAsset(animationPath).has_value(), "animation_read"); }));
+        }
+
+        if (!isBenchmarkEnabled(options, "bundle"))
+            return succeeded;
+
+        if (!std::filesystem::exists(modelPath) && !serializer.writeModel(modelAsset, modelPath))
+        {
+            std::cerr << "[FAILED] bundle (cannot write model)\n";
+            return false;
+        }
+
+        std::vector<uint8_t> modelBytes;
+        if (!readFileBytes(modelPath, modelBytes))
+        {
+            std::cerr << "[FAILED] bundle (cannot read model)\n";
+            return false;
+        }
+
+        engine::ElixBundleWriter bundleWriter;
+        std::vector<std::string> entryPaths;
+        for (uint32_t modelIndex = 0; modelIndex < BUNDLE_MODEL_COUNT; ++modelIndex)
+        {
+            entryPaths.push_back("models/bench_model_" + std::to_string(modelIndex) + ".elixasset");
+            bundleWriter.addFile(entryPaths.back(), std::span<const uint8_t>(modelBytes));
+        }
+
+        const std::filesystem::path bundlePath = scratchDirectory / "bench.elixbundle";
+        engine::ElixBundleReader bundleReader;
+        if (!bundleWriter.write(bundlePath) || !bundleReader.mount(bundlePath))
+        {
+            std::cerr << "[FAILED] bundle (cannot write or mount " << bundlePath << ")\n";
+            return false;
+        }
+
+        std::vector<uint8_t> entryBytes;
+        outTimings.push_back(measure("bundle_read", 1u, options.ioIterationCount, [&]()
+                                     {
+                                         for (const auto &entryPath : entryPaths)
+                                             check(bundleReader.readFile(entryPath, entryBytes), "bundle_read"); }));
+        outTimings.push_back(measure("bundle_read_model", 1u, options.ioIterationCount, [&]()
+                                     {
+                                         for (const auto &entryPath : entryPaths)
+                                             check(bundleReader.readFile(entryPath, entryBytes) &&
+                                                       serializer.readModel(entryBytes).has_value(),
+                                                   "bundle_read_model"); }));
+
+        return succeeded;
+    }
+
+    void printTimings(const std::vector<nlohmann::json> &summaries)
+    {
+        std::cout << '\n'
+                  << std::left << std::setw(30) << "Benchmark"
+                  << std::right << std::setw(12) << "mean ms" << std::setw(12) << "median ms"
+                  << std::setw(12) << "p95 ms" << std::setw(12) << "max ms" << '\n';
+
+        std::cout << std::fixed << std::setprecision(3);
+        for (const auto &summary : summaries)
+        {
+            std::cout << std::left << std::setw(30) << summary["name"].get<std::string>()
+                      << std::right << std::setw(12) << summary["mean_ms"].get<double>()
+                      << std::setw(12) << summary["median_ms"].get<double>()
+                      << std::setw(12) << summary["p95_ms"].get<double>()
+                      << std::setw(12) << summary["max_ms"].get<double>() << '\n';
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+    {
+        const std::string argument = argv[argumentIndex];
+        if (argument == "--help" || argument == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+    }
+
+    Options options;
+    if (!parseArguments(argc, argv, options))
+        return 1;
+
+    if (!elix::engine::PhysXCore::init())
+    {
+        std::cerr << "Failed to initialize PhysX.\n";
+        return 1;
+    }
+
+    std::vector<Timing> timings;
+    nlohmann::json statistics = nlohmann::json::object();
+    bool succeeded = true;
+
+    {
+        const auto setupStartTime = Clock::now();
+
+        SyntheticScene syntheticScene;
+        buildSyntheticScene(options, syntheticScene);
+        elix::engine::scripting::setActiveScene(syntheticScene.scene.get());
+
+        statistics["scene_entities"] = syntheticScene.scene->getEntities().size();
+        statistics["scene_build_ms"] = elapsedMs(setupStartTime);
+        std::cout << "Built synthetic scene: " << syntheticScene.scene->getEntities().size() << " entities, "
+                  << syntheticScene.animators.size() << " animators, " << syntheticScene.emitters.size() << " emitters, "
+                  << options.lightCount << " lights (" << static_cast<uint64_t>(statistics["scene_build_ms"].get<double>()) << " ms)\n";
+
+        runSceneBenchmarks(options, syntheticScene, timings);
+
+        if (isBenchmarkEnabled(options, "frame_data"))
+            runFrameDataBenchmark(options, syntheticScene, timings, statistics);
+
+        if (isBenchmarkEnabled(options, "light_clusters"))
+            succeeded = runLightClusterBenchmark(options, syntheticScene, timings, statistics) && succeeded;
+
+        if (isBenchmarkEnabled(options, "parallel_scripts"))
+            succeeded = runParallelScriptBenchmark(options, timings, statistics) && succeeded;
+
+        uint64_t aliveParticleCount = 0u;
+        for (auto *emitter : syntheticScene.emitters)
+        {
+            if (auto *particleSystem = emitter->getParticleSystem())
+                for (const auto &particleEmitter : particleSystem->getEmitters())
+                    aliveParticleCount += particleEmitter->getAliveCount();
+        }
+        statistics["alive_particles"] = aliveParticleCount;
+
+        elix::engine::scripting::setActiveScene(nullptr);
+    }
+
+    if (isBenchmarkEnabled(options, "serialization") || isBenchmarkEnabled(options, "bundle"))
+    {
+        const std::filesystem::path scratchDirectory = std::filesystem::temp_directory_path() / "velix_bench";
+        std::error_code directoryError;
+        std::filesystem::create_directories(scratchDirectory, directoryError);
+
+        succeeded = runAssetBenchmarks(options, scratchDirectory, timings) && succeeded;
+
+        std::filesystem::remove_all(scratchDirectory, directoryError);
+    }
+
+    elix::engine::PhysXCore::shutdown();
+
+    std::vector<nlohmann::json> summaries;
+    summaries.reserve(timings.size());
+    for (const auto &timing : timings)
+        summaries.push_back(summarize(timing));
+
+    printTimings(summaries);
+
+    const nlohmann::json results{
+        {"tool", "velix_bench"},
+        {"format_version", 1},
+        {"config",
+         {{"entities", options.entityCount},
+          {"hierarchy_depth", options.hierarchyDepth},
+          {"animators", options.animatorCount},
+          {"bones", options.boneCount},
+          {"emitters", options.emitterCount},
+          {"lights", options.lightCount},
+          {"cluster_lights", options.clusterLightCount},
+          {"scripts", options.scriptCount},
+          {"frames", options.frameCount},
+          {"warmup_frames", options.warmupFrameCount},
+          {"io_iterations", options.ioIterationCount},
+          {"seed", options.seed}}},
+        {"statistics", statistics},
+        {"results", summaries}};
+
+    std::ofstream outputFile(options.outputPath);
+    if (!outputFile)
+    {
+        std::cerr << "Cannot write results to " << options.outputPath << '\n';
+        return 1;
+    }
+
+    outputFile << results.dump(2) << '\n';
+    std::cout << "\nResults written to " << options.outputPath << '\n';
+
+    return succeeded ? 0 : 2;
+}
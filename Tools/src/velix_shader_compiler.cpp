@@ -0,0 +1,106 @@
+#include "Engine/Shaders/ShaderCompiler.hpp"
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::filesystem::path outputDirectory;
+        std::vector<std::filesystem::path> sourcePaths;
+    };
+
+    void printUsage(const char *executableName)
+    {
+        std::cout
+            << "Velix Shader Compiler\n"
+            << "Compiles GLSL shaders (.vert, .frag, .comp, ray tracing stages) to SPIR-V.\n\n"
+            << "Usage:\n"
+            << "  " << executableName << " --output <directory> <shader>...\n\n"
+            << "Options:\n"
+            << "  --output <directory>  Where <name>.<stage>.spv files are written.\n"
+            << "  --help                Show this help.\n\n"
+            << "Example:\n"
+            << "  " << executableName << " --output ./build/shaders ./resources/shaders/lighting.frag\n";
+    }
+
+    bool parseArguments(int argc, char **argv, Options &outOptions)
+    {
+        for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+        {
+            const std::string argument = argv[argumentIndex];
+
+            if (argument == "--output")
+            {
+                if (argumentIndex + 1 >= argc)
+                {
+                    std::cerr << "Missing value for " << argument << '\n';
+                    return false;
+                }
+
+                outOptions.outputDirectory = argv[++argumentIndex];
+            }
+            else if (argument.rfind("--", 0) == 0)
+            {
+                std::cerr << "Unknown option: " << argument << '\n';
+                return false;
+            }
+            else
+                outOptions.sourcePaths.emplace_back(argument);
+        }
+
+        if (outOptions.outputDirectory.empty() || outOptions.sourcePaths.empty())
+        {
+            std::cerr << "Expected --output and at least one shader source.\n";
+            return false;
+        }
+
+        return true;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+    {
+        const std::string argument = argv[argumentIndex];
+        if (argument == "--help" || argument == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+    }
+
+    Options options;
+    if (!parseArguments(argc, argv, options))
+        return 1;
+
+    std::error_code directoryError;
+    std::filesystem::create_directories(options.outputDirectory, directoryError);
+    if (directoryError)
+    {
+        std::cerr << "Cannot create " << options.outputDirectory << ": " << directoryError.message() << '\n';
+        return 1;
+    }
+
+    size_t failedCount = 0u;
+    for (const auto &sourcePath : options.sourcePaths)
+    {
+        const std::filesystem::path outputPath = options.outputDirectory / (sourcePath.filename().string() + ".spv");
+
+        std::string error;
+        if (!elix::engine::shaders::ShaderCompiler::compileFileToSpv(sourcePath, &error, outputPath))
+        {
+            std::cerr << "[FAILED] " << error << '\n';
+            ++failedCount;
+        }
+    }
+
+    std::cout << "Compiled " << options.sourcePaths.size() - failedCount << "/" << options.sourcePaths.size()
+              << " shaders into " << options.outputDirectory << '\n';
+
+    return failedCount == 0u ? 0 : 2;
+}
@@ -0,0 +1,387 @@
+#include "Engine/Terrain/TerrainAssetIO.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::filesystem::path inputPath;
+        std::optional<std::filesystem::path> outputPath;
+        bool recursive{false};
+        bool backup{false};
+        bool toJson{false};
+        uint32_t tileSize{elix::engine::TerrainTileFile::DEFAULT_TILE_SIZE};
+    };
+
+    std::string toLowerCopy(std::string value)
+    {
+        std::transform(value.begin(), value.end(), value.begin(), [](unsigned char character)
+                       { return static_cast<char>(std::tolower(character)); });
+        return value;
+    }
+
+    bool endsWith(const std::string &value, const std::string &suffix)
+    {
+        return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    void printUsage(const char *executableName)
+    {
+        std::cout
+            << "Velix Terrain Converter\n"
+            << "Converts JSON terrain assets (.elixterrain / .elixterrain.json) into the binary tiled .elixterrain format.\n\n"
+            << "Usage:\n"
+            << "  " << executableName << " --input <path> [options]\n"
+            << "  " << executableName << " <path> [options]\n\n"
+            << "Options:\n"
+            << "  --output <path>       Output file (single input file only).\n"
+            << "                        Default: next to the source, as <name>.elixterrain.\n"
+            << "  --recursive           Recurse when input is a directory.\n"
+            << "  --tile-size <count>   Samples per tile edge (16..1024). Default: "
+            << elix::engine::TerrainTileFile::DEFAULT_TILE_SIZE << "\n"
+            << "  --backup              Keep the JSON source (copied to <file>.bak when converting in place).\n"
+            << "  --to-json             Convert binary terrain back to JSON (<name>.elixterrain.json).\n"
+            << "  --help                Show this help.\n\n"
+            << "Examples:\n"
+            << "  " << executableName << " ./resources/terrain --recursive\n"
+            << "  " << executableName << " island.elixterrain --to-json\n";
+    }
+
+    bool parseArguments(int argc, char **argv, Options &outOptions)
+    {
+        std::vector<std::string> positionalArguments;
+
+        for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+        {
+            const std::string argument = argv[argumentIndex];
+
+            if (argument == "--input" || argument == "--output" || argument == "--tile-size")
+            {
+                if (argumentIndex + 1 >= argc)
+                {
+                    std::cerr << "Missing value for " << argument << '\n';
+                    return false;
+                }
+
+                const std::string value = argv[++argumentIndex];
+                if (argument == "--input")
+                    outOptions.inputPath = value;
+                else if (argument == "--output")
+                    outOptions.outputPath = std::filesystem::path(value);
+                else
+                {
+                    char *endPointer = nullptr;
+                    const unsigned long parsed = std::strtoul(value.c_str(), &endPointer, 10);
+                    if (!endPointer || endPointer == value.c_str() || parsed < 16u || parsed > 1024u)
+                    {
+                        std::cerr << "Invalid value for --tile-size: " << value << '\n';
+                        return false;
+                    }
+
+                    outOptions.tileSize = static_cast<uint32_t>(parsed);
+                }
+
+                continue;
+            }
+
+            if (argument == "--recursive")
+            {
+                outOptions.recursive = true;
+                continue;
+            }
+
+            if (argument == "--backup")
+            {
+                outOptions.backup = true;
+                continue;
+            }
+
+            if (argument == "--to-json")
+            {
+                outOptions.toJson = true;
+                continue;
+            }
+
+            if (!argument.empty() && argument[0] == '-')
+            {
+                std::cerr << "Unknown option: " << argument << '\n';
+                return false;
+            }
+
+            positionalArguments.push_back(argument);
+        }
+
+        if (outOptions.inputPath.empty())
+        {
+            if (positionalArguments.empty())
+            {
+                std::cerr << "Input path is required.\n";
+                return false;
+            }
+
+            outOptions.inputPath = positionalArguments.front();
+        }
+
+        return true;
+    }
+
+    bool isTerrainFile(const std::filesystem::path &path)
+    {
+        const std::string fileName = toLowerCopy(path.filename().string());
+        return endsWith(fileName, ".elixterrain") || endsWith(fileName, ".elixterrain.json");
+    }
+
+    // Only files that still need converting in the requested direction.
+    bool needsConversion(const Options &options, const std::filesystem::path &path)
+    {
+        if (!isTerrainFile(path))
+            return false;
+
+        const bool isBinary = elix::engine::TerrainTileFile::isTerrainTileFile(path.string());
+        return options.toJson ? isBinary : !isBinary;
+    }
+
+    std::vector<std::filesystem::path> gatherSourceFiles(const Options &options, const std::filesystem::path &absoluteInputPath)
+    {
+        std::vector<std::filesystem::path> files;
+
+        std::error_code errorCode;
+        if (std::filesystem::is_regular_file(absoluteInputPath, errorCode) && !errorCode)
+        {
+            if (needsConversion(options, absoluteInputPath))
+                files.push_back(absoluteInputPath.lexically_normal());
+            return files;
+        }
+
+        const auto visit = [&](const std::filesystem::directory_entry &entry)
+        {
+            std::error_code fileError;
+            if (entry.is_regular_file(fileError) && !fileError && needsConversion(options, entry.path()))
+                files.push_back(entry.path().lexically_normal());
+        };
+
+        if (options.recursive)
+        {
+            for (std::filesystem::recursive_directory_iterator iterator(absoluteInputPath, errorCode);
+                 !errorCode && iterator != std::filesystem::recursive_directory_iterator();
+                 iterator.increment(errorCode))
+                visit(*iterator);
+        }
+        else
+        {
+            for (std::filesystem::directory_iterator iterator(absoluteInputPath, errorCode);
+                 !errorCode && iterator != std::filesystem::directory_iterator();
+                 iterator.increment(errorCode))
+                visit(*iterator);
+        }
+
+        std::sort(files.begin(), files.end(), [](const std::filesystem::path &left, const std::filesystem::path &right)
+                  { return left.string() < right.string(); });
+
+        return files;
+    }
+
+    std::filesystem::path resolveOutputPath(const Options &options, const std::filesystem::path &sourceFilePath)
+    {
+        if (options.outputPath.has_value())
+            return std::filesystem::absolute(options.outputPath.value()).lexically_normal();
+
+        std::string outputPath = sourceFilePath.string();
+        if (endsWith(toLowerCopy(outputPath), ".json"))
+            outputPath.resize(outputPath.size() - 5u);
+
+        if (options.toJson)
+            outputPath += ".json";
+
+        return std::filesystem::path(outputPath).lexically_normal();
+    }
+
+    // Decodes the written file tile by tile and compares it with the asset it came from, so a JSON
+    // source is only removed once its binary replacement is known to read back identically.
+    bool verifyTileFile(const elix::engine::TerrainAsset &terrainAsset, const std::filesystem::path &filePath)
+    {
+        elix::engine::TerrainTileFile tileFile;
+        if (!tileFile.open(filePath.string()))
+            return false;
+
+        const auto &description = tileFile.getDescription();
+        if (description.width != terrainAsset.width || description.height != terrainAsset.height)
+            return false;
+
+        std::vector<uint16_t> heightSamples;
+        for (uint32_t tileY = 0; tileY < tileFile.getHeightTileCountY(); ++tileY)
+        {
+            for (uint32_t tileX = 0; tileX < tileFile.getHeightTileCountX(); ++tileX)
+            {
+                const auto rect = tileFile.getHeightTileRect(tileX, tileY);
+                uint16_t minValue = 0u;
+                uint16_t maxValue = 0u;
+                if (!tileFile.decodeHeightTile(tileX, tileY, heightSamples) || !tileFile.getHeightTileRange(tileX, tileY, minValue, maxValue))
+                    return false;
+
+                for (uint32_t row = 0; row < rect.height; ++row)
+                {
+                    const uint16_t *decodedRow = heightSamples.data() + static_cast<size_t>(row) * rect.width;
+                    const uint16_t *sourceRow = terrainAsset.heightSamples.data() + static_cast<size_t>(rect.y + row) * terrainAsset.width + rect.x;
+                    if (!std::equal(decodedRow, decodedRow + rect.width, sourceRow))
+                        return false;
+                }
+
+                const auto [tileMin, tileMax] = std::minmax_element(heightSamples.begin(), heightSamples.end());
+                if (*tileMin != minValue || *tileMax != maxValue)
+                    return false;
+            }
+        }
+
+        if (tileFile.getWeightTileCountX() == 0u)
+            return terrainAsset.weightmapData.empty();
+
+        const uint32_t channels = description.weightmapChannels;
+        const size_t sourceRowStride = static_cast<size_t>(terrainAsset.weightmapWidth) * channels;
+        std::vector<uint8_t> weightData;
+        for (uint32_t tileY = 0; tileY < tileFile.getWeightTileCountY(); ++tileY)
+        {
+            for (uint32_t tileX = 0; tileX < tileFile.getWeightTileCountX(); ++tileX)
+            {
+                const auto rect = tileFile.getWeightTileRect(tileX, tileY);
+                if (!tileFile.decodeWeightTile(tileX, tileY, weightData))
+                    return false;
+
+                const size_t rowBytes = static_cast<size_t>(rect.width) * channels;
+                for (uint32_t row = 0; row < rect.height; ++row)
+                {
+                    const uint8_t *decodedRow = weightData.data() + row * rowBytes;
+                    const uint8_t *sourceRow = terrainAsset.weightmapData.data() + static_cast<size_t>(rect.y + row) * sourceRowStride + static_cast<size_t>(rect.x) * channels;
+                    if (!std::equal(decodedRow, decodedRow + rowBytes, sourceRow))
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    uintmax_t fileSizeOrZero(const std::filesystem::path &path)
+    {
+        std::error_code errorCode;
+        const uintmax_t size = std::filesystem::file_size(path, errorCode);
+        return errorCode ? 0u : size;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex)
+    {
+        const std::string argument = argv[argumentIndex];
+        if (argument == "--help" || argument == "-h")
+        {
+            printUsage(argv[0]);
+            return 0;
+        }
+    }
+
+    Options options;
+    if (!parseArguments(argc, argv, options))
+        return 1;
+
+    const std::filesystem::path absoluteInputPath = std::filesystem::absolute(options.inputPath).lexically_normal();
+
+    std::error_code inputExistsError;
+    if (!std::filesystem::exists(absoluteInputPath, inputExistsError) || inputExistsError)
+    {
+        std::cerr << "Input path does not exist: " << absoluteInputPath << '\n';
+        return 1;
+    }
+
+    const std::vector<std::filesystem::path> sourceFiles = gatherSourceFiles(options, absoluteInputPath);
+    if (sourceFiles.empty())
+    {
+        std::cout << "No terrain files need converting.\n";
+        return 0;
+    }
+
+    if (options.outputPath.has_value() && sourceFiles.size() > 1u)
+    {
+        std::cerr << "--output can only be used with a single input file.\n";
+        return 1;
+    }
+
+    uint32_t convertedCount = 0u;
+    uint32_t failedCount = 0u;
+
+    // Files are converted one at a time; tile encoding inside each conversion already runs on the job system.
+    for (const auto &sourcePath : sourceFiles)
+    {
+        const auto outputPath = resolveOutputPath(options, sourcePath);
+        const auto startTime = std::chrono::steady_clock::now();
+
+        auto terrainAsset = elix::engine::loadTerrainAssetFromFile(sourcePath.string());
+        if (!terrainAsset.has_value())
+        {
+            ++failedCount;
+            std::cerr << "[FAILED] " << sourcePath << " (cannot load)\n";
+            continue;
+        }
+
+        const uintmax_t sourceSize = fileSizeOrZero(sourcePath);
+        const bool inPlace = outputPath == sourcePath;
+
+        if (options.backup && inPlace)
+        {
+            std::error_code copyError;
+            std::filesystem::copy_file(sourcePath, sourcePath.string() + ".bak", std::filesystem::copy_options::overwrite_existing, copyError);
+            if (copyError)
+            {
+                ++failedCount;
+                std::cerr << "[FAILED] " << sourcePath << " (cannot write backup)\n";
+                continue;
+            }
+        }
+
+        const bool saved = options.toJson
+                               ? elix::engine::saveTerrainAssetToJsonFile(terrainAsset.value(), outputPath.string())
+                               : elix::engine::saveTerrainAssetToFile(terrainAsset.value(), outputPath.string(), options.tileSize);
+        if (!saved)
+        {
+            ++failedCount;
+            std::cerr << "[FAILED] " << sourcePath << " -> " << outputPath << '\n';
+            continue;
+        }
+
+        if (!options.toJson && !verifyTileFile(terrainAsset.value(), outputPath))
+        {
+            ++failedCount;
+            std::cerr << "[FAILED] " << outputPath << " (does not read back as " << sourcePath << ")\n";
+            continue;
+        }
+
+        // A .elixterrain.json source converted next to itself would otherwise load as a second copy.
+        if (!inPlace && !options.toJson && !options.outputPath.has_value() && !options.backup)
+        {
+            std::error_code removeError;
+            std::filesystem::remove(sourcePath, removeError);
+        }
+
+        const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+        ++convertedCount;
+        std::cout << "[OK]     " << sourcePath << " -> " << outputPath
+                  << " (" << sourceSize / 1024u << " KB -> " << fileSizeOrZero(outputPath) / 1024u << " KB, " << elapsedMs << " ms)\n";
+    }
+
+    std::cout << "\nSummary\n"
+              << "  Converted: " << convertedCount << '\n'
+              << "  Failed:    " << failedCount << '\n';
+
+    return failedCount == 0u ? 0 : 2;
+}
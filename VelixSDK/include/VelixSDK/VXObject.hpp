@@ -60,14 +60,30 @@ public:
     }
 
     std::vector<engine::ECS *> getComponentsByName(const std::string &componentTypeName) const
+    {
+        return getComponentsByType(engine::scripting::resolveComponentType(componentTypeName.c_str()));
+    }
+
+    bool hasComponentByName(const std::string &componentTypeName) const
+    {
+        return engine::scripting::entityHasComponent(getOuter(), componentTypeName.c_str());
+    }
+
+    // Handle-based variants: resolve the type once with engine::scripting::resolveComponentType().
+    engine::ECS *getComponentByType(engine::scripting::ComponentTypeId componentType) const
+    {
+        return engine::scripting::getEntitySingleComponent(getOuter(), componentType);
+    }
+
+    std::vector<engine::ECS *> getComponentsByType(engine::scripting::ComponentTypeId componentType) const
     {
         std::vector<engine::ECS *> result;
-        const uint64_t count = engine::scripting::getEntityComponentsCount(getOuter(), componentTypeName.c_str());
+        const uint64_t count = engine::scripting::getEntityComponentsCount(getOuter(), componentType);
         result.reserve(static_cast<size_t>(count));
 
         for (uint64_t index = 0; index < count; ++index)
         {
-            auto *component = engine::scripting::getEntityComponentByIndex(getOuter(), componentTypeName.c_str(), index);
+            auto *component = engine::scripting::getEntityComponentByIndex(getOuter(), componentType, index);
             if (component)
                 result.push_back(component);
         }
@@ -75,9 +91,9 @@ public:
         return result;
     }
 
-    bool hasComponentByName(const std::string &componentTypeName) const
+    bool hasComponentByType(engine::scripting::ComponentTypeId componentType) const
     {
-        return engine::scripting::entityHasComponent(getOuter(), componentTypeName.c_str());
+        return engine::scripting::entityHasComponent(getOuter(), componentType);
     }
 
     engine::RenderQualitySettings &getRenderSettings() const
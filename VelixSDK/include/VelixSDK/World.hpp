@@ -123,6 +123,17 @@ public:
         engine::scripting::unloadGroup(tag.c_str());
     }
 
+    // Scene loads run in the background over several frames; progress is in [0, 1].
+    static bool isSceneLoading()
+    {
+        return engine::scripting::isSceneLoading();
+    }
+
+    static float getSceneLoadProgress()
+    {
+        return engine::scripting::getSceneLoadProgress();
+    }
+
 private:
     engine::Scene *m_scene{nullptr};
 };
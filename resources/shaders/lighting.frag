@@ -3,7 +3,6 @@
 const int DIRECTIONAL_LIGHT_TYPE = 0;
 const int SPOT_LIGHT_TYPE = 1;
 const int POINT_LIGHT_TYPE = 2;
-const int MAX_LIGHT_COUNT = 16;
 const int MAX_DIRECTIONAL_CASCADES = 4;
 const int MAX_SPOT_SHADOWS = 3;
 const float PI = 3.14159265359;
@@ -42,6 +41,14 @@ layout(std430, set = 0, binding = 2) readonly buffer LightSSBO
     Light lights[];
 } lightData;
 
+// Clustered light lists built on the CPU (LightClusterBuilder).
+layout(std430, set = 0, binding = 4) readonly buffer LightClusterSSBO
+{
+    uvec4 gridSize;   // xyz = cluster grid, w = directional light count
+    vec4 depthParams; // x = near, y = far, z = slice scale, w = slice bias
+    uint data[];      // (offset, count) per cluster, directional light indices, per-cluster light indices
+} lightClusters;
+
 layout(set = 1, binding = 0) uniform sampler2D uGBufferNormal;
 layout(set = 1, binding = 1) uniform sampler2D uGBufferAlbedo;
 layout(set = 1, binding = 2) uniform sampler2D uGBufferMaterial;
@@ -68,6 +75,16 @@ layout(push_constant) uniform LightingPC
     float _pad2;
 } pc;
 
+uint computeLightCluster(vec2 uv, float viewDepth)
+{
+    uvec3 grid = lightClusters.gridSize.xyz;
+    uint x = min(uint(uv.x * float(grid.x)), grid.x - 1u);
+    uint y = min(uint(uv.y * float(grid.y)), grid.y - 1u);
+    float slice = log(max(viewDepth, lightClusters.depthParams.x)) * lightClusters.depthParams.z - lightClusters.depthParams.w;
+    uint z = uint(clamp(slice, 0.0, float(grid.z - 1u)));
+    return (z * grid.y + y) * grid.x + x;
+}
+
 vec3 reconstructViewPosition(vec2 uv, float depth)
 {
     vec4 ndc = vec4(uv * 2.0 - 1.0, depth, 1.0);
@@ -369,9 +386,17 @@ void main()
     bool hasDirectionalLight = false;
     const bool usePipelineRTShadows = pc.shadowMode > 1.5;
 
-    int count = min(lightData.lightCount, MAX_LIGHT_COUNT);
-    for (int i = 0; i < count; ++i)
+    // Directional lights first, then the point/spot lights binned into this pixel's cluster.
+    uint cluster = computeLightCluster(vUV, max(-P_view.z, 0.0));
+    uint clusterCount = lightClusters.gridSize.x * lightClusters.gridSize.y * lightClusters.gridSize.z;
+    uint directionalCount = lightClusters.gridSize.w;
+    uint directionalOffset = clusterCount * 2u;
+    uint clusterOffset = lightClusters.data[cluster * 2u];
+    uint count = directionalCount + lightClusters.data[cluster * 2u + 1u];
+    for (uint n = 0u; n < count; ++n)
     {
+        int i = int(n < directionalCount ? lightClusters.data[directionalOffset + n]
+                                         : lightClusters.data[clusterOffset + n - directionalCount]);
         Light light = lightData.lights[i];
         int lightType = int(light.parameters.w);
 